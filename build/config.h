@@ -0,0 +1,12 @@
+// Automatically generated. Do not edit.
+#ifndef __CONFIG_GEN_H__
+#define __CONFIG_GEN_H__
+#define CONFIG_VERSION       "0.0"
+#define CONFIG_VERSION_MAJOR 0
+#define CONFIG_VERSION_MINOR 0
+#define CONFIG_GITHASH       "406e7ea3M"
+#define CONFIG_DATE          "2026-10-19"
+#define CONFIG_TIME          "05:12:06"
+#define CONFIG_YEAR          "2026"
+
+#endif
@@ -204,9 +204,16 @@ void GuiWinDataConfig::_DbSet(const Ff::KeyVal &keyval)
     }
     if (layerIx != -1)
     {
+        // Stringify all values at once
+        const int nKv = (int)keyval.kv.size();
+        std::vector<char> strBuf((nKv * 100) + UBLOXCFG_MAX_KEYVAL_STR_SIZE);
+        std::vector<const char *> strs(nKv, nullptr);
+        ubloxcfg_stringifyValues(strBuf.data(), (int)strBuf.size(), keyval.kv.data(), NULL, nKv, strs.data());
+
         // Process all key-value pairs in the response and store to the database
-        for (auto &kv: keyval.kv)
+        for (int kvIx = 0; kvIx < nKv; kvIx++)
         {
+            const UBLOXCFG_KEYVAL_t &kv = keyval.kv[kvIx];
             // Create/add new item
             auto dbitem = _DbGetItem(kv.id);
             if (dbitem == _dbItems.end())
@@ -216,7 +223,7 @@ void GuiWinDataConfig::_DbSet(const Ff::KeyVal &keyval)
                 dbitem = _dbItems.end() - 1;
             }
             // Store key-value for this layer
-            dbitem->SetValue(kv.val, static_cast<enum DbItemLayer_e>(layerIx));
+            dbitem->SetValue(kv.val, strs[kvIx], static_cast<enum DbItemLayer_e>(layerIx));
         }
 
         _DbSync();
@@ -323,17 +330,24 @@ GuiWinDataConfig::DbItem::DbItem(const uint32_t _id) :
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-void GuiWinDataConfig::DbItem::SetValue(const UBLOXCFG_VALUE_t &val, const enum DbItemLayer_e layerIx)
+void GuiWinDataConfig::DbItem::SetValue(const UBLOXCFG_VALUE_t &val, const char *valStr, const enum DbItemLayer_e layerIx)
 {
     if ( (layerIx >= IX_RAM) && (layerIx < NUM_LAYERS) )
     {
-        char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-        if (!ubloxcfg_stringifyValue(str, sizeof(str), type, defitem, &val))
+        if (valStr != NULL)
+        {
+            values[layerIx].str = valStr;
+        }
+        else
         {
-            std::strcpy(str, "wtf?!");
+            char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+            if (!ubloxcfg_stringifyValue(str, sizeof(str), type, defitem, &val))
+            {
+                std::strcpy(str, "wtf?!");
+            }
+            values[layerIx].str = str;
         }
         values[layerIx].val   = val;
-        values[layerIx].str   = str;
         values[layerIx].valid = true;
         _SyncValues();
         ChSync();
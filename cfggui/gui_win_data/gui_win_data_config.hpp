@@ -89,7 +89,7 @@ class GuiWinDataConfig : public GuiWinData
             Value                  values[NUM_LAYERS];
             bool                   valueChanged; //!< One or more values changed?
             bool                   valueValid;   //!< One or more values valid (available)? Implies: available on this receiver
-            void                   SetValue(const UBLOXCFG_VALUE_t &val, const enum DbItemLayer_e layerIx);
+            void                   SetValue(const UBLOXCFG_VALUE_t &val, const char *valStr, const enum DbItemLayer_e layerIx); //!< valStr from ubloxcfg_stringifyValues(), or NULL
             void                   ClearValues();//!< Clear (invalidate) all values
             void                   _SyncValues(); //!< Update (filterString, changed flags)
 
@@ -34,9 +34,18 @@
 #include "cfgtool_uc2cfg.h"
 #include "cfgtool_cfginfo.h"
 #include "cfgtool_parse.h"
+#include "cfgtool_index.h"
+#include "cfgtool_extract.h"
+#include "cfgtool_merge.h"
+#include "cfgtool_record.h"
+#include "cfgtool_bench.h"
+#include "cfgtool_stats.h"
+#include "cfgtool_monitor.h"
+#include "cfgtool_epochs.h"
 #include "cfgtool_reset.h"
 #include "cfgtool_status.h"
 #include "cfgtool_bin2hex.h"
+#include "cfgtool_serve.h"
 #include "config.h"
 
 /* ****************************************************************************************************************** */
@@ -47,14 +56,26 @@ typedef struct CMD_s
 {
     const char   *name;
     bool          need_i;
+    bool          many_i;
     bool          need_o;
     bool          need_p;
     bool          need_l;
     bool          need_r;
+    bool          need_s;
     bool          may_r;
     bool          may_n;
     bool          may_e;
     bool          may_u;
+    bool          may_S;
+    bool          may_m;
+    bool          may_f;
+    bool          may_t;
+    bool          may_E;
+    bool          may_R;
+    bool          may_z;
+    bool          may_j;
+    bool          may_T;
+    bool          may_F;
     const char   *info;
     const char *(*help)(void);
     int         (*run)(void);
@@ -75,12 +96,23 @@ typedef struct ARGS_s
     const char  *rxPort;
     const char  *cfgLayer;
     const char  *resetType;
+    const char  *serverSpec;
+    const char  *shmName;
+    const char  *maxMsgSize;
+    const char  *msgFilter;
+    const char  *timeRange;
+    const char  *epochRange;
+    const char  *rotate;
+    const char  *period;
+    const char  *format;
     bool         useUnknown;
     bool         extraInfo;
     bool         applyConfig;
     bool         noProbe;
     bool         doEpoch;
     bool         updateOnly;
+    bool         compress;
+    bool         json;
 
 } ARGS_t;
 
@@ -89,15 +121,24 @@ static ARGS_t gArgs;
 static int rx2cfg(void)  { return rx2cfgRun( gArgs.rxPort, gArgs.cfgLayer, gArgs.useUnknown); }
 static int rx2list(void) { return rx2listRun(gArgs.rxPort, gArgs.cfgLayer, gArgs.useUnknown); }
 static int cfg2rx(void)  { return cfg2rxRun( gArgs.rxPort, gArgs.cfgLayer, gArgs.resetType, gArgs.applyConfig, gArgs.updateOnly); }
-static int cfg2ubx(void) { return cfg2ubxRun(gArgs.cfgLayer, gArgs.extraInfo); }
-static int cfg2hex(void) { return cfg2hexRun(gArgs.cfgLayer, gArgs.extraInfo); }
-static int cfg2c(void)   { return cfg2cRun(  gArgs.cfgLayer, gArgs.extraInfo); }
+static int cfg2ubx(void) { return cfg2ubxRun(gArgs.cfgLayer, gArgs.extraInfo, gArgs.maxMsgSize); }
+static int cfg2hex(void) { return cfg2hexRun(gArgs.cfgLayer, gArgs.extraInfo, gArgs.maxMsgSize); }
+static int cfg2c(void)   { return cfg2cRun(  gArgs.cfgLayer, gArgs.extraInfo, gArgs.maxMsgSize); }
 static int uc2cfg(void)  { return uc2cfgRun(); }
 static int cfginfo(void) { return cfginfoRun(); }
 static int dump(void)    { return dumpRun( gArgs.rxPort, gArgs.extraInfo, gArgs.noProbe); }
 static int parse(void)   { return parseRun(  gArgs.extraInfo, gArgs.doEpoch ); }
+static int epochs(void)  { return epochsRun( gArgs.format, gArgs.msgFilter); }
+static int index_(void)  { return indexRun(  gArgs.inName, gArgs.outName, gArgs.outOverwrite); }
+static int extract(void) { return extractRun(gArgs.inName, gArgs.msgFilter, gArgs.timeRange, gArgs.epochRange); }
+static int merge(void)   { return mergeRun(  gArgs.inName, gArgs.extraInfo, gArgs.doEpoch); }
+static int record(void)  { return recordRun( gArgs.rxPort, gArgs.outName, gArgs.outOverwrite, gArgs.noProbe, gArgs.rotate, gArgs.compress, gArgs.extraInfo); }
+static int bench(void)   { return benchRun(  gArgs.inName, gArgs.json); }
+static int stats(void)   { return statsRun(  gArgs.rxPort, gArgs.noProbe, gArgs.json, gArgs.period); }
+static int monitor(void) { return monitorRun(gArgs.rxPort, gArgs.noProbe, gArgs.json, gArgs.period); }
 static int reset(void)   { return resetRun(  gArgs.rxPort, gArgs.resetType); }
-static int status(void)  { return statusRun( gArgs.rxPort, gArgs.extraInfo, gArgs.noProbe); }
+static int status(void)  { return statusRun( gArgs.rxPort, gArgs.extraInfo, gArgs.noProbe, gArgs.shmName); }
+static int serve(void)   { return serveRun(  gArgs.rxPort, gArgs.serverSpec, gArgs.extraInfo, gArgs.noProbe); }
 static int bin2hex(void) { return bin2hexRun(); }
 static int hex2bin(void) { return hex2binRun(); }
 
@@ -113,13 +154,16 @@ const CMD_t kCmds[] =
       .need_i = false, .need_o = true,  .need_p = true,  .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false },
 
     { .name = "cfg2ubx", .info = "Convert config file to UBX-CFG-VALSET message(s)",           .help = cfg2ubxHelp, .run = cfg2ubx,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false,
+      .may_m = true },
 
     { .name = "cfg2hex", .info = "Like cfg2ubx but prints a hex dump of the message(s)",       .help = NULL,        .run = cfg2hex,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false,
+      .may_m = true },
 
     { .name = "cfg2c",   .info = "Like cfg2ubx but prints a c source code of the message(s)",  .help = NULL,        .run = cfg2c,
-      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = true,  .need_r = false, .may_n = false, .may_e = false, .may_u = false,
+      .may_m = true },
 
     { .name = "uc2cfg",  .info = "Convert u-center config file to sane config file",           .help = uc2cfgHelp,  .run = uc2cfg,
       .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false },
@@ -130,14 +174,50 @@ const CMD_t kCmds[] =
     { .name = "dump",    .info = "Connects to receiver and prints received message frames",    .help = dumpHelp,    .run = dump,
       .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false },
 
+    { .name = "record",  .info = "Connects to receiver and records received data to file",     .help = recordHelp,  .run = record,
+      .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false,
+      .may_R = true, .may_z = true },
+
+    { .name = "stats",   .info = "Connects to receiver and prints message statistics",         .help = statsHelp,   .run = stats,
+      .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false,
+      .may_j = true, .may_T = true },
+
+    { .name = "monitor", .info = "Connects to many receivers and monitors them",               .help = monitorHelp, .run = monitor,
+      .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false,
+      .may_j = true, .may_T = true },
+
     { .name = "parse",   .info = "Parse file and output message frames",                       .help = parseHelp,   .run = parse,
       .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = true,  .may_u = false },
 
+    { .name = "epochs",  .info = "Export navigation epochs from file as CSV, JSON or binary",  .help = epochsHelp,  .run = epochs,
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false,
+      .may_f = true, .may_F = true },
+
+    { .name = "index",   .info = "Create message and epoch index for a logfile",               .help = indexHelp,   .run = index_,
+      .need_i = true,  .need_o = false, .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false },
+
+    { .name = "extract", .info = "Extract message frames by name, time or epoch from file",    .help = extractHelp, .run = extract,
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false,
+      .may_f = true, .may_t = true, .may_E = true },
+
+    { .name = "merge",   .info = "Merge files ordered by epoch time",                          .help = mergeHelp,   .run = merge,
+      .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = true,  .may_u = false,
+      .many_i = true },
+
+    { .name = "bench",   .info = "Benchmark message decoding and configuration functions",     .help = benchHelp,   .run = bench,
+      .need_i = false, .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false,
+      .many_i = true, .may_j = true },
+
     { .name = "reset",   .info = "Reset receiver",                                             .help = resetHelp,   .run = reset,
       .need_i = false, .need_o = false, .need_p = true,  .need_l = false, .need_r = true,  .may_n = false, .may_e = false, .may_u = false },
 
     { .name = "status",  .info = "Connects to receiver and prints status",                     .help = statusHelp,  .run = status,
-      .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false },
+      .need_i = false, .need_o = true,  .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false,
+      .may_S = true },
+
+    { .name = "serve",   .info = "Connects to receiver and serves its data to TCP/IP clients", .help = serveHelp,   .run = serve,
+      .need_i = false, .need_o = false, .need_p = true,  .need_l = false, .need_r = false, .may_n = true,  .may_e = false, .may_u = false,
+      .need_s = true },
 
     { .name = "bin2hex", .info = "Convert to hex dump",                                        .help = bin2hexHelp, .run = bin2hex,
       .need_i = true,  .need_o = true,  .need_p = false, .need_l = false, .need_r = false, .may_n = false, .may_e = false, .may_u = false },
@@ -191,6 +271,9 @@ const char * const kHelpStr =
     "                       [ser://]<device>[:<baudrate>]\n"
     "                       tcp://<host>:<port>[:<baudrate>]\n"
     "                       telnet://<host>:<port>[:<baudrate>]\n"
+    "                       udp://[<addr>]:<port>\n"
+    "                       file://<file>[@<speed>], stdin://[@<speed>]\n"
+    "                       sim://<file>[@<speed>][,<script>]\n"
     "    -l <layer(s)>  Configuration layer(s) to use:\n"
     "                       RAM, BBR, Flash, Default\n"
     "    -r <reset>     Reset mode to use to reset the receiver:\n"
@@ -201,6 +284,17 @@ const char * const kHelpStr =
     "    -a             Activate configuration after storing\n"
     "    -n             Do not probe/autobaud receiver, use passive reading only.\n"
     "                   For example, for other receivers or read-only connection.\n"
+    "    -s <server>    Server address to listen on: [<addr>:]<port>[,<filter>,...]\n"
+    "    -S <name>      Publish navigation epochs to shared memory <name>\n"
+    "    -m <size>      Maximum size of UBX-CFG-VALSET messages [bytes]\n"
+    "    -f <filter>    Message name or field filter\n"
+    "    -t <from>,<to> GPS time window\n"
+    "    -E <from>,<to> Epoch range\n"
+    "    -R <rotate>    Rotate output file by size or time\n"
+    "    -z             Compress output files\n"
+    "    -j             Output JSON\n"
+    "    -T <period>    Report period [s]\n"
+    "    -F <format>    Output format\n"
     "\n"
     // -----------------------------------------------------------------------------
     "    Available <commands>s:\n"
@@ -237,7 +331,7 @@ const char * const kLicenseHelp =
 const char * const kPortHelp =
     "Serial ports:\n"
     "\n"
-    "    Local serial ports: [ser://]<device>[@<baudrate>], where:\n"
+    "    Local serial ports: [ser://]<device>[@<baudrate>][,lowlat], where:\n"
     "\n"
 #ifdef _WIN
     "        <device>     COM1, COM23, etc.\n"
@@ -245,6 +339,9 @@ const char * const kPortHelp =
     "        <device>     /dev/ttyUSB0, /dev/ttyACM1, /dev/serial/..., etc.\n"
 #endif
     "        <baudrate>   Baudrate (optional)\n"
+    "        lowlat       Enable driver low-latency mode (optional, Linux only).\n"
+    "                     Reduces the latency of USB-serial adapters from 16ms\n"
+    "                     to about 1ms.\n"
     "\n"
     "        Note that 'ser://' is the default and can be omitted. If no <baudrate>\n"
     "        is specified, it is be automatically detected. That is, '-p <device>'\n"
@@ -274,7 +371,47 @@ const char * const kPortHelp =
     "        A minimal ser2net command line that should work is:\n"
     "           ser2net -d -C \"12345:telnet:0:/dev/ttyUSB0: remctl\"\n"
     "        This should allow using '-p telnet://localhost:12345'.\n"
-    "\n";
+    "\n"
+#ifndef _WIN
+    "    UDP/IP ports: udp://[<addr>]:<port>, where:\n"
+    "\n"
+    "        <addr>       Local address to bind to or multicast group to join\n"
+    "                     (optional, default: any). IPv6 addresses must be in\n"
+    "                     brackets, e.g. udp://[::1]:12345. Link-local addresses\n"
+    "                     need the interface, e.g. udp://[ff02::1%eth0]:12345\n"
+    "        <port>       Port number\n"
+    "\n"
+    "        Data is received from any source. Data sent to the port goes to the\n"
+    "        source of the last received datagram. Lost datagrams (socket buffer\n"
+    "        overflows) are counted and reported.\n"
+    "\n"
+#endif
+    "    Log replay: file://<file>[@<speed>] or stdin://[@<speed>], where:\n"
+    "\n"
+    "        <file>       Logfile\n"
+    "        <speed>      Replay speed (optional): 'max' (default) or a factor,\n"
+    "                     e.g. 1 (real-time) or 10 (ten times faster). The\n"
+    "                     timing is derived from the UBX-NAV-* messages.\n"
+    "\n"
+    "        These are read-only. Data sent to the port is discarded. Use '-n'.\n"
+    "\n"
+#ifndef _WIN
+    "    Simulated receiver: sim://<file>[@<speed>][,<script>], where:\n"
+    "\n"
+    "        <file>       Logfile to replay\n"
+    "        <speed>      Replay speed (optional): a factor, 1 (default, real-\n"
+    "                     time), or 'max'\n"
+    "        <script>     Scripted poll responses (optional)\n"
+    "\n"
+    "        This replays the logfile through a pseudo-terminal and answers UBX\n"
+    "        polls, with the response from the <script>, the last message of the\n"
+    "        same kind in the log, or a built-in response for UBX-MON-VER.\n"
+    "        UBX-CFG messages are acknowledged. The <script> has one poll and\n"
+    "        response pair per line as hex strings, e.g. 'b5620a04 b5620a04...'.\n"
+    "        The poll matches all polls starting with it.\n"
+    "\n"
+#endif
+    ;
 
 const char * const kLayersHelp =
     // -----------------------------------------------------------------------------
@@ -415,6 +552,15 @@ int main(int argc, char **argv)
         _ARGS_STR("-p", gArgs.rxPort)
         _ARGS_STR("-l", gArgs.cfgLayer)
         _ARGS_STR("-r", gArgs.resetType)
+        _ARGS_STR("-s", gArgs.serverSpec)
+        _ARGS_STR("-S", gArgs.shmName)
+        _ARGS_STR("-m", gArgs.maxMsgSize)
+        _ARGS_STR("-f", gArgs.msgFilter)
+        _ARGS_STR("-t", gArgs.timeRange)
+        _ARGS_STR("-E", gArgs.epochRange)
+        _ARGS_STR("-R", gArgs.rotate)
+        _ARGS_STR("-T", gArgs.period)
+        _ARGS_STR("-F", gArgs.format)
         _ARGS_BOOL("-u", gArgs.useUnknown, true)
         _ARGS_BOOL("-x", gArgs.extraInfo, true)
         _ARGS_BOOL("-a", gArgs.applyConfig, true)
@@ -422,6 +568,8 @@ int main(int argc, char **argv)
         _ARGS_BOOL("-n", gArgs.noProbe, true)
         _ARGS_BOOL("-e", gArgs.doEpoch, true)
         _ARGS_BOOL("-U", gArgs.updateOnly, true)
+        _ARGS_BOOL("-z", gArgs.compress, true)
+        _ARGS_BOOL("-j", gArgs.json, true)
         else if (gArgs.cmd != NULL)
         {
             argOk = false;
@@ -483,7 +631,16 @@ int main(int argc, char **argv)
     }
 
     // Open input file
-    if (res && gArgs.cmd->need_i)
+    if (res && gArgs.cmd->many_i)
+    {
+        // Command opens the input file(s) itself
+        if ( gArgs.cmd->need_i && ((gArgs.inName == NULL) || (gArgs.inName[0] == '\0')) )
+        {
+            WARNING("Need '-i <infile>,...' argument!");
+            res = false;
+        }
+    }
+    else if (res && gArgs.cmd->need_i)
     {
         if ( (gArgs.inName == NULL) || ((gArgs.inName[0] == '-') && (gArgs.inName[1] == '\0')) )
         {
@@ -520,7 +677,7 @@ int main(int argc, char **argv)
             }
         }
     }
-    else if ( (gArgs.cmd != NULL) && !gArgs.cmd->need_i && (gArgs.inName != NULL) )
+    else if ( (gArgs.cmd != NULL) && !gArgs.cmd->need_i && !gArgs.cmd->many_i && (gArgs.inName != NULL) )
     {
         WARNING("Illegal argument '-i %s'!", gArgs.inName);
         res = false;
@@ -593,6 +750,85 @@ int main(int argc, char **argv)
         res = false;
     }
 
+    // Require -s arg?
+    if ( (gArgs.cmd != NULL) && gArgs.cmd->need_s )
+    {
+        if ( (gArgs.serverSpec == NULL) || (gArgs.serverSpec[0] == '\0') )
+        {
+            WARNING("Need '-s <server>' argument!");
+            res = false;
+        }
+    }
+    else if ( (gArgs.cmd != NULL) && !gArgs.cmd->need_s && (gArgs.serverSpec != NULL) )
+    {
+        WARNING("Illegal argument '-s %s'!", gArgs.serverSpec);
+        res = false;
+    }
+
+    // May use -S arg?
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_S && (gArgs.shmName != NULL) )
+    {
+        WARNING("Illegal argument '-S %s'!", gArgs.shmName);
+        res = false;
+    }
+
+    // May use -m arg?
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_m && (gArgs.maxMsgSize != NULL) )
+    {
+        WARNING("Illegal argument '-m %s'!", gArgs.maxMsgSize);
+        res = false;
+    }
+
+    // May use -f, -t, -E args?
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_f && (gArgs.msgFilter != NULL) )
+    {
+        WARNING("Illegal argument '-f %s'!", gArgs.msgFilter);
+        res = false;
+    }
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_t && (gArgs.timeRange != NULL) )
+    {
+        WARNING("Illegal argument '-t %s'!", gArgs.timeRange);
+        res = false;
+    }
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_E && (gArgs.epochRange != NULL) )
+    {
+        WARNING("Illegal argument '-E %s'!", gArgs.epochRange);
+        res = false;
+    }
+
+    // May use -R, -z args?
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_R && (gArgs.rotate != NULL) )
+    {
+        WARNING("Illegal argument '-R %s'!", gArgs.rotate);
+        res = false;
+    }
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_z && gArgs.compress )
+    {
+        WARNING("Illegal argument '-z'!");
+        res = false;
+    }
+
+    // May use -j arg?
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_j && gArgs.json )
+    {
+        WARNING("Illegal argument '-j'!");
+        res = false;
+    }
+
+    // May use -T arg?
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_T && (gArgs.period != NULL) )
+    {
+        WARNING("Illegal argument '-T %s'!", gArgs.period);
+        res = false;
+    }
+
+    // May use -F arg?
+    if ( (gArgs.cmd != NULL) && !gArgs.cmd->may_F && (gArgs.format != NULL) )
+    {
+        WARNING("Illegal argument '-F %s'!", gArgs.format);
+        res = false;
+    }
+
     // May use -n arg?
     if ( (gArgs.cmd != NULL) && (!gArgs.cmd->may_n && gArgs.noProbe) )
     {
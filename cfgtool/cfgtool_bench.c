@@ -0,0 +1,881 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <errno.h>
+
+#include "cfgtool_util.h"
+
+#include "ubloxcfg.h"
+#include "ff_stuff.h"
+#include "ff_parser.h"
+#include "ff_epoch.h"
+#include "ff_ubx.h"
+#include "ff_nmea.h"
+#include "ff_rtcm3.h"
+#include "crc24q.h"
+#include "config.h"
+
+#include "cfgtool_bench.h"
+
+/* ****************************************************************************************************************** */
+
+const char *benchHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'bench':\n"
+"\n"
+"    Usage: cfgtool bench [-i <infile>] [-o <outfile>] [-y] [-j]\n"
+"\n"
+"    This runs the decoding stages used by the other commands over a set of\n"
+"    messages and reports how long they take. Without -i built-in synthetic\n"
+"    data is used (UBX, NMEA and RTCM3 messages of a typical navigation\n"
+"    epoch). With -i the messages from the given logfile are used.\n"
+"\n"
+"    The stages are:\n"
+"\n"
+"        parser          parserProcess() on the raw data, in 4 KiB chunks\n"
+"        parser+info     Same, but also generate the message info strings\n"
+"        epochCollect    epochCollect() on all messages\n"
+"        ubxInfo         ubxMessageInfo() on all UBX messages\n"
+"        nmeaDecode      nmeaDecode() on all NMEA messages\n"
+"        rtcm3Info       rtcm3MessageInfo() and rtcm3GetMsmHeader() or\n"
+"                        rtcm3GetArp() on all RTCM3 messages\n"
+"        cfgItemById     ubloxcfg_getItemById() for all configuration items\n"
+"        cfgItemByName   ubloxcfg_getItemByName() for all configuration items\n"
+"        cfgParseData    ubloxcfg_parseData() of each item of a UBX-CFG-VALGET\n"
+"                        payload\n"
+"        cfgStringify    ubloxcfg_stringifyKeyVal() for all items\n"
+"\n"
+"    Each stage is first run repeatedly for about half a second to get the\n"
+"    mean time per frame (message, or configuration item) and the throughput.\n"
+"    A second run times each frame individually to get the percentiles and the\n"
+"    maximum. The per-frame times are corrected by the overhead of reading\n"
+"    the clock and are less accurate than the mean for very fast stages.\n"
+"    The output is a table, or a JSON object with -j.\n"
+"\n"
+"    None of the stages allocate memory, and results should therefore be\n"
+"    comparable between different platforms and builds.\n"
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+#define BENCH_MAX_INPUT_SIZE  (256 * 1024 * 1024)
+#define BENCH_CHUNK_SIZE      4096
+#define BENCH_MIN_DURATION    500000000 // [ns]
+#define BENCH_NUM_EPOCHS      1000      // synthetic data
+
+typedef struct BENCH_MSG_s
+{
+    PARSER_MSG_t msg;
+    char         name[PARSER_MAX_NAME_SIZE];
+} BENCH_MSG_t;
+
+typedef struct BENCH_RES_s
+{
+    const char *name;
+    int         nFrames;     // per pass
+    uint64_t    nBytes;      // per pass
+    int         nPasses;
+    double      nsPerFrame;
+    double      mbPerSec;
+    uint32_t    p50;         // [ns]
+    uint32_t    p90;         // [ns]
+    uint32_t    p99;         // [ns]
+    uint32_t    max;         // [ns]
+} BENCH_RES_t;
+
+// Input data and messages
+static uint8_t     *gData;
+static int          gDataSize;
+static BENCH_MSG_t *gMsgs;
+static int          gNumMsgs;
+
+// Configuration items as in a UBX-CFG-VALGET response
+static UBLOXCFG_KEYVAL_t *gKeyVal;
+static const UBLOXCFG_ITEM_t **gItems;
+static int          gNumKeyVal;
+static uint8_t     *gCfgData;
+static int          gCfgDataSize;
+static int         *gCfgDataOffs; // Offset of each item in gCfgData, and the size of the data at the end
+
+// Overhead of reading the clock [ns]
+static uint32_t     gClockOverhead;
+
+/* ****************************************************************************************************************** */
+
+// Set RTCM3 bits (big-endian, MSB first)
+static void _setBits(uint8_t *buf, const int pos, const int len, const uint64_t val)
+{
+    for (int ix = 0; ix < len; ix++)
+    {
+        const int bit = pos + ix;
+        const uint8_t mask = 0x80 >> (bit % 8);
+        if ( ((val >> (len - 1 - ix)) & 0x01) != 0 )
+        {
+            buf[bit / 8] |= mask;
+        }
+        else
+        {
+            buf[bit / 8] &= ~mask;
+        }
+    }
+}
+
+static int _makeRtcm3(uint8_t *msg, const uint8_t *payload, const int payloadSize)
+{
+    msg[0] = RTCM3_PREAMBLE;
+    msg[1] = (payloadSize >> 8) & 0x03;
+    msg[2] = payloadSize & 0xff;
+    memcpy(&msg[RTCM3_HEAD_SIZE], payload, payloadSize);
+    const unsigned int crc = crc24q_hash(msg, RTCM3_HEAD_SIZE + payloadSize);
+    msg[RTCM3_HEAD_SIZE + payloadSize + 0] = (crc >> 16) & 0xff;
+    msg[RTCM3_HEAD_SIZE + payloadSize + 1] = (crc >>  8) & 0xff;
+    msg[RTCM3_HEAD_SIZE + payloadSize + 2] =  crc        & 0xff;
+    return RTCM3_FRAME_SIZE + payloadSize;
+}
+
+// Simple PRNG, so that the synthetic data is the same every time
+static uint32_t gRandState = 0x12345678;
+static uint32_t _rand(void)
+{
+    gRandState ^= gRandState << 13;
+    gRandState ^= gRandState >> 17;
+    gRandState ^= gRandState << 5;
+    return gRandState;
+}
+
+static int _makeEpoch(uint8_t *buf, const int epoch)
+{
+    const uint32_t iTow = 208680000 + (epoch * 1000);
+    const int hour = 9;
+    const int min = 58 + ((epoch / 60) % 60);
+    const int sec = epoch % 60;
+    int offs = 0;
+
+    // UBX-NAV-TIMEGPS
+    {
+        UBX_NAV_TIMEGPS_V0_GROUP0_t timegps;
+        memset(&timegps, 0, sizeof(timegps));
+        timegps.iTow  = iTow;
+        timegps.week  = 2150;
+        timegps.leapS = 18;
+        timegps.valid = UBX_NAV_TIMEGPS_V0_VALID_TOWVALID | UBX_NAV_TIMEGPS_V0_VALID_WEEKVALID |
+                        UBX_NAV_TIMEGPS_V0_VALID_LEAPSVALID;
+        timegps.tAcc  = 20;
+        offs += ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_TIMEGPS_MSGID, (const uint8_t *)&timegps, sizeof(timegps), &buf[offs]);
+    }
+
+    // UBX-NAV-PVT
+    {
+        UBX_NAV_PVT_V1_GROUP0_t pvt;
+        memset(&pvt, 0, sizeof(pvt));
+        pvt.iTOW    = iTow;
+        pvt.year    = 2021;
+        pvt.month   = 3;
+        pvt.day     = 23;
+        pvt.hour    = hour + (min / 60);
+        pvt.min     = min % 60;
+        pvt.sec     = sec;
+        pvt.valid   = UBX_NAV_PVT_V1_VALID_VALIDDATE | UBX_NAV_PVT_V1_VALID_VALIDTIME | UBX_NAV_PVT_V1_VALID_FULLYRESOLVED;
+        pvt.tAcc    = 20;
+        pvt.fixType = UBX_NAV_PVT_V1_FIXTYPE_3D;
+        pvt.flags   = UBX_NAV_PVT_V1_FLAGS_GNSSFIXOK;
+        pvt.flags2  = UBX_NAV_PVT_V1_FLAGS2_CONFAVAIL | UBX_NAV_PVT_V1_FLAGS2_CONFDATE | UBX_NAV_PVT_V1_FLAGS2_CONFTIME;
+        pvt.numSV   = 24;
+        pvt.lat     = 473977000 + (int32_t)(_rand() % 100);
+        pvt.lon     =  85420000 + (int32_t)(_rand() % 100);
+        pvt.height  = 450000 + (int32_t)(_rand() % 1000);
+        pvt.hMSL    = 402000 + (int32_t)(_rand() % 1000);
+        pvt.hAcc    = 800;
+        pvt.vAcc    = 1200;
+        pvt.sAcc    = 50;
+        pvt.pDOP    = 120;
+        offs += ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_PVT_MSGID, (const uint8_t *)&pvt, sizeof(pvt), &buf[offs]);
+    }
+
+    // UBX-NAV-SAT
+    {
+        uint8_t payload[sizeof(UBX_NAV_SAT_V1_GROUP0_t) + (32 * sizeof(UBX_NAV_SAT_V1_GROUP1_t))];
+        UBX_NAV_SAT_V1_GROUP0_t head;
+        memset(&head, 0, sizeof(head));
+        head.iTOW = iTow;
+        head.version = UBX_NAV_SAT_V1_VERSION;
+        head.numSvs = 32;
+        memcpy(&payload[0], &head, sizeof(head));
+        for (int ix = 0; ix < head.numSvs; ix++)
+        {
+            UBX_NAV_SAT_V1_GROUP1_t sat;
+            memset(&sat, 0, sizeof(sat));
+            sat.gnssId = (ix < 16 ? 0 /* GPS */ : 2 /* Galileo */);
+            sat.svId   = 1 + (ix % 16);
+            sat.cno    = 30 + (_rand() % 20);
+            sat.elev   = 5 + (_rand() % 80);
+            sat.azim   = _rand() % 360;
+            sat.prRes  = (int16_t)(_rand() % 100) - 50;
+            sat.flags  = 0x00001f1f;
+            memcpy(&payload[sizeof(head) + (ix * sizeof(sat))], &sat, sizeof(sat));
+        }
+        offs += ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_SAT_MSGID, payload, sizeof(payload), &buf[offs]);
+    }
+
+    // NMEA GGA, RMC and GSV
+    {
+        char payload[200];
+        snprintf(payload, sizeof(payload), "%02d%02d%02d.00,4723.86200,N,00832.52000,E,1,12,0.88,402.0,M,48.0,M,,",
+            hour + (min / 60), min % 60, sec);
+        offs += nmeaMakeMessage("GN", "GGA", payload, (char *)&buf[offs]);
+        snprintf(payload, sizeof(payload), "%02d%02d%02d.00,A,4723.86200,N,00832.52000,E,0.011,,230321,,,A,V",
+            hour + (min / 60), min % 60, sec);
+        offs += nmeaMakeMessage("GN", "RMC", payload, (char *)&buf[offs]);
+        for (int ix = 0; ix < 3; ix++)
+        {
+            snprintf(payload, sizeof(payload), "3,%d,12,%02d,45,123,42,%02d,12,045,38,%02d,67,300,47,%02d,23,200,35,1",
+                ix + 1, (ix * 4) + 1, (ix * 4) + 2, (ix * 4) + 3, (ix * 4) + 4);
+            offs += nmeaMakeMessage("GP", "GSV", payload, (char *)&buf[offs]);
+        }
+    }
+
+    // RTCM3-TYPE1005 (every 10 epochs) and RTCM3-TYPE1077 (GPS MSM7, 10 satellites, 2 signals)
+    if ((epoch % 10) == 0)
+    {
+        uint8_t payload[19];
+        memset(payload, 0, sizeof(payload));
+        _setBits(payload,   0, 12, 1005);
+        _setBits(payload,  12, 12, 42);
+        _setBits(payload,  34, 38, (uint64_t)42750000000);
+        _setBits(payload,  74, 38, (uint64_t)6470000000);
+        _setBits(payload, 114, 38, (uint64_t)46760000000);
+        offs += _makeRtcm3(&buf[offs], payload, sizeof(payload));
+    }
+    {
+        const int numSat = 10;
+        const int numSig = 2;
+        const int numCell = numSat * numSig;
+        const int numBits = 169 + numCell + (numSat * 51) + (numCell * 80);
+        uint8_t payload[400];
+        const int payloadSize = (numBits + 7) / 8;
+        for (int ix = 0; ix < payloadSize; ix++)
+        {
+            payload[ix] = _rand() & 0xff;
+        }
+        int pos = 0;
+        _setBits(payload, pos, 12, 1077);     pos += 12; // message type
+        _setBits(payload, pos, 12, 42);       pos += 12; // reference station
+        _setBits(payload, pos, 30, iTow);     pos += 30; // GPS epoch time
+        _setBits(payload, pos,  1, 0);        pos +=  1; // multiple message bit
+        _setBits(payload, pos,  3, 0);        pos +=  3; // IODS
+        _setBits(payload, pos,  7, 0);        pos +=  7; // reserved
+        _setBits(payload, pos,  2, 0);        pos +=  2; // clock steering
+        _setBits(payload, pos,  2, 0);        pos +=  2; // external clock
+        _setBits(payload, pos,  1, 0);        pos +=  1; // smoothing
+        _setBits(payload, pos,  3, 0);        pos +=  3; // smoothing interval
+        _setBits(payload, pos, 64, 0x7fe0000000000000); pos += 64; // satellites 2..11
+        _setBits(payload, pos, 32, 0x41000000); pos += 32; // signals 2 (L1C) and 8 (L2C)
+        _setBits(payload, pos, numCell, (1 << numCell) - 1);
+        offs += _makeRtcm3(&buf[offs], payload, payloadSize);
+    }
+
+    // UBX-NAV-EOE
+    {
+        UBX_NAV_EOE_V0_GROUP0_t eoe;
+        memset(&eoe, 0, sizeof(eoe));
+        eoe.iTOW = iTow;
+        offs += ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_EOE_MSGID, (const uint8_t *)&eoe, sizeof(eoe), &buf[offs]);
+    }
+
+    return offs;
+}
+
+static bool _makeData(void)
+{
+    gDataSize = 0;
+    gData = malloc(BENCH_NUM_EPOCHS * 2000);
+    if (gData == NULL)
+    {
+        WARNING("malloc fail");
+        return false;
+    }
+    for (int epoch = 0; epoch < BENCH_NUM_EPOCHS; epoch++)
+    {
+        gDataSize += _makeEpoch(&gData[gDataSize], epoch);
+    }
+    PRINT("Using %d bytes of synthetic data (%d epochs)", gDataSize, BENCH_NUM_EPOCHS);
+    return true;
+}
+
+static bool _loadData(const char *inName)
+{
+    FILE *file = (strcmp(inName, "-") == 0) ? stdin : fopen(inName, "rb");
+    if (file == NULL)
+    {
+        WARNING("Failed opening '%s' for reading: %s!", inName, strerror(errno));
+        return false;
+    }
+    bool res = true;
+    int size = 0;
+    int bufSize = 0;
+    while (size < BENCH_MAX_INPUT_SIZE)
+    {
+        if (size >= bufSize)
+        {
+            bufSize = (bufSize == 0 ? (1024 * 1024) : (2 * bufSize));
+            uint8_t *data = realloc(gData, bufSize);
+            if (data == NULL)
+            {
+                WARNING("malloc fail");
+                res = false;
+                break;
+            }
+            gData = data;
+        }
+        const int num = fread(&gData[size], 1, bufSize - size, file);
+        if (num <= 0)
+        {
+            break;
+        }
+        size += num;
+    }
+    if (ferror(file))
+    {
+        WARNING("Failed reading '%s': %s!", inName, strerror(errno));
+        res = false;
+    }
+    else if (size >= BENCH_MAX_INPUT_SIZE)
+    {
+        WARNING("Using only the first %d bytes of '%s'!", BENCH_MAX_INPUT_SIZE, inName);
+    }
+    if (file != stdin)
+    {
+        fclose(file);
+    }
+    gDataSize = size;
+    if (res)
+    {
+        PRINT("Using %d bytes from '%s'", gDataSize, inName);
+    }
+    return res;
+}
+
+// Split data into messages (copies, so that the messages can be used independently of the parser)
+static bool _splitData(void)
+{
+    PARSER_t *parser = malloc(sizeof(PARSER_t));
+    int maxMsgs = 1000;
+    gNumMsgs = 0;
+    gMsgs = malloc(maxMsgs * sizeof(*gMsgs));
+    uint8_t *msgData = malloc(gDataSize > 0 ? gDataSize : 1);
+    if ( (parser == NULL) || (gMsgs == NULL) || (msgData == NULL) )
+    {
+        WARNING("malloc fail");
+        free(parser);
+        free(msgData);
+        return false;
+    }
+    parserInit(parser);
+
+    bool res = true;
+    int msgDataSize = 0;
+    for (int offs = 0; res && (offs < gDataSize); offs += BENCH_CHUNK_SIZE)
+    {
+        const int size = MIN(BENCH_CHUNK_SIZE, gDataSize - offs);
+        parserAdd(parser, &gData[offs], size);
+        PARSER_MSG_t msg;
+        while (parserProcess(parser, &msg, false))
+        {
+            if (gNumMsgs >= maxMsgs)
+            {
+                maxMsgs *= 2;
+                BENCH_MSG_t *msgs = realloc(gMsgs, maxMsgs * sizeof(*gMsgs));
+                if (msgs == NULL)
+                {
+                    WARNING("malloc fail");
+                    res = false;
+                    break;
+                }
+                gMsgs = msgs;
+            }
+            BENCH_MSG_t *m = &gMsgs[gNumMsgs++];
+            m->msg = msg;
+            m->msg.info = NULL;
+            m->msg.data = NULL;
+            m->msg.ts = msgDataSize; // offset, see below
+            snprintf(m->name, sizeof(m->name), "%s", msg.name);
+            memcpy(&msgData[msgDataSize], msg.data, msg.size);
+            msgDataSize += msg.size;
+        }
+    }
+    free(parser);
+
+    if (res)
+    {
+        for (int ix = 0; ix < gNumMsgs; ix++)
+        {
+            gMsgs[ix].msg.data = &msgData[gMsgs[ix].msg.ts];
+            gMsgs[ix].msg.name = gMsgs[ix].name;
+        }
+        // Replace the raw data by the messages. It's the same bytes, except for an incomplete message at the end.
+        free(gData);
+        gData = msgData;
+        gDataSize = msgDataSize;
+    }
+    else
+    {
+        free(msgData);
+    }
+    return res;
+}
+
+static int _cmpKeyVal(const void *a, const void *b)
+{
+    const uint32_t idA = ((const UBLOXCFG_KEYVAL_t *)a)->id;
+    const uint32_t idB = ((const UBLOXCFG_KEYVAL_t *)b)->id;
+    return idA < idB ? -1 : (idA > idB ? 1 : 0);
+}
+
+// All items with (somewhat) realistic values, as in a UBX-CFG-VALGET response (sorted by ID)
+static bool _makeCfgData(void)
+{
+    int numItems = 0;
+    const UBLOXCFG_ITEM_t **allItems = ubloxcfg_getAllItems(&numItems);
+    gKeyVal = malloc(numItems * sizeof(*gKeyVal));
+    gItems = malloc(numItems * sizeof(*gItems));
+    gCfgData = malloc(numItems * (4 + 8));
+    gCfgDataOffs = malloc((numItems + 1) * sizeof(*gCfgDataOffs));
+    if ( (gKeyVal == NULL) || (gItems == NULL) || (gCfgData == NULL) || (gCfgDataOffs == NULL) )
+    {
+        WARNING("malloc fail");
+        return false;
+    }
+    gNumKeyVal = 0;
+    for (int ix = 0; ix < numItems; ix++)
+    {
+        const UBLOXCFG_ITEM_t *item = allItems[ix];
+        UBLOXCFG_KEYVAL_t *kv = &gKeyVal[gNumKeyVal++];
+        kv->id = item->id;
+        kv->val._raw = item->nConsts > 0 ? item->consts[ix % item->nConsts].val.X : (uint64_t)ix;
+        switch (item->size)
+        {
+            case UBLOXCFG_SIZE_BIT:   kv->val._raw &= 0x01;       break;
+            case UBLOXCFG_SIZE_ONE:   kv->val._raw &= 0xff;       break;
+            case UBLOXCFG_SIZE_TWO:   kv->val._raw &= 0xffff;     break;
+            case UBLOXCFG_SIZE_FOUR:  kv->val._raw &= 0xffffffff; break;
+            case UBLOXCFG_SIZE_EIGHT:                             break;
+        }
+        if (item->type == UBLOXCFG_TYPE_R4)
+        {
+            kv->val.R4 = (float)ix / 3.0f;
+        }
+        else if (item->type == UBLOXCFG_TYPE_R8)
+        {
+            kv->val.R8 = (double)ix / 3.0;
+        }
+    }
+    qsort(gKeyVal, gNumKeyVal, sizeof(*gKeyVal), _cmpKeyVal);
+    gCfgDataOffs[0] = 0;
+    for (int ix = 0; ix < gNumKeyVal; ix++)
+    {
+        gItems[ix] = ubloxcfg_getItemById(gKeyVal[ix].id);
+        int size = 0;
+        switch (UBLOXCFG_ID2SIZE(gKeyVal[ix].id))
+        {
+            case UBLOXCFG_SIZE_BIT:
+            case UBLOXCFG_SIZE_ONE:   size = 1; break;
+            case UBLOXCFG_SIZE_TWO:   size = 2; break;
+            case UBLOXCFG_SIZE_FOUR:  size = 4; break;
+            case UBLOXCFG_SIZE_EIGHT: size = 8; break;
+        }
+        gCfgDataOffs[ix + 1] = gCfgDataOffs[ix] + 4 + size;
+    }
+    return ubloxcfg_makeData(gCfgData, numItems * (4 + 8), gKeyVal, gNumKeyVal, &gCfgDataSize) &&
+        (gCfgDataSize == gCfgDataOffs[gNumKeyVal]);
+}
+
+/* ****************************************************************************************************************** */
+
+// The stages: process all frames once, optionally timing each frame, return number of frames, add processed bytes
+
+#define _T0(_dt_)         const uint64_t t0 = ((_dt_) != NULL ? TIME_NS() : 0)
+#define _T1(_dt_, _ix_)   if ((_dt_) != NULL) { (_dt_)[_ix_] = TIME_NS() - t0; }
+
+static int _parser(uint32_t *dt, uint64_t *bytes, const bool info)
+{
+    static PARSER_t parser;
+    parserInit(&parser);
+    int nFrames = 0;
+    for (int offs = 0; offs < gDataSize; offs += BENCH_CHUNK_SIZE)
+    {
+        const int size = MIN(BENCH_CHUNK_SIZE, gDataSize - offs);
+        parserAdd(&parser, &gData[offs], size);
+        while (true)
+        {
+            PARSER_MSG_t msg;
+            _T0(dt);
+            const bool ok = parserProcess(&parser, &msg, info);
+            if (!ok)
+            {
+                break;
+            }
+            _T1(dt, nFrames);
+            nFrames++;
+        }
+    }
+    *bytes += gDataSize;
+    return nFrames;
+}
+
+static int _parserNoInfo(uint32_t *dt, uint64_t *bytes)
+{
+    return _parser(dt, bytes, false);
+}
+
+static int _parserInfo(uint32_t *dt, uint64_t *bytes)
+{
+    return _parser(dt, bytes, true);
+}
+
+static int _epochCollect(uint32_t *dt, uint64_t *bytes)
+{
+    static EPOCH_t coll;
+    static EPOCH_t epoch;
+    epochInit(&coll);
+    for (int ix = 0; ix < gNumMsgs; ix++)
+    {
+        _T0(dt);
+        epochCollect(&coll, &gMsgs[ix].msg, &epoch);
+        _T1(dt, ix);
+    }
+    *bytes += gDataSize;
+    return gNumMsgs;
+}
+
+static int _ubxInfo(uint32_t *dt, uint64_t *bytes)
+{
+    int nFrames = 0;
+    for (int ix = 0; ix < gNumMsgs; ix++)
+    {
+        const PARSER_MSG_t *msg = &gMsgs[ix].msg;
+        if (msg->type == PARSER_MSGTYPE_UBX)
+        {
+            char info[PARSER_MAX_INFO_SIZE];
+            _T0(dt);
+            ubxMessageInfo(info, sizeof(info), msg->data, msg->size);
+            _T1(dt, nFrames);
+            nFrames++;
+            *bytes += msg->size;
+        }
+    }
+    return nFrames;
+}
+
+static int _nmeaDecode(uint32_t *dt, uint64_t *bytes)
+{
+    int nFrames = 0;
+    for (int ix = 0; ix < gNumMsgs; ix++)
+    {
+        const PARSER_MSG_t *msg = &gMsgs[ix].msg;
+        if (msg->type == PARSER_MSGTYPE_NMEA)
+        {
+            NMEA_MSG_t nmea;
+            _T0(dt);
+            nmeaDecode(&nmea, msg->data, msg->size);
+            _T1(dt, nFrames);
+            nFrames++;
+            *bytes += msg->size;
+        }
+    }
+    return nFrames;
+}
+
+static int _rtcm3Info(uint32_t *dt, uint64_t *bytes)
+{
+    int nFrames = 0;
+    for (int ix = 0; ix < gNumMsgs; ix++)
+    {
+        const PARSER_MSG_t *msg = &gMsgs[ix].msg;
+        if (msg->type == PARSER_MSGTYPE_RTCM3)
+        {
+            char info[PARSER_MAX_INFO_SIZE];
+            _T0(dt);
+            rtcm3MessageInfo(info, sizeof(info), msg->data, msg->size);
+            RTCM3_MSM_HEADER_t header;
+            if (!rtcm3GetMsmHeader(msg->data, &header))
+            {
+                RTCM3_ARP_t arp;
+                rtcm3GetArp(msg->data, &arp);
+            }
+            _T1(dt, nFrames);
+            nFrames++;
+            *bytes += msg->size;
+        }
+    }
+    return nFrames;
+}
+
+static int _cfgItemById(uint32_t *dt, uint64_t *bytes)
+{
+    for (int ix = 0; ix < gNumKeyVal; ix++)
+    {
+        _T0(dt);
+        gItems[ix] = ubloxcfg_getItemById(gKeyVal[ix].id);
+        _T1(dt, ix);
+    }
+    *bytes += gCfgDataSize;
+    return gNumKeyVal;
+}
+
+static int _cfgItemByName(uint32_t *dt, uint64_t *bytes)
+{
+    for (int ix = 0; ix < gNumKeyVal; ix++)
+    {
+        const char *name = gItems[ix]->name;
+        _T0(dt);
+        gItems[ix] = ubloxcfg_getItemByName(name);
+        _T1(dt, ix);
+    }
+    *bytes += gCfgDataSize;
+    return gNumKeyVal;
+}
+
+static int _cfgParseData(uint32_t *dt, uint64_t *bytes)
+{
+    // Parse the UBX-CFG-VALGET payload item by item, so that we get the time for each
+    for (int ix = 0; ix < gNumKeyVal; ix++)
+    {
+        int nKv = 0;
+        _T0(dt);
+        ubloxcfg_parseData(&gCfgData[gCfgDataOffs[ix]], gCfgDataOffs[ix + 1] - gCfgDataOffs[ix], &gKeyVal[ix], 1, &nKv);
+        _T1(dt, ix);
+    }
+    *bytes += gCfgDataSize;
+    return gNumKeyVal;
+}
+
+static int _cfgStringify(uint32_t *dt, uint64_t *bytes)
+{
+    for (int ix = 0; ix < gNumKeyVal; ix++)
+    {
+        char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+        _T0(dt);
+        ubloxcfg_stringifyKeyVal(str, sizeof(str), &gKeyVal[ix]);
+        _T1(dt, ix);
+    }
+    *bytes += gCfgDataSize;
+    return gNumKeyVal;
+}
+
+typedef struct BENCH_STAGE_s
+{
+    const char *name;
+    int       (*func)(uint32_t *dt, uint64_t *bytes);
+} BENCH_STAGE_t;
+
+static const BENCH_STAGE_t kStages[] =
+{
+    { .name = "parser",        .func = _parserNoInfo },
+    { .name = "parser+info",   .func = _parserInfo },
+    { .name = "epochCollect",  .func = _epochCollect },
+    { .name = "ubxInfo",       .func = _ubxInfo },
+    { .name = "nmeaDecode",    .func = _nmeaDecode },
+    { .name = "rtcm3Info",     .func = _rtcm3Info },
+    { .name = "cfgItemById",   .func = _cfgItemById },
+    { .name = "cfgItemByName", .func = _cfgItemByName },
+    { .name = "cfgParseData",  .func = _cfgParseData },
+    { .name = "cfgStringify",  .func = _cfgStringify },
+};
+
+/* ****************************************************************************************************************** */
+
+static int _cmpU32(const void *a, const void *b)
+{
+    const uint32_t vA = *(const uint32_t *)a;
+    const uint32_t vB = *(const uint32_t *)b;
+    return vA < vB ? -1 : (vA > vB ? 1 : 0);
+}
+
+static void _measureClockOverhead(void)
+{
+    uint32_t dt[1001];
+    for (int ix = 0; ix < NUMOF(dt); ix++)
+    {
+        const uint64_t t0 = TIME_NS();
+        dt[ix] = TIME_NS() - t0;
+    }
+    qsort(dt, NUMOF(dt), sizeof(dt[0]), _cmpU32);
+    gClockOverhead = dt[NUMOF(dt) / 2];
+    DEBUG("Clock overhead: %" PRIu32 " ns", gClockOverhead);
+}
+
+static uint32_t _percentile(const uint32_t *dt, const int num, const int perc)
+{
+    const int ix = (((num - 1) * perc) + 50) / 100;
+    const uint32_t val = dt[CLIP(ix, 0, num - 1)];
+    return val > gClockOverhead ? val - gClockOverhead : 0;
+}
+
+static bool _runStage(const BENCH_STAGE_t *stage, BENCH_RES_t *res)
+{
+    memset(res, 0, sizeof(*res));
+    res->name = stage->name;
+
+    // Warm-up, and figure out the number of frames
+    res->nFrames = stage->func(NULL, &res->nBytes);
+    if (res->nFrames <= 0)
+    {
+        return true;
+    }
+
+    // Mean over repeated passes
+    uint64_t bytes = 0;
+    const uint64_t t0 = TIME_NS();
+    uint64_t t1 = t0;
+    while ((t1 - t0) < BENCH_MIN_DURATION)
+    {
+        stage->func(NULL, &bytes);
+        res->nPasses++;
+        t1 = TIME_NS();
+    }
+    const double dt = (double)(t1 - t0);
+    res->nsPerFrame = dt / (double)res->nPasses / (double)res->nFrames;
+    res->mbPerSec = ((double)bytes / (1024.0 * 1024.0)) / (dt * 1e-9);
+
+    // Per-frame times
+    uint32_t *dts = malloc(res->nFrames * sizeof(*dts));
+    if (dts == NULL)
+    {
+        WARNING("malloc fail");
+        return false;
+    }
+    memset(dts, 0, res->nFrames * sizeof(*dts));
+    uint64_t dummy = 0;
+    stage->func(dts, &dummy);
+    qsort(dts, res->nFrames, sizeof(*dts), _cmpU32);
+    res->p50 = _percentile(dts, res->nFrames, 50);
+    res->p90 = _percentile(dts, res->nFrames, 90);
+    res->p99 = _percentile(dts, res->nFrames, 99);
+    res->max = _percentile(dts, res->nFrames, 100);
+    free(dts);
+
+    DEBUG("%s: %d frames, %" PRIu64 " bytes, %d passes", res->name, res->nFrames, res->nBytes, res->nPasses);
+    return true;
+}
+
+static void _printText(const BENCH_RES_t *results, const int num)
+{
+    ioOutputStr("%-15s %8s %10s %8s %9s %8s %8s %8s %8s\n",
+        "stage", "frames", "bytes", "ns/frame", "MB/s", "p50", "p90", "p99", "max");
+    for (int ix = 0; ix < num; ix++)
+    {
+        const BENCH_RES_t *res = &results[ix];
+        ioOutputStr("%-15s %8d %10" PRIu64 " %8.1f %9.1f %8" PRIu32 " %8" PRIu32 " %8" PRIu32 " %8" PRIu32 "\n",
+            res->name, res->nFrames, res->nBytes, res->nsPerFrame, res->mbPerSec,
+            res->p50, res->p90, res->p99, res->max);
+    }
+}
+
+static void _printJson(const BENCH_RES_t *results, const int num, const char *input)
+{
+    ioOutputStr("{\n");
+    ioOutputStr("  \"version\": \"%s\",\n", CONFIG_VERSION);
+    ioOutputStr("  \"input\": ");
+    ioOutputJsonStr(input);
+    ioOutputStr(",\n");
+    ioOutputStr("  \"input_bytes\": %d,\n", gDataSize);
+    ioOutputStr("  \"input_messages\": %d,\n", gNumMsgs);
+    ioOutputStr("  \"clock_overhead_ns\": %" PRIu32 ",\n", gClockOverhead);
+    ioOutputStr("  \"stages\": [\n");
+    for (int ix = 0; ix < num; ix++)
+    {
+        const BENCH_RES_t *res = &results[ix];
+        ioOutputStr("    { \"name\": \"%s\", \"frames\": %d, \"bytes\": %" PRIu64 ", \"passes\": %d,"
+            " \"ns_per_frame\": %.1f, \"mb_per_s\": %.1f, \"p50_ns\": %" PRIu32 ", \"p90_ns\": %" PRIu32 ","
+            " \"p99_ns\": %" PRIu32 ", \"max_ns\": %" PRIu32 " }%s\n",
+            res->name, res->nFrames, res->nBytes, res->nPasses, res->nsPerFrame, res->mbPerSec,
+            res->p50, res->p90, res->p99, res->max, ix < (num - 1) ? "," : "");
+    }
+    ioOutputStr("  ]\n");
+    ioOutputStr("}\n");
+}
+
+int benchRun(const char *inName, const bool json)
+{
+    bool res = true;
+    if (inName != NULL)
+    {
+        res = _loadData(inName);
+    }
+    else
+    {
+        res = _makeData();
+    }
+    if (res)
+    {
+        res = _splitData();
+    }
+    if (res)
+    {
+        res = _makeCfgData();
+    }
+    if (res)
+    {
+        PRINT("Benchmarking %d messages, %d configuration items", gNumMsgs, gNumKeyVal);
+        _measureClockOverhead();
+    }
+
+    BENCH_RES_t results[NUMOF(kStages)];
+    for (int ix = 0; res && (ix < NUMOF(kStages)); ix++)
+    {
+        PRINT("Running stage %s...", kStages[ix].name);
+        res = _runStage(&kStages[ix], &results[ix]);
+    }
+
+    if (res)
+    {
+        if (json)
+        {
+            _printJson(results, NUMOF(kStages), inName != NULL ? inName : "synthetic");
+        }
+        else
+        {
+            _printText(results, NUMOF(kStages));
+        }
+        res = ioWriteOutput(false);
+    }
+
+    free(gData);
+    free(gMsgs);
+    free(gKeyVal);
+    free(gItems);
+    free(gCfgData);
+    free(gCfgDataOffs);
+    gData = NULL;
+    gMsgs = NULL;
+    gKeyVal = NULL;
+    gItems = NULL;
+    gCfgData = NULL;
+    gCfgDataOffs = NULL;
+
+    return res ? EXIT_SUCCESS : EXIT_OTHERFAIL;
+}
+
+/* ****************************************************************************************************************** */
+// eof
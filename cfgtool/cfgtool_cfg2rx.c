@@ -54,10 +54,16 @@ const char *cfg2rxHelp(void)
 "    'reset' command description.\n"
 "\n"
 "    The -U switch makes the command only update the receiver configuration if\n"
-"    necessary. If the current configuration of the receiver already contains all\n"
-"    the configuration from <infile>, no action is taken and the command finishes\n"
-"    early. Additionally, with '-r factory', the items not covered by <infile>\n"
-"    are checked against the default configuration.\n"
+"    necessary. The current configuration of each of the <layers> is compared to\n"
+"    the configuration from <infile> and only the items that differ are stored.\n"
+"    If all <layers> are up to date, no action is taken and the command finishes\n"
+"    early. With '-r default' or '-r factory' the receiver is not reset. Instead,\n"
+"    items not covered by <infile> are deleted from the BBR and Flash layers and\n"
+"    are reverted to their default value in the RAM layer, which results in the\n"
+"    same configuration as a reset would. This is done for all three layers,\n"
+"    including the ones not in <layers>. With '-r factory' a cold start is done\n"
+"    in the end. This saves time and Flash wear for receivers that are mostly\n"
+"    configured already.\n"
 "\n"
 "    A configuration file consists of one or more lines of configuration\n"
 "    parameters. Leading and trailing whitespace, empty lines as well as comments\n"
@@ -157,6 +163,26 @@ const char *cfg2rxHelp(void)
 
 /* ****************************************************************************************************************** */
 
+// Configuration change required for one layer
+typedef struct CFG_DELTA_s
+{
+    bool                   use;
+    UBLOXCFG_LAYER_t       layer;
+    UBLOXCFG_KEYVAL_t      set[CFG_SET_MAX_KV];
+    int                    nSet;
+    bool                   setDone;
+    uint32_t               del[CFG_SET_MAX_KV];
+    int                    nDel;
+    bool                   delDone;
+} CFG_DELTA_t;
+
+#define CFG_DELTA_NUM 3 // RAM, BBR, Flash
+
+static CFG_DELTA_t *_cfgDeltaGet(RX_t *rx, const UBLOXCFG_KEYVAL_t *kv, const int nKv,
+    const bool ram, const bool bbr, const bool flash, const bool exact);
+static bool _cfgDeltaNeeded(const CFG_DELTA_t *deltas);
+static bool _cfgDeltaApply(RX_t *rx, CFG_DELTA_t *deltas);
+
 int cfg2rxRun(const char *portArg, const char *layerArg, const char *resetArg, const bool applyConfig, const bool updateOnly)
 {
     bool ram = false;
@@ -189,82 +215,62 @@ int cfg2rxRun(const char *portArg, const char *layerArg, const char *resetArg, c
         return EXIT_RXFAIL;
     }
 
-    // Check current config
+    // Update only what differs from the current configuration
     if (updateOnly)
     {
-        bool configNeedsUpdate = false;
-        // Get current and default config
-        const uint32_t keys[] = { UBX_CFG_VALGET_V0_ALL_WILDCARD };
-        UBLOXCFG_KEYVAL_t allKvRam[3000];
-        const int nAllKvRam = rxGetConfig(rx, UBLOXCFG_LAYER_RAM, keys, NUMOF(keys), allKvRam, NUMOF(allKvRam));
-        UBLOXCFG_KEYVAL_t allKvDef[NUMOF(allKvRam)];
-        const int nAllKvDef = reset == RX_RESET_FACTORY ?
-            rxGetConfig(rx, UBLOXCFG_LAYER_DEFAULT, keys, NUMOF(keys), allKvDef, NUMOF(allKvDef)) : 0;
-
-        // Check current configuration
-        for (int ixKvRam = 0; ixKvRam < nAllKvRam; ixKvRam++)
-        {
-            const UBLOXCFG_KEYVAL_t *kvRam = &allKvRam[ixKvRam];
-
-            // Check all items from config file
-            bool itemIsInCfg = false;
-            for (int ixKvCfg = 0; ixKvCfg < nAllKvCfg; ixKvCfg++)
+        // With reset to default the delta (incl. deleting items) replaces the reset
+        const bool exact = (resetArg != NULL) && ((reset == RX_RESET_DEFAULT) || (reset == RX_RESET_FACTORY));
+        CFG_DELTA_t *deltas = _cfgDeltaGet(rx, allKvCfg, nAllKvCfg, ram, bbr, flash, exact);
+        if ( (deltas != NULL) && !exact && (resetArg != NULL) && _cfgDeltaNeeded(deltas) )
+        {
+            // Other resets may change the configuration (e.g. RAM is reloaded), so re-do the delta after the reset
+            free(deltas);
+            deltas = NULL;
+            if (rxReset(rx, reset))
             {
-                const UBLOXCFG_KEYVAL_t *kvCfg = &allKvCfg[ixKvCfg];
-                if (kvRam->id == kvCfg->id)
-                {
-                    itemIsInCfg = true;
-                    if (kvRam->val._raw != kvCfg->val._raw)
-                    {
-                        configNeedsUpdate = true;
-                        char strCfg[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                        char strRam[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                        if ( ubloxcfg_stringifyKeyVal(strCfg, sizeof(strCfg), kvCfg) &&
-                             ubloxcfg_stringifyKeyVal(strRam, sizeof(strRam), kvRam) )
-                        {
-                            DEBUG("Config (%s) differs from current config (%s)", strCfg, strRam);
-                        }
-                    }
-                }
-            }
-
-            // Check if different from config, if factory reset requested, and unless item set by cfg file
-            if (!itemIsInCfg && (nAllKvDef > 0))
-            {
-                for (int ixKvDef = 0; ixKvDef < nAllKvDef; ixKvDef++)
-                {
-                    const UBLOXCFG_KEYVAL_t *kvDef = &allKvDef[ixKvDef];
-                    if (kvRam->id == kvDef->id)
-                    {
-                        if (kvRam->val._raw != kvDef->val._raw)
-                        {
-                            configNeedsUpdate = true;
-                            char strDef[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                            char strRam[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                            if ( ubloxcfg_stringifyKeyVal(strDef, sizeof(strDef), kvDef) &&
-                                 ubloxcfg_stringifyKeyVal(strRam, sizeof(strRam), kvRam) )
-                            {
-                                DEBUG("Default (%s) differs from current config (%s)", strDef, strRam);
-                            }
-                        }
-                    }
-                }
+                deltas = _cfgDeltaGet(rx, allKvCfg, nAllKvCfg, ram, bbr, flash, false);
             }
         }
+        if (deltas == NULL)
+        {
+            free(allKvCfg);
+            rxClose(rx);
+            free(rx);
+            return EXIT_RXFAIL;
+        }
 
-        // reset == RX_RESET_FACTORY
-        if (configNeedsUpdate)
+        bool res = true;
+        const bool needed = _cfgDeltaNeeded(deltas);
+        if (needed)
         {
-            PRINT("Current configuration differs from requestd config.");
+            PRINT("Current configuration differs from requested config.");
+            res = _cfgDeltaApply(rx, deltas);
         }
         else
         {
             PRINT("Current configuration is up to date. Skipping configuring receiver.");
-            free(allKvCfg);
-            rxClose(rx);
-            free(rx);
-            return EXIT_SUCCESS;
         }
+        free(deltas);
+
+        // The factory reset also clears the navigation data
+        if (res && exact && (reset == RX_RESET_FACTORY))
+        {
+            res = rxReset(rx, RX_RESET_COLD);
+        }
+        if (res && needed && applyConfig)
+        {
+            PRINT("Applying configuration");
+            res = rxReset(rx, RX_RESET_SOFT);
+        }
+        if (res && needed)
+        {
+            PRINT("Receiver successfully configured");
+        }
+
+        free(allKvCfg);
+        rxClose(rx);
+        free(rx);
+        return res ? EXIT_SUCCESS : EXIT_OTHERFAIL;
     }
 
     if ( (resetArg != NULL) && !rxReset(rx, reset))
@@ -302,11 +308,169 @@ int cfg2rxRun(const char *portArg, const char *layerArg, const char *resetArg, c
 
 /* ****************************************************************************************************************** */
 
+static CFG_DELTA_t *_cfgDeltaGet(RX_t *rx, const UBLOXCFG_KEYVAL_t *kv, const int nKv,
+    const bool ram, const bool bbr, const bool flash, const bool exact)
+{
+    CFG_DELTA_t *deltas = calloc(CFG_DELTA_NUM, sizeof(CFG_DELTA_t));
+    UBLOXCFG_KEYVAL_t *have = malloc(2 * 3000 * sizeof(UBLOXCFG_KEYVAL_t));
+    if ( (deltas == NULL) || (have == NULL) )
+    {
+        WARNING("malloc fail");
+        free(deltas);
+        free(have);
+        return NULL;
+    }
+    UBLOXCFG_KEYVAL_t *def = &have[3000];
+    deltas[0].use = ram;   deltas[0].layer = UBLOXCFG_LAYER_RAM;
+    deltas[1].use = bbr;   deltas[1].layer = UBLOXCFG_LAYER_BBR;
+    deltas[2].use = flash; deltas[2].layer = UBLOXCFG_LAYER_FLASH;
+
+    bool res = true;
+    const uint32_t keys[] = { UBX_CFG_VALGET_V0_ALL_WILDCARD };
+
+    // For the RAM layer we need the defaults to revert items not in the config
+    int nDef = 0;
+    if (exact)
+    {
+        nDef = rxGetConfig(rx, UBLOXCFG_LAYER_DEFAULT, keys, NUMOF(keys), def, 3000);
+        if (nDef < 0)
+        {
+            res = false;
+        }
+    }
+
+    for (int ix = 0; res && (ix < CFG_DELTA_NUM); ix++)
+    {
+        CFG_DELTA_t *delta = &deltas[ix];
+        // In exact mode all layers must end up like after the reset, the ones not used get no configuration
+        if (!delta->use && !exact)
+        {
+            continue;
+        }
+        const int nHave = rxGetConfig(rx, delta->layer, keys, NUMOF(keys), have, 3000);
+        if (nHave < 0)
+        {
+            res = false;
+            break;
+        }
+        const bool isRam = (delta->layer == UBLOXCFG_LAYER_RAM);
+        if (!ubxCfgDiff(kv, delta->use ? nKv : 0, have, nHave, exact && isRam ? def : NULL, exact && isRam ? nDef : 0,
+                delta->set, NUMOF(delta->set), &delta->nSet,
+                exact && !isRam ? delta->del : NULL, NUMOF(delta->del), &delta->nDel))
+        {
+            res = false;
+            break;
+        }
+        PRINT("Layer %s: %d items, %d to change, %d to delete", ubloxcfg_layerName(delta->layer),
+            nHave, delta->nSet, delta->nDel);
+
+        if (isDEBUG())
+        {
+            for (int setIx = 0; setIx < delta->nSet; setIx++)
+            {
+                char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+                if (ubloxcfg_stringifyKeyVal(str, sizeof(str), &delta->set[setIx]))
+                {
+                    DEBUG("Layer %s: set %s", ubloxcfg_layerName(delta->layer), str);
+                }
+            }
+            for (int delIx = 0; delIx < delta->nDel; delIx++)
+            {
+                const UBLOXCFG_ITEM_t *item = ubloxcfg_getItemById(delta->del[delIx]);
+                DEBUG("Layer %s: delete %s (0x%08"PRIx32")", ubloxcfg_layerName(delta->layer),
+                    item != NULL ? item->name : "?", delta->del[delIx]);
+            }
+        }
+    }
+
+    free(have);
+    if (!res)
+    {
+        WARNING("Failed determining configuration changes!");
+        free(deltas);
+        return NULL;
+    }
+    return deltas;
+}
+
+static bool _cfgDeltaNeeded(const CFG_DELTA_t *deltas)
+{
+    for (int ix = 0; ix < CFG_DELTA_NUM; ix++)
+    {
+        if ( (deltas[ix].nSet > 0) || (deltas[ix].nDel > 0) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool _cfgDeltaSameSet(const CFG_DELTA_t *a, const CFG_DELTA_t *b)
+{
+    for (int ix = 0; ix < a->nSet; ix++)
+    {
+        if ( (a->set[ix].id != b->set[ix].id) || (a->set[ix].val._raw != b->set[ix].val._raw) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool _cfgDeltaApply(RX_t *rx, CFG_DELTA_t *deltas)
+{
+    bool res = true;
+    // Send changes that are the same for several layers only once
+    for (int ix = 0; res && (ix < CFG_DELTA_NUM); ix++)
+    {
+        CFG_DELTA_t *delta = &deltas[ix];
+        if ( (delta->nSet > 0) && !delta->setDone )
+        {
+            bool layers[CFG_DELTA_NUM] = { false, false, false };
+            for (int ix2 = ix; ix2 < CFG_DELTA_NUM; ix2++)
+            {
+                CFG_DELTA_t *delta2 = &deltas[ix2];
+                if ( (delta2->nSet == delta->nSet) && _cfgDeltaSameSet(delta, delta2) )
+                {
+                    layers[ix2] = true;
+                    delta2->setDone = true;
+                }
+            }
+            res = rxSetConfig(rx, delta->set, delta->nSet, layers[0], layers[1], layers[2]);
+        }
+        if ( res && (delta->nDel > 0) && !delta->delDone )
+        {
+            bool layers[CFG_DELTA_NUM] = { false, false, false };
+            for (int ix2 = ix; ix2 < CFG_DELTA_NUM; ix2++)
+            {
+                CFG_DELTA_t *delta2 = &deltas[ix2];
+                if ( (delta2->nDel == delta->nDel) &&
+                     (memcmp(delta2->del, delta->del, delta->nDel * sizeof(*delta->del)) == 0) )
+                {
+                    layers[ix2] = true;
+                    delta2->delDone = true;
+                }
+            }
+            res = rxDelConfig(rx, delta->del, delta->nDel, layers[1], layers[2]);
+        }
+    }
+    return res;
+}
+
+/* ****************************************************************************************************************** */
+
+#define CFG_DB_HASH_BITS 12
+#define CFG_DB_HASH_SIZE (1 << CFG_DB_HASH_BITS) // must be > CFG_SET_MAX_KV, 2x or more is good
+#if (CFG_DB_HASH_SIZE <= CFG_SET_MAX_KV)
+#  error CFG_DB_HASH_SIZE too small!
+#endif
+
 typedef struct CFG_DB_s
 {
     UBLOXCFG_KEYVAL_t     *kv;
     int                    nKv;
     int                    maxKv;
+    uint16_t               hash[CFG_DB_HASH_SIZE]; // open addressing hash of kv[].id: index into kv + 1, 0 = empty
 } CFG_DB_t;
 
 static bool _cfgDbAdd(CFG_DB_t *db, IO_LINE_t *line);
@@ -322,7 +486,7 @@ UBLOXCFG_KEYVAL_t *cfgToKeyVal(int *nKv)
     }
     memset(kv, 0, kvSize);
 
-    CFG_DB_t db = { .kv = kv, .nKv = 0, .maxKv = CFG_SET_MAX_KV };
+    CFG_DB_t db = { .kv = kv, .nKv = 0, .maxKv = CFG_SET_MAX_KV, .hash = { 0 } };
     bool res = true;
     while (res)
     {
@@ -730,9 +894,11 @@ static bool _cfgDbAddKeyVal(CFG_DB_t *db, IO_LINE_t *line, const uint32_t id, co
         return false;
     }
 
-    for (int ix = 0; ix < db->maxKv; ix++)
+    // Find item (Fibonacci hashing, linear probing)
+    uint32_t slot = (id * UINT32_C(2654435761)) >> (32 - CFG_DB_HASH_BITS);
+    while (db->hash[slot] != 0)
     {
-        if (db->kv[ix].id == id)
+        if (db->kv[ db->hash[slot] - 1 ].id == id)
         {
             const UBLOXCFG_ITEM_t *item = ubloxcfg_getItemById(id);
             if (item != NULL)
@@ -745,8 +911,10 @@ static bool _cfgDbAddKeyVal(CFG_DB_t *db, IO_LINE_t *line, const uint32_t id, co
             }
             return false;
         }
+        slot = (slot + 1) & (CFG_DB_HASH_SIZE - 1);
     }
 
+    db->hash[slot] = db->nKv + 1;
     db->kv[db->nKv].id = id;
     db->kv[db->nKv].val = *value;
     if (isDEBUG())
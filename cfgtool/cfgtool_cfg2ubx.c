@@ -15,6 +15,7 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
+#include <stdio.h>
 #include <string.h>
 #include <stddef.h>
 #include <stdlib.h>
@@ -35,14 +36,23 @@ const char *cfg2ubxHelp(void)
 "Commands 'cfg2ubx', 'cfg2hex' and 'cfg2c':\n"
 "\n"
 "    Usage: cfgtool cfg2ubx [-i <infile>] [-o <outfile>] [-y] -l <layer(s)>\n"
+"                   [-m <size>]\n"
 "           cfgtool cfg2hex [-i <infile>] [-o <outfile>] [-y] -l <layer(s)> [-x]\n"
+"                   [-m <size>]\n"
 "           cfgtool cfg2c [-i <infile>] [-o <outfile>] [-y] -l <layer(s)> [-x]\n"
+"                   [-m <size>]\n"
 "\n"
 "    The cfg2ubx, cfg2hex and cfg2c modes convert a configuration file into one\n"
 "    or more UBX-CFG-VALSET messages, output as binary UBX messages, u-center\n"
 "    compatible hex dumps, or c code. Optional extra comments can be enabled\n"
 "    using the -x flag.\n"
 "    See the 'rx2cfg' command for the specification of the configuration file.\n"
+"\n"
+"    The size of the messages can be limited using the -m flag, for example, for\n"
+"    receivers or connections that cannot handle messages of the maximum size\n"
+"    (780 bytes). In this case, the items are grouped so that as few messages\n"
+"    as possible are needed, which may change the order of the items. Multiple\n"
+"    messages are sent as a transaction, so that all items are applied at once.\n"
 "\n";
 }
 
@@ -53,26 +63,26 @@ typedef enum FMT_e
     FMT_UBX, FMT_HEX, FMT_C
 } FMT_t;
 
-static int _cfg2fmt(const char *layerArg, const bool extraInfo, const FMT_t fmt);
+static int _cfg2fmt(const char *layerArg, const bool extraInfo, const char *maxSizeArg, const FMT_t fmt);
 
-int cfg2ubxRun(const char *layerArg, const bool extraInfo)
+int cfg2ubxRun(const char *layerArg, const bool extraInfo, const char *maxSizeArg)
 {
-    return _cfg2fmt(layerArg, extraInfo, FMT_UBX);
+    return _cfg2fmt(layerArg, extraInfo, maxSizeArg, FMT_UBX);
 }
 
-int cfg2hexRun(const char *layerArg, const bool extraInfo)
+int cfg2hexRun(const char *layerArg, const bool extraInfo, const char *maxSizeArg)
 {
-    return _cfg2fmt(layerArg, extraInfo, FMT_HEX);
+    return _cfg2fmt(layerArg, extraInfo, maxSizeArg, FMT_HEX);
 }
 
-int cfg2cRun(const char *layerArg, const bool extraInfo)
+int cfg2cRun(const char *layerArg, const bool extraInfo, const char *maxSizeArg)
 {
-    return _cfg2fmt(layerArg, extraInfo, FMT_C);
+    return _cfg2fmt(layerArg, extraInfo, maxSizeArg, FMT_C);
 }
 
 /* ****************************************************************************************************************** */
 
-static int _cfg2fmt(const char *layerArg, const bool extraInfo, const FMT_t fmt)
+static int _cfg2fmt(const char *layerArg, const bool extraInfo, const char *maxSizeArg, const FMT_t fmt)
 {
     bool ram = false;
     bool bbr = false;
@@ -82,6 +92,19 @@ static int _cfg2fmt(const char *layerArg, const bool extraInfo, const FMT_t fmt)
         return EXIT_BADARGS;
     }
 
+    UBX_CFG_VALSET_OPTS_t opts = { .pack = true, .noTransaction = false, .maxSize = 0 };
+    if (maxSizeArg != NULL)
+    {
+        const int minSize = (int)sizeof(UBX_CFG_VALSET_V1_GROUP0_t) + 4 + 8 + UBX_FRAME_SIZE;
+        int n = 0;
+        if ( (sscanf(maxSizeArg, "%d%n", &opts.maxSize, &n) != 1) || (maxSizeArg[n] != '\0') ||
+             (opts.maxSize < minSize) || (opts.maxSize > UBX_CFG_VALSET_V1_MAX_SIZE) )
+        {
+            WARNING("Illegal message size '%s', must be %d..%d!", maxSizeArg, minSize, UBX_CFG_VALSET_V1_MAX_SIZE);
+            return EXIT_BADARGS;
+        }
+    }
+
     PRINT("Loading configuration");
     int nKv = 0;
     UBLOXCFG_KEYVAL_t *kv = cfgToKeyVal(&nKv);
@@ -92,14 +115,24 @@ static int _cfg2fmt(const char *layerArg, const bool extraInfo, const FMT_t fmt)
 
     PRINT("Converting %d items into UBX-CFG-VALSET messages", nKv);
     int nMsgs = 0;
-    UBX_CFG_VALSET_MSG_t *msgs = ubxKeyValToUbxCfgValset(kv, nKv, ram, bbr, flash, &nMsgs);
+    int nMsgsUnpacked = 0;
+    UBX_CFG_VALSET_MSG_t *msgs = ubxKeyValToUbxCfgValsetOpts(kv, nKv, ram, bbr, flash, &opts, &nMsgs, &nMsgsUnpacked);
     if (msgs == NULL)
     {
         free(kv);
         return EXIT_OTHERFAIL;
     }
+    const int nMsgsWithData = nMsgs - (nMsgs > 1 ? 1 : 0); // transaction end message has no data
+    if (nMsgsWithData < nMsgsUnpacked)
+    {
+        PRINT("Packed %d items into %d instead of %d messages (%d fewer)",
+            nKv, nMsgsWithData, nMsgsUnpacked, nMsgsUnpacked - nMsgsWithData);
+    }
+    else
+    {
+        PRINT("Using %d message%s for %d items", nMsgsWithData, nMsgsWithData == 1 ? "" : "s", nKv);
+    }
 
-    int kvOffs = 0;
     for (int msgIx = 0; msgIx < nMsgs; msgIx++)
     {
         PRINT("Dumping UBX-CFG-VALSET %d/%d (%s)",
@@ -113,12 +146,13 @@ static int _cfg2fmt(const char *layerArg, const bool extraInfo, const FMT_t fmt)
                 comment1, msgIx + 1, nMsgs, msgs[msgIx].info);
             if (extraInfo)
             {
-                for (int kvIx = 0; (kvIx < UBX_CFG_VALSET_V1_MAX_KV) && (kvOffs < nKv); kvIx++, kvOffs++)
+                for (int ix = 0; ix < msgs[msgIx].nKv; ix++)
                 {
+                    const int kvIx = msgs[msgIx].kvIx[ix];
                     char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                    if (ubloxcfg_stringifyKeyVal(str, sizeof(str), &kv[kvOffs]))
+                    if (ubloxcfg_stringifyKeyVal(str, sizeof(str), &kv[kvIx]))
                     {
-                        ioOutputStr("%s%2d. %s\n", comment2, kvOffs + 1, str);
+                        ioOutputStr("%s%2d. %s\n", comment2, kvIx + 1, str);
                     }
                 }
             }
@@ -157,6 +191,7 @@ static int _cfg2fmt(const char *layerArg, const bool extraInfo, const FMT_t fmt)
         ioOutputStr("};\n", nMsgs);
     }
 
+    free(msgs);
     free(kv);
     return ioWriteOutput(false) ? EXIT_SUCCESS : EXIT_OTHERFAIL;
 }
@@ -18,8 +18,11 @@
 #include <string.h>
 #include <stddef.h>
 #include <signal.h>
+#include <inttypes.h>
+#include <pthread.h>
 
 #include "cfgtool_util.h"
+#include "cfgtool_queue.h"
 
 #include "ff_rx.h"
 #include "ff_ubx.h"
@@ -41,6 +44,10 @@ const char *dumpHelp(void)
 "    and optionally a hex dump of the messages until SIGINT (e.g. CTRL-C)"NOT_WIN(", SIGHUP")"\n"
 "    or SIGTERM is received.\n"
 "\n"
+"    The receiver is read in a separate thread. If the output cannot keep up\n"
+"    (e.g. slow terminal or pipe), messages are dropped rather than stalling\n"
+"    the receiver connection, and the losses are reported.\n"
+"\n"
 "    Returns success (0) if receiver was detected and at least one message was\n"
 "    received. Otherwise returns "STRINGIFY(EXIT_RXFAIL)" (rx not detected) or "STRINGIFY(EXIT_RXNODATA)" (no messages).\n"
 "\n"
@@ -57,20 +64,120 @@ const char *dumpHelp(void)
 
 /* ****************************************************************************************************************** */
 
-bool gAbort;
+#define DUMP_QUEUE_SIZE   (16 * 1024 * 1024)
+#define DUMP_FLUSH_ITEMS  32
+
+static bool gAbort;
 
 static void _sigHandler(int signal)
 {
     if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
     {
         PRINT("Aborting...");
-        gAbort = true;
+        __atomic_store_n(&gAbort, true, __ATOMIC_RELAXED);
     }
 }
 
+// Entry in the queue, followed by the message data resp. the epoch string (incl. nul)
+typedef struct DUMP_ITEM_s
+{
+    bool             isEpoch;
+    PARSER_MSGTYPE_t type;
+    uint32_t         seq;
+    uint32_t         latency;
+    int              size;
+    char             name[PARSER_MAX_NAME_SIZE];
+} DUMP_ITEM_t;
+
+typedef struct DUMP_s
+{
+    RX_t            *rx;
+    QUEUE_t         *queue;
+    bool             done;     // Reader has stopped
+    // Statistics (reader)
+    uint32_t         nNmea, sNmea;
+    uint32_t         nUbx,  sUbx;
+    uint32_t         nRtcm, sRtcm;
+    uint32_t         nNova, sNova;
+    uint32_t         nGarb, sGarb;
+    uint32_t         nMsgs, sMsgs;
+} DUMP_t;
+
+static void _push(DUMP_t *dump, const DUMP_ITEM_t *item, const void *data)
+{
+    uint8_t *entry = queuePushBegin(dump->queue, sizeof(*item) + item->size);
+    if (entry != NULL)
+    {
+        memcpy(entry, item, sizeof(*item));
+        memcpy(&entry[sizeof(*item)], data, item->size);
+        queuePushEnd(dump->queue);
+    }
+    // Never wait for the output, drop instead (and count only lost receiver data, not the derived epochs)
+    else if (!item->isEpoch)
+    {
+        queueDrop(dump->queue, item->size);
+    }
+}
+
+// Reader thread: get messages from the receiver, collect epochs and pass everything to the output (main thread)
+static void *_reader(void *arg)
+{
+    DUMP_t *dump = (DUMP_t *)arg;
+
+    const uint32_t tOffs = TIME() - timeOfDay(); // Offset between wall clock and parser time reference
+
+    EPOCH_t coll;
+    EPOCH_t epoch;
+    epochInit(&coll);
+
+    while (!__atomic_load_n(&gAbort, __ATOMIC_RELAXED))
+    {
+        PARSER_MSG_t *msg = rxGetNextMessage(dump->rx);
+        if (msg != NULL)
+        {
+            dump->nMsgs++;
+            dump->sMsgs += msg->size;
+            switch (msg->type)
+            {
+                case PARSER_MSGTYPE_UBX:     dump->nUbx++;  dump->sUbx  += msg->size; break;
+                case PARSER_MSGTYPE_NMEA:    dump->nNmea++; dump->sNmea += msg->size; break;
+                case PARSER_MSGTYPE_RTCM3:   dump->nRtcm++; dump->sRtcm += msg->size; break;
+                case PARSER_MSGTYPE_NOVATEL: dump->nNova++; dump->sNova += msg->size; break;
+                case PARSER_MSGTYPE_GARBAGE: dump->nGarb++; dump->sGarb += msg->size; break;
+            }
+
+            if (epochCollect(&coll, msg, &epoch))
+            {
+                DUMP_ITEM_t item = { .isEpoch = true, .seq = epoch.seq, .size = strlen(epoch.str) + 1 };
+                _push(dump, &item, epoch.str);
+            }
+
+            DUMP_ITEM_t item = { .isEpoch = false, .type = msg->type, .seq = msg->seq, .size = msg->size };
+            // Relative to wall clock top of second
+            item.latency = msg->tsReal != 0 ? (uint32_t)((msg->tsReal / 1000000) % 1000) : (msg->ts - tOffs) % 1000;
+            snprintf(item.name, sizeof(item.name), "%s", msg->name);
+            _push(dump, &item, msg->data);
+        }
+        // End of input (file replay)
+        else if (rxIsEof(dump->rx))
+        {
+            break;
+        }
+        // No data, yield
+        else
+        {
+            SLEEP(5);
+        }
+    }
+
+    __atomic_store_n(&dump->done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
 int dumpRun(const char *portArg, const bool extraInfo, const bool noProbe)
 {
     RX_ARGS_t args = RX_ARGS_DEFAULT();
+    args.msginfo = false; // stringified by the output (main thread), see below
     if (noProbe)
     {
         args.autobaud = false;
@@ -83,95 +190,118 @@ int dumpRun(const char *portArg, const bool extraInfo, const bool noProbe)
         return EXIT_RXFAIL;
     }
 
-    uint32_t nNmea = 0, sNmea = 0;
-    uint32_t nUbx  = 0, sUbx  = 0;
-    uint32_t nRtcm = 0, sRtcm = 0;
-    uint32_t nNova = 0, sNova = 0;
-    uint32_t nGarb = 0, sGarb = 0;
-    uint32_t nMsgs = 0, sMsgs = 0;
+    DUMP_t dump;
+    memset(&dump, 0, sizeof(dump));
+    dump.rx = rx;
+    dump.queue = queueCreate(DUMP_QUEUE_SIZE);
+    if (dump.queue == NULL)
+    {
+        rxClose(rx);
+        free(rx);
+        return EXIT_OTHERFAIL;
+    }
 
-    gAbort = false;
+    __atomic_store_n(&gAbort, false, __ATOMIC_RELAXED);
     signal(SIGINT, _sigHandler);
     signal(SIGTERM, _sigHandler);
     NOT_WIN( signal(SIGHUP, _sigHandler) );
 
-    const uint32_t tOffs = TIME() - timeOfDay(); // Offset between wall clock and parser time reference
-
-    EPOCH_t coll;
-    EPOCH_t epoch;
-    epochInit(&coll);
+    pthread_t readerThread;
+    if (pthread_create(&readerThread, NULL, _reader, &dump) != 0)
+    {
+        WARNING("Failed creating thread!");
+        queueDestroy(dump.queue);
+        rxClose(rx);
+        free(rx);
+        return EXIT_OTHERFAIL;
+    }
 
+    // Output everything the reader gives us, until the reader is done and the queue is empty
     PRINT("Dumping received data...");
-    while (!gAbort)
+    bool res = true;
+    bool append = false;
+    int nPending = 0;
+    uint32_t nDropped = 0;
+    uint64_t sDropped = 0;
+    while (true)
     {
-        PARSER_MSG_t *msg = rxGetNextMessage(rx);
-        if (msg != NULL)
+        const bool done = __atomic_load_n(&dump.done, __ATOMIC_ACQUIRE);
+        int size = 0;
+        const uint8_t *entry = res ? queuePopBegin(dump.queue, &size) : NULL;
+        if (entry != NULL)
         {
-            const uint32_t latency = (msg->ts - tOffs) % 1000; // Relative to wall clock top of second
-            nMsgs++;
-            sMsgs += msg->size;
-            if (epochCollect(&coll, msg, &epoch))
+            QUEUE_STATS_t qstats;
+            queueGetStats(dump.queue, &qstats);
+            if (qstats.nDropped != nDropped)
             {
-                ioOutputStr("epoch %4u, %s\n", epoch.seq, epoch.str);
-                if (!ioWriteOutput(nMsgs == 1 ? false : true))
-                {
-                    break;
-                }
+                ioOutputStr("overflow: dropped %u messages (%" PRIu64 " bytes)\n",
+                    qstats.nDropped - nDropped, qstats.sDropped - sDropped);
+                nDropped = qstats.nDropped;
+                sDropped = qstats.sDropped;
             }
-            const char *prot = "?";
-            switch (msg->type)
+
+            DUMP_ITEM_t item;
+            memcpy(&item, entry, sizeof(item));
+            const uint8_t *data = &entry[sizeof(item)];
+            if (item.isEpoch)
             {
-                case PARSER_MSGTYPE_UBX:
-                    prot = "UBX";
-                    nUbx++;
-                    sUbx += msg->size;
-                    break;
-                case PARSER_MSGTYPE_NMEA:
-                    prot = "NMEA";
-                    nNmea++;
-                    sNmea += msg->size;
-                    break;
-                case PARSER_MSGTYPE_RTCM3:
-                    prot = "RTMC3";
-                    nRtcm++;
-                    sRtcm += msg->size;
-                    break;
-                case PARSER_MSGTYPE_NOVATEL:
-                    prot = "NOVATEL";
-                    nNova++;
-                    sNova += msg->size;
-                    break;
-                case PARSER_MSGTYPE_GARBAGE:
-                    prot = "GARBAGE";
-                    nGarb++;
-                    sGarb += msg->size;
-                    break;
+                ioOutputStr("epoch %4u, %s\n", item.seq, (const char *)data);
             }
-            ioOutputStr("message %4u, dt %4u, size %4d, %-8s %-20s %s\n",
-                msg->seq, latency, msg->size, prot, msg->name, msg->info != NULL ? msg->info : "n/a");
-            if (extraInfo)
+            else
             {
-                ioAddOutputHexdump(msg->data, msg->size);
+                char info[PARSER_MAX_INFO_SIZE];
+                ioOutputStr("message %4u, dt %4u, size %4d, %-8s %-20s %s\n",
+                    item.seq, item.latency, item.size, parserMsgtypeName(item.type),
+                    item.name, parserMessageInfo(info, sizeof(info), item.type, data, item.size) ? info : "n/a");
+                if (extraInfo)
+                {
+                    ioAddOutputHexdump(data, item.size);
+                }
             }
-            if (!ioWriteOutput(nMsgs == 1 ? false : true))
+            queuePopEnd(dump.queue);
+            nPending++;
+        }
+
+        // Write output in batches, and when there's nothing more to do for now
+        if ( (nPending > 0) && ((entry == NULL) || (nPending >= DUMP_FLUSH_ITEMS)) )
+        {
+            if (!ioWriteOutput(append))
             {
-                break;
+                res = false;
+                __atomic_store_n(&gAbort, true, __ATOMIC_RELAXED);
             }
+            append = true;
+            nPending = 0;
         }
-        // No data, yield
-        else
+
+        if (entry == NULL)
         {
+            if (done || !res)
+            {
+                break;
+            }
             SLEEP(5);
         }
     }
 
-    ioOutputStr("stats UBX      count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nUbx,  nMsgs > 0 ? (double)nUbx  / (double)nMsgs * 1e2 : 0.0, sUbx,  sMsgs > 0 ? (double)sUbx  / (double)sMsgs * 1e2 : 0.0);
-    ioOutputStr("stats NMEA     count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nNmea, nMsgs > 0 ? (double)nNmea / (double)nMsgs * 1e2 : 0.0, sNmea, sMsgs > 0 ? (double)sNmea / (double)sMsgs * 1e2 : 0.0);
-    ioOutputStr("stats RTCM3    count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nRtcm, nMsgs > 0 ? (double)nRtcm / (double)nMsgs * 1e2 : 0.0, sRtcm, sMsgs > 0 ? (double)sRtcm / (double)sMsgs * 1e2 : 0.0);
-    ioOutputStr("stats NOVATEL  count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nUbx,  nMsgs > 0 ? (double)nNova / (double)nMsgs * 1e2 : 0.0, sNova, sMsgs > 0 ? (double)sNova / (double)sMsgs * 1e2 : 0.0);
-    ioOutputStr("stats GARBAGE  count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nGarb, nMsgs > 0 ? (double)nGarb / (double)nMsgs * 1e2 : 0.0, sGarb, sMsgs > 0 ? (double)sGarb / (double)sMsgs * 1e2 : 0.0);
+    __atomic_store_n(&gAbort, true, __ATOMIC_RELAXED);
+    pthread_join(readerThread, NULL);
+
+    QUEUE_STATS_t qstats;
+    queueGetStats(dump.queue, &qstats);
+    queueDestroy(dump.queue);
+
+    const uint32_t nMsgs = dump.nMsgs;
+    const uint32_t sMsgs = dump.sMsgs;
+    ioOutputStr("stats UBX      count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", dump.nUbx,  nMsgs > 0 ? (double)dump.nUbx  / (double)nMsgs * 1e2 : 0.0, dump.sUbx,  sMsgs > 0 ? (double)dump.sUbx  / (double)sMsgs * 1e2 : 0.0);
+    ioOutputStr("stats NMEA     count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", dump.nNmea, nMsgs > 0 ? (double)dump.nNmea / (double)nMsgs * 1e2 : 0.0, dump.sNmea, sMsgs > 0 ? (double)dump.sNmea / (double)sMsgs * 1e2 : 0.0);
+    ioOutputStr("stats RTCM3    count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", dump.nRtcm, nMsgs > 0 ? (double)dump.nRtcm / (double)nMsgs * 1e2 : 0.0, dump.sRtcm, sMsgs > 0 ? (double)dump.sRtcm / (double)sMsgs * 1e2 : 0.0);
+    ioOutputStr("stats NOVATEL  count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", dump.nNova, nMsgs > 0 ? (double)dump.nNova / (double)nMsgs * 1e2 : 0.0, dump.sNova, sMsgs > 0 ? (double)dump.sNova / (double)sMsgs * 1e2 : 0.0);
+    ioOutputStr("stats GARBAGE  count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", dump.nGarb, nMsgs > 0 ? (double)dump.nGarb / (double)nMsgs * 1e2 : 0.0, dump.sGarb, sMsgs > 0 ? (double)dump.sGarb / (double)sMsgs * 1e2 : 0.0);
     ioOutputStr("stats Total    count %6u (100.0%%)  size %10u (100.0%%)\n", nMsgs, sMsgs);
-    bool res = ioWriteOutput(true);
+    ioOutputStr("stats Queue    dropped %u (%" PRIu64 " bytes), max fill %u of %u bytes\n",
+        qstats.nDropped, qstats.sDropped, qstats.maxFill, qstats.size);
+    res = ioWriteOutput(append) && res;
 
     rxClose(rx);
     free(rx);
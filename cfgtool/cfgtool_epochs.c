@@ -0,0 +1,705 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <signal.h>
+#include <math.h>
+
+#include "cfgtool_util.h"
+
+#include "ff_parser.h"
+#include "ff_epoch.h"
+
+#include "cfgtool_epochs.h"
+
+/* ****************************************************************************************************************** */
+
+#define EPOCHS_DEFAULT_FIELDS "seq,gpsWeek,gpsTow,fixStr,fixOk,numSv,lat,lon,height,heightMsl,horizAcc,vertAcc,velN,velE,velD,vel2d,pDOP"
+
+const char *epochsHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'epochs':\n"
+"\n"
+"    Usage: cfgtool epochs [-i <infile>] [-o <outfile>] [-y] [-F <format>]\n"
+"                          [-f <fields>]\n"
+"\n"
+"    This processes data from the input file through the parser and the epoch\n"
+"    collector and outputs the detected navigation epochs in a machine-readable\n"
+"    format. The <format> is one of:\n"
+"\n"
+"        csv      Comma-separated values, with a header line (default)\n"
+"        jsonl    JSON lines, one object per epoch\n"
+"        bin      Fixed-layout little-endian binary records, with a header\n"
+"\n"
+"    The <fields> are a comma-separated list of field names, or 'all' for all\n"
+"    fields. The default is:\n"
+"\n"
+"        " EPOCHS_DEFAULT_FIELDS "\n"
+"\n"
+"    Available fields (and units) are:\n"
+"\n"
+"        seq                                 Epoch sequence number\n"
+"        fix, fixStr, fixOk                  Fix type (EPOCH_FIX_t, string),\n"
+"                                            fix ok flag\n"
+"        numSv                               Number of satellites used\n"
+"        pDOP                                Position DOP\n"
+"        lat, lon, height                    Position [deg, deg, m]\n"
+"        x, y, z                             Position (ECEF) [m]\n"
+"        horizAcc, vertAcc, posAcc           Position accuracy [m]\n"
+"        velN, velE, velD, vel2d, vel3d      Velocity [m/s]\n"
+"        velAcc                              Velocity accuracy [m/s]\n"
+"        relLen, relN, relE, relD            Relative position (RTK) [m]\n"
+"        relAccN, relAccE, relAccD           Relative position accuracy [m]\n"
+"        heightMsl                           Height above mean sea level [m]\n"
+"        hour, minute, second, timeAcc       UTC time [h, min, s, s]\n"
+"        confTime, leapSecKnown              UTC time flags\n"
+"        leapSeconds                         GPS leap seconds [s]\n"
+"        year, month, day, confDate          UTC date, date flag\n"
+"        gpsWeek, gpsTow, gpsTowAcc          GPS time [week, s, s]\n"
+"        numSigUsed, numSigUsed<gnss>        Number of signals used\n"
+"        numSatUsed, numSatUsed<gnss>        Number of satellites used\n"
+"                                            (<gnss>: Gps, Glo, Gal, Bds, Sbas,\n"
+"                                            Qzss)\n"
+"        diffAge                             Age of differential corrections [s]\n"
+"        uptime                              Receiver uptime [s]\n"
+"\n"
+"    Fields that are not available in an epoch, or numbers that are not finite,\n"
+"    are empty (csv) or null (jsonl). In the binary format fields that are not\n"
+"    available have their bit in the valid mask cleared.\n"
+"\n"
+"    The binary format starts with a 16 bytes header: 'UBXEPOCH' (8 bytes),\n"
+"    version (uint16_t, currently 1), number of fields (uint16_t) and record\n"
+"    size (uint32_t). This is followed by a 20 bytes description for each field:\n"
+"    name (16 bytes, nul-padded), type (uint8_t, 1 = bool (uint8_t), 2 = int32_t,\n"
+"    3 = uint32_t, 4 = float, 5 = double, 6 = string (16 bytes, nul-padded)),\n"
+"    size (uint8_t) and offset in the record (uint16_t). Each record starts with\n"
+"    a uint64_t valid mask (bit 0 for the first field, etc.), followed by the\n"
+"    fields. Multi-byte values are little-endian.\n"
+"\n"
+"    Examples:\n"
+"\n"
+"        cfgtool epochs -i log.ubx -o log.csv\n"
+"        cfgtool epochs -i log.ubx -F jsonl -f seq,gpsTow,lat,lon,height\n"
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+typedef enum EPOCHS_TYPE_e
+{
+    EPOCHS_TYPE_BOOL   = 1,
+    EPOCHS_TYPE_INT    = 2,
+    EPOCHS_TYPE_UINT   = 3,
+    EPOCHS_TYPE_FLOAT  = 4,
+    EPOCHS_TYPE_DOUBLE = 5,
+    EPOCHS_TYPE_STR    = 6,
+} EPOCHS_TYPE_t;
+
+typedef enum EPOCHS_FORMAT_e
+{
+    EPOCHS_FORMAT_CSV,
+    EPOCHS_FORMAT_JSONL,
+    EPOCHS_FORMAT_BIN,
+} EPOCHS_FORMAT_t;
+
+typedef struct EPOCHS_FIELD_s
+{
+    const char   *name;
+    EPOCHS_TYPE_t type;
+    int           offs;     // offset of the value in EPOCH_t
+    int           haveOffs; // offset of the have flag in EPOCH_t, -1 if always available
+    double        scale;    // for EPOCHS_TYPE_DOUBLE
+    int           prec;     // number of decimals for EPOCHS_TYPE_FLOAT and EPOCHS_TYPE_DOUBLE
+} EPOCHS_FIELD_t;
+
+#define EPOCHS_BIN_STR_SIZE 16
+#define EPOCHS_BIN_NAME_SIZE 16
+#define EPOCHS_RAD2DEG      57.295779513082320876798154814105
+
+#define _F(_name_, _type_, _field_, _have_, _scale_, _prec_) \
+    { .name = _name_, .type = EPOCHS_TYPE_ ## _type_, .offs = (int)offsetof(EPOCH_t, _field_), \
+      .haveOffs = (int)offsetof(EPOCH_t, _have_), .scale = _scale_, .prec = _prec_ }
+#define _A(_name_, _field_, _ix_, _have_, _scale_, _prec_) \
+    { .name = _name_, .type = EPOCHS_TYPE_DOUBLE, .offs = (int)(offsetof(EPOCH_t, _field_) + ((_ix_) * sizeof(double))), \
+      .haveOffs = (int)offsetof(EPOCH_t, _have_), .scale = _scale_, .prec = _prec_ }
+
+static const EPOCHS_FIELD_t kFields[] =
+{
+    { .name = "seq", .type = EPOCHS_TYPE_UINT, .offs = (int)offsetof(EPOCH_t, seq), .haveOffs = -1 },
+    _F("fix",            INT,    fix,            haveFix,          0.0, 0),
+    _F("fixStr",         STR,    fixStr,         haveFix,          0.0, 0),
+    _F("fixOk",          BOOL,   fixOk,          haveFix,          0.0, 0),
+    _F("numSv",          INT,    numSv,          haveNumSv,        0.0, 0),
+    _F("pDOP",           FLOAT,  pDOP,           havePdop,         0.0, 2),
+    _A("lat",                    llh, 0,         havePos,          EPOCHS_RAD2DEG, 9),
+    _A("lon",                    llh, 1,         havePos,          EPOCHS_RAD2DEG, 9),
+    _A("height",                 llh, 2,         havePos,          1.0, 4),
+    _A("x",                      xyz, 0,         havePos,          1.0, 4),
+    _A("y",                      xyz, 1,         havePos,          1.0, 4),
+    _A("z",                      xyz, 2,         havePos,          1.0, 4),
+    _F("horizAcc",       DOUBLE, horizAcc,       havePos,          1.0, 4),
+    _F("vertAcc",        DOUBLE, vertAcc,        havePos,          1.0, 4),
+    _F("posAcc",         DOUBLE, posAcc,         havePos,          1.0, 4),
+    _A("velN",                   velNed, 0,      haveVel,          1.0, 4),
+    _A("velE",                   velNed, 1,      haveVel,          1.0, 4),
+    _A("velD",                   velNed, 2,      haveVel,          1.0, 4),
+    _F("vel2d",          DOUBLE, vel2d,          haveVel,          1.0, 4),
+    _F("vel3d",          DOUBLE, vel3d,          haveVel,          1.0, 4),
+    _F("velAcc",         DOUBLE, velAcc,         haveVel,          1.0, 4),
+    _F("relLen",         DOUBLE, relLen,         haveRelPos,       1.0, 4),
+    _A("relN",                   relNed, 0,      haveRelPos,       1.0, 4),
+    _A("relE",                   relNed, 1,      haveRelPos,       1.0, 4),
+    _A("relD",                   relNed, 2,      haveRelPos,       1.0, 4),
+    _A("relAccN",                relAcc, 0,      haveRelPos,       1.0, 4),
+    _A("relAccE",                relAcc, 1,      haveRelPos,       1.0, 4),
+    _A("relAccD",                relAcc, 2,      haveRelPos,       1.0, 4),
+    _F("heightMsl",      DOUBLE, heightMsl,      haveMsl,          1.0, 4),
+    _F("hour",           INT,    hour,           haveTime,         0.0, 0),
+    _F("minute",         INT,    minute,         haveTime,         0.0, 0),
+    _F("second",         DOUBLE, second,         haveTime,         1.0, 3),
+    _F("timeAcc",        DOUBLE, timeAcc,        haveTime,         1.0, 9),
+    _F("confTime",       BOOL,   confTime,       haveTime,         0.0, 0),
+    _F("leapSecKnown",   BOOL,   leapSecKnown,   haveTime,         0.0, 0),
+    _F("leapSeconds",    INT,    leapSeconds,    haveLeapSeconds,  0.0, 0),
+    _F("year",           INT,    year,           haveDate,         0.0, 0),
+    _F("month",          INT,    month,          haveDate,         0.0, 0),
+    _F("day",            INT,    day,            haveDate,         0.0, 0),
+    _F("confDate",       BOOL,   confDate,       haveDate,         0.0, 0),
+    _F("gpsWeek",        INT,    gpsWeek,        haveGpsWeek,      0.0, 0),
+    _F("gpsTow",         DOUBLE, gpsTow,         haveGpsTow,       1.0, 3),
+    _F("gpsTowAcc",      DOUBLE, gpsTowAcc,      haveGpsTow,       1.0, 9),
+    _F("numSigUsed",     INT,    numSigUsed,     haveNumSig,       0.0, 0),
+    _F("numSigUsedGps",  INT,    numSigUsedGps,  haveNumSig,       0.0, 0),
+    _F("numSigUsedGlo",  INT,    numSigUsedGlo,  haveNumSig,       0.0, 0),
+    _F("numSigUsedGal",  INT,    numSigUsedGal,  haveNumSig,       0.0, 0),
+    _F("numSigUsedBds",  INT,    numSigUsedBds,  haveNumSig,       0.0, 0),
+    _F("numSigUsedSbas", INT,    numSigUsedSbas, haveNumSig,       0.0, 0),
+    _F("numSigUsedQzss", INT,    numSigUsedQzss, haveNumSig,       0.0, 0),
+    _F("numSatUsed",     INT,    numSatUsed,     haveNumSat,       0.0, 0),
+    _F("numSatUsedGps",  INT,    numSatUsedGps,  haveNumSat,       0.0, 0),
+    _F("numSatUsedGlo",  INT,    numSatUsedGlo,  haveNumSat,       0.0, 0),
+    _F("numSatUsedGal",  INT,    numSatUsedGal,  haveNumSat,       0.0, 0),
+    _F("numSatUsedBds",  INT,    numSatUsedBds,  haveNumSat,       0.0, 0),
+    _F("numSatUsedSbas", INT,    numSatUsedSbas, haveNumSat,       0.0, 0),
+    _F("numSatUsedQzss", INT,    numSatUsedQzss, haveNumSat,       0.0, 0),
+    _F("diffAge",        DOUBLE, diffAge,        haveDiffAge,      1.0, 1),
+    _F("uptime",         DOUBLE, uptime,         haveUptime,       1.0, 3),
+};
+
+#undef _F
+#undef _A
+
+/* ****************************************************************************************************************** */
+
+// Fast number formatting, much faster than snprintf() for the typical values here
+
+static char *_fmtUint(char *str, uint64_t val)
+{
+    char tmp[24];
+    int len = 0;
+    do
+    {
+        tmp[len++] = '0' + (val % 10);
+        val /= 10;
+    }
+    while (val > 0);
+    while (len > 0)
+    {
+        *str++ = tmp[--len];
+    }
+    return str;
+}
+
+static char *_fmtInt(char *str, const int64_t val)
+{
+    if (val < 0)
+    {
+        *str++ = '-';
+        return _fmtUint(str, (uint64_t)(-(val + 1)) + 1);
+    }
+    return _fmtUint(str, (uint64_t)val);
+}
+
+static const uint64_t kPow10[] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
+static char *_fmtFixed(char *str, const double val, const int prec)
+{
+    const double scaled = fabs(val) * (double)kPow10[prec];
+    // Out of range for integer arithmetics, use the slow path
+    if (!(scaled < 1e18))
+    {
+        const int len = snprintf(str, 32, "%.15g", val);
+        return str + CLIP(len, 0, 31);
+    }
+    const uint64_t num = (uint64_t)(scaled + 0.5);
+    if ( (val < 0.0) && (num > 0) )
+    {
+        *str++ = '-';
+    }
+    str = _fmtUint(str, num / kPow10[prec]);
+    if (prec > 0)
+    {
+        *str++ = '.';
+        uint64_t frac = num % kPow10[prec];
+        for (int ix = prec - 1; ix >= 0; ix--)
+        {
+            str[ix] = '0' + (frac % 10);
+            frac /= 10;
+        }
+        str += prec;
+    }
+    return str;
+}
+
+static char *_fmtStr(char *str, const char *val)
+{
+    while (*val != '\0')
+    {
+        *str++ = *val++;
+    }
+    return str;
+}
+
+/* ****************************************************************************************************************** */
+
+static bool _fieldValid(const EPOCHS_FIELD_t *field, const EPOCH_t *epoch)
+{
+    return (field->haveOffs < 0) || *(const bool *)((const uint8_t *)epoch + field->haveOffs);
+}
+
+// Format field for CSV or JSON, non-finite numbers are not available (empty resp. null)
+static char *_fmtField(char *str, const EPOCHS_FIELD_t *field, const EPOCH_t *epoch, const bool json)
+{
+    const void *ptr = (const uint8_t *)epoch + field->offs;
+    switch (field->type)
+    {
+        case EPOCHS_TYPE_BOOL:
+            *str++ = *(const bool *)ptr ? '1' : '0';
+            break;
+        case EPOCHS_TYPE_INT:
+            str = _fmtInt(str, *(const int *)ptr);
+            break;
+        case EPOCHS_TYPE_UINT:
+            str = _fmtUint(str, *(const uint32_t *)ptr);
+            break;
+        case EPOCHS_TYPE_FLOAT:
+        case EPOCHS_TYPE_DOUBLE:
+        {
+            const double val = field->type == EPOCHS_TYPE_FLOAT ?
+                *(const float *)ptr : *(const double *)ptr * field->scale;
+            if (isfinite(val))
+            {
+                str = _fmtFixed(str, val, field->prec);
+            }
+            else if (json)
+            {
+                str = _fmtStr(str, "null");
+            }
+            break;
+        }
+        case EPOCHS_TYPE_STR:
+        {
+            const char *val = *(const char * const *)ptr;
+            if (json)
+            {
+                *str++ = '"';
+            }
+            str = _fmtStr(str, val != NULL ? val : "");
+            if (json)
+            {
+                *str++ = '"';
+            }
+            break;
+        }
+    }
+    return str;
+}
+
+static int _binFieldSize(const EPOCHS_FIELD_t *field)
+{
+    switch (field->type)
+    {
+        case EPOCHS_TYPE_BOOL:   return sizeof(uint8_t);
+        case EPOCHS_TYPE_INT:    return sizeof(int32_t);
+        case EPOCHS_TYPE_UINT:   return sizeof(uint32_t);
+        case EPOCHS_TYPE_FLOAT:  return sizeof(float);
+        case EPOCHS_TYPE_DOUBLE: return sizeof(double);
+        case EPOCHS_TYPE_STR:    return EPOCHS_BIN_STR_SIZE;
+    }
+    return 0;
+}
+
+static uint8_t *_binField(uint8_t *data, const EPOCHS_FIELD_t *field, const EPOCH_t *epoch, const bool valid)
+{
+    const int size = _binFieldSize(field);
+    memset(data, 0, size);
+    if (valid)
+    {
+        const void *ptr = (const uint8_t *)epoch + field->offs;
+        switch (field->type)
+        {
+            case EPOCHS_TYPE_BOOL:
+            {
+                const uint8_t val = *(const bool *)ptr ? 1 : 0;
+                memcpy(data, &val, sizeof(val));
+                break;
+            }
+            case EPOCHS_TYPE_INT:
+            {
+                const int32_t val = *(const int *)ptr;
+                memcpy(data, &val, sizeof(val));
+                break;
+            }
+            case EPOCHS_TYPE_UINT:
+            case EPOCHS_TYPE_FLOAT:
+                memcpy(data, ptr, size);
+                break;
+            case EPOCHS_TYPE_DOUBLE:
+            {
+                const double val = *(const double *)ptr * field->scale;
+                memcpy(data, &val, sizeof(val));
+                break;
+            }
+            case EPOCHS_TYPE_STR:
+            {
+                const char *val = *(const char * const *)ptr;
+                if (val != NULL)
+                {
+                    strncpy((char *)data, val, EPOCHS_BIN_STR_SIZE - 1);
+                }
+                break;
+            }
+        }
+    }
+    return data + size;
+}
+
+/* ****************************************************************************************************************** */
+
+// Output is formatted into this buffer, which is passed on to ioWriteOutput() in large chunks
+static uint8_t gBuf[512 * 1024];
+static int gBufSize;
+static bool gBufAppend;
+#define EPOCHS_MAX_RECORD_SIZE (NUMOF(kFields) * 50)
+
+static bool _flush(void)
+{
+    if (gBufSize == 0)
+    {
+        return true;
+    }
+    ioAddOutputBin(gBuf, gBufSize);
+    gBufSize = 0;
+    const bool res = ioWriteOutput(gBufAppend);
+    gBufAppend = true;
+    return res;
+}
+
+static bool _parseFields(const char *fieldsArg, const EPOCHS_FIELD_t **fields, int *nFields)
+{
+    *nFields = 0;
+    if (strcmp(fieldsArg, "all") == 0)
+    {
+        for (int ix = 0; ix < NUMOF(kFields); ix++)
+        {
+            fields[(*nFields)++] = &kFields[ix];
+        }
+        return true;
+    }
+    char tmp[1000];
+    snprintf(tmp, sizeof(tmp), "%s", fieldsArg);
+    char *save = NULL;
+    for (const char *name = strtok_r(tmp, ",", &save); name != NULL; name = strtok_r(NULL, ",", &save))
+    {
+        const EPOCHS_FIELD_t *field = NULL;
+        for (int ix = 0; ix < NUMOF(kFields); ix++)
+        {
+            if (strcmp(kFields[ix].name, name) == 0)
+            {
+                field = &kFields[ix];
+                break;
+            }
+        }
+        if (field == NULL)
+        {
+            WARNING("Unknown field '%s'!", name);
+            return false;
+        }
+        if (*nFields >= NUMOF(kFields))
+        {
+            WARNING("Too many fields!");
+            return false;
+        }
+        fields[(*nFields)++] = field;
+    }
+    if (*nFields == 0)
+    {
+        WARNING("No fields!");
+        return false;
+    }
+    return true;
+}
+
+static void _header(const EPOCHS_FORMAT_t format, const EPOCHS_FIELD_t **fields, const int nFields)
+{
+    switch (format)
+    {
+        case EPOCHS_FORMAT_CSV:
+        {
+            char *str = (char *)&gBuf[gBufSize];
+            for (int ix = 0; ix < nFields; ix++)
+            {
+                if (ix > 0)
+                {
+                    *str++ = ',';
+                }
+                str = _fmtStr(str, fields[ix]->name);
+            }
+            *str++ = '\n';
+            gBufSize = (uint8_t *)str - gBuf;
+            break;
+        }
+        case EPOCHS_FORMAT_JSONL:
+            break;
+        case EPOCHS_FORMAT_BIN:
+        {
+            uint8_t *data = &gBuf[gBufSize];
+            int recSize = sizeof(uint64_t);
+            for (int ix = 0; ix < nFields; ix++)
+            {
+                recSize += _binFieldSize(fields[ix]);
+            }
+            const uint16_t version = 1;
+            const uint16_t num = nFields;
+            const uint32_t size = recSize;
+            memcpy(&data[0], "UBXEPOCH", 8);
+            memcpy(&data[8], &version, sizeof(version));
+            memcpy(&data[10], &num, sizeof(num));
+            memcpy(&data[12], &size, sizeof(size));
+            data += 16;
+            uint16_t offs = sizeof(uint64_t);
+            for (int ix = 0; ix < nFields; ix++)
+            {
+                memset(data, 0, EPOCHS_BIN_NAME_SIZE);
+                strncpy((char *)data, fields[ix]->name, EPOCHS_BIN_NAME_SIZE - 1);
+                data[EPOCHS_BIN_NAME_SIZE + 0] = fields[ix]->type;
+                data[EPOCHS_BIN_NAME_SIZE + 1] = _binFieldSize(fields[ix]);
+                memcpy(&data[EPOCHS_BIN_NAME_SIZE + 2], &offs, sizeof(offs));
+                offs += _binFieldSize(fields[ix]);
+                data += EPOCHS_BIN_NAME_SIZE + 4;
+            }
+            gBufSize = data - gBuf;
+            break;
+        }
+    }
+}
+
+static void _record(const EPOCHS_FORMAT_t format, const EPOCHS_FIELD_t **fields, const int nFields, const EPOCH_t *epoch)
+{
+    switch (format)
+    {
+        case EPOCHS_FORMAT_CSV:
+        {
+            char *str = (char *)&gBuf[gBufSize];
+            for (int ix = 0; ix < nFields; ix++)
+            {
+                if (ix > 0)
+                {
+                    *str++ = ',';
+                }
+                if (_fieldValid(fields[ix], epoch))
+                {
+                    str = _fmtField(str, fields[ix], epoch, false);
+                }
+            }
+            *str++ = '\n';
+            gBufSize = (uint8_t *)str - gBuf;
+            break;
+        }
+        case EPOCHS_FORMAT_JSONL:
+        {
+            char *str = (char *)&gBuf[gBufSize];
+            *str++ = '{';
+            for (int ix = 0; ix < nFields; ix++)
+            {
+                if (ix > 0)
+                {
+                    *str++ = ',';
+                }
+                *str++ = '"';
+                str = _fmtStr(str, fields[ix]->name);
+                *str++ = '"';
+                *str++ = ':';
+                if (!_fieldValid(fields[ix], epoch))
+                {
+                    str = _fmtStr(str, "null");
+                }
+                else if (fields[ix]->type == EPOCHS_TYPE_BOOL)
+                {
+                    str = _fmtStr(str, *(const bool *)((const uint8_t *)epoch + fields[ix]->offs) ? "true" : "false");
+                }
+                else
+                {
+                    str = _fmtField(str, fields[ix], epoch, true);
+                }
+            }
+            *str++ = '}';
+            *str++ = '\n';
+            gBufSize = (uint8_t *)str - gBuf;
+            break;
+        }
+        case EPOCHS_FORMAT_BIN:
+        {
+            uint8_t *data = &gBuf[gBufSize];
+            uint64_t mask = 0;
+            uint8_t *p = data + sizeof(mask);
+            for (int ix = 0; ix < nFields; ix++)
+            {
+                const bool valid = _fieldValid(fields[ix], epoch);
+                if (valid)
+                {
+                    mask |= (uint64_t)1 << ix;
+                }
+                p = _binField(p, fields[ix], epoch, valid);
+            }
+            memcpy(data, &mask, sizeof(mask));
+            gBufSize = p - gBuf;
+            break;
+        }
+    }
+}
+
+/* ****************************************************************************************************************** */
+
+static bool gAbort;
+
+static void _sigHandler(int signal)
+{
+    if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
+    {
+        PRINT("Aborting...");
+        gAbort = true;
+    }
+}
+
+int epochsRun(const char *formatArg, const char *fieldsArg)
+{
+    EPOCHS_FORMAT_t format = EPOCHS_FORMAT_CSV;
+    if ( (formatArg == NULL) || (strcmp(formatArg, "csv") == 0) )
+    {
+        format = EPOCHS_FORMAT_CSV;
+    }
+    else if (strcmp(formatArg, "jsonl") == 0)
+    {
+        format = EPOCHS_FORMAT_JSONL;
+    }
+    else if (strcmp(formatArg, "bin") == 0)
+    {
+        format = EPOCHS_FORMAT_BIN;
+    }
+    else
+    {
+        WARNING("Illegal format '%s'!", formatArg);
+        return EXIT_BADARGS;
+    }
+
+    const EPOCHS_FIELD_t *fields[NUMOF(kFields)];
+    int nFields = 0;
+    if (!_parseFields(fieldsArg != NULL ? fieldsArg : EPOCHS_DEFAULT_FIELDS, fields, &nFields))
+    {
+        return EXIT_BADARGS;
+    }
+    // Valid mask in the binary records
+    if (nFields > 64)
+    {
+        WARNING("Too many fields!");
+        return EXIT_BADARGS;
+    }
+
+    gAbort = false;
+    signal(SIGINT, _sigHandler);
+    signal(SIGTERM, _sigHandler);
+    NOT_WIN( signal(SIGHUP, _sigHandler) );
+
+    static PARSER_t parser;
+    parserInit(&parser);
+
+    static EPOCH_t coll;
+    static EPOCH_t epoch;
+    epochInit(&coll);
+
+    gBufSize = 0;
+    gBufAppend = false;
+    _header(format, fields, nFields);
+
+    bool res = true;
+    uint32_t nEpochs = 0;
+    while (res && !gAbort)
+    {
+        uint8_t buf[64 * 1024];
+        const int num = ioReadInput(buf, sizeof(buf));
+        if (num < 0) // eof
+        {
+            break;
+        }
+        else if (num == 0) // wait
+        {
+            SLEEP(5);
+            continue;
+        }
+
+        for (int offs = 0; offs < num; offs += PARSER_BUF_SIZE / 2)
+        {
+            parserAdd(&parser, &buf[offs], MIN(num - offs, PARSER_BUF_SIZE / 2));
+            PARSER_MSG_t msg;
+            while (parserProcess(&parser, &msg, false))
+            {
+                if (epochCollect(&coll, &msg, &epoch))
+                {
+                    nEpochs++;
+                    _record(format, fields, nFields, &epoch);
+                    if (gBufSize > (int)(sizeof(gBuf) - EPOCHS_MAX_RECORD_SIZE))
+                    {
+                        res = _flush();
+                    }
+                }
+            }
+        }
+    }
+
+    if (res)
+    {
+        res = _flush();
+    }
+    // Make sure the output file is created even if there are no epochs (binary format, no fields in jsonl)
+    if (res && !gBufAppend)
+    {
+        res = ioWriteOutput(false);
+    }
+    PRINT("Exported %u epochs", nEpochs);
+
+    return res ? EXIT_SUCCESS : EXIT_OTHERFAIL;
+}
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,687 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <signal.h>
+#include <inttypes.h>
+#include <math.h>
+#include <unistd.h>
+
+#include "cfgtool_util.h"
+
+#include "ff_parser.h"
+#include "ff_epoch.h"
+#include "ff_logindex.h"
+
+#include "cfgtool_extract.h"
+
+/* ****************************************************************************************************************** */
+
+const char *extractHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'extract':\n"
+"\n"
+"    Usage: cfgtool extract [-i <infile>] [-o <outfile>] [-y] [-f <filter>]\n"
+"                           [-t <from>,<to>] [-E <from>,<to>]\n"
+"\n"
+"    This processes data from the input file through the parser and writes the\n"
+"    raw message frames that pass all given filters to the output file:\n"
+"\n"
+"        -f <filter>  Comma-separated list of message names, where a name\n"
+"                     matches itself and all messages starting with the name\n"
+"                     followed by a '-', and '*' and '?' are wildcards. For\n"
+"                     example, 'UBX-NAV-PVT,RTCM3' or 'NMEA-G?-GGA,UBX-*-SAT'.\n"
+"        -t <from>,<to>  GPS time window (inclusive) of the epochs, where\n"
+"                     <from> and <to> are both either GPS time of week [s],\n"
+"                     <week>:<tow> or GPS time of day <hh>:<mm>:<ss>. Either\n"
+"                     can be omitted for an open interval.\n"
+"        -E <from>,<to>  Epoch sequence number range (inclusive). Either can\n"
+"                     be omitted for an open interval.\n"
+"\n"
+"    Messages are assigned to epochs as detected by 'parse -e'. With -t or -E\n"
+"    messages that do not belong to an epoch are not output.\n"
+"\n"
+"    If an index exists for the input file (see the 'index' command), it is\n"
+"    used to skip directly to the wanted epochs and messages.\n"
+"\n"
+"    Example:\n"
+"\n"
+"        cfgtool extract -i day.ubx -o out.ubx -f UBX-NAV-PVT,RTCM3 \\\n"
+"            -t 10:00:00,10:05:00\n"
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+#define EXTRACT_MAX_FILTERS   50
+#define EXTRACT_WEEK_MS       (7 * 86400 * 1000)
+#define EXTRACT_DAY_MS        (86400 * 1000)
+#define EXTRACT_FLUSH_SIZE    (512 * 1024)  // Write output when this much data has accumulated
+#define EXTRACT_PENDING_SIZE  (1024 * 1024) // Maximum size of messages waiting for their epoch
+#define EXTRACT_MAX_PENDING   10000         // Maximum number of messages waiting for their epoch
+
+typedef enum TIME_TYPE_e
+{
+    TIME_TYPE_NONE, TIME_TYPE_TOW, TIME_TYPE_GPS, TIME_TYPE_TOD
+} TIME_TYPE_t;
+
+typedef struct EXTRACT_s
+{
+    // Filters
+    char         filterStr[1000];
+    const char  *filters[EXTRACT_MAX_FILTERS];
+    int          nFilters;
+    TIME_TYPE_t  timeType;
+    bool         haveTimeFrom;
+    bool         haveTimeTo;
+    int64_t      timeFrom;  // [ms]
+    int64_t      timeTo;    // [ms]
+    bool         haveEpoch;
+    uint32_t     epochFrom;
+    uint32_t     epochTo;
+    // Output
+    bool         first;
+    int          outSize;
+    uint32_t     nOut;
+    uint64_t     sOut;
+    bool         fail;
+} EXTRACT_t;
+
+static bool gAbort;
+
+static void _sigHandler(int signal)
+{
+    if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
+    {
+        PRINT("Aborting...");
+        gAbort = true;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _parseTime(const char *str, TIME_TYPE_t *type, int64_t *ms)
+{
+    int n = 0;
+    int week = 0;
+    int hour = 0;
+    int min = 0;
+    double sec = 0.0;
+    const int len = strlen(str);
+    if ( (sscanf(str, "%d:%d:%lf%n", &hour, &min, &sec, &n) == 3) && (n == len) &&
+         (hour >= 0) && (hour < 24) && (min >= 0) && (min < 60) && (sec >= 0.0) && (sec < 61.0) )
+    {
+        *type = TIME_TYPE_TOD;
+        *ms = (int64_t)floor(((hour * 3600 + min * 60 + sec) * 1e3) + 0.5);
+        return true;
+    }
+    if ( (sscanf(str, "%d:%lf%n", &week, &sec, &n) == 2) && (n == len) &&
+         (week >= 0) && (week < 65536) && (sec >= 0.0) && (sec < (double)(EXTRACT_WEEK_MS / 1000)) )
+    {
+        *type = TIME_TYPE_GPS;
+        *ms = ((int64_t)week * EXTRACT_WEEK_MS) + (int64_t)floor((sec * 1e3) + 0.5);
+        return true;
+    }
+    if ( (sscanf(str, "%lf%n", &sec, &n) == 1) && (n == len) &&
+         (sec >= 0.0) && (sec < (double)(EXTRACT_WEEK_MS / 1000)) )
+    {
+        *type = TIME_TYPE_TOW;
+        *ms = (int64_t)floor((sec * 1e3) + 0.5);
+        return true;
+    }
+    return false;
+}
+
+// Split "<from>,<to>" where either may be empty
+static bool _splitRange(const char *str, char *from, char *to, const int size)
+{
+    const char *comma = strchr(str, ',');
+    if ( (comma == NULL) || (strchr(comma + 1, ',') != NULL) || ((comma - str) >= size) ||
+         (snprintf(to, size, "%s", comma + 1) >= size) )
+    {
+        return false;
+    }
+    memcpy(from, str, comma - str);
+    from[comma - str] = '\0';
+    return true;
+}
+
+static bool _parseArgs(EXTRACT_t *extract, const char *filter, const char *timeRange, const char *epochRange)
+{
+    if (filter != NULL)
+    {
+        if (snprintf(extract->filterStr, sizeof(extract->filterStr), "%s", filter) >= (int)sizeof(extract->filterStr))
+        {
+            WARNING("Illegal argument '-f %s'!", filter);
+            return false;
+        }
+        char *save = NULL;
+        char *tok = strtok_r(extract->filterStr, ",", &save);
+        while (tok != NULL)
+        {
+            if (extract->nFilters >= EXTRACT_MAX_FILTERS)
+            {
+                WARNING("Too many filters in '-f %s'!", filter);
+                return false;
+            }
+            extract->filters[extract->nFilters++] = tok;
+            tok = strtok_r(NULL, ",", &save);
+        }
+        if (extract->nFilters == 0)
+        {
+            WARNING("Illegal argument '-f %s'!", filter);
+            return false;
+        }
+    }
+
+    char from[100];
+    char to[100];
+    if (timeRange != NULL)
+    {
+        TIME_TYPE_t typeFrom = TIME_TYPE_NONE;
+        TIME_TYPE_t typeTo = TIME_TYPE_NONE;
+        if ( !_splitRange(timeRange, from, to, sizeof(from)) ||
+             ( (from[0] != '\0') && !_parseTime(from, &typeFrom, &extract->timeFrom) ) ||
+             ( (to[0] != '\0') && !_parseTime(to, &typeTo, &extract->timeTo) ) ||
+             ( (typeFrom == TIME_TYPE_NONE) && (typeTo == TIME_TYPE_NONE) ) ||
+             ( (typeFrom != TIME_TYPE_NONE) && (typeTo != TIME_TYPE_NONE) && (typeFrom != typeTo) ) )
+        {
+            WARNING("Illegal argument '-t %s'!", timeRange);
+            return false;
+        }
+        extract->haveTimeFrom = (typeFrom != TIME_TYPE_NONE);
+        extract->haveTimeTo   = (typeTo   != TIME_TYPE_NONE);
+        extract->timeType     = extract->haveTimeFrom ? typeFrom : typeTo;
+        if ( (extract->timeType != TIME_TYPE_TOD) && extract->haveTimeFrom && extract->haveTimeTo &&
+             (extract->timeFrom > extract->timeTo) )
+        {
+            WARNING("Illegal argument '-t %s'!", timeRange);
+            return false;
+        }
+    }
+
+    if (epochRange != NULL)
+    {
+        int n = 0;
+        extract->epochFrom = 0;
+        extract->epochTo = UINT32_MAX;
+        if ( !_splitRange(epochRange, from, to, sizeof(from)) ||
+             ( (from[0] != '\0') && ((sscanf(from, "%" SCNu32 "%n", &extract->epochFrom, &n) != 1) || (n != (int)strlen(from))) ) ||
+             ( (to[0]   != '\0') && ((sscanf(to,   "%" SCNu32 "%n", &extract->epochTo,   &n) != 1) || (n != (int)strlen(to))) ) ||
+             ( (from[0] == '\0') && (to[0] == '\0') ) || (extract->epochFrom > extract->epochTo) )
+        {
+            WARNING("Illegal argument '-E %s'!", epochRange);
+            return false;
+        }
+        extract->haveEpoch = true;
+    }
+
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Simple glob, '*' matches any number of characters, '?' matches one character
+static bool _glob(const char *pattern, const char *str)
+{
+    const char *starP = NULL;
+    const char *starS = NULL;
+    while (*str != '\0')
+    {
+        if ( (*pattern == '?') || (*pattern == *str) )
+        {
+            pattern++;
+            str++;
+        }
+        else if (*pattern == '*')
+        {
+            starP = pattern++;
+            starS = str;
+        }
+        else if (starP != NULL)
+        {
+            pattern = starP + 1;
+            str = ++starS;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    while (*pattern == '*')
+    {
+        pattern++;
+    }
+    return *pattern == '\0';
+}
+
+static bool _nameMatches(const EXTRACT_t *extract, const char *name)
+{
+    if (extract->nFilters == 0)
+    {
+        return true;
+    }
+    for (int ix = 0; ix < extract->nFilters; ix++)
+    {
+        // Same as the filters of the 'serve' command, e.g. "UBX-NAV" matches "UBX-NAV-PVT"
+        const char *filter = extract->filters[ix];
+        const int len = strlen(filter);
+        if ( (strncmp(name, filter, len) == 0) && ((name[len] == '\0') || (name[len] == '-')) )
+        {
+            return true;
+        }
+        if ( (strpbrk(filter, "*?") != NULL) && _glob(filter, name) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool _haveEpochFilter(const EXTRACT_t *extract)
+{
+    return extract->haveEpoch || (extract->timeType != TIME_TYPE_NONE);
+}
+
+// Check if epoch matches the filters, sets *past if the epoch is after the wanted window
+static bool _epochMatches(const EXTRACT_t *extract, const uint32_t seq,
+    const bool haveWeek, const int week, const bool haveTow, const uint32_t towMs, bool *past)
+{
+    *past = false;
+    if (extract->haveEpoch)
+    {
+        if (seq > extract->epochTo)
+        {
+            *past = true;
+            return false;
+        }
+        if (seq < extract->epochFrom)
+        {
+            return false;
+        }
+    }
+
+    int64_t t = 0;
+    switch (extract->timeType)
+    {
+        case TIME_TYPE_NONE:
+            return true;
+        case TIME_TYPE_TOW:
+            if (!haveTow)
+            {
+                return false;
+            }
+            t = towMs;
+            break;
+        case TIME_TYPE_GPS:
+            if (!haveWeek || !haveTow)
+            {
+                return false;
+            }
+            t = ((int64_t)week * EXTRACT_WEEK_MS) + towMs;
+            if (extract->haveTimeTo && (t > extract->timeTo))
+            {
+                *past = true;
+                return false;
+            }
+            break;
+        case TIME_TYPE_TOD:
+            if (!haveTow)
+            {
+                return false;
+            }
+            t = towMs % EXTRACT_DAY_MS;
+            // Window across midnight
+            if (extract->haveTimeFrom && extract->haveTimeTo && (extract->timeFrom > extract->timeTo))
+            {
+                return (t >= extract->timeFrom) || (t <= extract->timeTo);
+            }
+            break;
+    }
+    return (!extract->haveTimeFrom || (t >= extract->timeFrom)) && (!extract->haveTimeTo || (t <= extract->timeTo));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _output(EXTRACT_t *extract, const uint8_t *data, const int size)
+{
+    ioAddOutputBin(data, size);
+    extract->outSize += size;
+    extract->nOut++;
+    extract->sOut += size;
+    if (extract->outSize >= EXTRACT_FLUSH_SIZE)
+    {
+        if (!ioWriteOutput(!extract->first))
+        {
+            extract->fail = true;
+        }
+        extract->first = false;
+        extract->outSize = 0;
+    }
+}
+
+// Check if the index has the time needed for the time filter
+static bool _indexHasTime(const EXTRACT_t *extract, const LOG_INDEX_t *idx)
+{
+    if (extract->timeType == TIME_TYPE_NONE)
+    {
+        return true;
+    }
+    const uint8_t flag = extract->timeType == TIME_TYPE_GPS ? LOG_INDEX_FLAG_TIME : LOG_INDEX_FLAG_TOW;
+    for (uint32_t ix = 0; ix < idx->nEpochs; ix++)
+    {
+        if ((idx->epochs[ix].flags & flag) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Extract using the index: go through the (wanted) epochs and read the matching messages from the logfile
+static void _extractIndex(EXTRACT_t *extract, LOG_INDEX_t *idx)
+{
+    bool *nameMatch = malloc((idx->nNames + 1) * sizeof(bool));
+    LOG_INDEX_MSG_t *msgs = malloc(1000 * sizeof(LOG_INDEX_MSG_t));
+    if ( (nameMatch == NULL) || (msgs == NULL) )
+    {
+        WARNING("malloc fail!");
+        extract->fail = true;
+        free(nameMatch);
+        free(msgs);
+        return;
+    }
+    for (int ix = 0; ix < idx->nNames; ix++)
+    {
+        nameMatch[ix] = _nameMatches(extract, idx->names[ix]);
+    }
+
+    // Without epoch filters process all messages as one range, otherwise process the wanted epochs' messages
+    uint32_t epochIx = 0;
+    if (extract->haveEpoch)
+    {
+        for (epochIx = 0; (epochIx < idx->nEpochs) && (idx->epochs[epochIx].epoch < extract->epochFrom); epochIx++) { }
+    }
+    else if ( (extract->timeType == TIME_TYPE_GPS) && extract->haveTimeFrom )
+    {
+        const int ix = logIndexFindTime(idx, extract->timeFrom / EXTRACT_WEEK_MS, extract->timeFrom % EXTRACT_WEEK_MS);
+        epochIx = ix >= 0 ? (uint32_t)ix : idx->nEpochs;
+    }
+    else if ( (extract->timeType == TIME_TYPE_TOW) && extract->haveTimeFrom )
+    {
+        const int ix = logIndexFindTime(idx, -1, extract->timeFrom);
+        epochIx = ix >= 0 ? (uint32_t)ix : idx->nEpochs;
+    }
+    const bool byEpoch = _haveEpochFilter(extract);
+    uint64_t pos = UINT64_MAX;
+    uint8_t data[PARSER_MAX_ANY_SIZE];
+    while (!gAbort && !extract->fail)
+    {
+        uint32_t msgIx;
+        uint32_t endIx;
+        uint32_t epoch = 0;
+        if (byEpoch)
+        {
+            if (epochIx >= idx->nEpochs)
+            {
+                break;
+            }
+            const LOG_INDEX_EPOCH_t *e = &idx->epochs[epochIx];
+            const bool haveWeek = (e->flags & LOG_INDEX_FLAG_TIME) != 0;
+            const bool haveTow  = (e->flags & LOG_INDEX_FLAG_TOW) != 0;
+            bool past = false;
+            const bool match = _epochMatches(extract, e->epoch, haveWeek, e->gpsWeek, haveTow, e->gpsTowMs, &past);
+            if (past)
+            {
+                break;
+            }
+            epochIx++;
+            if (!match)
+            {
+                continue;
+            }
+            msgIx = e->msgIx;
+            endIx = epochIx < idx->nEpochs ? idx->epochs[epochIx].msgIx : idx->nMsgs;
+            epoch = e->epoch;
+        }
+        else
+        {
+            msgIx = 0;
+            endIx = idx->nMsgs;
+        }
+
+        while (!gAbort && !extract->fail && (msgIx < endIx))
+        {
+            const int nMsgs = logIndexGetMsgs(idx, msgIx, msgs, (endIx - msgIx) < 1000 ? (endIx - msgIx) : 1000);
+            if (nMsgs <= 0)
+            {
+                WARNING("Failed reading index!");
+                extract->fail = true;
+                break;
+            }
+            msgIx += nMsgs;
+            for (int ix = 0; ix < nMsgs; ix++)
+            {
+                const LOG_INDEX_MSG_t *msg = &msgs[ix];
+                if ( (byEpoch && (msg->epoch != epoch)) ||
+                     ( (msg->nameIx < idx->nNames) ? !nameMatch[msg->nameIx] : (extract->nFilters > 0) ) ||
+                     (msg->size > sizeof(data)) )
+                {
+                    continue;
+                }
+                if ( (pos != msg->offset) && !ioSeekInput(msg->offset) )
+                {
+                    WARNING("Failed seeking input!");
+                    extract->fail = true;
+                    break;
+                }
+                if (ioReadInput(data, msg->size) != msg->size)
+                {
+                    WARNING("Failed reading input!");
+                    extract->fail = true;
+                    break;
+                }
+                pos = msg->offset + msg->size;
+                _output(extract, data, msg->size);
+            }
+        }
+
+        if (!byEpoch)
+        {
+            break;
+        }
+    }
+
+    free(nameMatch);
+    free(msgs);
+}
+
+// Messages waiting for their epoch
+typedef struct PENDING_s
+{
+    uint8_t  data[EXTRACT_PENDING_SIZE];
+    int      size;
+    int      offs[EXTRACT_MAX_PENDING];
+    int      sizes[EXTRACT_MAX_PENDING];
+    int      num;
+} PENDING_t;
+
+static void _pendingFlush(EXTRACT_t *extract, PENDING_t *pending, const bool output)
+{
+    for (int ix = 0; output && (ix < pending->num); ix++)
+    {
+        _output(extract, &pending->data[ pending->offs[ix] ], pending->sizes[ix]);
+    }
+    pending->num = 0;
+    pending->size = 0;
+}
+
+// Extract without index: parse everything
+static void _extractStream(EXTRACT_t *extract)
+{
+    PARSER_t parser;
+    parserInit(&parser);
+
+    EPOCH_t coll;
+    EPOCH_t epoch;
+    epochInit(&coll);
+
+    PENDING_t *pending = calloc(1, sizeof(PENDING_t));
+    if (pending == NULL)
+    {
+        WARNING("malloc fail!");
+        extract->fail = true;
+        return;
+    }
+
+    const bool byEpoch = _haveEpochFilter(extract);
+    bool past = false;
+    while (!gAbort && !extract->fail && !past)
+    {
+        uint8_t buf[8192];
+        const int num = ioReadInput(buf, sizeof(buf));
+        if (num < 0) // eof
+        {
+            break;
+        }
+        else if (num == 0) // wait
+        {
+            SLEEP(5);
+            continue;
+        }
+        parserAdd(&parser, buf, num);
+
+        PARSER_MSG_t msg;
+        while (!extract->fail && !past && parserProcess(&parser, &msg, false))
+        {
+            if (!byEpoch)
+            {
+                if (_nameMatches(extract, msg.name))
+                {
+                    _output(extract, msg.data, msg.size);
+                }
+                continue;
+            }
+
+            // An epoch is complete either because this message ends it (UBX-NAV-EOE), or because this message
+            // already belongs to the next epoch (see also logIndexAdd())
+            const bool haveEpoch = epochCollect(&coll, &msg, &epoch);
+            const bool endOfEpoch = haveEpoch && (msg.type == PARSER_MSGTYPE_UBX) && (strcmp(msg.name, "UBX-NAV-EOE") == 0);
+            bool match = false;
+            if (haveEpoch)
+            {
+                match = _epochMatches(extract, epoch.seq, epoch.haveGpsWeek, epoch.gpsWeek, epoch.haveGpsTow,
+                    (uint32_t)floor((epoch.gpsTow * 1e3) + 0.5), &past);
+                if (!endOfEpoch)
+                {
+                    _pendingFlush(extract, pending, match);
+                }
+            }
+
+            // Messages that do not belong to any epoch are dropped
+            if ( (pending->num >= EXTRACT_MAX_PENDING) || ((pending->size + msg.size) > EXTRACT_PENDING_SIZE) )
+            {
+                _pendingFlush(extract, pending, false);
+            }
+            if (_nameMatches(extract, msg.name))
+            {
+                memcpy(&pending->data[pending->size], msg.data, msg.size);
+                pending->offs[pending->num] = pending->size;
+                pending->sizes[pending->num] = msg.size;
+                pending->size += msg.size;
+                pending->num++;
+            }
+
+            if (endOfEpoch)
+            {
+                _pendingFlush(extract, pending, match);
+            }
+        }
+    }
+
+    free(pending);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int extractRun(const char *inName, const char *filter, const char *timeRange, const char *epochRange)
+{
+    EXTRACT_t extract;
+    memset(&extract, 0, sizeof(extract));
+    if (!_parseArgs(&extract, filter, timeRange, epochRange))
+    {
+        return EXIT_BADARGS;
+    }
+    extract.first = true;
+
+    gAbort = false;
+    signal(SIGINT, _sigHandler);
+    signal(SIGTERM, _sigHandler);
+    NOT_WIN( signal(SIGHUP, _sigHandler) );
+
+    // Use index if there is one
+    LOG_INDEX_t *idx = NULL;
+    if ( (inName != NULL) && (strcmp(inName, "-") != 0) )
+    {
+        char idxFile[1000];
+        snprintf(idxFile, sizeof(idxFile), "%s.idx", inName);
+        if (access(idxFile, F_OK) == 0)
+        {
+            idx = logIndexOpen(idxFile, inName);
+            // No epoch in the index has the time the filter needs, process the logfile instead
+            if ( (idx != NULL) && !_indexHasTime(&extract, idx) )
+            {
+                PRINT("Not using index '%s', it has no %s.", idxFile,
+                    extract.timeType == TIME_TYPE_GPS ? "GPS week and time" : "GPS time of week");
+                logIndexClose(idx);
+                idx = NULL;
+            }
+            else if (idx != NULL)
+            {
+                PRINT("Using index '%s'.", idxFile);
+            }
+            else
+            {
+                WARNING("Not using index '%s'. Re-create it using the 'index' command.", idxFile);
+            }
+        }
+    }
+
+    if (idx != NULL)
+    {
+        _extractIndex(&extract, idx);
+        logIndexClose(idx);
+    }
+    else
+    {
+        _extractStream(&extract);
+    }
+
+    if (!extract.fail && !ioWriteOutput(!extract.first))
+    {
+        extract.fail = true;
+    }
+    PRINT("Extracted %u messages, %" PRIu64 " bytes.", extract.nOut, extract.sOut);
+
+    return !extract.fail ? EXIT_SUCCESS : EXIT_OTHERFAIL;
+}
+
+/* ****************************************************************************************************************** */
+// eof
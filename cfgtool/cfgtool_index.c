@@ -0,0 +1,181 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <signal.h>
+#include <inttypes.h>
+
+#include "cfgtool_util.h"
+
+#include "ff_parser.h"
+#include "ff_epoch.h"
+#include "ff_logindex.h"
+
+#include "cfgtool_index.h"
+
+/* ****************************************************************************************************************** */
+
+const char *indexHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'index':\n"
+"\n"
+"    Usage: cfgtool index -i <infile> [-o <idxfile>] [-y]\n"
+"\n"
+"    This scans a logfile once and writes an index of all messages and epochs\n"
+"    to <idxfile> (default: <infile>.idx). For each message the index has its\n"
+"    offset and size in the logfile, its name, and the sequence number and GPS\n"
+"    time of the epoch it belongs to. The 'extract' command uses the index to\n"
+"    jump directly to a time, an epoch or to messages of a certain kind.\n"
+"\n"
+"    The index is tied to the logfile by its size and a hash of the beginning of\n"
+"    the file. Re-index after changing the logfile. Compressed logfiles and\n"
+"    standard input are not supported.\n"
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+static bool gAbort;
+
+static void _sigHandler(int signal)
+{
+    if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
+    {
+        PRINT("Aborting...");
+        gAbort = true;
+    }
+}
+
+static void _printEpoch(const char *what, const LOG_INDEX_EPOCH_t *epoch)
+{
+    if ((epoch->flags & LOG_INDEX_FLAG_TIME) != 0)
+    {
+        PRINT("%s epoch %u at offset %" PRIu64 ", GPS time %04u:%010.3f", what, epoch->epoch, epoch->offset,
+            epoch->gpsWeek, (double)epoch->gpsTowMs * 1e-3);
+    }
+    else
+    {
+        PRINT("%s epoch %u at offset %" PRIu64 ", GPS time ????:%010.3f (no week)", what, epoch->epoch, epoch->offset,
+            (double)epoch->gpsTowMs * 1e-3);
+    }
+}
+
+int indexRun(const char *inName, const char *idxName, const bool overwrite)
+{
+    if ( (inName == NULL) || (strcmp(inName, "-") == 0) )
+    {
+        WARNING("Need '-i <infile>' argument (standard input cannot be indexed)!");
+        return EXIT_BADARGS;
+    }
+    char idxFile[1000];
+    if ( (idxName == NULL) || (strcmp(idxName, "-") == 0) )
+    {
+        snprintf(idxFile, sizeof(idxFile), "%s.idx", inName);
+    }
+    else
+    {
+        snprintf(idxFile, sizeof(idxFile), "%s", idxName);
+    }
+
+    LOG_INDEX_WRITER_t *writer = logIndexCreate(idxFile, overwrite);
+    if (writer == NULL)
+    {
+        return EXIT_OTHERFAIL;
+    }
+    PRINT("Indexing '%s' to '%s'...", inName, idxFile);
+
+    gAbort = false;
+    signal(SIGINT, _sigHandler);
+    signal(SIGTERM, _sigHandler);
+    NOT_WIN( signal(SIGHUP, _sigHandler) );
+
+    PARSER_t parser;
+    parserInit(&parser);
+
+    EPOCH_t coll;
+    EPOCH_t epoch;
+    epochInit(&coll);
+
+    bool res = true;
+    while (res && !gAbort)
+    {
+        uint8_t buf[8192];
+        const int num = ioReadInput(buf, sizeof(buf));
+        if (num < 0) // eof
+        {
+            break;
+        }
+        else if (num == 0) // wait
+        {
+            SLEEP(5);
+            continue;
+        }
+        parserAdd(&parser, buf, num);
+
+        PARSER_MSG_t msg;
+        while (res && parserProcess(&parser, &msg, false))
+        {
+            const bool haveEpoch = epochCollect(&coll, &msg, &epoch);
+            res = logIndexAdd(writer, &msg, haveEpoch ? &epoch : NULL);
+        }
+    }
+
+    uint32_t nMsgs = 0;
+    uint32_t nEpochs = 0;
+    if (!logIndexFinish(writer, &nMsgs, &nEpochs) || !res || gAbort)
+    {
+        return EXIT_OTHERFAIL;
+    }
+
+    // Check that we can read it back and report a summary
+    LOG_INDEX_t *idx = logIndexOpen(idxFile, inName);
+    if (idx == NULL)
+    {
+        return EXIT_OTHERFAIL;
+    }
+    PRINT("Indexed %u messages (%d different), %u epochs, %" PRIu64 " bytes",
+        idx->nMsgs, idx->nNames, idx->nEpochs, idx->logSize);
+    // Logs without week number (e.g. no UBX-NAV-TIMEGPS) have the time of week only
+    int firstIx = logIndexFindTime(idx, 0, 0);
+    uint8_t flag = LOG_INDEX_FLAG_TIME;
+    if (firstIx < 0)
+    {
+        firstIx = logIndexFindTime(idx, -1, 0);
+        flag = LOG_INDEX_FLAG_TOW;
+    }
+    if (firstIx >= 0)
+    {
+        _printEpoch("First", &idx->epochs[firstIx]);
+        for (int ix = (int)idx->nEpochs - 1; ix >= firstIx; ix--)
+        {
+            if ((idx->epochs[ix].flags & flag) != 0)
+            {
+                _printEpoch("Last ", &idx->epochs[ix]);
+                break;
+            }
+        }
+    }
+    logIndexClose(idx);
+
+    return EXIT_SUCCESS;
+}
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,598 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <signal.h>
+#include <inttypes.h>
+#include <math.h>
+#include <errno.h>
+
+#include "cfgtool_util.h"
+
+#include "ff_parser.h"
+#include "ff_epoch.h"
+
+#include "cfgtool_merge.h"
+
+/* ****************************************************************************************************************** */
+
+const char *mergeHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'merge':\n"
+"\n"
+"    Usage: cfgtool merge -i <infile>,<infile>[,...] [-o <outfile>] [-y] [-x|-e]\n"
+"\n"
+"    This processes the data from two or more input files through one parser\n"
+"    and epoch collector per file and merges the message frames ordered by the\n"
+"    GPS time of the epoch they belong to. Frames of the same epoch remain\n"
+"    together, and epochs with the same time are ordered by input file.\n"
+"    Frames that do not belong to an epoch with a known time stay with the\n"
+"    previous epoch of the same file.\n"
+"\n"
+"    Without GPS week number (e.g. no UBX-NAV-TIMEGPS) the week is derived\n"
+"    from the UTC date of the epoch. Failing that, epochs are ordered by GPS\n"
+"    time of week only, which does not work across the end of the week. A\n"
+"    warning is shown for such sources and for sources without any time.\n"
+"\n"
+"    By default, the raw frames are output. Add -x to instead output\n"
+"    information on the frames, tagged with the source (input file number,\n"
+"    1, 2, ...). Add -e to instead output the time-aligned epochs, one line per\n"
+"    source and GPS time, with '-' for sources without an epoch at that time.\n"
+"\n"
+"    Only one epoch per input file is kept in memory at any time.\n"
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+#define MERGE_MAX_SRCS      16
+#define MERGE_WEEK_MS       (7 * 86400 * 1000)
+#define MERGE_FLUSH_SIZE    (512 * 1024)  // Write output when this much data has accumulated
+#define MERGE_CHUNK_SIZE    (1024 * 1024) // Maximum size of messages of one epoch
+#define MERGE_MAX_MSGS      10000         // Maximum number of messages of one epoch
+
+// One input file
+typedef struct SRC_s
+{
+    int          nr;
+    const char  *name;
+    FILE        *file;
+    bool         eof;
+    PARSER_t     parser;
+    EPOCH_t      coll;
+    // Messages of the current epoch, the first nReady are complete (the "chunk")
+    uint8_t      data[MERGE_CHUNK_SIZE];
+    int          size;
+    int          offs[MERGE_MAX_MSGS];
+    int          sizes[MERGE_MAX_MSGS];
+    char         names[MERGE_MAX_MSGS][PARSER_MAX_NAME_SIZE];
+    int          num;
+    int          nReady;
+    // Chunk info
+    int64_t      time;      // Sort key [ms]
+    bool         timeWeek;  // time has the week, otherwise it is time of week only
+    bool         haveEpoch;
+    EPOCH_t      epoch;
+    int64_t      lastTime;
+    bool         lastTimeWeek;
+    uint32_t     nTowOnly;  // Number of epochs with time of week only
+    uint32_t     nNoTime;   // Number of epochs without time
+    uint32_t     nMsgs;
+    uint32_t     nEpochs;
+} SRC_t;
+
+typedef struct MERGE_s
+{
+    SRC_t       *srcs[MERGE_MAX_SRCS];
+    int          nSrcs;
+    int          heap[MERGE_MAX_SRCS]; // Min-heap of sources with a ready chunk, by (time, nr)
+    int          nHeap;
+    bool         first;
+    int          outSize;
+    bool         fail;
+} MERGE_t;
+
+static bool gAbort;
+
+static void _sigHandler(int signal)
+{
+    if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
+    {
+        PRINT("Aborting...");
+        gAbort = true;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _srcAdd(SRC_t *src, const PARSER_MSG_t *msg)
+{
+    memcpy(&src->data[src->size], msg->data, msg->size);
+    src->offs[src->num] = src->size;
+    src->sizes[src->num] = msg->size;
+    snprintf(src->names[src->num], sizeof(src->names[0]), "%s", msg->name);
+    src->size += msg->size;
+    src->num++;
+}
+
+// GPS week from the UTC date and time of the epoch, -1 if unknown
+static int _weekFromUtc(const EPOCH_t *epoch, const int64_t towMs)
+{
+    if ( !epoch->haveDate || !epoch->haveTime || (epoch->year < 1980) || (epoch->month < 1) || (epoch->month > 12) )
+    {
+        return -1;
+    }
+    // Days since 1980-01-06 (start of GPS time), see http://howardhinnant.github.io/date_algorithms.html
+    const int y = epoch->year - (epoch->month <= 2 ? 1 : 0);
+    const int era = y / 400;
+    const int yoe = y - (era * 400);
+    const int doy = (((153 * (epoch->month + (epoch->month > 2 ? -3 : 9))) + 2) / 5) + epoch->day - 1;
+    const int doe = (yoe * 365) + (yoe / 4) - (yoe / 100) + doy;
+    const int64_t days = ((int64_t)era * 146097) + doe - 719468 - 3657;
+    const int leapSec = epoch->haveLeapSeconds ? epoch->leapSeconds : 18;
+    const int64_t gpsMs = (days * 86400000) + (((epoch->hour * 3600) + (epoch->minute * 60) + leapSec) * 1000) +
+        (int64_t)floor((epoch->second * 1e3) + 0.5);
+    // The week that puts the time of week closest to the time from the date, so that it doesn't matter if the leap
+    // seconds are a bit off or the time is only approximate
+    return (int)floor(((double)(gpsMs - towMs) / (double)MERGE_WEEK_MS) + 0.5);
+}
+
+// Mark the first num messages as ready
+static void _srcReady(SRC_t *src, const int num, const EPOCH_t *epoch)
+{
+    src->nReady = num;
+    src->haveEpoch = false;
+    if (epoch != NULL)
+    {
+        src->haveEpoch = true;
+        src->epoch = *epoch;
+        src->nEpochs++;
+        if (epoch->haveGpsTow)
+        {
+            const int64_t towMs = (int64_t)floor((epoch->gpsTow * 1e3) + 0.5);
+            const int week = epoch->haveGpsWeek ? epoch->gpsWeek : _weekFromUtc(epoch, towMs);
+            if (week >= 0)
+            {
+                src->lastTime = ((int64_t)week * MERGE_WEEK_MS) + towMs;
+                src->lastTimeWeek = true;
+            }
+            else
+            {
+                if (src->nTowOnly == 0)
+                {
+                    WARNING("Source %d: no GPS week, ordering by GPS time of week only!", src->nr);
+                }
+                src->nTowOnly++;
+                src->lastTime = towMs;
+                src->lastTimeWeek = false;
+            }
+        }
+        else
+        {
+            src->nNoTime++;
+        }
+    }
+    src->time = src->lastTime;
+    src->timeWeek = src->lastTimeWeek;
+}
+
+// Remove the ready messages
+static void _srcConsume(SRC_t *src)
+{
+    if (src->nReady < src->num)
+    {
+        const int offs = src->offs[src->nReady];
+        memmove(&src->data[0], &src->data[offs], src->size - offs);
+        for (int ix = src->nReady; ix < src->num; ix++)
+        {
+            const int dst = ix - src->nReady;
+            src->offs[dst] = src->offs[ix] - offs;
+            src->sizes[dst] = src->sizes[ix];
+            memcpy(src->names[dst], src->names[ix], sizeof(src->names[0]));
+        }
+        src->size -= offs;
+    }
+    else
+    {
+        src->size = 0;
+    }
+    src->num -= src->nReady;
+    src->nReady = 0;
+    src->haveEpoch = false;
+}
+
+// Get next chunk of messages, returns false if there are no more messages
+static bool _srcNext(SRC_t *src)
+{
+    while (!gAbort)
+    {
+        PARSER_MSG_t msg;
+        while (parserProcess(&src->parser, &msg, false))
+        {
+            src->nMsgs++;
+            EPOCH_t epoch;
+            const bool haveEpoch = epochCollect(&src->coll, &msg, &epoch);
+            const bool endOfEpoch = haveEpoch && (msg.type == PARSER_MSGTYPE_UBX) && (strcmp(msg.name, "UBX-NAV-EOE") == 0);
+
+            // An epoch is complete either because this message ends it (UBX-NAV-EOE), or because this message
+            // already belongs to the next epoch (see also logIndexAdd())
+            if (haveEpoch && !endOfEpoch)
+            {
+                _srcReady(src, src->num, &epoch);
+                _srcAdd(src, &msg);
+                return true;
+            }
+            _srcAdd(src, &msg);
+            if (endOfEpoch)
+            {
+                _srcReady(src, src->num, &epoch);
+                return true;
+            }
+            // No epochs (or not anymore), make a chunk of what we have, leaving room for the next message
+            if ( (src->num >= (MERGE_MAX_MSGS - 1)) || ((src->size + PARSER_MAX_ANY_SIZE) > MERGE_CHUNK_SIZE) )
+            {
+                _srcReady(src, src->num, NULL);
+                return true;
+            }
+        }
+
+        if (src->eof)
+        {
+            break;
+        }
+        uint8_t buf[8192];
+        const int num = fread(buf, 1, sizeof(buf), src->file);
+        if (num > 0)
+        {
+            parserAdd(&src->parser, buf, num);
+        }
+        else
+        {
+            src->eof = true;
+        }
+    }
+
+    // Messages after the last epoch
+    if (src->num > 0)
+    {
+        _srcReady(src, src->num, NULL);
+        return true;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Compare times, by time of week only if either has no week
+static int _timeCmp(int64_t timeA, const bool weekA, int64_t timeB, const bool weekB)
+{
+    if ( (timeA != INT64_MIN) && (timeB != INT64_MIN) && (!weekA || !weekB) )
+    {
+        timeA %= MERGE_WEEK_MS;
+        timeB %= MERGE_WEEK_MS;
+    }
+    return timeA < timeB ? -1 : (timeA > timeB ? 1 : 0);
+}
+
+static bool _heapLess(const MERGE_t *merge, const int a, const int b)
+{
+    const SRC_t *srcA = merge->srcs[a];
+    const SRC_t *srcB = merge->srcs[b];
+    const int cmp = _timeCmp(srcA->time, srcA->timeWeek, srcB->time, srcB->timeWeek);
+    return (cmp < 0) || ((cmp == 0) && (srcA->nr < srcB->nr));
+}
+
+static void _heapPush(MERGE_t *merge, const int srcIx)
+{
+    int ix = merge->nHeap++;
+    merge->heap[ix] = srcIx;
+    while (ix > 0)
+    {
+        const int parent = (ix - 1) / 2;
+        if (!_heapLess(merge, merge->heap[ix], merge->heap[parent]))
+        {
+            break;
+        }
+        const int tmp = merge->heap[ix];
+        merge->heap[ix] = merge->heap[parent];
+        merge->heap[parent] = tmp;
+        ix = parent;
+    }
+}
+
+static int _heapPop(MERGE_t *merge)
+{
+    const int top = merge->heap[0];
+    merge->nHeap--;
+    merge->heap[0] = merge->heap[merge->nHeap];
+    int ix = 0;
+    while (true)
+    {
+        const int left = (2 * ix) + 1;
+        const int right = left + 1;
+        int smallest = ix;
+        if ( (left < merge->nHeap) && _heapLess(merge, merge->heap[left], merge->heap[smallest]) )
+        {
+            smallest = left;
+        }
+        if ( (right < merge->nHeap) && _heapLess(merge, merge->heap[right], merge->heap[smallest]) )
+        {
+            smallest = right;
+        }
+        if (smallest == ix)
+        {
+            break;
+        }
+        const int tmp = merge->heap[ix];
+        merge->heap[ix] = merge->heap[smallest];
+        merge->heap[smallest] = tmp;
+        ix = smallest;
+    }
+    return top;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _flush(MERGE_t *merge, const bool force)
+{
+    if ( !force && (merge->outSize < MERGE_FLUSH_SIZE) )
+    {
+        return;
+    }
+    if (!ioWriteOutput(!merge->first))
+    {
+        merge->fail = true;
+    }
+    merge->first = false;
+    merge->outSize = 0;
+}
+
+static void _timeStr(char *str, const int size, const int64_t time, const bool week)
+{
+    if ( (time != INT64_MIN) && !week )
+    {
+        snprintf(str, size, "????:%010.3f", (double)time * 1e-3);
+    }
+    else if (time != INT64_MIN)
+    {
+        snprintf(str, size, "%04d:%010.3f", (int)(time / MERGE_WEEK_MS), (double)(time % MERGE_WEEK_MS) * 1e-3);
+    }
+    else
+    {
+        snprintf(str, size, "----:------.---");
+    }
+}
+
+static void _outputFrames(MERGE_t *merge, const SRC_t *src, const bool extraInfo)
+{
+    char timeStr[50];
+    if (extraInfo)
+    {
+        _timeStr(timeStr, sizeof(timeStr), src->time, src->timeWeek);
+    }
+    for (int ix = 0; ix < src->nReady; ix++)
+    {
+        if (extraInfo)
+        {
+            ioOutputStr("source %2d, time %s, epoch %5u, size %4d, %s\n", src->nr, timeStr,
+                src->haveEpoch ? src->epoch.seq : 0, src->sizes[ix], src->names[ix]);
+            merge->outSize += 100;
+        }
+        else
+        {
+            ioAddOutputBin(&src->data[ src->offs[ix] ], src->sizes[ix]);
+            merge->outSize += src->sizes[ix];
+        }
+        _flush(merge, false);
+    }
+}
+
+int mergeRun(const char *inNames, const bool extraInfo, const bool doEpoch)
+{
+    if (extraInfo && doEpoch)
+    {
+        WARNING("Cannot use both -x and -e!");
+        return EXIT_BADARGS;
+    }
+
+    MERGE_t merge;
+    memset(&merge, 0, sizeof(merge));
+    merge.first = true;
+
+    // Open input files
+    char names[2000];
+    if (snprintf(names, sizeof(names), "%s", inNames) >= (int)sizeof(names))
+    {
+        WARNING("Illegal argument '-i %s'!", inNames);
+        return EXIT_BADARGS;
+    }
+    bool res = true;
+    char *save = NULL;
+    char *name = strtok_r(names, ",", &save);
+    while (res && (name != NULL))
+    {
+        if (merge.nSrcs >= MERGE_MAX_SRCS)
+        {
+            WARNING("Too many input files (max %d)!", MERGE_MAX_SRCS);
+            res = false;
+            break;
+        }
+        SRC_t *src = calloc(1, sizeof(SRC_t));
+        if (src == NULL)
+        {
+            WARNING("malloc fail!");
+            res = false;
+            break;
+        }
+        merge.srcs[merge.nSrcs++] = src;
+        src->nr = merge.nSrcs;
+        src->name = name;
+        src->lastTime = INT64_MIN;
+        parserInit(&src->parser);
+        epochInit(&src->coll);
+        src->file = fopen(name, "rb");
+        if (src->file == NULL)
+        {
+            WARNING("Failed opening '%s' for reading: %s!", name, strerror(errno));
+            res = false;
+        }
+        name = strtok_r(NULL, ",", &save);
+    }
+    if (res && (merge.nSrcs < 2))
+    {
+        WARNING("Need at least two input files!");
+        res = false;
+    }
+    if (!res)
+    {
+        for (int ix = 0; ix < merge.nSrcs; ix++)
+        {
+            if (merge.srcs[ix]->file != NULL)
+            {
+                fclose(merge.srcs[ix]->file);
+            }
+            free(merge.srcs[ix]);
+        }
+        return EXIT_BADARGS;
+    }
+
+    gAbort = false;
+    signal(SIGINT, _sigHandler);
+    signal(SIGTERM, _sigHandler);
+    NOT_WIN( signal(SIGHUP, _sigHandler) );
+
+    // Get the first chunk of each source
+    for (int ix = 0; ix < merge.nSrcs; ix++)
+    {
+        PRINT("Source %d: %s", merge.srcs[ix]->nr, merge.srcs[ix]->name);
+        if (_srcNext(merge.srcs[ix]))
+        {
+            _heapPush(&merge, ix);
+        }
+    }
+
+    // Merge
+    uint32_t nAligned = 0;
+    while (!gAbort && !merge.fail && (merge.nHeap > 0))
+    {
+        if (doEpoch)
+        {
+            // Collect all sources with an epoch at the time of the first one in the heap
+            const int64_t time = merge.srcs[ merge.heap[0] ]->time;
+            const bool timeWeek = merge.srcs[ merge.heap[0] ]->timeWeek;
+            SRC_t *aligned[MERGE_MAX_SRCS] = { NULL };
+            int srcIxs[MERGE_MAX_SRCS];
+            int nSrcIxs = 0;
+            while (merge.nHeap > 0)
+            {
+                const SRC_t *top = merge.srcs[ merge.heap[0] ];
+                if (_timeCmp(top->time, top->timeWeek, time, timeWeek) != 0)
+                {
+                    break;
+                }
+                const int srcIx = _heapPop(&merge);
+                SRC_t *src = merge.srcs[srcIx];
+                if (src->haveEpoch && (src->time != INT64_MIN) && (aligned[srcIx] == NULL))
+                {
+                    aligned[srcIx] = src;
+                }
+                srcIxs[nSrcIxs++] = srcIx;
+            }
+            bool haveAny = false;
+            for (int ix = 0; !haveAny && (ix < merge.nSrcs); ix++)
+            {
+                haveAny = (aligned[ix] != NULL);
+            }
+            if (haveAny)
+            {
+                char timeStr[50];
+                _timeStr(timeStr, sizeof(timeStr), time, timeWeek);
+                for (int ix = 0; ix < merge.nSrcs; ix++)
+                {
+                    if (aligned[ix] != NULL)
+                    {
+                        ioOutputStr("epoch %s, source %2d, epoch %5u, %s\n",
+                            timeStr, ix + 1, aligned[ix]->epoch.seq, aligned[ix]->epoch.str);
+                    }
+                    else
+                    {
+                        ioOutputStr("epoch %s, source %2d, epoch     -, -\n", timeStr, ix + 1);
+                    }
+                    merge.outSize += 200;
+                }
+                nAligned++;
+                _flush(&merge, false);
+            }
+            for (int ix = 0; ix < nSrcIxs; ix++)
+            {
+                SRC_t *src = merge.srcs[ srcIxs[ix] ];
+                _srcConsume(src);
+                if (_srcNext(src))
+                {
+                    _heapPush(&merge, srcIxs[ix]);
+                }
+            }
+        }
+        else
+        {
+            const int srcIx = _heapPop(&merge);
+            SRC_t *src = merge.srcs[srcIx];
+            _outputFrames(&merge, src, extraInfo);
+            _srcConsume(src);
+            if (_srcNext(src))
+            {
+                _heapPush(&merge, srcIx);
+            }
+        }
+    }
+    if (!merge.fail)
+    {
+        _flush(&merge, true);
+    }
+
+    for (int ix = 0; ix < merge.nSrcs; ix++)
+    {
+        SRC_t *src = merge.srcs[ix];
+        PRINT("Source %d: %u messages, %u epochs", src->nr, src->nMsgs, src->nEpochs);
+        if (src->nTowOnly > 0)
+        {
+            WARNING("Source %d: %u epochs without GPS week, ordered by GPS time of week only!", src->nr, src->nTowOnly);
+        }
+        if ( (src->nEpochs > 0) && (src->nNoTime == src->nEpochs) )
+        {
+            WARNING("Source %d: no epochs with GPS time, its messages were not ordered by time!", src->nr);
+        }
+        else if (src->nNoTime > 0)
+        {
+            WARNING("Source %d: %u epochs without GPS time, kept with the previous epoch!", src->nr, src->nNoTime);
+        }
+        fclose(src->file);
+        free(src);
+    }
+    if (doEpoch)
+    {
+        PRINT("Aligned %u epochs", nAligned);
+    }
+
+    return !merge.fail && !gAbort ? EXIT_SUCCESS : EXIT_OTHERFAIL;
+}
+
+/* ****************************************************************************************************************** */
+// eof
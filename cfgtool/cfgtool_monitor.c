@@ -0,0 +1,389 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <inttypes.h>
+
+#include "cfgtool_util.h"
+
+#include "ff_rx.h"
+#include "ff_rxhub.h"
+#include "ff_epoch.h"
+
+#include "cfgtool_monitor.h"
+
+/* ****************************************************************************************************************** */
+
+const char *monitorHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'monitor':\n"
+"\n"
+"    Usage: cfgtool monitor -p '<port> <port> ...' [-o <outfile>] [-y] [-n] [-j]\n"
+"                   [-T <period>]\n"
+"\n"
+"    Connects to many receivers and monitors them until SIGINT (e.g. CTRL-C),\n"
+"    SIGHUP or SIGTERM is received, or until all receivers have failed. The\n"
+"    ports are given as a whitespace separated list. All receivers are served\n"
+"    by a single thread, so that this scales to many receivers. Replay ports\n"
+"    (file://, stdin:// and sim://) cannot be used.\n"
+"\n"
+"    A report is output at the end and every <period> seconds (default 10).\n"
+"    The reports are tables, or JSON objects (one per line) with -j. For each\n"
+"    receiver the report has:\n"
+"\n"
+"        state           ok, or failed if the receiver could not be opened or\n"
+"                        the connection was lost\n"
+"        messages, bytes Number of messages and their total size\n"
+"        rate            Message rate [Hz] and data rate [B/s] in the period\n"
+"        epochs          Number of navigation epochs\n"
+"        fix, sv         Fix type and number of satellites used in the last\n"
+"                        navigation epoch\n"
+"        age             Time since the last message [s]\n"
+"\n"
+"    This is not available on Windows.\n"
+"\n"
+"    Examples:\n"
+"\n"
+"        cfgtool monitor -p 'tcp://10.0.0.1:2001 tcp://10.0.0.1:2002' -n\n"
+"        cfgtool monitor -p \"$(cat ports.txt)\" -n -j -T 60 -o monitor.json\n"
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+#define MONITOR_MAX_RX 250
+
+typedef struct MONITOR_RX_s
+{
+    const char  *spec;
+    RX_t        *rx;
+    bool         ok;
+    uint64_t     nMsgs;
+    uint64_t     nBytes;
+    uint64_t     nMsgsReport;   // nMsgs at time of last report
+    uint64_t     nBytesReport;  // nBytes at time of last report
+    uint32_t     nEpochs;
+    const char  *fixStr;
+    int          numSv;
+    uint64_t     tLast;         // [ns]
+    EPOCH_t      coll;
+    EPOCH_t      epoch;
+} MONITOR_RX_t;
+
+typedef struct MONITOR_s
+{
+    MONITOR_RX_t rxs[MONITOR_MAX_RX];
+    int          nRxs;
+    RX_HUB_t    *hub;
+    uint64_t     tStart;   // [ns]
+    uint64_t     tReport;  // [ns]
+} MONITOR_t;
+
+static void _msgCb(PARSER_MSG_t *msg, void *arg)
+{
+    MONITOR_RX_t *mrx = (MONITOR_RX_t *)arg;
+
+    // Port failed, the hub has removed it
+    if (msg == NULL)
+    {
+        WARNING("Receiver %s failed!", mrx->spec);
+        mrx->ok = false;
+        return;
+    }
+
+    mrx->nMsgs++;
+    mrx->nBytes += msg->size;
+    mrx->tLast = msg->tsLast != 0 ? msg->tsLast : TIME_NS();
+    if (epochCollect(&mrx->coll, msg, &mrx->epoch))
+    {
+        mrx->nEpochs++;
+        mrx->fixStr = mrx->epoch.haveFix ? mrx->epoch.fixStr : NULL;
+        mrx->numSv  = mrx->epoch.haveNumSv ? mrx->epoch.numSv : -1;
+    }
+}
+
+static void _report(MONITOR_t *mon, const bool json, const bool final)
+{
+    const uint64_t now = TIME_NS();
+    const double dur = (double)(now - mon->tStart) * 1e-9;
+    const double durReport = (double)(now - mon->tReport) * 1e-9;
+    mon->tReport = now;
+
+    int nOk = 0;
+    uint64_t nMsgs = 0;
+    uint64_t nBytes = 0;
+    for (int ix = 0; ix < mon->nRxs; ix++)
+    {
+        nOk += mon->rxs[ix].ok ? 1 : 0;
+        nMsgs += mon->rxs[ix].nMsgs;
+        nBytes += mon->rxs[ix].nBytes;
+    }
+    RX_HUB_STATS_t hubStats;
+    if (!rxHubGetStats(mon->hub, &hubStats))
+    {
+        memset(&hubStats, 0, sizeof(hubStats));
+    }
+
+    if (json)
+    {
+        ioOutputStr("{ \"time\": %.3f, \"final\": %s, \"receivers\": %d, \"ok\": %d, \"messages\": %" PRIu64
+            ", \"bytes\": %" PRIu64 ", \"parsers\": %d, \"parsers_used\": %d, \"ports\": [",
+            dur, final ? "true" : "false", mon->nRxs, nOk, nMsgs, nBytes, hubStats.nParsers, hubStats.nParsersUsed);
+    }
+    else
+    {
+        ioOutputStr("%s monitor after %.1f s: %d of %d receivers ok, %" PRIu64 " messages, %" PRIu64 " bytes,"
+            " %d of %d parsers in use\n", final ? "Final" : "Periodic", dur, nOk, mon->nRxs, nMsgs, nBytes,
+            hubStats.nParsersUsed, hubStats.nParsers);
+        ioOutputStr("%-40s %-6s %10s %12s %8s %10s %8s %-8s %3s %7s\n",
+            "port", "state", "messages", "bytes", "rate", "B/s", "epochs", "fix", "sv", "age");
+    }
+
+    for (int ix = 0; ix < mon->nRxs; ix++)
+    {
+        MONITOR_RX_t *mrx = &mon->rxs[ix];
+        const double rate = durReport > 0.0 ? (double)(mrx->nMsgs - mrx->nMsgsReport) / durReport : 0.0;
+        const double bps = durReport > 0.0 ? (double)(mrx->nBytes - mrx->nBytesReport) / durReport : 0.0;
+        const double age = mrx->tLast != 0 ? (double)(now - mrx->tLast) * 1e-9 : -1.0;
+        mrx->nMsgsReport = mrx->nMsgs;
+        mrx->nBytesReport = mrx->nBytes;
+        if (json)
+        {
+            ioOutputStr("%s { \"port\": ", ix > 0 ? "," : "");
+            ioOutputJsonStr(mrx->spec);
+            ioOutputStr(", \"ok\": %s, \"messages\": %" PRIu64 ", \"bytes\": %" PRIu64 ", \"rate\": %.3f,"
+                " \"bytes_per_s\": %.1f, \"epochs\": %" PRIu32 ", \"fix\": ",
+                mrx->ok ? "true" : "false", mrx->nMsgs, mrx->nBytes, rate, bps, mrx->nEpochs);
+            if (mrx->fixStr != NULL)
+            {
+                ioOutputJsonStr(mrx->fixStr);
+            }
+            else
+            {
+                ioOutputStr("null");
+            }
+            if (mrx->numSv >= 0)
+            {
+                ioOutputStr(", \"sv\": %d", mrx->numSv);
+            }
+            else
+            {
+                ioOutputStr(", \"sv\": null");
+            }
+            if (age >= 0.0)
+            {
+                ioOutputStr(", \"age\": %.3f }", age);
+            }
+            else
+            {
+                ioOutputStr(", \"age\": null }");
+            }
+        }
+        else
+        {
+            char svStr[20] = "-";
+            char ageStr[20] = "-";
+            if (mrx->numSv >= 0)
+            {
+                snprintf(svStr, sizeof(svStr), "%d", mrx->numSv);
+            }
+            if (age >= 0.0)
+            {
+                snprintf(ageStr, sizeof(ageStr), "%.1f", age);
+            }
+            ioOutputStr("%-40s %-6s %10" PRIu64 " %12" PRIu64 " %8.2f %10.1f %8" PRIu32 " %-8s %3s %7s\n",
+                mrx->spec, mrx->ok ? "ok" : "failed", mrx->nMsgs, mrx->nBytes, rate, bps, mrx->nEpochs,
+                mrx->fixStr != NULL ? mrx->fixStr : "-", svStr, ageStr);
+        }
+    }
+
+    ioOutputStr(json ? " ] }\n" : "\n");
+}
+
+/* ****************************************************************************************************************** */
+
+static bool gAbort;
+
+static void _sigHandler(int signal)
+{
+    if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
+    {
+        PRINT("Aborting...");
+        gAbort = true;
+    }
+}
+
+int monitorRun(const char *portsArg, const bool noProbe, const bool json, const char *periodArg)
+{
+    double period = 10.0;
+    if (periodArg != NULL)
+    {
+        char *endptr = NULL;
+        period = strtod(periodArg, &endptr);
+        if ( (endptr == periodArg) || (*endptr != '\0') || (period < 0.1) )
+        {
+            WARNING("Illegal period '%s'!", periodArg);
+            return EXIT_BADARGS;
+        }
+    }
+
+    MONITOR_t *mon = (MONITOR_t *)malloc(sizeof(MONITOR_t));
+    char *ports = strdup(portsArg);
+    if ( (mon == NULL) || (ports == NULL) )
+    {
+        WARNING("malloc fail!");
+        free(mon);
+        free(ports);
+        return EXIT_OTHERFAIL;
+    }
+    memset(mon, 0, sizeof(*mon));
+
+    bool res = true;
+    char *savePtr = NULL;
+    for (char *spec = strtok_r(ports, " \t\r\n", &savePtr); spec != NULL; spec = strtok_r(NULL, " \t\r\n", &savePtr))
+    {
+        if (mon->nRxs >= MONITOR_MAX_RX)
+        {
+            WARNING("Too many ports (max %d)!", MONITOR_MAX_RX);
+            res = false;
+            break;
+        }
+        mon->rxs[mon->nRxs].spec = spec;
+        mon->nRxs++;
+    }
+    if (res && (mon->nRxs == 0))
+    {
+        WARNING("Need at least one port!");
+        res = false;
+    }
+    if (!res)
+    {
+        free(mon);
+        free(ports);
+        return EXIT_BADARGS;
+    }
+
+    mon->hub = rxHubInit("monitor");
+    if (mon->hub == NULL)
+    {
+        free(mon);
+        free(ports);
+        return EXIT_OTHERFAIL;
+    }
+
+    // Connect to all receivers, failed ones are reported as such
+    RX_ARGS_t args = RX_ARGS_DEFAULT();
+    if (noProbe)
+    {
+        args.autobaud = false;
+        args.detect   = false;
+    }
+    int nOk = 0;
+    for (int ix = 0; ix < mon->nRxs; ix++)
+    {
+        MONITOR_RX_t *mrx = &mon->rxs[ix];
+        epochInit(&mrx->coll);
+        mrx->numSv = -1;
+        mrx->rx = rxInit(mrx->spec, &args);
+        if ( (mrx->rx == NULL) || !rxOpen(mrx->rx) )
+        {
+            WARNING("Failed connecting to receiver %s!", mrx->spec);
+            free(mrx->rx);
+            mrx->rx = NULL;
+            continue;
+        }
+        if (!rxHubAddRx(mon->hub, mrx->rx, _msgCb, mrx))
+        {
+            WARNING("Cannot monitor receiver %s!", mrx->spec);
+            continue;
+        }
+        mrx->ok = true;
+        nOk++;
+    }
+
+    if (nOk > 0)
+    {
+        gAbort = false;
+        signal(SIGINT, _sigHandler);
+        signal(SIGTERM, _sigHandler);
+        NOT_WIN( signal(SIGHUP, _sigHandler) );
+
+        PRINT("Monitoring %d of %d receivers...", nOk, mon->nRxs);
+        mon->tStart = TIME_NS();
+        mon->tReport = mon->tStart;
+        bool append = false;
+        const uint64_t periodNs = (uint64_t)(period * 1e9);
+        while (res && !gAbort && (nOk > 0))
+        {
+            if (rxHubRun(mon->hub, 100) < 0)
+            {
+                res = false;
+                break;
+            }
+
+            if ((TIME_NS() - mon->tReport) >= periodNs)
+            {
+                _report(mon, json, false);
+                res = ioWriteOutput(append);
+                append = true;
+            }
+
+            nOk = 0;
+            for (int ix = 0; ix < mon->nRxs; ix++)
+            {
+                nOk += mon->rxs[ix].ok ? 1 : 0;
+            }
+        }
+
+        _report(mon, json, true);
+        if (!ioWriteOutput(append))
+        {
+            res = false;
+        }
+    }
+
+    uint64_t nMsgs = 0;
+    for (int ix = 0; ix < mon->nRxs; ix++)
+    {
+        MONITOR_RX_t *mrx = &mon->rxs[ix];
+        nMsgs += mrx->nMsgs;
+        if (mrx->rx != NULL)
+        {
+            rxHubRemoveRx(mon->hub, mrx->rx);
+            rxClose(mrx->rx);
+            free(mrx->rx);
+        }
+    }
+    rxHubDestroy(mon->hub);
+    const bool anyRx = (mon->tStart != 0);
+    free(mon);
+    free(ports);
+
+    if (!anyRx)
+    {
+        return EXIT_RXFAIL;
+    }
+    return res ? (nMsgs > 0 ? EXIT_SUCCESS : EXIT_RXNODATA) : EXIT_OTHERFAIL;
+}
+
+/* ****************************************************************************************************************** */
+// eof
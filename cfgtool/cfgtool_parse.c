@@ -18,8 +18,11 @@
 #include <string.h>
 #include <stddef.h>
 #include <signal.h>
+#include <inttypes.h>
+#include <pthread.h>
 
 #include "cfgtool_util.h"
+#include "cfgtool_queue.h"
 
 #include "ff_ubx.h"
 #include "ff_parser.h"
@@ -43,6 +46,10 @@ const char *parseHelp(void)
 "    or SIGTERM is received.\n"
 "\n"
 "    Add -e to enable epoch detection and to output detected epochs.\n"
+"\n"
+"    Input is read and parsed in a separate thread. When reading from a live\n"
+"    source (e.g. a pipe) and the output cannot keep up, messages are dropped\n"
+"    rather than stalling the input, and the losses are reported.\n"
 "\n";
 }
 
@@ -55,24 +62,72 @@ static void _sigHandler(int signal)
     if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
     {
         PRINT("Aborting...");
-        gAbort = true;
+        __atomic_store_n(&gAbort, true, __ATOMIC_RELAXED);
     }
 }
 
-int parseRun(const bool extraInfo, const bool doEpoch)
+#define PARSE_QUEUE_SIZE   (16 * 1024 * 1024)
+#define PARSE_FLUSH_ITEMS  32
+
+// Entry in the queue, followed by the message data resp. the epoch string (incl. nul)
+typedef struct PARSE_ITEM_s
 {
-    uint32_t nNmea = 0, sNmea = 0;
-    uint32_t nUbx  = 0, sUbx  = 0;
-    uint32_t nRtcm = 0, sRtcm = 0;
-    uint32_t nGarb = 0, sGarb = 0;
-    uint32_t nNova = 0, sNova = 0;
-    uint32_t nMsgs = 0, sMsgs = 0;
-    uint32_t nEpochs = 0;
-
-    gAbort = false;
-    signal(SIGINT, _sigHandler);
-    signal(SIGTERM, _sigHandler);
-    NOT_WIN( signal(SIGHUP, _sigHandler) );
+    bool             isEpoch;
+    PARSER_MSGTYPE_t type;
+    uint32_t         seq;
+    int              size;
+    char             name[PARSER_MAX_NAME_SIZE];
+} PARSE_ITEM_t;
+
+typedef struct PARSE_s
+{
+    QUEUE_t         *queue;
+    bool             doEpoch;
+    bool             live;     // Input is live (drop on overflow) or a file (wait on overflow)
+    bool             done;     // Reader has stopped
+    // Statistics (reader)
+    uint32_t         nNmea, sNmea;
+    uint32_t         nUbx,  sUbx;
+    uint32_t         nRtcm, sRtcm;
+    uint32_t         nGarb, sGarb;
+    uint32_t         nNova, sNova;
+    uint32_t         nMsgs, sMsgs;
+    uint32_t         nEpochs;
+} PARSE_t;
+
+static void _push(PARSE_t *parse, const PARSE_ITEM_t *item, const void *data)
+{
+    while (true)
+    {
+        uint8_t *entry = queuePushBegin(parse->queue, sizeof(*item) + item->size);
+        if (entry != NULL)
+        {
+            memcpy(entry, item, sizeof(*item));
+            memcpy(&entry[sizeof(*item)], data, item->size);
+            queuePushEnd(parse->queue);
+            break;
+        }
+        // Live input must never wait for the output, drop instead
+        else if (parse->live || __atomic_load_n(&gAbort, __ATOMIC_RELAXED))
+        {
+            if (!item->isEpoch) // Count only lost input data, not the derived epochs
+            {
+                queueDrop(parse->queue, item->size);
+            }
+            break;
+        }
+        // Input from a file can wait
+        else
+        {
+            SLEEP(1);
+        }
+    }
+}
+
+// Reader thread: read input, run parser, collect epochs and pass everything to the output (main thread)
+static void *_reader(void *arg)
+{
+    PARSE_t *parse = (PARSE_t *)arg;
 
     PARSER_t parser;
     parserInit(&parser);
@@ -81,7 +136,7 @@ int parseRun(const bool extraInfo, const bool doEpoch)
     EPOCH_t epoch;
     epochInit(&coll);
 
-    while (!gAbort)
+    while (!__atomic_load_n(&gAbort, __ATOMIC_RELAXED))
     {
         uint8_t buf[250];
         const int num = ioReadInput(buf, sizeof(buf));
@@ -97,70 +152,154 @@ int parseRun(const bool extraInfo, const bool doEpoch)
         parserAdd(&parser, buf, num);
 
         PARSER_MSG_t msg;
-        while (parserProcess(&parser, &msg, true))
+        while (parserProcess(&parser, &msg, false))
         {
-            nMsgs++;
-            sMsgs += msg.size;
+            parse->nMsgs++;
+            parse->sMsgs += msg.size;
+            switch (msg.type)
+            {
+                case PARSER_MSGTYPE_UBX:     parse->nUbx++;  parse->sUbx  += msg.size; break;
+                case PARSER_MSGTYPE_NMEA:    parse->nNmea++; parse->sNmea += msg.size; break;
+                case PARSER_MSGTYPE_RTCM3:   parse->nRtcm++; parse->sRtcm += msg.size; break;
+                case PARSER_MSGTYPE_NOVATEL: parse->nNova++; parse->sNova += msg.size; break;
+                case PARSER_MSGTYPE_GARBAGE: parse->nGarb++; parse->sGarb += msg.size; break;
+            }
 
-            if (doEpoch && epochCollect(&coll, &msg, &epoch))
+            if (parse->doEpoch && epochCollect(&coll, &msg, &epoch))
             {
-                nEpochs++;
-                ioOutputStr("epoch   %4d, size    0, NONE     EPOCH                %s\n", nEpochs, epoch.str);
+                parse->nEpochs++;
+                PARSE_ITEM_t item = { .isEpoch = true, .seq = parse->nEpochs, .size = strlen(epoch.str) + 1 };
+                _push(parse, &item, epoch.str);
             }
-            const char *prot = "?";
-            switch (msg.type)
+
+            PARSE_ITEM_t item = { .isEpoch = false, .type = msg.type, .seq = msg.seq, .size = msg.size };
+            snprintf(item.name, sizeof(item.name), "%s", msg.name);
+            _push(parse, &item, msg.data);
+        }
+    }
+
+    __atomic_store_n(&parse->done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+int parseRun(const bool extraInfo, const bool doEpoch)
+{
+    PARSE_t parse;
+    memset(&parse, 0, sizeof(parse));
+    parse.doEpoch = doEpoch;
+    parse.live = ioInputIsLive();
+    parse.queue = queueCreate(PARSE_QUEUE_SIZE);
+    if (parse.queue == NULL)
+    {
+        return EXIT_OTHERFAIL;
+    }
+
+    __atomic_store_n(&gAbort, false, __ATOMIC_RELAXED);
+    signal(SIGINT, _sigHandler);
+    signal(SIGTERM, _sigHandler);
+    NOT_WIN( signal(SIGHUP, _sigHandler) );
+
+    pthread_t readerThread;
+    if (pthread_create(&readerThread, NULL, _reader, &parse) != 0)
+    {
+        WARNING("Failed creating thread!");
+        queueDestroy(parse.queue);
+        return EXIT_OTHERFAIL;
+    }
+
+    // Output everything the reader gives us, until the reader is done and the queue is empty
+    bool res = true;
+    bool append = false;
+    int nPending = 0;
+    uint32_t nDropped = 0;
+    uint64_t sDropped = 0;
+    while (true)
+    {
+        const bool done = __atomic_load_n(&parse.done, __ATOMIC_ACQUIRE);
+        int size = 0;
+        const uint8_t *entry = res ? queuePopBegin(parse.queue, &size) : NULL;
+        if (entry != NULL)
+        {
+            QUEUE_STATS_t qstats;
+            queueGetStats(parse.queue, &qstats);
+            if (qstats.nDropped != nDropped)
             {
-                case PARSER_MSGTYPE_UBX:
-                    prot = "UBX";
-                    nUbx++;
-                    sUbx += msg.size;
-                    break;
-                case PARSER_MSGTYPE_NMEA:
-                    prot = "NMEA";
-                    nNmea++;
-                    sNmea += msg.size;
-                    break;
-                case PARSER_MSGTYPE_RTCM3:
-                    prot = "RTCM3";
-                    nRtcm++;
-                    sRtcm += msg.size;
-                    break;
-                case PARSER_MSGTYPE_NOVATEL:
-                    prot = "NOVATEL";
-                    nNova++;
-                    sNova += msg.size;
-                    break;
-                case PARSER_MSGTYPE_GARBAGE:
-                    prot = "GARBAGE";
-                    nGarb++;
-                    sGarb += msg.size;
-                    break;
+                ioOutputStr("overflow: dropped %u messages (%" PRIu64 " bytes)\n",
+                    qstats.nDropped - nDropped, qstats.sDropped - sDropped);
+                nDropped = qstats.nDropped;
+                sDropped = qstats.sDropped;
             }
-            ioOutputStr("message %4u, size %4d, %-8s %-20s %s\n",
-                msg.seq, msg.size, prot, msg.name, msg.info != NULL ? msg.info : "n/a");
-            if (extraInfo)
+
+            PARSE_ITEM_t item;
+            memcpy(&item, entry, sizeof(item));
+            const uint8_t *data = &entry[sizeof(item)];
+            if (item.isEpoch)
+            {
+                ioOutputStr("epoch   %4d, size    0, NONE     EPOCH                %s\n", item.seq, (const char *)data);
+            }
+            else
+            {
+                char info[PARSER_MAX_INFO_SIZE];
+                ioOutputStr("message %4u, size %4d, %-8s %-20s %s\n",
+                    item.seq, item.size, parserMsgtypeName(item.type), item.name,
+                    parserMessageInfo(info, sizeof(info), item.type, data, item.size) ? info : "n/a");
+                if (extraInfo)
+                {
+                    ioAddOutputHexdump(data, item.size);
+                }
+            }
+            queuePopEnd(parse.queue);
+            nPending++;
+        }
+
+        // Write output in batches, and when there's nothing more to do for now
+        if ( (nPending > 0) && ((entry == NULL) || (nPending >= PARSE_FLUSH_ITEMS)) )
+        {
+            if (!ioWriteOutput(append))
             {
-                ioAddOutputHexdump(msg.data, msg.size);
+                res = false;
+                __atomic_store_n(&gAbort, true, __ATOMIC_RELAXED);
             }
-            if (!ioWriteOutput(nMsgs == 1 ? false : true))
+            append = true;
+            nPending = 0;
+        }
+
+        if (entry == NULL)
+        {
+            if (done || !res)
             {
                 break;
             }
+            SLEEP(5);
         }
     }
 
-    ioOutputStr("stats UBX      count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nUbx,  nMsgs > 0 ? (double)nUbx  / (double)nMsgs * 1e2 : 0.0, sUbx,  sMsgs > 0 ? (double)sUbx  / (double)sMsgs * 1e2 : 0.0);
-    ioOutputStr("stats NMEA     count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nNmea, nMsgs > 0 ? (double)nNmea / (double)nMsgs * 1e2 : 0.0, sNmea, sMsgs > 0 ? (double)sNmea / (double)sMsgs * 1e2 : 0.0);
-    ioOutputStr("stats RTCM3    count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nRtcm, nMsgs > 0 ? (double)nRtcm / (double)nMsgs * 1e2 : 0.0, sRtcm, sMsgs > 0 ? (double)sRtcm / (double)sMsgs * 1e2 : 0.0);
-    ioOutputStr("stats NOVATEL  count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nNova, nMsgs > 0 ? (double)nNova / (double)nMsgs * 1e2 : 0.0, sNova, sMsgs > 0 ? (double)sNova / (double)sMsgs * 1e2 : 0.0);
-    ioOutputStr("stats GARBAGE  count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", nGarb, nMsgs > 0 ? (double)nGarb / (double)nMsgs * 1e2 : 0.0, sGarb, sMsgs > 0 ? (double)sGarb / (double)sMsgs * 1e2 : 0.0);
+    __atomic_store_n(&gAbort, true, __ATOMIC_RELAXED);
+    pthread_join(readerThread, NULL);
+
+    QUEUE_STATS_t qstats;
+    queueGetStats(parse.queue, &qstats);
+    queueDestroy(parse.queue);
+
+    const uint32_t nMsgs = parse.nMsgs;
+    const uint32_t sMsgs = parse.sMsgs;
+    ioOutputStr("stats UBX      count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", parse.nUbx,  nMsgs > 0 ? (double)parse.nUbx  / (double)nMsgs * 1e2 : 0.0, parse.sUbx,  sMsgs > 0 ? (double)parse.sUbx  / (double)sMsgs * 1e2 : 0.0);
+    ioOutputStr("stats NMEA     count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", parse.nNmea, nMsgs > 0 ? (double)parse.nNmea / (double)nMsgs * 1e2 : 0.0, parse.sNmea, sMsgs > 0 ? (double)parse.sNmea / (double)sMsgs * 1e2 : 0.0);
+    ioOutputStr("stats RTCM3    count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", parse.nRtcm, nMsgs > 0 ? (double)parse.nRtcm / (double)nMsgs * 1e2 : 0.0, parse.sRtcm, sMsgs > 0 ? (double)parse.sRtcm / (double)sMsgs * 1e2 : 0.0);
+    ioOutputStr("stats NOVATEL  count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", parse.nNova, nMsgs > 0 ? (double)parse.nNova / (double)nMsgs * 1e2 : 0.0, parse.sNova, sMsgs > 0 ? (double)parse.sNova / (double)sMsgs * 1e2 : 0.0);
+    ioOutputStr("stats GARBAGE  count %6u (%5.1f%%)  size %10u (%5.1f%%)\n", parse.nGarb, nMsgs > 0 ? (double)parse.nGarb / (double)nMsgs * 1e2 : 0.0, parse.sGarb, sMsgs > 0 ? (double)parse.sGarb / (double)sMsgs * 1e2 : 0.0);
     ioOutputStr("stats Total    count %6u (100.0%%)  size %10u (100.0%%)\n", nMsgs, sMsgs);
     if (doEpoch)
     {
-        ioOutputStr("stats EPOCH    count %5u (%5.1f%%)\n", nEpochs, nMsgs > 0 ? (double)nEpochs / (double)nMsgs * 1e2 : 0.0);
+        ioOutputStr("stats EPOCH    count %5u (%5.1f%%)\n", parse.nEpochs, nMsgs > 0 ? (double)parse.nEpochs / (double)nMsgs * 1e2 : 0.0);
+    }
+    if (parse.live)
+    {
+        ioOutputStr("stats Queue    dropped %u (%" PRIu64 " bytes), max fill %u of %u bytes\n",
+            qstats.nDropped, qstats.sDropped, qstats.maxFill, qstats.size);
     }
 
-    return ioWriteOutput(true) ? EXIT_SUCCESS : EXIT_OTHERFAIL;
+    return (ioWriteOutput(append) && res) ? EXIT_SUCCESS : EXIT_OTHERFAIL;
 }
 
 /* ****************************************************************************************************************** */
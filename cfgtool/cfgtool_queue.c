@@ -0,0 +1,187 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+
+#include "cfgtool_util.h"
+
+#include "cfgtool_queue.h"
+
+/* ****************************************************************************************************************** */
+
+// Each entry starts with a header, entries are aligned to 8 bytes. An entry never wraps around the end of the ring
+// buffer. A padding entry is inserted instead, which the consumer skips.
+typedef struct QUEUE_HEAD_s
+{
+    uint32_t size;    // Entry size (without header)
+    uint32_t padding; // 1 = padding entry, 0 = real entry
+} QUEUE_HEAD_t;
+
+#define QUEUE_ALIGN(_size_) ( ((_size_) + 7) & ~7 )
+#define QUEUE_ENTRY_SIZE(_size_) ( (uint32_t)sizeof(QUEUE_HEAD_t) + QUEUE_ALIGN((uint32_t)(_size_)) )
+
+struct QUEUE_s
+{
+    uint8_t          *buf;
+    uint32_t          size;
+    uint32_t          mask;
+
+    // Producer, and shared with the consumer (atomic)
+    uint32_t          head;
+    uint8_t           _pad0[64 - sizeof(uint32_t)]; // keep head and tail in separate cache lines
+    uint32_t          pushHead; // head after the entry being pushed
+    uint32_t          maxFill;
+    uint32_t          nPushed;
+    uint32_t          nDropped;
+    uint64_t          sDropped;
+    uint8_t           _pad1[64];
+
+    // Consumer, and shared with the producer (atomic)
+    uint32_t          tail;
+    uint8_t           _pad2[64 - sizeof(uint32_t)];
+    uint32_t          popTail; // tail after the entry being popped
+};
+
+#define _LOAD(_var_)            __atomic_load_n(&(_var_), __ATOMIC_ACQUIRE)
+#define _STORE(_var_, _val_)    __atomic_store_n(&(_var_), (_val_), __ATOMIC_RELEASE)
+#define _LOAD_RELAXED(_var_)    __atomic_load_n(&(_var_), __ATOMIC_RELAXED)
+#define _STORE_RELAXED(_var_, _val_) __atomic_store_n(&(_var_), (_val_), __ATOMIC_RELAXED)
+
+QUEUE_t *queueCreate(const uint32_t size)
+{
+    uint32_t bufSize = 1024;
+    while ( (bufSize < size) && (bufSize < ((uint32_t)1 << 30)) )
+    {
+        bufSize <<= 1;
+    }
+    QUEUE_t *queue = malloc(sizeof(QUEUE_t));
+    uint8_t *buf = malloc(bufSize);
+    if ( (queue == NULL) || (buf == NULL) )
+    {
+        WARNING("malloc fail");
+        free(queue);
+        free(buf);
+        return NULL;
+    }
+    memset(queue, 0, sizeof(*queue));
+    queue->buf  = buf;
+    queue->size = bufSize;
+    queue->mask = bufSize - 1;
+    return queue;
+}
+
+void queueDestroy(QUEUE_t *queue)
+{
+    if (queue != NULL)
+    {
+        free(queue->buf);
+        free(queue);
+    }
+}
+
+void *queuePushBegin(QUEUE_t *queue, const int size)
+{
+    const uint32_t entrySize = QUEUE_ENTRY_SIZE(size);
+    if ( (size < 0) || (entrySize > (queue->size / 2)) )
+    {
+        return NULL;
+    }
+    uint32_t head = queue->head;
+    const uint32_t tail = _LOAD(queue->tail);
+    const uint32_t avail = queue->size - (head - tail);
+    const uint32_t pos = head & queue->mask;
+    const uint32_t contiguous = queue->size - pos;
+
+    // Entry doesn't fit at the end, pad and start at the beginning
+    if (contiguous < entrySize)
+    {
+        if (avail < (contiguous + entrySize))
+        {
+            return NULL;
+        }
+        QUEUE_HEAD_t pad = { .size = contiguous - sizeof(QUEUE_HEAD_t), .padding = 1 };
+        memcpy(&queue->buf[pos], &pad, sizeof(pad));
+        head += contiguous;
+    }
+    else if (avail < entrySize)
+    {
+        return NULL;
+    }
+
+    uint8_t *entry = &queue->buf[head & queue->mask];
+    QUEUE_HEAD_t hdr = { .size = size, .padding = 0 };
+    memcpy(entry, &hdr, sizeof(hdr));
+    queue->pushHead = head + entrySize;
+    return entry + sizeof(QUEUE_HEAD_t);
+}
+
+void queuePushEnd(QUEUE_t *queue)
+{
+    _STORE(queue->head, queue->pushHead);
+    const uint32_t fill = queue->pushHead - _LOAD(queue->tail);
+    if (fill > queue->maxFill)
+    {
+        _STORE_RELAXED(queue->maxFill, fill);
+    }
+    _STORE_RELAXED(queue->nPushed, queue->nPushed + 1);
+}
+
+void queueDrop(QUEUE_t *queue, const int size)
+{
+    _STORE_RELAXED(queue->nDropped, queue->nDropped + 1);
+    _STORE_RELAXED(queue->sDropped, queue->sDropped + size);
+}
+
+const void *queuePopBegin(QUEUE_t *queue, int *size)
+{
+    uint32_t tail = queue->tail;
+    const uint32_t head = _LOAD(queue->head);
+    while (tail != head)
+    {
+        const uint8_t *entry = &queue->buf[tail & queue->mask];
+        QUEUE_HEAD_t hdr;
+        memcpy(&hdr, entry, sizeof(hdr));
+        if (hdr.padding != 0)
+        {
+            tail += sizeof(QUEUE_HEAD_t) + hdr.size;
+            _STORE(queue->tail, tail);
+            continue;
+        }
+        *size = hdr.size;
+        queue->popTail = tail + QUEUE_ENTRY_SIZE(hdr.size);
+        return entry + sizeof(QUEUE_HEAD_t);
+    }
+    return NULL;
+}
+
+void queuePopEnd(QUEUE_t *queue)
+{
+    _STORE(queue->tail, queue->popTail);
+}
+
+void queueGetStats(QUEUE_t *queue, QUEUE_STATS_t *stats)
+{
+    stats->size     = queue->size;
+    stats->maxFill  = _LOAD_RELAXED(queue->maxFill);
+    stats->nPushed  = _LOAD_RELAXED(queue->nPushed);
+    stats->nDropped = _LOAD_RELAXED(queue->nDropped);
+    stats->sDropped = _LOAD_RELAXED(queue->sDropped);
+}
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,63 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef __CFGTOOL_QUEUE_H__
+#define __CFGTOOL_QUEUE_H__
+
+/* ****************************************************************************************************************** */
+
+// Lock-free single-producer single-consumer (SPSC) queue of variable size entries in a fixed size ring buffer. One
+// thread may push entries, another thread may pop them. Nothing blocks. If there's no room for an entry the producer
+// decides what to do: wait and retry, or drop it (and count it using queueDrop()).
+
+typedef struct QUEUE_s QUEUE_t;
+
+typedef struct QUEUE_STATS_s
+{
+    uint32_t size;      // Size of the ring buffer [bytes]
+    uint32_t maxFill;   // Maximum fill level seen [bytes]
+    uint32_t nPushed;   // Number of entries pushed
+    uint32_t nDropped;  // Number of entries dropped by the producer (see queueDrop())
+    uint64_t sDropped;  // Size of entries dropped by the producer [bytes]
+} QUEUE_STATS_t;
+
+// Create queue, size is rounded up to the next power of two
+QUEUE_t *queueCreate(const uint32_t size);
+
+// Destroy queue (all entries are discarded)
+void queueDestroy(QUEUE_t *queue);
+
+// Producer: get space for a new entry, returns NULL if there is no room. The entry becomes visible to the consumer
+// only after queuePushEnd().
+void *queuePushBegin(QUEUE_t *queue, const int size);
+void queuePushEnd(QUEUE_t *queue);
+
+// Producer: count a dropped entry (for the statistics)
+void queueDrop(QUEUE_t *queue, const int size);
+
+// Consumer: get next entry, returns NULL if the queue is empty. The entry remains valid until queuePopEnd().
+const void *queuePopBegin(QUEUE_t *queue, int *size);
+void queuePopEnd(QUEUE_t *queue);
+
+// Any thread: get statistics
+void queueGetStats(QUEUE_t *queue, QUEUE_STATS_t *stats);
+
+/* ****************************************************************************************************************** */
+#endif // __CFGTOOL_QUEUE_H__
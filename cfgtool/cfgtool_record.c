@@ -0,0 +1,667 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <signal.h>
+#include <inttypes.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#ifdef FF_HAVE_ZLIB
+#  include <zlib.h>
+#endif
+
+#include "cfgtool_util.h"
+
+#include "ff_rx.h"
+
+#include "cfgtool_record.h"
+
+/* ****************************************************************************************************************** */
+
+const char *recordHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'record':\n"
+"\n"
+"    Usage: cfgtool record -p <port> -o <outfile> [-y] [-n] [-R <rotate>] [-z]\n"
+"                          [-x]\n"
+"\n"
+"    Connects to the receiver and writes the received data unmodified to the\n"
+"    output file until SIGINT (e.g. CTRL-C)" NOT_WIN(", SIGHUP") " or SIGTERM is received.\n"
+"\n"
+"    Data is written by a separate thread, so that reading from the receiver\n"
+"    never waits for the disk. If the disk cannot keep up, data is dropped and\n"
+"    the number of dropped bytes is reported.\n"
+"\n"
+"    -R <rotate>  Start a new output file after the given size ('k', 'M' or\n"
+"                 'G' suffix, e.g. '100M') or time ('s', 'min' or 'h' suffix,\n"
+"                 e.g. '1h'). The files are named <outfile> with a sequence\n"
+"                 number inserted before the extension, e.g. log_0001.ubx.\n"
+"    -z           Compress (gzip) closed files to .ubz in the background\n"
+#ifndef FF_HAVE_ZLIB
+"                 (not available in this build)\n"
+#endif
+"    -x           Write a receive time file (<outfile>.ts), with one line\n"
+"                 '<offset> <size> <time>' per chunk of received data, where\n"
+"                 <time> is the wall clock time in [ns] since 1970\n"
+"\n"
+"    Examples:\n"
+"\n"
+#ifdef _WIN32
+"        cfgtool record -p COM3 -o log.ubx -R 1h -z\n"
+#else
+"        cfgtool record -p /dev/ttyACM0 -o log.ubx -R 1h -z\n"
+#endif
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+#define RECORD_BUF_SIZE     (4 * 1024 * 1024) // Size of each of the two buffers
+#define RECORD_BUF_MAX_TS   50000             // Maximum number of receive time records in a buffer
+#define RECORD_BUF_MAX_ROT  10000             // Maximum number of file rotations in a buffer
+#define RECORD_SWAP_SIZE    (64 * 1024)       // Hand over buffer to the writer at this size...
+#define RECORD_SWAP_TIME    200               // ...or after this time [ms]
+#define RECORD_MAX_COMPRESS 100               // Maximum number of files waiting for compression
+
+typedef struct RECORD_TS_s
+{
+    uint64_t offs;
+    int      size;
+    uint64_t ts;
+} RECORD_TS_t;
+
+typedef struct RECORD_ROT_s
+{
+    int          offs;       // Start new file at this offset in data
+    int          ts;         // ...and at this receive time record
+} RECORD_ROT_t;
+
+typedef struct RECORD_BUF_s
+{
+    uint8_t      data[RECORD_BUF_SIZE];
+    int          size;
+    RECORD_TS_t  ts[RECORD_BUF_MAX_TS];
+    int          nTs;
+    RECORD_ROT_t rot[RECORD_BUF_MAX_ROT];
+    int          nRot;
+} RECORD_BUF_t;
+
+typedef struct RECORD_s
+{
+    // Configuration
+    const char      *outName;
+    bool             overwrite;
+    bool             doTs;
+    bool             compress;
+    uint64_t         rotateSize;  // [bytes], 0 = don't rotate by size
+    uint32_t         rotateTime;  // [ms], 0 = don't rotate by time
+
+    // Reader (main thread)
+    RECORD_BUF_t    *fill;        // Buffer being filled by the reader
+    uint64_t         fileOffs;    // Offset in the current file
+    uint32_t         fileStart;   // Time when current file was started
+    uint32_t         lastSwap;
+    uint64_t         nBytes;
+    uint64_t         nDropped;
+    uint64_t         nDroppedReported;
+
+    // Writer thread
+    pthread_t        writerThread;
+    pthread_mutex_t  mutex;
+    pthread_cond_t   cond;
+    RECORD_BUF_t    *full;        // Buffer handed over to the writer, NULL if the writer is idle
+    bool             done;        // No more data for the writer
+    bool             fail;        // Writer failed
+    FILE            *file;
+    FILE            *tsFile;
+    char             fileName[1000];
+    int              fileNr;
+    uint64_t         nWritten;
+
+    // Compression thread
+    pthread_t        compressThread;
+    pthread_cond_t   compressCond;
+    char             compressFiles[RECORD_MAX_COMPRESS][1000];
+    int              nCompress;
+    bool             compressDone;
+} RECORD_t;
+
+static bool gAbort;
+
+static void _sigHandler(int signal)
+{
+    if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
+    {
+        PRINT("Aborting...");
+        gAbort = true;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _parseRotate(const char *str, uint64_t *size, uint32_t *time)
+{
+    double val = 0.0;
+    int n = 0;
+    if ( (sscanf(str, "%lf%n", &val, &n) != 1) || (val <= 0.0) )
+    {
+        return false;
+    }
+    const char *unit = &str[n];
+    if      (strcmp(unit, "k")   == 0) { *size = (uint64_t)(val * 1024.0); }
+    else if (strcmp(unit, "M")   == 0) { *size = (uint64_t)(val * 1024.0 * 1024.0); }
+    else if (strcmp(unit, "G")   == 0) { *size = (uint64_t)(val * 1024.0 * 1024.0 * 1024.0); }
+    else if (strcmp(unit, "s")   == 0) { *time = (uint32_t)(val * 1e3); }
+    else if (strcmp(unit, "min") == 0) { *time = (uint32_t)(val * 60e3); }
+    else if (strcmp(unit, "h")   == 0) { *time = (uint32_t)(val * 3600e3); }
+    else
+    {
+        return false;
+    }
+    return (*size >= 1024) || (*time >= 1000);
+}
+
+// Output file name, with sequence number if rotating: log.ubx --> log_0001.ubx
+static void _fileName(const RECORD_t *record, char *name, const int size, const int nr)
+{
+    if ( (record->rotateSize == 0) && (record->rotateTime == 0) )
+    {
+        snprintf(name, size, "%s", record->outName);
+        return;
+    }
+    const char *slash = strrchr(record->outName, '/');
+    const char *dot = strrchr(record->outName, '.');
+    if ( (dot == NULL) || ((slash != NULL) && (dot < slash)) || (dot == record->outName) )
+    {
+        snprintf(name, size, "%s_%04d", record->outName, nr);
+    }
+    else
+    {
+        snprintf(name, size, "%.*s_%04d%s", (int)(dot - record->outName), record->outName, nr, dot);
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifdef FF_HAVE_ZLIB
+static bool _compressFile(const char *name)
+{
+    char zName[1010];
+    snprintf(zName, sizeof(zName), "%s", name);
+    char *dot = strrchr(zName, '.');
+    if ( (dot != NULL) && (strcmp(dot, ".ubx") == 0) )
+    {
+        strcpy(dot, ".ubz");
+    }
+    else
+    {
+        strcat(zName, ".ubz");
+    }
+
+    FILE *in = fopen(name, "rb");
+    gzFile out = gzopen(zName, "wb");
+    bool res = (in != NULL) && (out != NULL);
+    while (res)
+    {
+        uint8_t buf[64 * 1024];
+        const int num = fread(buf, 1, sizeof(buf), in);
+        if (num <= 0)
+        {
+            break;
+        }
+        res = (gzwrite(out, buf, num) == num);
+    }
+    if (in != NULL)
+    {
+        fclose(in);
+    }
+    if ( (out != NULL) && (gzclose(out) != Z_OK) )
+    {
+        res = false;
+    }
+    if (res)
+    {
+        remove(name);
+        DEBUG("Compressed '%s' to '%s'", name, zName);
+    }
+    else
+    {
+        WARNING("Failed compressing '%s' to '%s'!", name, zName);
+        remove(zName);
+    }
+    return res;
+}
+#endif
+
+static void *_compressThread(void *arg)
+{
+    RECORD_t *record = (RECORD_t *)arg;
+    pthread_mutex_lock(&record->mutex);
+    while (true)
+    {
+        while ( (record->nCompress == 0) && !record->compressDone )
+        {
+            pthread_cond_wait(&record->compressCond, &record->mutex);
+        }
+        if (record->nCompress == 0)
+        {
+            break;
+        }
+        char name[sizeof(record->compressFiles[0])];
+        memcpy(name, record->compressFiles[0], sizeof(name));
+        record->nCompress--;
+        memmove(&record->compressFiles[0], &record->compressFiles[1], record->nCompress * sizeof(record->compressFiles[0]));
+        pthread_mutex_unlock(&record->mutex);
+#ifdef FF_HAVE_ZLIB
+        _compressFile(name);
+#endif
+        pthread_mutex_lock(&record->mutex);
+    }
+    pthread_mutex_unlock(&record->mutex);
+    return NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _writerOpen(RECORD_t *record)
+{
+    record->fileNr++;
+    _fileName(record, record->fileName, sizeof(record->fileName), record->fileNr);
+    if (!record->overwrite && (access(record->fileName, F_OK) == 0))
+    {
+        WARNING("Failed opening '%s': File already exists!", record->fileName);
+        return false;
+    }
+    record->file = fopen(record->fileName, "wb");
+    if (record->file == NULL)
+    {
+        WARNING("Failed opening '%s': %s", record->fileName, strerror(errno));
+        return false;
+    }
+    if (record->doTs)
+    {
+        char tsName[1010];
+        snprintf(tsName, sizeof(tsName), "%s.ts", record->fileName);
+        record->tsFile = fopen(tsName, "w");
+        if (record->tsFile == NULL)
+        {
+            WARNING("Failed opening '%s': %s", tsName, strerror(errno));
+            return false;
+        }
+    }
+    PRINT("Writing to '%s'.", record->fileName);
+    return true;
+}
+
+static bool _writerClose(RECORD_t *record)
+{
+    bool res = true;
+    if (record->file != NULL)
+    {
+        res = (fflush(record->file) == 0);
+        NOT_WIN( res = res && (fsync(fileno(record->file)) == 0) );
+        res = (fclose(record->file) == 0) && res;
+        record->file = NULL;
+    }
+    if (record->tsFile != NULL)
+    {
+        res = (fclose(record->tsFile) == 0) && res;
+        record->tsFile = NULL;
+    }
+    if (!res)
+    {
+        WARNING("Failed writing '%s'!", record->fileName);
+    }
+
+    // Queue for compression
+    if (res && record->compress)
+    {
+        pthread_mutex_lock(&record->mutex);
+        if (record->nCompress < RECORD_MAX_COMPRESS)
+        {
+            snprintf(record->compressFiles[record->nCompress], sizeof(record->compressFiles[0]), "%s", record->fileName);
+            record->nCompress++;
+            pthread_cond_signal(&record->compressCond);
+        }
+        else
+        {
+            WARNING("Too many files waiting for compression, not compressing '%s'!", record->fileName);
+        }
+        pthread_mutex_unlock(&record->mutex);
+    }
+    return res;
+}
+
+static bool _writerWrite(RECORD_t *record, const uint8_t *data, const int size, const RECORD_TS_t *ts, const int nTs)
+{
+    if ( (size > 0) && (record->file == NULL) && !_writerOpen(record) )
+    {
+        return false;
+    }
+    bool res = true;
+    if (size > 0)
+    {
+        res = (fwrite(data, size, 1, record->file) == 1) && (fflush(record->file) == 0);
+        record->nWritten += size;
+    }
+    for (int ix = 0; res && (record->tsFile != NULL) && (ix < nTs); ix++)
+    {
+        res = (fprintf(record->tsFile, "%" PRIu64 " %d %" PRIu64 "\n", ts[ix].offs, ts[ix].size, ts[ix].ts) > 0);
+    }
+    if (!res)
+    {
+        WARNING("Failed writing '%s': %s", record->fileName, strerror(errno));
+    }
+    return res;
+}
+
+static bool _writerWriteBuf(RECORD_t *record, const RECORD_BUF_t *buf)
+{
+    // Write up to each rotation point, then close the file, and write the rest
+    int offs = 0;
+    int tsIx = 0;
+    for (int ix = 0; ix < buf->nRot; ix++)
+    {
+        const RECORD_ROT_t *rot = &buf->rot[ix];
+        if ( !_writerWrite(record, &buf->data[offs], rot->offs - offs, &buf->ts[tsIx], rot->ts - tsIx) ||
+             ( (record->file != NULL) && !_writerClose(record) ) )
+        {
+            return false;
+        }
+        offs = rot->offs;
+        tsIx = rot->ts;
+    }
+    return _writerWrite(record, &buf->data[offs], buf->size - offs, &buf->ts[tsIx], buf->nTs - tsIx);
+}
+
+static void *_writerThread(void *arg)
+{
+    RECORD_t *record = (RECORD_t *)arg;
+    pthread_mutex_lock(&record->mutex);
+    while (true)
+    {
+        while ( (record->full == NULL) && !record->done )
+        {
+            pthread_cond_wait(&record->cond, &record->mutex);
+        }
+        if (record->full == NULL)
+        {
+            break;
+        }
+        RECORD_BUF_t *buf = record->full;
+        pthread_mutex_unlock(&record->mutex);
+
+        const bool res = _writerWriteBuf(record, buf);
+        buf->size = 0;
+        buf->nTs = 0;
+        buf->nRot = 0;
+
+        pthread_mutex_lock(&record->mutex);
+        record->full = NULL;
+        if (!res)
+        {
+            record->fail = true;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&record->mutex);
+    if (record->file != NULL)
+    {
+        _writerClose(record);
+    }
+    return NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Hand over the fill buffer to the writer, if the writer is idle. Never blocks.
+static bool _readerSwap(RECORD_t *record, RECORD_BUF_t **other)
+{
+    bool res = false;
+    pthread_mutex_lock(&record->mutex); // only held briefly by the writer
+    if (record->full == NULL)
+    {
+        record->full = record->fill;
+        record->fill = *other;
+        *other = record->full;
+        pthread_cond_signal(&record->cond);
+        res = true;
+    }
+    pthread_mutex_unlock(&record->mutex);
+    return res;
+}
+
+static void _readerAdd(RECORD_t *record, RECORD_BUF_t **other, const PARSER_MSG_t *msg)
+{
+    const uint32_t now = TIME();
+
+    // Rotate? At message boundaries only, as often as needed (a small size limit can rotate many times per buffer)
+    RECORD_BUF_t *buf = record->fill;
+    const bool rotate = (record->fileOffs > 0) &&
+        ( ((record->rotateSize > 0) && ((record->fileOffs + msg->size) > record->rotateSize)) ||
+          ((record->rotateTime > 0) && ((now - record->fileStart) >= record->rotateTime)) );
+    if (rotate && (buf->nRot >= RECORD_BUF_MAX_ROT) && _readerSwap(record, other))
+    {
+        buf = record->fill;
+    }
+
+    record->nBytes += msg->size;
+    if ( ((buf->size + msg->size) > RECORD_BUF_SIZE) || (record->doTs && (buf->nTs >= RECORD_BUF_MAX_TS)) ||
+         (rotate && (buf->nRot >= RECORD_BUF_MAX_ROT)) )
+    {
+        record->nDropped += msg->size;
+        return;
+    }
+    if (rotate)
+    {
+        buf->rot[buf->nRot].offs = buf->size;
+        buf->rot[buf->nRot].ts = buf->nTs;
+        buf->nRot++;
+        record->fileOffs = 0;
+        record->fileStart = now;
+    }
+    memcpy(&buf->data[buf->size], msg->data, msg->size);
+    buf->size += msg->size;
+    if (record->doTs)
+    {
+        RECORD_TS_t *ts = &buf->ts[buf->nTs++];
+        ts->offs = record->fileOffs;
+        ts->size = msg->size;
+        ts->ts   = msg->tsReal != 0 ? msg->tsReal : TIME_NS_REAL();
+    }
+    record->fileOffs += msg->size;
+    if (record->fileStart == 0)
+    {
+        record->fileStart = now;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+int recordRun(const char *portArg, const char *outName, const bool overwrite, const bool noProbe,
+    const char *rotate, const bool compress, const bool doTs)
+{
+    RECORD_t *record = calloc(1, sizeof(RECORD_t));
+    RECORD_BUF_t *bufs = calloc(2, sizeof(RECORD_BUF_t));
+    if ( (record == NULL) || (bufs == NULL) )
+    {
+        WARNING("malloc fail!");
+        free(record);
+        free(bufs);
+        return EXIT_OTHERFAIL;
+    }
+    bool res = true;
+    if ( (outName == NULL) || (strcmp(outName, "-") == 0) )
+    {
+        WARNING("Need '-o <outfile>' argument!");
+        res = false;
+    }
+    if ( res && (rotate != NULL) && !_parseRotate(rotate, &record->rotateSize, &record->rotateTime) )
+    {
+        WARNING("Illegal argument '-R %s'!", rotate);
+        res = false;
+    }
+#ifndef FF_HAVE_ZLIB
+    if (res && compress)
+    {
+        WARNING("Compression (-z) is not available in this build!");
+        res = false;
+    }
+#endif
+    if (!res)
+    {
+        free(record);
+        free(bufs);
+        return EXIT_BADARGS;
+    }
+    record->outName   = outName;
+    record->overwrite = overwrite;
+    record->compress  = compress;
+    record->doTs      = doTs;
+    record->fill      = &bufs[0];
+    RECORD_BUF_t *other = &bufs[1];
+
+    RX_ARGS_t args = RX_ARGS_DEFAULT();
+    if (noProbe)
+    {
+        args.autobaud = false;
+        args.detect   = false;
+    }
+    RX_t *rx = rxInit(portArg, &args);
+    if ( (rx == NULL) || !rxOpen(rx) )
+    {
+        free(rx);
+        free(record);
+        free(bufs);
+        return EXIT_RXFAIL;
+    }
+
+    pthread_mutex_init(&record->mutex, NULL);
+    pthread_cond_init(&record->cond, NULL);
+    pthread_cond_init(&record->compressCond, NULL);
+    const bool haveWriter = (pthread_create(&record->writerThread, NULL, _writerThread, record) == 0);
+    const bool haveCompress = haveWriter && (pthread_create(&record->compressThread, NULL, _compressThread, record) == 0);
+    if (!haveWriter || !haveCompress)
+    {
+        WARNING("Failed creating threads!");
+        if (haveWriter)
+        {
+            pthread_mutex_lock(&record->mutex);
+            record->done = true;
+            pthread_cond_signal(&record->cond);
+            pthread_mutex_unlock(&record->mutex);
+            pthread_join(record->writerThread, NULL);
+        }
+        pthread_cond_destroy(&record->compressCond);
+        pthread_cond_destroy(&record->cond);
+        pthread_mutex_destroy(&record->mutex);
+        rxClose(rx);
+        free(rx);
+        free(record);
+        free(bufs);
+        return EXIT_OTHERFAIL;
+    }
+
+    gAbort = false;
+    signal(SIGINT, _sigHandler);
+    signal(SIGTERM, _sigHandler);
+    NOT_WIN( signal(SIGHUP, _sigHandler) );
+
+    PRINT("Recording received data...");
+    uint32_t nMsgs = 0;
+    uint32_t lastReport = TIME();
+    record->lastSwap = TIME();
+    while (!gAbort)
+    {
+        PARSER_MSG_t *msg = rxGetNextMessageTimeout(rx, 50);
+        if (msg != NULL)
+        {
+            nMsgs++;
+            _readerAdd(record, &other, msg);
+        }
+
+        const uint32_t now = TIME();
+        if ( ((record->fill->size > 0) || (record->fill->nRot > 0)) &&
+             ( (record->fill->size >= RECORD_SWAP_SIZE) || ((now - record->lastSwap) >= RECORD_SWAP_TIME) ) )
+        {
+            if (_readerSwap(record, &other))
+            {
+                record->lastSwap = now;
+            }
+        }
+
+        if ( (now - lastReport) >= 1000 )
+        {
+            lastReport = now;
+            pthread_mutex_lock(&record->mutex);
+            const bool fail = record->fail;
+            pthread_mutex_unlock(&record->mutex);
+            if (fail)
+            {
+                break;
+            }
+            if (record->nDropped != record->nDroppedReported)
+            {
+                WARNING("Dropped %" PRIu64 " bytes (total %" PRIu64 " bytes), disk too slow!",
+                    record->nDropped - record->nDroppedReported, record->nDropped);
+                record->nDroppedReported = record->nDropped;
+            }
+        }
+    }
+    rxClose(rx);
+    free(rx);
+
+    // Write remaining data, stop writer, then stop compression (after it has compressed the last file)
+    while ( (record->fill->size > 0) && !_readerSwap(record, &other) )
+    {
+        SLEEP(10);
+    }
+    pthread_mutex_lock(&record->mutex);
+    record->done = true;
+    pthread_cond_signal(&record->cond);
+    pthread_mutex_unlock(&record->mutex);
+    pthread_join(record->writerThread, NULL);
+
+    pthread_mutex_lock(&record->mutex);
+    record->compressDone = true;
+    pthread_cond_signal(&record->compressCond);
+    if (record->nCompress > 0)
+    {
+        PRINT("Waiting for compression of %d file(s)...", record->nCompress);
+    }
+    pthread_mutex_unlock(&record->mutex);
+    pthread_join(record->compressThread, NULL);
+
+    pthread_cond_destroy(&record->compressCond);
+    pthread_cond_destroy(&record->cond);
+    pthread_mutex_destroy(&record->mutex);
+
+    PRINT("Received %u messages, %" PRIu64 " bytes, wrote %" PRIu64 " bytes to %d file(s), dropped %" PRIu64 " bytes",
+        nMsgs, record->nBytes, record->nWritten, record->fileNr, record->nDropped);
+    const bool fail = record->fail;
+    free(record);
+    free(bufs);
+
+    return fail ? EXIT_OTHERFAIL : (nMsgs > 0 ? EXIT_SUCCESS : EXIT_RXNODATA);
+}
+
+/* ****************************************************************************************************************** */
+// eof
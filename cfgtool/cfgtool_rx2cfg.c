@@ -72,6 +72,7 @@ typedef struct CFG_DB_REC_s
 {
     UBLOXCFG_KEYVAL_t      kv;
     const UBLOXCFG_ITEM_t *item;
+    const char            *valStr; // Stringified value, NULL if it didn't fit into CFG_DB_t.valStrs
     bool                   flag;
 } CFG_DB_REC_t;
 
@@ -82,11 +83,14 @@ typedef struct CFG_DB_s
     int              nKv;
     int              nKvKnown;
     int              nKvUnknown;
+    char             valStrs[MAX_ITEMS * 100];
 } CFG_DB_t;
 
 // Forward declarations
 static CFG_DB_t *_getCfgDb(RX_t *rx, const UBLOXCFG_LAYER_t layer);
+static const CFG_DB_REC_t *_dbFindRec(const CFG_DB_t *db, const uint32_t id);
 static const UBLOXCFG_KEYVAL_t *_dbFindKeyVal(const CFG_DB_t *db, const uint32_t id);
+static bool _dbValStr(const CFG_DB_REC_t *rec, char *str, const int size);
 static void _dbFlag(CFG_DB_t *db, const uint32_t id);
 
 /* ****************************************************************************************************************** */
@@ -105,7 +109,7 @@ typedef struct PORT_CFG_s
 
 static bool _portCfgStr(const PORT_CFG_t *cfg, const CFG_DB_t *db, char *str, const int size);
 static bool _rateCfgStr(const UBLOXCFG_MSGRATE_t *cfg, const CFG_DB_t *db, char *str, const int size);
-static bool _itemCfgStr(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item, char *str, const int size);
+static bool _itemCfgStr(const CFG_DB_REC_t *rec, char *str, const int size);
 
 int rx2cfgRun(const char *portArg, const char *layerArg, const bool useUnknownItems)
 {
@@ -285,25 +289,26 @@ int rx2cfgRun(const char *portArg, const char *layerArg, const bool useUnknownIt
     // All the remaining items
     for (int ix = 0; ix < dbLayer->nKv; ix++)
     {
-        const UBLOXCFG_KEYVAL_t *kvLayer = &dbLayer->recs[ix].kv;
-        const UBLOXCFG_ITEM_t *item = dbLayer->recs[ix].item; // NULL if item is unknown
+        const CFG_DB_REC_t *recLayer = &dbLayer->recs[ix];
+        const UBLOXCFG_KEYVAL_t *kvLayer = &recLayer->kv;
+        const UBLOXCFG_ITEM_t *item = recLayer->item; // NULL if item is unknown
 
         // Skip those used above, and unknown items unless we want to output them
-        if ( dbLayer->recs[ix].flag || ((item == NULL) && !useUnknownItems) )
+        if ( recLayer->flag || ((item == NULL) && !useUnknownItems) )
         {
             continue;
         }
 
-        const UBLOXCFG_KEYVAL_t *kvDefault = _dbFindKeyVal(dbDefault, kvLayer->id);
-        if (kvDefault == NULL)
+        const CFG_DB_REC_t *recDefault = _dbFindRec(dbDefault, kvLayer->id);
+        if (recDefault == NULL)
         {
             continue;
         }
 
         char cfgStrLayer[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-        const bool haveCfgStrLayer = _itemCfgStr(kvLayer, item, cfgStrLayer, sizeof(cfgStrLayer));
+        const bool haveCfgStrLayer = _itemCfgStr(recLayer, cfgStrLayer, sizeof(cfgStrLayer));
         char cfgStrDefault[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-        const bool haveCfgStrDefault = _itemCfgStr(kvDefault, item, cfgStrDefault, sizeof(cfgStrDefault));
+        const bool haveCfgStrDefault = _itemCfgStr(recDefault, cfgStrDefault, sizeof(cfgStrDefault));
         if (!haveCfgStrLayer || !haveCfgStrDefault)
         {
             continue;
@@ -365,7 +370,7 @@ int rx2cfgRun(const char *portArg, const char *layerArg, const bool useUnknownIt
 
 /* ****************************************************************************************************************** */
 
-static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_KEYVAL_t *defaultKv);
+static void _addOutputKeyValuePair(const CFG_DB_REC_t *rec, const CFG_DB_REC_t *defaultRec);
 
 int rx2listRun(const char *portArg, const char *layerArg, const bool useUnknownItems)
 {
@@ -423,19 +428,18 @@ int rx2listRun(const char *portArg, const char *layerArg, const bool useUnknownI
         layerName, useUnknownItems ? dbLayer->nKv : dbLayer->nKvKnown, dbLayer->nKv);
     for (int ix = 0; ix < dbLayer->nKv; ix++)
     {
-        const UBLOXCFG_KEYVAL_t *kv = &dbLayer->recs[ix].kv;
-        const UBLOXCFG_ITEM_t *item = dbLayer->recs[ix].item; // NULL if item is unknown
+        const CFG_DB_REC_t *rec = &dbLayer->recs[ix];
 
         // Skip unknown items unless we want to output them
-        if ( (item == NULL) && !useUnknownItems )
+        if ( (rec->item == NULL) && !useUnknownItems )
         {
             continue;
         }
 
-        const UBLOXCFG_KEYVAL_t *defaultKv = dbLayer != dbDefault ?
-            _dbFindKeyVal(dbDefault, kv->id) : NULL;
+        const CFG_DB_REC_t *defaultRec = dbLayer != dbDefault ?
+            _dbFindRec(dbDefault, rec->kv.id) : NULL;
 
-        _addOutputKeyValuePair(kv, item, defaultKv);
+        _addOutputKeyValuePair(rec, defaultRec);
     }
 
     // Clean up
@@ -466,11 +470,15 @@ static CFG_DB_t *_getCfgDb(RX_t *rx, UBLOXCFG_LAYER_t layer)
 {
     CFG_DB_t *db = malloc(sizeof(CFG_DB_t));
     UBLOXCFG_KEYVAL_t *kv = malloc(sizeof(UBLOXCFG_KEYVAL_t) * NUMOF(db->recs));
-    if ( (db == NULL) || (kv == NULL) )
+    const UBLOXCFG_ITEM_t **items = malloc(sizeof(*items) * NUMOF(db->recs));
+    const char **strs = malloc(sizeof(*strs) * NUMOF(db->recs));
+    if ( (db == NULL) || (kv == NULL) || (items == NULL) || (strs == NULL) )
     {
         WARNING("_getCfgDb() malloc fail");
         free(db);
         free(kv);
+        free(items);
+        free(strs);
         return NULL;
     }
     memset(db, 0, sizeof(*db));
@@ -488,15 +496,16 @@ static CFG_DB_t *_getCfgDb(RX_t *rx, UBLOXCFG_LAYER_t layer)
     {
         free(db);
         free(kv);
+        free(items);
+        free(strs);
         return NULL;
     }
 
-    // Check items, stringify and mark known ones
+    // Check items and mark known ones
     for (int ix = 0; ix < db->nKv; ix++)
     {
-        db->recs[ix].kv   = kv[ix];
-        db->recs[ix].item = ubloxcfg_getItemById(kv[ix].id);
-        if (db->recs[ix].item != NULL)
+        items[ix] = ubloxcfg_getItemById(kv[ix].id);
+        if (items[ix] != NULL)
         {
             db->nKvKnown++;
         }
@@ -506,6 +515,15 @@ static CFG_DB_t *_getCfgDb(RX_t *rx, UBLOXCFG_LAYER_t layer)
         }
     }
 
+    // Stringify all values at once, the (unlikely) ones that don't fit are done on demand by _dbValStr()
+    ubloxcfg_stringifyValues(db->valStrs, sizeof(db->valStrs), kv, items, db->nKv, strs);
+    for (int ix = 0; ix < db->nKv; ix++)
+    {
+        db->recs[ix].kv     = kv[ix];
+        db->recs[ix].item   = items[ix];
+        db->recs[ix].valStr = strs[ix];
+    }
+
     // Sort
     qsort(db->recs, db->nKv, sizeof(*db->recs), _dbSortFunc);
 
@@ -513,6 +531,8 @@ static CFG_DB_t *_getCfgDb(RX_t *rx, UBLOXCFG_LAYER_t layer)
         db->nKv, db->nKvKnown, db->nKvUnknown);
 
     free(kv);
+    free(items);
+    free(strs);
     return db;
 }
 
@@ -546,20 +566,37 @@ static int _dbSortFunc(const void *a, const void *b)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static const UBLOXCFG_KEYVAL_t *_dbFindKeyVal(const CFG_DB_t *db, const uint32_t id)
+static const CFG_DB_REC_t *_dbFindRec(const CFG_DB_t *db, const uint32_t id)
 {
-    const UBLOXCFG_KEYVAL_t *res = NULL;
+    const CFG_DB_REC_t *res = NULL;
     for (int ix = 0; ix < db->nKv; ix++)
     {
         if (db->recs[ix].kv.id == id)
         {
-            res = &db->recs[ix].kv;
+            res = &db->recs[ix];
             break;
         }
     }
     return res;
 }
 
+static const UBLOXCFG_KEYVAL_t *_dbFindKeyVal(const CFG_DB_t *db, const uint32_t id)
+{
+    const CFG_DB_REC_t *rec = _dbFindRec(db, id);
+    return rec != NULL ? &rec->kv : NULL;
+}
+
+static bool _dbValStr(const CFG_DB_REC_t *rec, char *str, const int size)
+{
+    if (rec->valStr != NULL)
+    {
+        return snprintf(str, size, "%s", rec->valStr) < size;
+    }
+    const UBLOXCFG_ITEM_t *item = rec->item;
+    const char *valStr = NULL;
+    return ubloxcfg_stringifyValues(str, size, &rec->kv, &item, 1, &valStr) == 1;
+}
+
 static void _dbFlag(CFG_DB_t *db, const uint32_t id)
 {
     for (int ix = 0; ix < db->nKv; ix++)
@@ -689,32 +726,9 @@ static bool _rateCfgStr(const UBLOXCFG_MSGRATE_t *cfg, const CFG_DB_t *db, char
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static bool _itemCfgStr(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item, char *str, const int size)
+static bool _itemCfgStr(const CFG_DB_REC_t *rec, char *str, const int size)
 {
-    UBLOXCFG_TYPE_t type = item != NULL ? item->type : UBLOXCFG_TYPE_X8;
-    if (item == NULL)
-    {
-        const UBLOXCFG_SIZE_t valSize = UBLOXCFG_ID2SIZE(kv->id);
-        switch (valSize)
-        {
-            case UBLOXCFG_SIZE_BIT:
-                type = UBLOXCFG_TYPE_L;
-                break;
-            case UBLOXCFG_SIZE_ONE:
-                type = UBLOXCFG_TYPE_X1;
-                break;
-            case UBLOXCFG_SIZE_TWO:
-                type = UBLOXCFG_TYPE_X2;
-                break;
-            case UBLOXCFG_SIZE_FOUR:
-                type = UBLOXCFG_TYPE_X4;
-                break;
-            case UBLOXCFG_SIZE_EIGHT:
-                type = UBLOXCFG_TYPE_X8;
-                break;
-        }
-    }
-    if (!ubloxcfg_stringifyValue(str, size, type, item, &kv->val))
+    if (!_dbValStr(rec, str, size))
     {
         return false;
     }
@@ -732,42 +746,37 @@ static bool _itemCfgStr(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_KEYVAL_t *defaultKv)
+static void _addOutputKeyValuePair(const CFG_DB_REC_t *rec, const CFG_DB_REC_t *defaultRec)
 {
-    UBLOXCFG_TYPE_t type = UBLOXCFG_TYPE_X8; // stringification format
+    const UBLOXCFG_KEYVAL_t *kv = &rec->kv;
+    const UBLOXCFG_ITEM_t *item = rec->item;
 
-    // Add CFG-FOO-BAR names for known items and use the correct type
+    // Add CFG-FOO-BAR names for known items
     const UBLOXCFG_SIZE_t valSize = UBLOXCFG_ID2SIZE(kv->id);
     const char *sizeDesc = NULL;
     if (item != NULL)
     {
         ioOutputStr("%-40s", item->name);
-        type = item->type;
     }
-    // Put ID instead of name for unknown items and map to X type based on size
+    // Put ID instead of name for unknown items (the value is stringified as X type based on size)
     else
     {
         ioOutputStr("0x%08x                              ", kv->id);
         switch (valSize)
         {
             case UBLOXCFG_SIZE_BIT:
-                type = UBLOXCFG_TYPE_L;
                 sizeDesc = "1 bit";
                 break;
             case UBLOXCFG_SIZE_ONE:
-                type = UBLOXCFG_TYPE_X1;
                 sizeDesc = "1 byte";
                 break;
             case UBLOXCFG_SIZE_TWO:
-                type = UBLOXCFG_TYPE_X2;
                 sizeDesc = "2 bytes";
                 break;
             case UBLOXCFG_SIZE_FOUR:
-                type = UBLOXCFG_TYPE_X4;
                 sizeDesc = "4 bytes";
                 break;
             case UBLOXCFG_SIZE_EIGHT:
-                type = UBLOXCFG_TYPE_X8;
                 sizeDesc = "8 bytes";
                 break;
         }
@@ -776,7 +785,7 @@ static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_I
     // Stringify value
     char valStr[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
     char *valConstStr = NULL;
-    if (ubloxcfg_stringifyValue(valStr, sizeof(valStr), type, item, &kv->val))
+    if (_dbValStr(rec, valStr, sizeof(valStr)))
     {
         // Prefer pretty value
         char *dummy;
@@ -827,7 +836,7 @@ static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_I
             ioOutputStr("= %s, ", valStr);
         }
         // X8 is sometimes used to store text...
-        else if (type == UBLOXCFG_TYPE_X8)
+        else if (item->type == UBLOXCFG_TYPE_X8)
         {
             char str[9];
             int strLen = 0;
@@ -851,15 +860,15 @@ static void _addOutputKeyValuePair(const UBLOXCFG_KEYVAL_t *kv, const UBLOXCFG_I
         }
 
         // Add ID and type
-        ioOutputStr("0x%08x, %s", kv->id, ubloxcfg_typeStr(type));
+        ioOutputStr("0x%08x, %s", kv->id, ubloxcfg_typeStr(item->type));
     }
 
     // Add default value if available and different
     char defaultValStr[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
     defaultValStr[0] = '\0';
-    if ( (defaultKv != NULL) && (defaultKv->val._raw != kv->val._raw) )
+    if ( (defaultRec != NULL) && (defaultRec->kv.val._raw != kv->val._raw) )
     {
-        if (ubloxcfg_stringifyValue(defaultValStr, sizeof(defaultValStr), type, item, &defaultKv->val))
+        if (_dbValStr(defaultRec, defaultValStr, sizeof(defaultValStr)))
         {
 
             ioOutputStr(", default: %s", defaultValStr);
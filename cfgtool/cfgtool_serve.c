@@ -0,0 +1,665 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#define _GNU_SOURCE // accept4()
+#include <string.h>
+#include <stddef.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <unistd.h>
+#include <errno.h>
+#ifndef _WIN32
+#  include <fcntl.h>
+#  include <poll.h>
+#  include <netdb.h>
+#  include <sys/types.h>
+#  include <sys/socket.h>
+#  include <sys/uio.h>
+#  include <netinet/in.h>
+#  include <netinet/tcp.h>
+#  include <arpa/inet.h>
+#endif
+
+#include "cfgtool_util.h"
+
+#include "ff_rx.h"
+#include "ff_port.h"
+#include "ff_parser.h"
+
+#include "cfgtool_serve.h"
+
+/* ****************************************************************************************************************** */
+
+#define SERVE_RING_SIZE_KB 1024
+
+const char *serveHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'serve':\n"
+"\n"
+"    Usage: cfgtool serve -p <port> -s <server> [-n] [-x]\n"
+"\n"
+"    Connects to the receiver and makes its data available to any number of\n"
+"    TCP/IP clients until SIGINT (e.g. CTRL-C)"NOT_WIN(", SIGHUP")" or SIGTERM is received.\n"
+"    The <server> is [<addr>:]<port>[,<filter>,...], where:\n"
+"\n"
+"        <addr>       Address to listen on (optional, default: any)\n"
+"        <port>       Port number to listen on\n"
+"        <filter>     Only serve messages whose name starts with <filter>,\n"
+"                     e.g. 'UBX' (all UBX messages), 'UBX-NAV' or 'NMEA-GN-GGA'\n"
+"                     (optional, default: all data)\n"
+"\n"
+"    Without filters, the data is served unmodified (including any garbage).\n"
+"    Messages (UBX, NMEA, etc.) that the clients send are forwarded to the\n"
+"    receiver. Data from different clients is not interleaved and any garbage\n"
+"    is dropped.\n"
+"\n"
+"    Clients that cannot keep up with the data rate are disconnected when they\n"
+"    fall behind by more than " STRINGIFY(SERVE_RING_SIZE_KB) " kB.\n"
+"\n"
+"    It also stops when the connection to the receiver is lost or at the end\n"
+"    of input (e.g. file:// replay), once the clients have got all data.\n"
+"\n"
+"    With -x statistics are printed every 10 seconds.\n"
+"\n"
+"    Examples:\n"
+"\n"
+"        cfgtool serve -p /dev/ttyACM0 -s 12345\n"
+"        cfgtool serve -p /dev/ttyUSB0@115200 -s localhost:12345,UBX-NAV,NMEA\n"
+"\n"
+"    The data can be received using, for example, '-p tcp://<host>:12345'.\n"
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+static bool gAbort;
+
+static void _sigHandler(int signal)
+{
+    if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
+    {
+        PRINT("Aborting...");
+        gAbort = true;
+    }
+}
+
+#ifndef _WIN32
+
+// The data for the clients is stored in one ring buffer. The write position (head) and the per-client read positions
+// (cursors) grow monotonically, the position in the buffer is the position modulo the buffer size. A client whose
+// cursor falls behind the head by more than the buffer size has lost data and is disconnected.
+typedef struct SERVE_RING_s
+{
+    uint8_t  buf[SERVE_RING_SIZE_KB * 1024];
+    uint64_t head;
+} SERVE_RING_t;
+
+#define SERVE_MAX_CLIENTS  32
+#define SERVE_MAX_FILTERS  20
+
+typedef struct SERVE_CLIENT_s
+{
+    int       fd;
+    char      addr[100];
+    uint64_t  cursor;
+    uint32_t  tConn;
+    uint64_t  nTx;          // Bytes sent to client
+    uint64_t  nRx;          // Bytes received from client
+    uint32_t  nFwd;         // Messages forwarded to receiver
+    uint8_t   rxBuf[2048];
+    PARSER_t *parser;       // Parser for data from the client, allocated on first use
+} SERVE_CLIENT_t;
+
+typedef struct SERVE_s
+{
+    RX_t          *rx;
+    int            listenFd;
+    SERVE_RING_t   ring;
+    SERVE_CLIENT_t clients[SERVE_MAX_CLIENTS];
+    int            nClients;
+    char           filters[SERVE_MAX_FILTERS][PARSER_MAX_NAME_SIZE];
+    int            nFilters;
+    uint32_t       nMsgs;
+    uint32_t       nMsgsServed;
+    uint32_t       nDisconnSlow;
+} SERVE_t;
+
+static bool _serveParseSpec(SERVE_t *serve, const char *spec, char *host, const int hostSize, char *port, const int portSize);
+static bool _serveListen(SERVE_t *serve, const char *host, const char *port);
+static void _serveAccept(SERVE_t *serve);
+static void _serveClientRead(SERVE_t *serve, SERVE_CLIENT_t *client);
+static bool _serveClientWrite(SERVE_t *serve, SERVE_CLIENT_t *client);
+static void _serveClientClose(SERVE_t *serve, SERVE_CLIENT_t *client, const char *reason);
+static bool _serveFilter(const SERVE_t *serve, const PARSER_MSG_t *msg);
+static void _serveRingPut(SERVE_RING_t *ring, const uint8_t *data, const int size);
+static void _servePrintStats(const SERVE_t *serve);
+
+#endif // !_WIN32
+
+int serveRun(const char *portArg, const char *serverSpec, const bool extraInfo, const bool noProbe)
+{
+#ifdef _WIN32
+    (void)portArg;
+    (void)serverSpec;
+    (void)extraInfo;
+    (void)noProbe;
+    WARNING("Command 'serve' is not available on Windows!");
+    return EXIT_OTHERFAIL;
+#else
+    SERVE_t *serve = (SERVE_t *)malloc(sizeof(SERVE_t));
+    if (serve == NULL)
+    {
+        WARNING("malloc fail");
+        return EXIT_OTHERFAIL;
+    }
+    memset(serve, 0, sizeof(*serve));
+    serve->listenFd = -1;
+
+    char host[200];
+    char port[20];
+    if (!_serveParseSpec(serve, serverSpec, host, sizeof(host), port, sizeof(port)))
+    {
+        WARNING("Bad server spec '%s'!", serverSpec);
+        free(serve);
+        return EXIT_BADARGS;
+    }
+
+    RX_ARGS_t args = RX_ARGS_DEFAULT();
+    if (noProbe)
+    {
+        args.autobaud = false;
+        args.detect   = false;
+    }
+    serve->rx = rxInit(portArg, &args);
+    if ( (serve->rx == NULL) || !rxOpen(serve->rx) )
+    {
+        free(serve->rx);
+        free(serve);
+        return EXIT_RXFAIL;
+    }
+
+    if (!_serveListen(serve, host, port))
+    {
+        rxClose(serve->rx);
+        free(serve->rx);
+        free(serve);
+        return EXIT_OTHERFAIL;
+    }
+
+    gAbort = false;
+    signal(SIGINT, _sigHandler);
+    signal(SIGTERM, _sigHandler);
+    signal(SIGHUP, _sigHandler);
+    signal(SIGPIPE, SIG_IGN); // We'll see EPIPE from writev()
+
+    const int rxFd = portGetFd(rxGetPort(serve->rx));
+    uint32_t tStats = TIME();
+    bool rxEnd = false; // Receiver connection lost or end of input
+    uint32_t tEnd = 0;
+    while (!gAbort)
+    {
+        // Get available messages from the receiver and add them to the ring buffer, but give the clients a chance to
+        // catch up if there's a lot of data (e.g. replaying a logfile as fast as possible)
+        PARSER_MSG_t *msg = NULL;
+        uint32_t nBytes = 0;
+        while ( !gAbort && (nBytes < (sizeof(serve->ring.buf) / 8)) && ((msg = rxGetNextMessage(serve->rx)) != NULL) )
+        {
+            serve->nMsgs++;
+            nBytes += msg->size;
+            if ( (serve->nClients > 0) && _serveFilter(serve, msg) )
+            {
+                _serveRingPut(&serve->ring, msg->data, msg->size);
+                serve->nMsgsServed++;
+            }
+        }
+
+        // Send data to clients, first try right away, most of the time this will just work
+        for (int ix = 0; ix < serve->nClients; )
+        {
+            if (_serveClientWrite(serve, &serve->clients[ix]))
+            {
+                ix++;
+            }
+            // else: client was removed, next client is now at ix
+        }
+
+        // No more data from the receiver, stop once the clients have got everything (or are too slow for that)
+        if (!rxEnd && (msg == NULL) && rxIsEof(serve->rx))
+        {
+            rxEnd = true;
+            tEnd = TIME();
+            WARNING("End of input");
+        }
+        if (rxEnd && (msg == NULL))
+        {
+            bool done = true;
+            for (int ix = 0; ix < serve->nClients; ix++)
+            {
+                if (serve->clients[ix].cursor != serve->ring.head)
+                {
+                    done = false;
+                }
+            }
+            if (done || ((TIME() - tEnd) > 5000))
+            {
+                break;
+            }
+        }
+
+        // Wait for more data from the receiver, clients ready for more data, or data from clients
+        struct pollfd fds[SERVE_MAX_CLIENTS + 2];
+        int nFds = 0;
+        fds[nFds].fd = serve->listenFd;
+        fds[nFds].events = POLLIN;
+        nFds++;
+        for (int ix = 0; ix < serve->nClients; ix++)
+        {
+            fds[nFds].fd = serve->clients[ix].fd;
+            fds[nFds].events = POLLIN | (serve->clients[ix].cursor != serve->ring.head ? POLLOUT : 0);
+            nFds++;
+        }
+        int rxIx = -1;
+        if ( (rxFd >= 0) && !rxEnd )
+        {
+            rxIx = nFds;
+            fds[nFds].fd = rxFd;
+            fds[nFds].events = POLLIN;
+            nFds++;
+        }
+        // For ports without fd we have to poll the receiver regularly
+        const int res = poll(fds, nFds, rxFd >= 0 ? 100 : 5);
+        if ( (res < 0) && (errno != EINTR) )
+        {
+            WARNING("poll() fail: %s", strerror(errno));
+            break;
+        }
+
+        // Receiver connection lost. Poll would keep reporting that, so stop polling it. Remaining data is read above.
+        if ( (res > 0) && (rxIx >= 0) && ((fds[rxIx].revents & (POLLHUP | POLLERR | POLLNVAL)) != 0) )
+        {
+            WARNING("Receiver connection lost");
+            rxEnd = true;
+            tEnd = TIME();
+        }
+
+        // Handle clients (backwards as _serveClientClose() reorders the list)
+        for (int ix = serve->nClients - 1; ix >= 0; ix--)
+        {
+            const short revents = fds[ix + 1].revents;
+            if (revents & (POLLIN | POLLHUP | POLLERR))
+            {
+                _serveClientRead(serve, &serve->clients[ix]);
+            }
+        }
+
+        // New connection
+        if (fds[0].revents & POLLIN)
+        {
+            _serveAccept(serve);
+        }
+
+        if (extraInfo && ((TIME() - tStats) >= 10000))
+        {
+            _servePrintStats(serve);
+            tStats += 10000;
+        }
+    }
+
+    _servePrintStats(serve);
+
+    while (serve->nClients > 0)
+    {
+        _serveClientClose(serve, &serve->clients[0], "shutdown");
+    }
+    close(serve->listenFd);
+    rxClose(serve->rx);
+    free(serve->rx);
+    const bool ok = serve->nMsgs > 0;
+    free(serve);
+
+    return ok ? EXIT_SUCCESS : EXIT_RXNODATA;
+#endif
+}
+
+#ifndef _WIN32
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _serveParseSpec(SERVE_t *serve, const char *spec, char *host, const int hostSize, char *port, const int portSize)
+{
+    if ( (spec == NULL) || (spec[0] == '\0') )
+    {
+        return false;
+    }
+
+    // Split off filters
+    char str[1000];
+    if (snprintf(str, sizeof(str), "%s", spec) >= (int)sizeof(str))
+    {
+        return false;
+    }
+    char *filters = strchr(str, ',');
+    if (filters != NULL)
+    {
+        *filters = '\0';
+        filters++;
+        char *save = NULL;
+        char *filter = strtok_r(filters, ",", &save);
+        while (filter != NULL)
+        {
+            if ( (serve->nFilters >= NUMOF(serve->filters)) ||
+                 (snprintf(serve->filters[serve->nFilters], sizeof(serve->filters[0]), "%s", filter) >= (int)sizeof(serve->filters[0])) )
+            {
+                return false;
+            }
+            serve->nFilters++;
+            filter = strtok_r(NULL, ",", &save);
+        }
+    }
+
+    // [<addr>:]<port>
+    const char *colon = strrchr(str, ':');
+    const char *portStr = colon != NULL ? &colon[1] : str;
+    if (colon != NULL)
+    {
+        const int hostLen = colon - str;
+        if ( (hostLen >= hostSize) || (hostLen < 1) )
+        {
+            return false;
+        }
+        memcpy(host, str, hostLen);
+        host[hostLen] = '\0';
+        // Strip IPv6 brackets, e.g. [::1]
+        if ( (host[0] == '[') && (host[hostLen - 1] == ']') )
+        {
+            memmove(host, &host[1], hostLen - 2);
+            host[hostLen - 2] = '\0';
+        }
+    }
+    else
+    {
+        host[0] = '\0';
+    }
+
+    int portNum = 0;
+    int n = 0;
+    if ( (sscanf(portStr, "%d%n", &portNum, &n) != 1) || (portStr[n] != '\0') || (portNum < 1) || (portNum > 65535) )
+    {
+        return false;
+    }
+    snprintf(port, portSize, "%d", portNum);
+    return true;
+}
+
+static bool _serveListen(SERVE_t *serve, const char *host, const char *port)
+{
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags    = AI_PASSIVE;
+    struct addrinfo *addrs = NULL;
+    const int res = getaddrinfo(host[0] != '\0' ? host : NULL, port, &hints, &addrs);
+    if (res != 0)
+    {
+        WARNING("Failed resolving %s:%s: %s", host, port, gai_strerror(res));
+        return false;
+    }
+
+    // Prefer IPv6 (which typically also accepts IPv4 connections), use first address that works
+    int fd = -1;
+    for (int pass = 0; (fd < 0) && (pass < 2); pass++)
+    {
+        for (struct addrinfo *ai = addrs; (fd < 0) && (ai != NULL); ai = ai->ai_next)
+        {
+            if ( (pass == 0) != (ai->ai_family == AF_INET6) )
+            {
+                continue;
+            }
+            fd = socket(ai->ai_family, ai->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, ai->ai_protocol);
+            if (fd < 0)
+            {
+                continue;
+            }
+            const int one = 1;
+            setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+            if ( (bind(fd, ai->ai_addr, ai->ai_addrlen) != 0) || (listen(fd, 10) != 0) )
+            {
+                DEBUG("bind/listen fail: %s", strerror(errno));
+                close(fd);
+                fd = -1;
+            }
+        }
+    }
+    freeaddrinfo(addrs);
+
+    if (fd < 0)
+    {
+        WARNING("Failed listening on %s:%s!", host[0] != '\0' ? host : "*", port);
+        return false;
+    }
+
+    serve->listenFd = fd;
+    PRINT("Listening on %s:%s", host[0] != '\0' ? host : "*", port);
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _serveAccept(SERVE_t *serve)
+{
+    struct sockaddr_storage sa;
+    socklen_t saLen = sizeof(sa);
+    const int fd = accept4(serve->listenFd, (struct sockaddr *)&sa, &saLen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (fd < 0)
+    {
+        if ( (errno != EAGAIN) && (errno != EWOULDBLOCK) )
+        {
+            WARNING("accept() fail: %s", strerror(errno));
+        }
+        return;
+    }
+
+    char addr[INET6_ADDRSTRLEN + 10];
+    char host[INET6_ADDRSTRLEN];
+    char port[10];
+    if (getnameinfo((struct sockaddr *)&sa, saLen, host, sizeof(host), port, sizeof(port), NI_NUMERICHOST | NI_NUMERICSERV) == 0)
+    {
+        snprintf(addr, sizeof(addr), "%s:%s", host, port);
+    }
+    else
+    {
+        snprintf(addr, sizeof(addr), "?");
+    }
+
+    if (serve->nClients >= NUMOF(serve->clients))
+    {
+        WARNING("Too many clients, rejecting %s", addr);
+        close(fd);
+        return;
+    }
+
+    const int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+    SERVE_CLIENT_t *client = &serve->clients[serve->nClients];
+    memset(client, 0, sizeof(*client));
+    client->fd = fd;
+    client->cursor = serve->ring.head; // New clients get data from now on
+    client->tConn = TIME();
+    snprintf(client->addr, sizeof(client->addr), "%s", addr);
+    serve->nClients++;
+    PRINT("Client %s connected (%d clients)", client->addr, serve->nClients);
+}
+
+static void _serveClientClose(SERVE_t *serve, SERVE_CLIENT_t *client, const char *reason)
+{
+    PRINT("Client %s disconnected (%s), tx %"PRIu64", rx %"PRIu64", fwd %u, %.1fs (%d clients)",
+        client->addr, reason, client->nTx, client->nRx, client->nFwd, (double)(TIME() - client->tConn) * 1e-3,
+        serve->nClients - 1);
+    close(client->fd);
+    free(client->parser);
+    // Move last client into this slot
+    const int ix = client - serve->clients;
+    serve->nClients--;
+    if (ix != serve->nClients)
+    {
+        memcpy(client, &serve->clients[serve->nClients], sizeof(*client));
+    }
+}
+
+static void _serveClientRead(SERVE_t *serve, SERVE_CLIENT_t *client)
+{
+    while (true)
+    {
+        const int num = read(client->fd, client->rxBuf, sizeof(client->rxBuf));
+        if (num == 0)
+        {
+            _serveClientClose(serve, client, "closed");
+            return;
+        }
+        else if (num < 0)
+        {
+            if ( (errno != EAGAIN) && (errno != EWOULDBLOCK) )
+            {
+                _serveClientClose(serve, client, strerror(errno));
+            }
+            return;
+        }
+        client->nRx += num;
+
+        // Forward complete messages to the receiver
+        if (client->parser == NULL)
+        {
+            client->parser = (PARSER_t *)malloc(sizeof(PARSER_t));
+            if (client->parser == NULL)
+            {
+                WARNING("malloc fail");
+                return;
+            }
+            parserInit(client->parser);
+        }
+        parserAdd(client->parser, client->rxBuf, num);
+        PARSER_MSG_t msg;
+        while (parserProcess(client->parser, &msg, false))
+        {
+            if (msg.type != PARSER_MSGTYPE_GARBAGE)
+            {
+                DEBUG("Client %s: forward %s (%d)", client->addr, msg.name, msg.size);
+                rxSend(serve->rx, msg.data, msg.size);
+                client->nFwd++;
+            }
+            else
+            {
+                DEBUG("Client %s: drop %s (%d)", client->addr, msg.name, msg.size);
+            }
+        }
+    }
+}
+
+// Returns false if client was removed
+static bool _serveClientWrite(SERVE_t *serve, SERVE_CLIENT_t *client)
+{
+    const SERVE_RING_t *ring = &serve->ring;
+    const uint64_t avail = ring->head - client->cursor;
+    if (avail == 0)
+    {
+        return true;
+    }
+    // Data the client hasn't got yet has been overwritten
+    if (avail > sizeof(ring->buf))
+    {
+        serve->nDisconnSlow++;
+        _serveClientClose(serve, client, "too slow");
+        return false;
+    }
+
+    // Send directly from the ring buffer, in up to two chunks if the data wraps around
+    const uint64_t offs = client->cursor % sizeof(ring->buf);
+    const uint64_t size1 = MIN(avail, sizeof(ring->buf) - offs);
+    struct iovec iov[2] =
+    {
+        { .iov_base = (void *)&ring->buf[offs], .iov_len = size1 },
+        { .iov_base = (void *)&ring->buf[0],    .iov_len = avail - size1 },
+    };
+    const ssize_t num = writev(client->fd, iov, iov[1].iov_len > 0 ? 2 : 1);
+    if (num < 0)
+    {
+        if ( (errno != EAGAIN) && (errno != EWOULDBLOCK) )
+        {
+            _serveClientClose(serve, client, strerror(errno));
+            return false;
+        }
+        return true;
+    }
+    client->cursor += num;
+    client->nTx += num;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _serveFilter(const SERVE_t *serve, const PARSER_MSG_t *msg)
+{
+    if (serve->nFilters == 0)
+    {
+        return true;
+    }
+    // Match entire name or beginning of name up to a '-'
+    for (int ix = 0; ix < serve->nFilters; ix++)
+    {
+        const char *filter = serve->filters[ix];
+        const int len = strlen(filter);
+        if ( (strncmp(msg->name, filter, len) == 0) && ((msg->name[len] == '\0') || (msg->name[len] == '-')) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void _serveRingPut(SERVE_RING_t *ring, const uint8_t *data, const int size)
+{
+    const uint64_t offs = ring->head % sizeof(ring->buf);
+    const int size1 = MIN((uint64_t)size, sizeof(ring->buf) - offs);
+    memcpy(&ring->buf[offs], data, size1);
+    if (size1 < size)
+    {
+        memcpy(&ring->buf[0], &data[size1], size - size1);
+    }
+    ring->head += size;
+}
+
+static void _servePrintStats(const SERVE_t *serve)
+{
+    PRINT("Stats: %u messages from receiver, %u served (%"PRIu64" bytes), %d clients, %u disconnected (too slow)",
+        serve->nMsgs, serve->nMsgsServed, serve->ring.head, serve->nClients, serve->nDisconnSlow);
+    for (int ix = 0; ix < serve->nClients; ix++)
+    {
+        const SERVE_CLIENT_t *client = &serve->clients[ix];
+        PRINT("Stats: client %s: tx %"PRIu64", rx %"PRIu64", fwd %u, lag %"PRIu64", %.1fs",
+            client->addr, client->nTx, client->nRx, client->nFwd, serve->ring.head - client->cursor,
+            (double)(TIME() - client->tConn) * 1e-3);
+    }
+}
+
+#endif // !_WIN32
+
+/* ****************************************************************************************************************** */
+// eof
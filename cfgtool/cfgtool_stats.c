@@ -0,0 +1,525 @@
+/* ************************************************************************************************/ // clang-format off
+// u-blox 9 positioning receivers configuration tool
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <math.h>
+#include <inttypes.h>
+
+#include "cfgtool_util.h"
+
+#include "ff_rx.h"
+#include "ff_epoch.h"
+
+#include "cfgtool_stats.h"
+
+/* ****************************************************************************************************************** */
+
+const char *statsHelp(void)
+{
+    return
+// -----------------------------------------------------------------------------
+"Command 'stats':\n"
+"\n"
+"    Usage: cfgtool stats -p <port> [-o <outfile>] [-y] [-n] [-j] [-T <period>]\n"
+"\n"
+"    Connects to the receiver and collects statistics on the received messages\n"
+"    until SIGINT (e.g. CTRL-C)"NOT_WIN(", SIGHUP")" or SIGTERM is received. A report is\n"
+"    output at the end and, with -T, every <period> seconds. The reports are\n"
+"    tables, or JSON objects (one per line) with -j.\n"
+"\n"
+"    For each message (by name) the report has:\n"
+"\n"
+"        count, bytes    Number of messages and their total size\n"
+"        rate            Message rate [Hz] and data rate [B/s]\n"
+"        interval        Time between consecutive messages (mean, standard\n"
+"                        deviation, min, p50, p90, p99, max) [ms]\n"
+"        latency         Arrival time relative to the start of the navigation\n"
+"                        epoch (min, p50, p90, p99, max) [ms]\n"
+"\n"
+"    The totals include the load of the link for serial ports, which is the\n"
+"    data rate relative to the baudrate (assuming 8N1 framing), and the reads\n"
+"    from the port that returned data: their number, size (mean, max) [bytes]\n"
+"    and interval (as above). For USB-serial adapters the read interval shows\n"
+"    the latency timer of the driver (see the ',lowlat' port option).\n"
+"\n"
+"    The latency is the arrival time of the message relative to the top of the\n"
+"    wall clock second, resp. to the navigation period for rates higher than\n"
+"    1 Hz. This requires a synchronised system clock (e.g. NTP).\n"
+"\n"
+"    The intervals and latencies are kept in histograms with about 3% resolution\n"
+"    and constant memory use, so that this can run for arbitrarily long times.\n"
+"    Note that the arrival times are those of the data as read from the port,\n"
+"    which includes buffering in the operating system and the USB stack.\n"
+"\n"
+"    Examples:\n"
+"\n"
+#ifdef _WIN32
+"        cfgtool stats -p COM3 -T 10\n"
+#else
+"        cfgtool stats -p /dev/ttyUSB0 -T 10\n"
+"        timeout 60 cfgtool stats -p tcp://192.168.1.1:12345 -n -j\n"
+#endif
+"\n";
+}
+
+/* ****************************************************************************************************************** */
+
+// Log-linear histogram (like HdrHistogram): values below 2^STATS_HIST_SUB_BITS are counted exactly, above that each
+// power of two is split into 2^STATS_HIST_SUB_BITS buckets.
+#define STATS_HIST_SUB_BITS  5
+#define STATS_HIST_SUB_NUM   (1 << STATS_HIST_SUB_BITS)
+#define STATS_HIST_NUM       (STATS_HIST_SUB_NUM + ((32 - STATS_HIST_SUB_BITS) * STATS_HIST_SUB_NUM))
+
+#define STATS_MAX_MSGS       200
+
+typedef struct STATS_HIST_s
+{
+    uint32_t n;
+    uint32_t min;
+    uint32_t max;
+    double   sum;
+    double   sumSq;
+    uint32_t counts[STATS_HIST_NUM];
+} STATS_HIST_t;
+
+typedef struct STATS_MSG_s
+{
+    char         name[PARSER_MAX_NAME_SIZE];
+    uint32_t     hash;
+    uint64_t     count;
+    uint64_t     bytes;
+    uint64_t     tFirst; // [ns]
+    uint64_t     tLast;  // [ns]
+    STATS_HIST_t interval; // [us]
+    STATS_HIST_t latency;  // [us]
+} STATS_MSG_t;
+
+typedef struct STATS_s
+{
+    STATS_MSG_t  msgs[STATS_MAX_MSGS];
+    int          nMsgs;
+    uint64_t     count;
+    uint64_t     bytes;
+    uint64_t     tStart;       // [ns]
+    uint64_t     tReport;      // [ns]
+    uint64_t     bytesReport;  // bytes at time of last report
+    uint32_t     period;       // navigation period [ms]
+    double       lastTow;
+    int          baudrate;
+    uint32_t     numReads;     // port reads seen so far
+    uint64_t     readTsLast;   // [ns]
+    STATS_HIST_t readSize;     // [bytes]
+    STATS_HIST_t readInterval; // [us]
+} STATS_t;
+
+static STATS_t gStats;
+
+static int _histBucket(const uint32_t val)
+{
+    if (val < STATS_HIST_SUB_NUM)
+    {
+        return val;
+    }
+    int exp = 31;
+    while ((val & ((uint32_t)1 << exp)) == 0)
+    {
+        exp--;
+    }
+    const int shift = exp - STATS_HIST_SUB_BITS;
+    const int sub = (val >> shift) - STATS_HIST_SUB_NUM;
+    return STATS_HIST_SUB_NUM + (shift * STATS_HIST_SUB_NUM) + sub;
+}
+
+static uint32_t _histValue(const int bucket) // middle of the bucket
+{
+    if (bucket < STATS_HIST_SUB_NUM)
+    {
+        return bucket;
+    }
+    const int shift = (bucket - STATS_HIST_SUB_NUM) / STATS_HIST_SUB_NUM;
+    const uint32_t sub = (bucket - STATS_HIST_SUB_NUM) % STATS_HIST_SUB_NUM;
+    const uint32_t low = (STATS_HIST_SUB_NUM + sub) << shift;
+    return low + (((uint32_t)1 << shift) / 2);
+}
+
+static void _histAdd(STATS_HIST_t *hist, const uint32_t val)
+{
+    if (hist->n == 0)
+    {
+        hist->min = val;
+        hist->max = val;
+    }
+    else
+    {
+        hist->min = MIN(hist->min, val);
+        hist->max = MAX(hist->max, val);
+    }
+    hist->n++;
+    hist->sum += (double)val;
+    hist->sumSq += (double)val * (double)val;
+    hist->counts[_histBucket(val)]++;
+}
+
+static uint32_t _histPercentile(const STATS_HIST_t *hist, const int perc)
+{
+    if (hist->n == 0)
+    {
+        return 0;
+    }
+    const uint64_t thrs = (((uint64_t)hist->n * perc) + 99) / 100;
+    uint64_t cum = 0;
+    for (int bucket = 0; bucket < STATS_HIST_NUM; bucket++)
+    {
+        cum += hist->counts[bucket];
+        if ( (cum > 0) && (cum >= thrs) )
+        {
+            const uint32_t val = _histValue(bucket);
+            return CLIP(val, hist->min, hist->max);
+        }
+    }
+    return hist->max;
+}
+
+static double _histMean(const STATS_HIST_t *hist)
+{
+    return hist->n > 0 ? hist->sum / (double)hist->n : 0.0;
+}
+
+static double _histStd(const STATS_HIST_t *hist)
+{
+    if (hist->n < 2)
+    {
+        return 0.0;
+    }
+    const double mean = _histMean(hist);
+    const double var = (hist->sumSq / (double)hist->n) - (mean * mean);
+    return var > 0.0 ? sqrt(var) : 0.0;
+}
+
+static uint32_t _hash(const char *str)
+{
+    uint32_t hash = 0x811c9dc5;
+    while (*str != '\0')
+    {
+        hash ^= (uint8_t)*str++;
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+static STATS_MSG_t *_getMsg(const char *name)
+{
+    const uint32_t hash = _hash(name);
+    for (int ix = 0; ix < gStats.nMsgs; ix++)
+    {
+        STATS_MSG_t *m = &gStats.msgs[ix];
+        if ( (m->hash == hash) && (strcmp(m->name, name) == 0) )
+        {
+            return m;
+        }
+    }
+    // Collect all further messages in the last entry
+    if (gStats.nMsgs >= (STATS_MAX_MSGS - 1))
+    {
+        STATS_MSG_t *m = &gStats.msgs[STATS_MAX_MSGS - 1];
+        if (gStats.nMsgs < STATS_MAX_MSGS)
+        {
+            snprintf(m->name, sizeof(m->name), "(other)");
+            m->hash = _hash(m->name);
+            gStats.nMsgs++;
+        }
+        return m;
+    }
+    STATS_MSG_t *m = &gStats.msgs[gStats.nMsgs++];
+    snprintf(m->name, sizeof(m->name), "%s", name);
+    m->hash = hash;
+    return m;
+}
+
+static void _update(const PARSER_MSG_t *msg)
+{
+    STATS_MSG_t *m = _getMsg(msg->name);
+    const uint64_t t = msg->tsLast != 0 ? msg->tsLast : TIME_NS();
+    if (m->count > 0)
+    {
+        const uint64_t dt = (t - m->tLast) / 1000;
+        _histAdd(&m->interval, dt > UINT32_MAX ? UINT32_MAX : (uint32_t)dt);
+    }
+    else
+    {
+        m->tFirst = t;
+    }
+    m->tLast = t;
+    m->count++;
+    m->bytes += msg->size;
+
+    const uint64_t tReal = msg->tsReal != 0 ? msg->tsReal : TIME_NS_REAL();
+    _histAdd(&m->latency, (uint32_t)((tReal / 1000) % ((uint64_t)gStats.period * 1000)));
+
+    gStats.count++;
+    gStats.bytes += msg->size;
+}
+
+static void _updateEpoch(const EPOCH_t *epoch)
+{
+    // Detect navigation period, for the latency
+    if (epoch->haveGpsTow)
+    {
+        if (gStats.lastTow > 0.0)
+        {
+            const int period = (int)floor(((epoch->gpsTow - gStats.lastTow) * 1e3) + 0.5);
+            if ( (period > 0) && (period <= 1000) && ((1000 % period) == 0) && (period != (int)gStats.period) )
+            {
+                DEBUG("Navigation period %d ms", period);
+                gStats.period = period;
+            }
+        }
+        gStats.lastTow = epoch->gpsTow;
+    }
+}
+
+static void _updateReads(PORT_t *port)
+{
+    if ( (port == NULL) || (port->numReads == gStats.numReads) )
+    {
+        return;
+    }
+    PORT_READ_t reads[PORT_READ_LOG_SIZE];
+    const uint32_t numNew = port->numReads - gStats.numReads;
+    const int num = portGetReadLog(port, reads, numNew < (uint32_t)NUMOF(reads) ? (int)numNew : NUMOF(reads));
+    // Don't measure the interval across reads that dropped out of the log
+    if (numNew > (uint32_t)num)
+    {
+        gStats.readTsLast = 0;
+    }
+    for (int ix = 0; ix < num; ix++)
+    {
+        _histAdd(&gStats.readSize, reads[ix].size);
+        if (gStats.readTsLast != 0)
+        {
+            const uint64_t dt = (reads[ix].ts - gStats.readTsLast) / 1000;
+            _histAdd(&gStats.readInterval, dt > UINT32_MAX ? UINT32_MAX : (uint32_t)dt);
+        }
+        gStats.readTsLast = reads[ix].ts;
+    }
+    gStats.numReads = port->numReads;
+}
+
+static int _cmpMsgName(const void *a, const void *b)
+{
+    return strcmp((*(const STATS_MSG_t * const *)a)->name, (*(const STATS_MSG_t * const *)b)->name);
+}
+
+static void _report(const bool json, const bool final)
+{
+    const uint64_t now = TIME_NS();
+    const double dur = (double)(now - gStats.tStart) * 1e-9;
+    const double durReport = (double)(now - gStats.tReport) * 1e-9;
+    const double bps = durReport > 0.0 ? (double)(gStats.bytes - gStats.bytesReport) / durReport : 0.0;
+    const double load = gStats.baudrate > 0 ? bps * 10.0 / (double)gStats.baudrate : 0.0;
+    gStats.tReport = now;
+    gStats.bytesReport = gStats.bytes;
+
+    const STATS_MSG_t *msgs[STATS_MAX_MSGS];
+    for (int ix = 0; ix < gStats.nMsgs; ix++)
+    {
+        msgs[ix] = &gStats.msgs[ix];
+    }
+    qsort(msgs, gStats.nMsgs, sizeof(*msgs), _cmpMsgName);
+
+    if (json)
+    {
+        ioOutputStr("{ \"time\": %.3f, \"final\": %s, \"count\": %" PRIu64 ", \"bytes\": %" PRIu64 ", \"bytes_per_s\": %.1f,"
+            " \"baudrate\": %d, \"load\": %.4f, \"period_ms\": %" PRIu32 ",",
+            dur, final ? "true" : "false", gStats.count, gStats.bytes, bps, gStats.baudrate, load, gStats.period);
+        ioOutputStr(" \"reads\": { \"count\": %" PRIu32 ", \"size_mean\": %.1f, \"size_max\": %" PRIu32 ","
+            " \"interval_ms\": { \"mean\": %.3f, \"std\": %.3f, \"min\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f } },"
+            " \"messages\": [",
+            gStats.numReads, _histMean(&gStats.readSize), gStats.readSize.max,
+            _histMean(&gStats.readInterval) * 1e-3, _histStd(&gStats.readInterval) * 1e-3,
+            (double)gStats.readInterval.min * 1e-3, (double)_histPercentile(&gStats.readInterval, 50) * 1e-3,
+            (double)_histPercentile(&gStats.readInterval, 90) * 1e-3,
+            (double)_histPercentile(&gStats.readInterval, 99) * 1e-3, (double)gStats.readInterval.max * 1e-3);
+        for (int ix = 0; ix < gStats.nMsgs; ix++)
+        {
+            const STATS_MSG_t *m = msgs[ix];
+            const double dt = (double)(m->tLast - m->tFirst) * 1e-9;
+            ioOutputStr("%s { \"name\": \"%s\", \"count\": %" PRIu64 ", \"bytes\": %" PRIu64 ", \"rate\": %.3f, \"bytes_per_s\": %.1f,"
+                " \"interval_ms\": { \"mean\": %.3f, \"std\": %.3f, \"min\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f },"
+                " \"latency_ms\": { \"min\": %.3f, \"p50\": %.3f, \"p90\": %.3f, \"p99\": %.3f, \"max\": %.3f } }",
+                ix > 0 ? "," : "", m->name, m->count, m->bytes,
+                dt > 0.0 ? (double)(m->count - 1) / dt : 0.0, dur > 0.0 ? (double)m->bytes / dur : 0.0,
+                _histMean(&m->interval) * 1e-3, _histStd(&m->interval) * 1e-3, (double)m->interval.min * 1e-3,
+                (double)_histPercentile(&m->interval, 50) * 1e-3, (double)_histPercentile(&m->interval, 90) * 1e-3,
+                (double)_histPercentile(&m->interval, 99) * 1e-3, (double)m->interval.max * 1e-3,
+                (double)m->latency.min * 1e-3, (double)_histPercentile(&m->latency, 50) * 1e-3,
+                (double)_histPercentile(&m->latency, 90) * 1e-3, (double)_histPercentile(&m->latency, 99) * 1e-3,
+                (double)m->latency.max * 1e-3);
+        }
+        ioOutputStr(" ] }\n");
+    }
+    else
+    {
+        ioOutputStr("%s stats after %.1f s: %" PRIu64 " messages, %" PRIu64 " bytes, %.1f B/s",
+            final ? "Final" : "Periodic", dur, gStats.count, gStats.bytes, bps);
+        if (gStats.baudrate > 0)
+        {
+            ioOutputStr(" (%.1f%% of %d baud)", load * 1e2, gStats.baudrate);
+        }
+        ioOutputStr(", navigation period %" PRIu32 " ms\n", gStats.period);
+        ioOutputStr("%" PRIu32 " reads, size mean %.1f max %" PRIu32 " bytes, interval mean %.1f std %.1f min %.1f"
+            " p50 %.1f p90 %.1f p99 %.1f max %.1f ms\n",
+            gStats.numReads, _histMean(&gStats.readSize), gStats.readSize.max,
+            _histMean(&gStats.readInterval) * 1e-3, _histStd(&gStats.readInterval) * 1e-3,
+            (double)gStats.readInterval.min * 1e-3, (double)_histPercentile(&gStats.readInterval, 50) * 1e-3,
+            (double)_histPercentile(&gStats.readInterval, 90) * 1e-3,
+            (double)_histPercentile(&gStats.readInterval, 99) * 1e-3, (double)gStats.readInterval.max * 1e-3);
+        ioOutputStr("%-28s %8s %10s %7s %8s | %-55s | %-39s\n", "", "", "", "", "",
+            "interval [ms]", "latency [ms]");
+        ioOutputStr("%-28s %8s %10s %7s %8s | %7s %7s %7s %7s %7s %7s %7s | %7s %7s %7s %7s %7s\n",
+            "message", "count", "bytes", "rate", "B/s", "mean", "std", "min", "p50", "p90", "p99", "max",
+            "min", "p50", "p90", "p99", "max");
+        for (int ix = 0; ix < gStats.nMsgs; ix++)
+        {
+            const STATS_MSG_t *m = msgs[ix];
+            const double dt = (double)(m->tLast - m->tFirst) * 1e-9;
+            ioOutputStr("%-28s %8" PRIu64 " %10" PRIu64 " %7.2f %8.1f | %7.1f %7.1f %7.1f %7.1f %7.1f %7.1f %7.1f |"
+                " %7.1f %7.1f %7.1f %7.1f %7.1f\n",
+                m->name, m->count, m->bytes,
+                dt > 0.0 ? (double)(m->count - 1) / dt : 0.0, dur > 0.0 ? (double)m->bytes / dur : 0.0,
+                _histMean(&m->interval) * 1e-3, _histStd(&m->interval) * 1e-3, (double)m->interval.min * 1e-3,
+                (double)_histPercentile(&m->interval, 50) * 1e-3, (double)_histPercentile(&m->interval, 90) * 1e-3,
+                (double)_histPercentile(&m->interval, 99) * 1e-3, (double)m->interval.max * 1e-3,
+                (double)m->latency.min * 1e-3, (double)_histPercentile(&m->latency, 50) * 1e-3,
+                (double)_histPercentile(&m->latency, 90) * 1e-3, (double)_histPercentile(&m->latency, 99) * 1e-3,
+                (double)m->latency.max * 1e-3);
+        }
+        ioOutputStr("\n");
+    }
+}
+
+/* ****************************************************************************************************************** */
+
+static bool gAbort;
+
+static void _sigHandler(int signal)
+{
+    if ( (signal == SIGINT) || (signal == SIGTERM) NOT_WIN(|| (signal == SIGHUP)) )
+    {
+        PRINT("Aborting...");
+        gAbort = true;
+    }
+}
+
+int statsRun(const char *portArg, const bool noProbe, const bool json, const char *periodArg)
+{
+    double period = 0.0;
+    if (periodArg != NULL)
+    {
+        char *endptr = NULL;
+        period = strtod(periodArg, &endptr);
+        if ( (endptr == periodArg) || (*endptr != '\0') || (period < 0.1) )
+        {
+            WARNING("Illegal period '%s'!", periodArg);
+            return EXIT_BADARGS;
+        }
+    }
+
+    RX_ARGS_t args = RX_ARGS_DEFAULT();
+    if (noProbe)
+    {
+        args.autobaud = false;
+        args.detect   = false;
+    }
+    RX_t *rx = rxInit(portArg, &args);
+    if ( (rx == NULL) || !rxOpen(rx) )
+    {
+        free(rx);
+        return EXIT_RXFAIL;
+    }
+
+    memset(&gStats, 0, sizeof(gStats));
+    gStats.tStart = TIME_NS();
+    gStats.tReport = gStats.tStart;
+    gStats.period = 1000;
+    PORT_t *port = rxGetPort(rx);
+    if ( (port != NULL) && ((port->type == PORT_TYPE_SER) || (port->type == PORT_TYPE_TELNET)) )
+    {
+        gStats.baudrate = rxGetBaudrate(rx);
+    }
+
+    gAbort = false;
+    signal(SIGINT, _sigHandler);
+    signal(SIGTERM, _sigHandler);
+    NOT_WIN( signal(SIGHUP, _sigHandler) );
+
+    EPOCH_t coll;
+    EPOCH_t epoch;
+    epochInit(&coll);
+
+    PRINT("Collecting statistics...");
+    bool res = true;
+    bool append = false;
+    const uint64_t periodNs = (uint64_t)(period * 1e9);
+    while (res && !gAbort)
+    {
+        PARSER_MSG_t *msg = rxGetNextMessage(rx);
+        _updateReads(port);
+        if (msg != NULL)
+        {
+            _update(msg);
+            if (epochCollect(&coll, msg, &epoch))
+            {
+                _updateEpoch(&epoch);
+            }
+        }
+        // End of input (file replay)
+        else if (rxIsEof(rx))
+        {
+            break;
+        }
+        // No data, yield
+        else
+        {
+            SLEEP(5);
+        }
+
+        if ( (periodNs > 0) && ((TIME_NS() - gStats.tReport) >= periodNs) )
+        {
+            _report(json, false);
+            res = ioWriteOutput(append);
+            append = true;
+        }
+    }
+
+    if (res)
+    {
+        _report(json, true);
+        res = ioWriteOutput(append);
+    }
+
+    rxClose(rx);
+    free(rx);
+
+    return res ? (gStats.count > 0 ? EXIT_SUCCESS : EXIT_RXNODATA) : EXIT_OTHERFAIL;
+}
+
+/* ****************************************************************************************************************** */
+// eof
@@ -25,6 +25,7 @@
 #include "ff_rx.h"
 #include "ff_ubx.h"
 #include "ff_epoch.h"
+#include "ff_epochshm.h"
 
 #include "cfgtool_status.h"
 
@@ -36,12 +37,17 @@ const char *statusHelp(void)
 // -----------------------------------------------------------------------------
 "Command 'status':\n"
 "\n"
-"    Usage: cfgtool status -p <port> [-n] [-x]\n"
+"    Usage: cfgtool status -p <port> [-n] [-x] [-S <name>]\n"
 "\n"
 "    Connects to the receiver and outputs the navigation status for each\n"
 "    detected epoch. This requires navigation messages, such as UBX-NAV-PVT to\n"
 "    be enabled. The program stops when SIGINT (e.g. CTRL-C)"NOT_WIN(", SIGHUP")"\n"
 "    or SIGTERM is received.\n"
+"\n"
+"    With -S the epochs are additionally published to the POSIX shared memory\n"
+"    object <name>, from where other processes can read them with very low\n"
+"    latency (see ff_epochshm.h for the reader API). This is not available on\n"
+"    Windows.\n"
 "\n";
 }
 
@@ -162,7 +168,7 @@ static bool _printInfo(const bool colours, const INFO_t *info, const EPOCH_t *ep
     return ioWriteOutput(true);
 }
 
-int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
+int statusRun(const char *portArg, const bool extraInfo, const bool noProbe, const char *shmName)
 {
     RX_ARGS_t args = RX_ARGS_DEFAULT();
     if (noProbe)
@@ -177,6 +183,18 @@ int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
         return EXIT_RXFAIL;
     }
 
+    EPOCH_SHM_t *shm = NULL;
+    if (shmName != NULL)
+    {
+        shm = epochShmCreate(shmName, 0);
+        if (shm == NULL)
+        {
+            rxClose(rx);
+            free(rx);
+            return EXIT_OTHERFAIL;
+        }
+    }
+
     DEBUG_CFG_t debugCfg;
     debugGetCfg(&debugCfg);
 
@@ -212,6 +230,7 @@ int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
             {
                 info.nEpoch++;
                 lastEpoch = now;
+                epochShmPublish(shm, &epoch);
                 if (!_printInfo(debugCfg.colour, &info, &epoch))
                 {
                     break;
@@ -251,6 +270,11 @@ int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
                     break;
             }
         }
+        // End of input (file replay)
+        else if (rxIsEof(rx))
+        {
+            break;
+        }
         // No data, yield
         else
         {
@@ -266,6 +290,7 @@ int statusRun(const char *portArg, const bool extraInfo, const bool noProbe)
 
     rxClose(rx);
     free(rx);
+    epochShmClose(shm);
 
     return res ? (info.nMsgs > 0 ? EXIT_SUCCESS : EXIT_RXNODATA) : EXIT_OTHERFAIL;
 }
@@ -27,7 +27,7 @@
 
 const char *statusHelp(void);
 
-int statusRun(const char *portArg, const bool extraInfo, const bool noProbe);
+int statusRun(const char *portArg, const bool extraInfo, const bool noProbe, const char *shmName);
 
 /* ****************************************************************************************************************** */
 #endif // __CFGTOOL_STATUS_H__
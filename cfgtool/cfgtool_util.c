@@ -24,6 +24,7 @@
 #include <stdarg.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <sys/stat.h>
 
 #include "ubloxcfg.h"
 
@@ -136,6 +137,29 @@ int ioReadInput(uint8_t *data, const int size)
     return res;
 }
 
+bool ioInputIsLive(void)
+{
+    if (gInFile == NULL)
+    {
+        return false;
+    }
+    struct stat st;
+    // Pipes, ttys, sockets, etc. deliver data at their own pace, regular files can be read at ours
+    return (fstat(fileno(gInFile), &st) != 0) || !S_ISREG(st.st_mode);
+}
+
+bool ioSeekInput(const uint64_t offset)
+{
+    if ( (gInFile == NULL) || (gInFile == stdin) )
+    {
+        return false;
+    }
+#ifdef _WIN32
+    return _fseeki64(gInFile, (__int64)offset, SEEK_SET) == 0;
+#else
+    return fseeko(gInFile, (off_t)offset, SEEK_SET) == 0;
+#endif
+}
 
 static char gOutputBuf[1024 * 1024] = { 0 };
 static int gOutputBufSize = 0;
@@ -165,6 +189,28 @@ void ioOutputStr(const char *fmt, ...)
     }
 }
 
+void ioOutputJsonStr(const char *str)
+{
+    ioOutputStr("\"");
+    for (const char *pc = str; *pc != '\0'; pc++)
+    {
+        const uint8_t c = (uint8_t)*pc;
+        if ( (c == '"') || (c == '\\') )
+        {
+            ioOutputStr("\\%c", c);
+        }
+        else if (c < 0x20)
+        {
+            ioOutputStr("\\u%04x", c);
+        }
+        else
+        {
+            ioOutputStr("%c", c);
+        }
+    }
+    ioOutputStr("\"");
+}
+
 void ioAddOutputBin(const uint8_t *data, const int size)
 {
     const int totSize = sizeof(gOutputBuf);
@@ -268,9 +314,15 @@ bool ioWriteOutput(const bool append)
 
     const char *failStr = NULL;
     bool res = true;
-    if ( (gOutFile != stdout) && (gOutFile != stderr) )
+    // Open the output file on the first call, and re-open (truncate) it if not appending. Keep it open otherwise.
+    if ( (gOutFile != stdout) && (gOutFile != stderr) && ((gOutFile == NULL) || !append) )
     {
-        if (!append && !gOutOverwrite && (access(gOutName, F_OK) == 0))
+        if (gOutFile != NULL)
+        {
+            fclose(gOutFile);
+            gOutFile = NULL;
+        }
+        else if (!append && !gOutOverwrite && (access(gOutName, F_OK) == 0))
         {
             failStr = "File already exists";
             res = false;
@@ -47,7 +47,10 @@ void ioSetOutput(const char *name, FILE *file, const bool overwrite);
 void ioSetInput(const char *name, FILE *file);
 IO_LINE_t *ioGetNextInputLine(void);
 int  ioReadInput(uint8_t *data, const int size);
+bool ioSeekInput(const uint64_t offset);
+bool ioInputIsLive(void);
 void ioOutputStr(const char *fmt, ...);
+void ioOutputJsonStr(const char *str); // quoted and escaped JSON string
 void ioAddOutputBin(const uint8_t *data, const int size);
 void ioAddOutputHex(const uint8_t *data, const int size, const int wordsPerLine, const bool ugly);
 void ioAddOutputHexdump(const uint8_t *data, const int size);
@@ -26,7 +26,8 @@
 /* ****************************************************************************************************************** */
 
 Ff::ParserMsg::ParserMsg(const PARSER_MSG_t *_msg) :
-    type{}, data{}, size{_msg->size}, seq{_msg->seq}, ts{_msg->ts}, name{_msg->name}, info{}
+    type{}, data{}, size{_msg->size}, seq{_msg->seq}, ts{_msg->ts},
+    tsFirst{_msg->tsFirst}, tsLast{_msg->tsLast}, tsReal{_msg->tsReal}, name{_msg->name}, info{}
 {
     switch (_msg->type)
     {
@@ -42,6 +42,9 @@ namespace Ff
         int         size;
         uint32_t    seq;
         uint32_t    ts;
+        uint64_t    tsFirst;
+        uint64_t    tsLast;
+        uint64_t    tsReal;
         enum Src_e { UNKN, FROM_RX, TO_RX, VIRTUAL, USER, LOG };
         Src_e       src;
         std::string srcStr;
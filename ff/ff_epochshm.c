@@ -0,0 +1,533 @@
+// flipflip's navigation epoch shared memory publisher and reader
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <inttypes.h>
+#ifndef _WIN32
+#  include <unistd.h>
+#  include <fcntl.h>
+#  include <signal.h>
+#  include <sys/types.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#endif
+
+#include "ff_stuff.h"
+#include "ff_debug.h"
+
+#include "ff_epochshm.h"
+
+/* ****************************************************************************************************************** */
+
+//#define EPOCHSHM_DEBUG(fmt, args...) DEBUG("epochshm: " fmt, ## args)
+#define EPOCHSHM_DEBUG(...) /* nothing */
+
+#define EPOCHSHM_MAGIC     0x48534245 // "EBSH"
+#define EPOCHSHM_MAX_SLOTS 1024
+#define EPOCHSHM_CACHELINE 64
+
+// Shared memory layout: one header followed by nSlots slots, each aligned to a cache line
+typedef struct EPOCHSHM_HEAD_s
+{
+    uint32_t magic;    // EPOCHSHM_MAGIC, written last when the publisher has initialised everything
+    uint32_t version;  // EPOCH_SHM_VERSION
+    uint32_t slotSize; // Size of one slot (stride)
+    uint32_t nSlots;   // Number of slots
+    uint32_t alive;    // 1 while the publisher is running
+    uint32_t pid;      // Publisher process ID
+    uint64_t head;     // Number of epochs published so far (the latest is in slot (head - 1) % nSlots)
+} EPOCHSHM_HEAD_t;
+
+typedef struct EPOCHSHM_SLOT_s
+{
+    uint32_t lock;     // Sequence lock: odd while the publisher is writing the slot
+    uint32_t _pad;
+    uint64_t index;    // Index of the epoch in the slot (0, 1, 2, ...)
+    EPOCH_SHM_EPOCH_t epoch;
+} EPOCHSHM_SLOT_t;
+
+#define EPOCHSHM_ALIGN(size)   ( (((size) + EPOCHSHM_CACHELINE - 1) / EPOCHSHM_CACHELINE) * EPOCHSHM_CACHELINE )
+#define EPOCHSHM_HEAD_SIZE     EPOCHSHM_ALIGN(sizeof(EPOCHSHM_HEAD_t))
+#define EPOCHSHM_SLOT_SIZE     EPOCHSHM_ALIGN(sizeof(EPOCHSHM_SLOT_t))
+
+struct EPOCH_SHM_s
+{
+    char              name[100];
+    bool              publisher;
+    size_t            size;
+    uint8_t          *mem;
+    EPOCHSHM_HEAD_t  *head;
+    uint64_t          nPub;
+};
+
+#ifndef _WIN32
+
+static EPOCHSHM_SLOT_t *_epochShmSlot(EPOCH_SHM_t *shm, const uint64_t index)
+{
+    return (EPOCHSHM_SLOT_t *)&shm->mem[ EPOCHSHM_HEAD_SIZE + ((index % shm->head->nSlots) * EPOCHSHM_SLOT_SIZE) ];
+}
+
+static void _epochShmName(char *dst, const int size, const char *name)
+{
+    snprintf(dst, size, "%s%s", name[0] == '/' ? "" : "/", name);
+}
+
+static void _epochShmCompact(EPOCH_SHM_EPOCH_t *dst, const EPOCH_t *src)
+{
+    memset(dst, 0, sizeof(*dst));
+    dst->seq             = src->seq;
+    dst->ts              = src->ts;
+    dst->tsPub           = TIME_NS_REAL();
+
+    dst->fix             = src->fix;
+    dst->fixOk           = src->fixOk;
+    dst->haveFix         = src->haveFix;
+    dst->havePos         = src->havePos;
+    dst->haveVel         = src->haveVel;
+    dst->haveRelPos      = src->haveRelPos;
+    dst->haveMsl         = src->haveMsl;
+    dst->haveTime        = src->haveTime;
+    dst->confTime        = src->confTime;
+    dst->leapSecKnown    = src->leapSecKnown;
+    dst->haveDate        = src->haveDate;
+    dst->confDate        = src->confDate;
+    dst->haveGpsWeek     = src->haveGpsWeek;
+    dst->haveGpsTow      = src->haveGpsTow;
+    dst->haveLeapSeconds = src->haveLeapSeconds;
+    dst->haveNumSv       = src->haveNumSv;
+    dst->havePdop        = src->havePdop;
+    dst->haveDiffAge     = src->haveDiffAge;
+    dst->haveNumSig      = src->haveNumSig;
+    dst->haveNumSat      = src->haveNumSat;
+
+    memcpy(dst->llh,    src->llh,    sizeof(dst->llh));
+    memcpy(dst->xyz,    src->xyz,    sizeof(dst->xyz));
+    dst->horizAcc        = src->horizAcc;
+    dst->vertAcc         = src->vertAcc;
+    dst->posAcc          = src->posAcc;
+    memcpy(dst->velNed, src->velNed, sizeof(dst->velNed));
+    dst->vel2d           = src->vel2d;
+    dst->vel3d           = src->vel3d;
+    dst->velAcc          = src->velAcc;
+    dst->relLen          = src->relLen;
+    memcpy(dst->relNed, src->relNed, sizeof(dst->relNed));
+    memcpy(dst->relAcc, src->relAcc, sizeof(dst->relAcc));
+    dst->heightMsl       = src->heightMsl;
+    dst->second          = src->second;
+    dst->timeAcc         = src->timeAcc;
+    dst->gpsTow          = src->gpsTow;
+    dst->gpsTowAcc       = src->gpsTowAcc;
+    dst->diffAge         = src->diffAge;
+    dst->pDOP            = src->pDOP;
+    dst->hour            = src->hour;
+    dst->minute          = src->minute;
+    dst->day             = src->day;
+    dst->month           = src->month;
+    dst->year            = src->year;
+    dst->gpsWeek         = src->gpsWeek;
+    dst->leapSeconds     = src->leapSeconds;
+    dst->numSv           = src->numSv;
+    dst->numSigUsed      = src->numSigUsed;
+    dst->numSatUsed      = src->numSatUsed;
+
+    memcpy(dst->str, src->str, sizeof(dst->str));
+    dst->str[sizeof(dst->str) - 1] = '\0';
+}
+
+// Read epoch from slot, returns false if the slot does not (or no longer) contain the wanted epoch
+static bool _epochShmRead(EPOCH_SHM_t *shm, const uint64_t index, EPOCH_SHM_EPOCH_t *epoch)
+{
+    EPOCHSHM_SLOT_t *slot = _epochShmSlot(shm, index);
+    for (int retry = 0; retry < 1000; retry++)
+    {
+        const uint32_t lock1 = __atomic_load_n(&slot->lock, __ATOMIC_ACQUIRE);
+        if ((lock1 & 0x1) != 0)
+        {
+            continue; // publisher is writing the slot
+        }
+        const uint64_t slotIndex = slot->index;
+        memcpy(epoch, &slot->epoch, sizeof(*epoch));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        const uint32_t lock2 = __atomic_load_n(&slot->lock, __ATOMIC_RELAXED);
+        if (lock1 == lock2)
+        {
+            return slotIndex == index;
+        }
+    }
+    EPOCHSHM_DEBUG("%s: read fail", shm->name);
+    return false;
+}
+
+// Check if the publisher is still running. It may have crashed without closing the shared memory.
+static bool _epochShmPublisherAlive(const EPOCHSHM_HEAD_t *head)
+{
+    if (__atomic_load_n(&head->alive, __ATOMIC_ACQUIRE) == 0)
+    {
+        return false;
+    }
+    const pid_t pid = head->pid;
+    return (kill(pid, 0) == 0) || (errno == EPERM);
+}
+
+// Remove existing shared memory if it is left over from a publisher that is no longer running. Anything else (a
+// running publisher, or something we don't know) is left alone.
+static bool _epochShmRemoveStale(const char *name)
+{
+    const int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        return errno == ENOENT; // gone in the meantime
+    }
+    struct stat st;
+    void *mem = MAP_FAILED;
+    if ( (fstat(fd, &st) == 0) && (st.st_size >= (off_t)EPOCHSHM_HEAD_SIZE) )
+    {
+        mem = mmap(NULL, EPOCHSHM_HEAD_SIZE, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (mem == MAP_FAILED)
+    {
+        WARNING("epochshm: %s exists but is not epoch shared memory, not removing it!", name);
+        return false;
+    }
+
+    const EPOCHSHM_HEAD_t *head = (const EPOCHSHM_HEAD_t *)mem;
+    bool res = false;
+    if (__atomic_load_n(&head->magic, __ATOMIC_ACQUIRE) != EPOCHSHM_MAGIC)
+    {
+        WARNING("epochshm: %s exists but is not (yet) initialised, not removing it!", name);
+    }
+    else if (_epochShmPublisherAlive(head))
+    {
+        WARNING("epochshm: %s is in use by another publisher (pid %u)!", name, head->pid);
+    }
+    else
+    {
+        // Readers still having it mapped will notice that that publisher is gone (see epochShmIsAlive())
+        DEBUG("epochshm: Removing %s left over from publisher pid %u", name, head->pid);
+        res = (shm_unlink(name) == 0) || (errno == ENOENT);
+    }
+    munmap(mem, EPOCHSHM_HEAD_SIZE);
+    return res;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+EPOCH_SHM_t *epochShmCreate(const char *name, const int nSlots)
+{
+    const int num = nSlots > 0 ? nSlots : EPOCH_SHM_DEFAULT_SLOTS;
+    if ( (name == NULL) || (name[0] == '\0') || (num < 2) || (num > EPOCHSHM_MAX_SLOTS) )
+    {
+        WARNING("epochshm: Bad parameters!");
+        return NULL;
+    }
+
+    EPOCH_SHM_t *shm = calloc(1, sizeof(EPOCH_SHM_t));
+    if (shm == NULL)
+    {
+        WARNING("epochshm: malloc fail!");
+        return NULL;
+    }
+    _epochShmName(shm->name, sizeof(shm->name), name);
+    shm->publisher = true;
+    shm->size = EPOCHSHM_HEAD_SIZE + (num * EPOCHSHM_SLOT_SIZE);
+
+    // Create, or replace left-overs from a previous (crashed) publisher
+    int fd = shm_open(shm->name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    if ( (fd < 0) && (errno == EEXIST) && _epochShmRemoveStale(shm->name) )
+    {
+        fd = shm_open(shm->name, O_RDWR | O_CREAT | O_EXCL, 0644);
+    }
+    if (fd < 0)
+    {
+        WARNING("epochshm: Failed creating %s: %s", shm->name, strerror(errno));
+        free(shm);
+        return NULL;
+    }
+    if (ftruncate(fd, shm->size) != 0)
+    {
+        WARNING("epochshm: Failed sizing %s: %s", shm->name, strerror(errno));
+        close(fd);
+        shm_unlink(shm->name);
+        free(shm);
+        return NULL;
+    }
+    shm->mem = mmap(NULL, shm->size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (shm->mem == MAP_FAILED)
+    {
+        WARNING("epochshm: Failed mapping %s: %s", shm->name, strerror(errno));
+        shm_unlink(shm->name);
+        free(shm);
+        return NULL;
+    }
+
+    memset(shm->mem, 0, shm->size);
+    shm->head = (EPOCHSHM_HEAD_t *)shm->mem;
+    shm->head->version  = EPOCH_SHM_VERSION;
+    shm->head->slotSize = EPOCHSHM_SLOT_SIZE;
+    shm->head->nSlots   = num;
+    shm->head->alive    = 1;
+    shm->head->pid      = getpid();
+    __atomic_store_n(&shm->head->magic, EPOCHSHM_MAGIC, __ATOMIC_RELEASE);
+
+    DEBUG("epochshm: Created %s (%d slots, %u bytes)", shm->name, num, (uint32_t)shm->size);
+    return shm;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool epochShmPublish(EPOCH_SHM_t *shm, const EPOCH_t *epoch)
+{
+    if ( (shm == NULL) || !shm->publisher || (epoch == NULL) || !epoch->valid )
+    {
+        return false;
+    }
+
+    // Prepare compact epoch before taking the lock, so that the slot is locked as short as possible
+    EPOCH_SHM_EPOCH_t compact;
+    _epochShmCompact(&compact, epoch);
+
+    const uint64_t index = shm->nPub;
+    EPOCHSHM_SLOT_t *slot = _epochShmSlot(shm, index);
+
+    // Lock slot (make sequence odd), the fence makes sure the lock is visible before any of the data
+    const uint32_t lock = slot->lock;
+    __atomic_store_n(&slot->lock, lock + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    slot->index = index;
+    memcpy(&slot->epoch, &compact, sizeof(slot->epoch));
+
+    // Unlock slot (make sequence even again) and advance head
+    __atomic_store_n(&slot->lock, lock + 2, __ATOMIC_RELEASE);
+    shm->nPub++;
+    __atomic_store_n(&shm->head->head, shm->nPub, __ATOMIC_RELEASE);
+
+    EPOCHSHM_DEBUG("%s: publish %"PRIu64" seq %u", shm->name, index, compact.seq);
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+EPOCH_SHM_t *epochShmOpen(const char *name)
+{
+    if ( (name == NULL) || (name[0] == '\0') )
+    {
+        return NULL;
+    }
+
+    EPOCH_SHM_t *shm = calloc(1, sizeof(EPOCH_SHM_t));
+    if (shm == NULL)
+    {
+        WARNING("epochshm: malloc fail!");
+        return NULL;
+    }
+    _epochShmName(shm->name, sizeof(shm->name), name);
+
+    const int fd = shm_open(shm->name, O_RDONLY, 0);
+    if (fd < 0)
+    {
+        DEBUG("epochshm: Failed opening %s: %s", shm->name, strerror(errno));
+        free(shm);
+        return NULL;
+    }
+    struct stat st;
+    if ( (fstat(fd, &st) != 0) || (st.st_size < (off_t)(EPOCHSHM_HEAD_SIZE + EPOCHSHM_SLOT_SIZE)) )
+    {
+        DEBUG("epochshm: Bad size %s", shm->name);
+        close(fd);
+        free(shm);
+        return NULL;
+    }
+    shm->size = st.st_size;
+    shm->mem = mmap(NULL, shm->size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (shm->mem == MAP_FAILED)
+    {
+        WARNING("epochshm: Failed mapping %s: %s", shm->name, strerror(errno));
+        free(shm);
+        return NULL;
+    }
+    shm->head = (EPOCHSHM_HEAD_t *)shm->mem;
+
+    if ( (__atomic_load_n(&shm->head->magic, __ATOMIC_ACQUIRE) != EPOCHSHM_MAGIC) ||
+         (shm->head->version != EPOCH_SHM_VERSION) || (shm->head->slotSize != EPOCHSHM_SLOT_SIZE) ||
+         (shm->head->nSlots < 2) ||
+         (shm->size < (EPOCHSHM_HEAD_SIZE + (shm->head->nSlots * EPOCHSHM_SLOT_SIZE))) )
+    {
+        WARNING("epochshm: Incompatible or not initialised %s!", shm->name);
+        munmap(shm->mem, shm->size);
+        free(shm);
+        return NULL;
+    }
+
+    DEBUG("epochshm: Opened %s (%u slots, pid %u)", shm->name, shm->head->nSlots, shm->head->pid);
+    return shm;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool epochShmGetLatest(EPOCH_SHM_t *shm, EPOCH_SHM_EPOCH_t *epoch)
+{
+    if ( (shm == NULL) || (epoch == NULL) )
+    {
+        return false;
+    }
+    for (int retry = 0; retry < 10; retry++)
+    {
+        const uint64_t head = __atomic_load_n(&shm->head->head, __ATOMIC_ACQUIRE);
+        if (head == 0)
+        {
+            return false;
+        }
+        if (_epochShmRead(shm, head - 1, epoch))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool epochShmGetNext(EPOCH_SHM_t *shm, uint64_t *cursor, EPOCH_SHM_EPOCH_t *epoch, uint32_t *nLost)
+{
+    if ( (shm == NULL) || (cursor == NULL) || (epoch == NULL) )
+    {
+        return false;
+    }
+    if (nLost != NULL)
+    {
+        *nLost = 0;
+    }
+    const bool first = (*cursor == 0);
+    while (true)
+    {
+        const uint64_t head = __atomic_load_n(&shm->head->head, __ATOMIC_ACQUIRE);
+        if (*cursor >= head)
+        {
+            return false;
+        }
+
+        // The publisher may be overwriting the oldest slot right now, so that one is not available
+        const uint64_t oldest = head >= shm->head->nSlots ? head - shm->head->nSlots + 1 : 0;
+        if (*cursor < oldest)
+        {
+            if ( (nLost != NULL) && !first )
+            {
+                *nLost += oldest - *cursor;
+            }
+            *cursor = oldest;
+        }
+
+        if (_epochShmRead(shm, *cursor, epoch))
+        {
+            (*cursor)++;
+            return true;
+        }
+        // Slot was overwritten while reading it, try again with the new head
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool epochShmIsAlive(EPOCH_SHM_t *shm)
+{
+    if (shm == NULL)
+    {
+        return false;
+    }
+    return _epochShmPublisherAlive(shm->head);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void epochShmClose(EPOCH_SHM_t *shm)
+{
+    if (shm == NULL)
+    {
+        return;
+    }
+    if (shm->publisher)
+    {
+        __atomic_store_n(&shm->head->alive, 0, __ATOMIC_RELEASE);
+        shm_unlink(shm->name);
+        DEBUG("epochshm: Removed %s (%"PRIu64" epochs published)", shm->name, shm->nPub);
+    }
+    munmap(shm->mem, shm->size);
+    free(shm);
+}
+
+/* ****************************************************************************************************************** */
+#else // _WIN32
+
+EPOCH_SHM_t *epochShmCreate(const char *name, const int nSlots)
+{
+    (void)name;
+    (void)nSlots;
+    WARNING("epochshm: Not supported on this platform!");
+    return NULL;
+}
+
+bool epochShmPublish(EPOCH_SHM_t *shm, const EPOCH_t *epoch)
+{
+    (void)shm;
+    (void)epoch;
+    return false;
+}
+
+EPOCH_SHM_t *epochShmOpen(const char *name)
+{
+    (void)name;
+    WARNING("epochshm: Not supported on this platform!");
+    return NULL;
+}
+
+bool epochShmGetLatest(EPOCH_SHM_t *shm, EPOCH_SHM_EPOCH_t *epoch)
+{
+    (void)shm;
+    (void)epoch;
+    return false;
+}
+
+bool epochShmGetNext(EPOCH_SHM_t *shm, uint64_t *cursor, EPOCH_SHM_EPOCH_t *epoch, uint32_t *nLost)
+{
+    (void)shm;
+    (void)cursor;
+    (void)epoch;
+    (void)nLost;
+    return false;
+}
+
+bool epochShmIsAlive(EPOCH_SHM_t *shm)
+{
+    (void)shm;
+    return false;
+}
+
+void epochShmClose(EPOCH_SHM_t *shm)
+{
+    (void)shm;
+}
+
+#endif // _WIN32
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,217 @@
+/*!
+    \file
+    \brief Navigation epoch shared memory publisher and reader
+
+    - Copyright (c) 2020-2021 Philippe Kehl (flipflip at oinkzwurgl dot org),
+      https://oinkzwurgl.org/hacking/ubloxcfg
+
+    This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+    License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+    version.
+
+    This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+    warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+    details.
+
+    You should have received a copy of the GNU General Public License along with this program.
+    If not, see <https://www.gnu.org/licenses/>.
+
+    \defgroup FF_EPOCHSHM Navigation epoch shared memory
+
+    \b Concept
+
+    - One process (the publisher) collects navigation epochs (see \ref FF_EPOCH) and publishes them into a POSIX shared
+      memory object
+    - Any number of other processes (readers) on the same machine can get the epochs from there, with very low latency
+      and without any system calls (once the shared memory is opened)
+    - The epochs are stored in a compact fixed layout (EPOCH_SHM_EPOCH_t), which contains the most relevant fields of
+      EPOCH_t but no pointers and no signal and satellite details
+    - The shared memory is a ring buffer of a few slots, each protected by a sequence lock. The publisher never waits
+      for readers. Readers retry if the publisher happened to update the slot while reading it, and they can detect
+      if they have missed epochs.
+    - Only available on Linux (and other POSIX systems)
+
+    \b Example (reader)
+
+    \code{.c}
+    #include "ff_epochshm.h"
+
+    EPOCH_SHM_t *shm = epochShmOpen("ubloxcfg");   // Shared memory created by the publisher, e.g. "cfgtool status -S ubloxcfg"
+    EPOCH_SHM_EPOCH_t epoch;
+    uint64_t cursor = 0;
+
+    while (epochShmIsAlive(shm))
+    {
+        uint32_t nLost = 0;
+        if (epochShmGetNext(shm, &cursor, &epoch, &nLost))
+        {
+            printf("epoch: %s (latency %.3fms)\n", epoch.str, (double)(TIME_NS_REAL() - epoch.tsPub) * 1e-6);
+        }
+        else
+        {
+            usleep(1000);  // or do something else
+        }
+    }
+    epochShmClose(shm);
+    \endcode
+
+    @{
+*/
+
+#ifndef __FF_EPOCHSHM_H__
+#define __FF_EPOCHSHM_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ff_epoch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ****************************************************************************************************************** */
+
+//! Layout version, increment on any change of EPOCH_SHM_EPOCH_t
+#define EPOCH_SHM_VERSION 1
+
+//! Default number of slots in the ring buffer
+#define EPOCH_SHM_DEFAULT_SLOTS 16
+
+//! Compact navigation epoch (a subset of EPOCH_t, see there for the meaning of the fields)
+typedef struct EPOCH_SHM_EPOCH_s
+{
+    uint32_t  seq;            //!< Epoch sequence number (EPOCH_t.seq)
+    uint32_t  ts;             //!< Epoch time (EPOCH_t.ts) [ms]
+    uint64_t  tsPub;          //!< Time the epoch was published (TIME_NS_REAL()) [ns]
+
+    int32_t   fix;            //!< EPOCH_FIX_t
+    uint8_t   fixOk;
+    uint8_t   haveFix;
+    uint8_t   havePos;
+    uint8_t   haveVel;
+    uint8_t   haveRelPos;
+    uint8_t   haveMsl;
+    uint8_t   haveTime;
+    uint8_t   confTime;
+    uint8_t   leapSecKnown;
+    uint8_t   haveDate;
+    uint8_t   confDate;
+    uint8_t   haveGpsWeek;
+    uint8_t   haveGpsTow;
+    uint8_t   haveLeapSeconds;
+    uint8_t   haveNumSv;
+    uint8_t   havePdop;
+    uint8_t   haveDiffAge;
+    uint8_t   haveNumSig;
+    uint8_t   haveNumSat;
+    uint8_t   _pad[1];
+
+    double    llh[3];         //!< Latitude [deg], longitude [deg], height [m]
+    double    xyz[3];         //!< ECEF position [m]
+    double    horizAcc;
+    double    vertAcc;
+    double    posAcc;
+    double    velNed[3];
+    double    vel2d;
+    double    vel3d;
+    double    velAcc;
+    double    relLen;
+    double    relNed[3];
+    double    relAcc[3];
+    double    heightMsl;
+    double    second;
+    double    timeAcc;
+    double    gpsTow;
+    double    gpsTowAcc;
+    double    diffAge;
+    float     pDOP;
+    int32_t   hour;
+    int32_t   minute;
+    int32_t   day;
+    int32_t   month;
+    int32_t   year;
+    int32_t   gpsWeek;
+    int32_t   leapSeconds;
+    int32_t   numSv;
+    int32_t   numSigUsed;
+    int32_t   numSatUsed;
+
+    char      str[256];       //!< Stringification (EPOCH_t.str)
+} EPOCH_SHM_EPOCH_t;
+
+//! Shared memory handle (opaque)
+typedef struct EPOCH_SHM_s EPOCH_SHM_t;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+//! Create shared memory for publishing epochs
+/*!
+    \param[in]  name    Name of the shared memory object (e.g. "ubloxcfg", which will be /dev/shm/ubloxcfg on Linux)
+    \param[in]  nSlots  Number of slots in the ring buffer (0 = EPOCH_SHM_DEFAULT_SLOTS)
+
+    Shared memory left over from a publisher that is no longer running is replaced. It fails if another publisher
+    is using the name.
+
+    \returns a handle, or NULL on error
+*/
+EPOCH_SHM_t *epochShmCreate(const char *name, const int nSlots);
+
+//! Publish epoch
+/*!
+    \param[in]  shm    Handle from epochShmCreate()
+    \param[in]  epoch  The epoch (from epochCollect())
+
+    \returns true on success, false otherwise
+*/
+bool epochShmPublish(EPOCH_SHM_t *shm, const EPOCH_t *epoch);
+
+//! Open shared memory for reading epochs
+/*!
+    \param[in]  name    Name of the shared memory object (as given to epochShmCreate())
+
+    \returns a handle, or NULL on error (e.g. no publisher, or incompatible layout)
+*/
+EPOCH_SHM_t *epochShmOpen(const char *name);
+
+//! Get latest epoch
+/*!
+    \param[in]   shm    Handle from epochShmOpen()
+    \param[out]  epoch  The latest epoch
+
+    \returns true if an epoch was available, false otherwise
+*/
+bool epochShmGetLatest(EPOCH_SHM_t *shm, EPOCH_SHM_EPOCH_t *epoch);
+
+//! Get next epoch
+/*!
+    \param[in]      shm     Handle from epochShmOpen()
+    \param[in,out]  cursor  Reader position, initialise to 0 to start with the oldest available epoch
+    \param[out]     epoch   The next epoch
+    \param[out]     nLost   Number of epochs missed because the reader was too slow (optional, can be NULL)
+
+    \returns true if the next epoch was available, false otherwise
+*/
+bool epochShmGetNext(EPOCH_SHM_t *shm, uint64_t *cursor, EPOCH_SHM_EPOCH_t *epoch, uint32_t *nLost);
+
+//! Check if publisher is still alive
+/*!
+    \param[in]  shm  Handle from epochShmOpen()
+
+    \returns true if the publisher has not closed the shared memory, false otherwise (the reader should close and
+             try to open it again)
+*/
+bool epochShmIsAlive(EPOCH_SHM_t *shm);
+
+//! Close shared memory
+/*!
+    \param[in]  shm  Handle from epochShmCreate() or epochShmOpen(). For the publisher this removes the shared memory.
+*/
+void epochShmClose(EPOCH_SHM_t *shm);
+
+/* ****************************************************************************************************************** */
+#ifdef __cplusplus
+}
+#endif
+#endif // __FF_EPOCHSHM_H__
+///@}
@@ -0,0 +1,757 @@
+// flipflip's logfile message and epoch index
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <math.h>
+#ifndef _WIN32
+#  include <unistd.h>
+#  include <sys/types.h>
+#endif
+
+#include "ff_stuff.h"
+#include "ff_debug.h"
+
+#include "ff_logindex.h"
+
+/* ****************************************************************************************************************** */
+
+//#define LOGINDEX_DEBUG(fmt, args...) DEBUG("logindex: " fmt, ## args)
+#define LOGINDEX_DEBUG(...) /* nothing */
+
+#define LOGINDEX_MAGIC        "UBXCFGIX"
+#define LOGINDEX_HASH_SIZE    65536 // Hash the first this many bytes of the logfile
+#define LOGINDEX_MAX_PENDING  10000 // Maximum number of messages waiting for their epoch
+#define LOGINDEX_NAME_SLOTS   4096  // Size of the message name hash table, must be a power of 2
+#define LOGINDEX_MAX_NAMES    (LOGINDEX_NAME_SLOTS / 2)
+#define LOGINDEX_FILE_BUF     (1024 * 1024)
+
+#ifdef _WIN32
+#  define LOGINDEX_FSEEK(f, o) _fseeki64(f, (__int64)(o), SEEK_SET)
+#else
+#  define LOGINDEX_FSEEK(f, o) fseeko(f, (off_t)(o), SEEK_SET)
+#endif
+
+struct LOG_INDEX_WRITER_s
+{
+    char               file[1000];
+    char               tmpFile[1010];
+    FILE              *fh;
+    char              *fileBuf;
+    bool               fail;
+    uint64_t           offset;      // Current offset in the logfile
+    uint32_t           hash;        // Hash of the first LOGINDEX_HASH_SIZE bytes of the logfile
+    uint32_t           nMsgs;       // Number of message records written
+    LOG_INDEX_MSG_t    pending[LOGINDEX_MAX_PENDING]; // Messages waiting for their epoch
+    int                nPending;
+    LOG_INDEX_EPOCH_t *epochs;      // Epochs (written at the end)
+    uint32_t           nEpochs;
+    uint32_t           maxEpochs;
+    uint16_t           nameSlots[LOGINDEX_NAME_SLOTS]; // Hash table: name index + 1, 0 = empty
+    uint32_t           nameHashes[LOGINDEX_MAX_NAMES];
+    uint32_t           nameOffs[LOGINDEX_MAX_NAMES];   // Offsets into names
+    int                nNames;
+    char              *names;       // Names (length + chars)
+    uint32_t           namesSize;
+    uint32_t           maxNamesSize;
+};
+
+// FNV-1a
+static uint32_t _logIndexHash(uint32_t hash, const uint8_t *data, const int size)
+{
+    for (int ix = 0; ix < size; ix++)
+    {
+        hash ^= data[ix];
+        hash *= 0x01000193;
+    }
+    return hash;
+}
+
+#define LOGINDEX_HASH_INIT 0x811c9dc5
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _logIndexPut16(uint8_t *p, const uint16_t v)
+{
+    p[0] = v & 0xff;
+    p[1] = (v >> 8) & 0xff;
+}
+
+static void _logIndexPut32(uint8_t *p, const uint32_t v)
+{
+    _logIndexPut16(&p[0], v & 0xffff);
+    _logIndexPut16(&p[2], (v >> 16) & 0xffff);
+}
+
+static void _logIndexPut64(uint8_t *p, const uint64_t v)
+{
+    _logIndexPut32(&p[0], v & 0xffffffff);
+    _logIndexPut32(&p[4], (v >> 32) & 0xffffffff);
+}
+
+static uint16_t _logIndexGet16(const uint8_t *p)
+{
+    return (uint16_t)p[0] | ((uint16_t)p[1] << 8);
+}
+
+static uint32_t _logIndexGet32(const uint8_t *p)
+{
+    return (uint32_t)_logIndexGet16(&p[0]) | ((uint32_t)_logIndexGet16(&p[2]) << 16);
+}
+
+static uint64_t _logIndexGet64(const uint8_t *p)
+{
+    return (uint64_t)_logIndexGet32(&p[0]) | ((uint64_t)_logIndexGet32(&p[4]) << 32);
+}
+
+static void _logIndexPutMsg(uint8_t *p, const LOG_INDEX_MSG_t *msg)
+{
+    _logIndexPut64(&p[ 0], msg->offset);
+    _logIndexPut16(&p[ 8], msg->size);
+    _logIndexPut16(&p[10], msg->nameIx);
+    _logIndexPut32(&p[12], msg->epoch);
+    _logIndexPut32(&p[16], msg->gpsTowMs);
+    _logIndexPut16(&p[20], msg->gpsWeek);
+    p[22] = msg->type;
+    p[23] = msg->flags;
+}
+
+static void _logIndexGetMsg(const uint8_t *p, LOG_INDEX_MSG_t *msg)
+{
+    msg->offset   = _logIndexGet64(&p[ 0]);
+    msg->size     = _logIndexGet16(&p[ 8]);
+    msg->nameIx   = _logIndexGet16(&p[10]);
+    msg->epoch    = _logIndexGet32(&p[12]);
+    msg->gpsTowMs = _logIndexGet32(&p[16]);
+    msg->gpsWeek  = _logIndexGet16(&p[20]);
+    msg->type     = p[22];
+    msg->flags    = p[23];
+}
+
+static void _logIndexPutEpoch(uint8_t *p, const LOG_INDEX_EPOCH_t *epoch)
+{
+    _logIndexPut64(&p[ 0], epoch->offset);
+    _logIndexPut32(&p[ 8], epoch->msgIx);
+    _logIndexPut32(&p[12], epoch->epoch);
+    _logIndexPut32(&p[16], epoch->gpsTowMs);
+    _logIndexPut16(&p[20], epoch->gpsWeek);
+    p[22] = epoch->fix;
+    p[23] = epoch->flags;
+}
+
+static void _logIndexGetEpoch(const uint8_t *p, LOG_INDEX_EPOCH_t *epoch)
+{
+    epoch->offset   = _logIndexGet64(&p[ 0]);
+    epoch->msgIx    = _logIndexGet32(&p[ 8]);
+    epoch->epoch    = _logIndexGet32(&p[12]);
+    epoch->gpsTowMs = _logIndexGet32(&p[16]);
+    epoch->gpsWeek  = _logIndexGet16(&p[20]);
+    epoch->fix      = p[22];
+    epoch->flags    = p[23];
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static uint16_t _logIndexNameIx(LOG_INDEX_WRITER_t *writer, const char *name)
+{
+    const int len = strlen(name) > 255 ? 255 : strlen(name);
+    const uint32_t hash = _logIndexHash(LOGINDEX_HASH_INIT, (const uint8_t *)name, len);
+    uint32_t slot = hash & (LOGINDEX_NAME_SLOTS - 1);
+    while (writer->nameSlots[slot] != 0)
+    {
+        const int nameIx = writer->nameSlots[slot] - 1;
+        const char *n = &writer->names[ writer->nameOffs[nameIx] ];
+        if ( (writer->nameHashes[nameIx] == hash) && ((uint8_t)n[0] == len) && (memcmp(&n[1], name, len) == 0) )
+        {
+            return nameIx;
+        }
+        slot = (slot + 1) & (LOGINDEX_NAME_SLOTS - 1);
+    }
+
+    // New name
+    if (writer->nNames >= LOGINDEX_MAX_NAMES)
+    {
+        return LOG_INDEX_NO_NAME;
+    }
+    if ((writer->namesSize + 1 + len) > writer->maxNamesSize)
+    {
+        const uint32_t maxNamesSize = (writer->maxNamesSize * 2) + 1 + len;
+        char *names = realloc(writer->names, maxNamesSize);
+        if (names == NULL)
+        {
+            return LOG_INDEX_NO_NAME;
+        }
+        writer->names = names;
+        writer->maxNamesSize = maxNamesSize;
+    }
+    const int nameIx = writer->nNames;
+    writer->nameOffs[nameIx] = writer->namesSize;
+    writer->nameHashes[nameIx] = hash;
+    writer->names[writer->namesSize] = (char)len;
+    memcpy(&writer->names[writer->namesSize + 1], name, len);
+    writer->namesSize += 1 + len;
+    writer->nameSlots[slot] = nameIx + 1;
+    writer->nNames++;
+    LOGINDEX_DEBUG("name %d %s", nameIx, name);
+    return nameIx;
+}
+
+// Write pending messages, assigning them to the epoch (or no epoch)
+static void _logIndexFlush(LOG_INDEX_WRITER_t *writer, const int num, const LOG_INDEX_EPOCH_t *epoch)
+{
+    uint8_t rec[LOG_INDEX_MSG_SIZE];
+    for (int ix = 0; ix < num; ix++)
+    {
+        LOG_INDEX_MSG_t *msg = &writer->pending[ix];
+        if (epoch != NULL)
+        {
+            msg->epoch    = epoch->epoch;
+            msg->gpsTowMs = epoch->gpsTowMs;
+            msg->gpsWeek  = epoch->gpsWeek;
+            msg->flags    = epoch->flags;
+        }
+        _logIndexPutMsg(rec, msg);
+        if (fwrite(rec, sizeof(rec), 1, writer->fh) != 1)
+        {
+            writer->fail = true;
+        }
+    }
+    writer->nMsgs += num;
+    writer->nPending -= num;
+    if (writer->nPending > 0)
+    {
+        memmove(&writer->pending[0], &writer->pending[num], writer->nPending * sizeof(writer->pending[0]));
+    }
+}
+
+static bool _logIndexAddEpoch(LOG_INDEX_WRITER_t *writer, const EPOCH_t *epoch, const int num)
+{
+    if (writer->nEpochs >= writer->maxEpochs)
+    {
+        const uint32_t maxEpochs = writer->maxEpochs > 0 ? 2 * writer->maxEpochs : 10000;
+        LOG_INDEX_EPOCH_t *epochs = realloc(writer->epochs, maxEpochs * sizeof(*epochs));
+        if (epochs == NULL)
+        {
+            WARNING("logindex: malloc fail!");
+            return false;
+        }
+        writer->epochs = epochs;
+        writer->maxEpochs = maxEpochs;
+    }
+
+    LOG_INDEX_EPOCH_t *e = &writer->epochs[writer->nEpochs];
+    memset(e, 0, sizeof(*e));
+    e->offset = num > 0 ? writer->pending[0].offset : writer->offset;
+    e->msgIx  = writer->nMsgs;
+    e->epoch  = epoch->seq;
+    e->fix    = epoch->haveFix ? epoch->fix : EPOCH_FIX_UNKNOWN;
+    if (epoch->haveGpsTow)
+    {
+        e->gpsTowMs = (uint32_t)floor((epoch->gpsTow * 1e3) + 0.5);
+        e->flags   |= LOG_INDEX_FLAG_TOW;
+        if (epoch->haveGpsWeek)
+        {
+            e->gpsWeek  = epoch->gpsWeek;
+            e->flags   |= LOG_INDEX_FLAG_TIME;
+        }
+    }
+    writer->nEpochs++;
+    _logIndexFlush(writer, num, e);
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+LOG_INDEX_WRITER_t *logIndexCreate(const char *file, const bool overwrite)
+{
+    if ( (file == NULL) || (file[0] == '\0') )
+    {
+        WARNING("logindex: Bad parameters!");
+        return NULL;
+    }
+    if (!overwrite)
+    {
+        FILE *fh = fopen(file, "r");
+        if (fh != NULL)
+        {
+            fclose(fh);
+            WARNING("logindex: %s already exists!", file);
+            return NULL;
+        }
+    }
+
+    LOG_INDEX_WRITER_t *writer = calloc(1, sizeof(LOG_INDEX_WRITER_t));
+    if (writer == NULL)
+    {
+        WARNING("logindex: malloc fail!");
+        return NULL;
+    }
+    snprintf(writer->file, sizeof(writer->file), "%s", file);
+    snprintf(writer->tmpFile, sizeof(writer->tmpFile), "%s.tmp", file);
+    writer->hash = LOGINDEX_HASH_INIT;
+
+    writer->fh = fopen(writer->tmpFile, "wb");
+    if (writer->fh == NULL)
+    {
+        WARNING("logindex: Failed creating %s: %s", writer->tmpFile, strerror(errno));
+        free(writer);
+        return NULL;
+    }
+    writer->fileBuf = malloc(LOGINDEX_FILE_BUF);
+    if (writer->fileBuf != NULL)
+    {
+        setvbuf(writer->fh, writer->fileBuf, _IOFBF, LOGINDEX_FILE_BUF);
+    }
+
+    LOGINDEX_DEBUG("create %s", file);
+    return writer;
+}
+
+bool logIndexAdd(LOG_INDEX_WRITER_t *writer, const PARSER_MSG_t *msg, const EPOCH_t *epoch)
+{
+    if ( (writer == NULL) || (msg == NULL) || (msg->size < 0) || (msg->size > 0xffff) )
+    {
+        return false;
+    }
+
+    if (writer->offset < LOGINDEX_HASH_SIZE)
+    {
+        const uint64_t rem = LOGINDEX_HASH_SIZE - writer->offset;
+        writer->hash = _logIndexHash(writer->hash, msg->data, (uint64_t)msg->size < rem ? msg->size : (int)rem);
+    }
+
+    // A full buffer means there are no epochs in the data (or not anymore), write what we have without epoch
+    if (writer->nPending >= LOGINDEX_MAX_PENDING)
+    {
+        _logIndexFlush(writer, writer->nPending, NULL);
+    }
+
+    // An epoch is complete either because this message ends it (UBX-NAV-EOE), or because this message (or rather its
+    // time) already belongs to the next epoch
+    const bool endOfEpoch = (epoch != NULL) && (msg->type == PARSER_MSGTYPE_UBX) && (strcmp(msg->name, "UBX-NAV-EOE") == 0);
+    if ( (epoch != NULL) && !endOfEpoch )
+    {
+        if (!_logIndexAddEpoch(writer, epoch, writer->nPending))
+        {
+            writer->fail = true;
+        }
+    }
+
+    LOG_INDEX_MSG_t *rec = &writer->pending[writer->nPending];
+    memset(rec, 0, sizeof(*rec));
+    rec->offset = writer->offset;
+    rec->size   = msg->size;
+    rec->nameIx = _logIndexNameIx(writer, msg->name != NULL ? msg->name : "");
+    rec->type   = msg->type;
+    writer->nPending++;
+    writer->offset += msg->size;
+
+    if (endOfEpoch)
+    {
+        if (!_logIndexAddEpoch(writer, epoch, writer->nPending))
+        {
+            writer->fail = true;
+        }
+    }
+
+    return !writer->fail;
+}
+
+bool logIndexFinish(LOG_INDEX_WRITER_t *writer, uint32_t *nMsgs, uint32_t *nEpochs)
+{
+    if (writer == NULL)
+    {
+        return false;
+    }
+
+    // Messages after the last epoch
+    _logIndexFlush(writer, writer->nPending, NULL);
+
+    // Epochs
+    uint8_t rec[LOG_INDEX_EPOCH_SIZE];
+    for (uint32_t ix = 0; !writer->fail && (ix < writer->nEpochs); ix++)
+    {
+        _logIndexPutEpoch(rec, &writer->epochs[ix]);
+        if (fwrite(rec, sizeof(rec), 1, writer->fh) != 1)
+        {
+            writer->fail = true;
+        }
+    }
+
+    // Names
+    if ( !writer->fail && (writer->namesSize > 0) && (fwrite(writer->names, writer->namesSize, 1, writer->fh) != 1) )
+    {
+        writer->fail = true;
+    }
+
+    // Footer
+    uint8_t footer[LOG_INDEX_FOOTER_SIZE];
+    memset(footer, 0, sizeof(footer));
+    _logIndexPut32(&footer[ 0], writer->nMsgs);
+    _logIndexPut32(&footer[ 4], writer->nEpochs);
+    _logIndexPut32(&footer[ 8], writer->nNames);
+    _logIndexPut32(&footer[12], writer->namesSize);
+    _logIndexPut64(&footer[16], writer->offset);
+    _logIndexPut32(&footer[24], writer->hash);
+    _logIndexPut32(&footer[36], LOG_INDEX_VERSION);
+    memcpy(&footer[40], LOGINDEX_MAGIC, 8);
+    if ( !writer->fail && (fwrite(footer, sizeof(footer), 1, writer->fh) != 1) )
+    {
+        writer->fail = true;
+    }
+
+    if (fclose(writer->fh) != 0)
+    {
+        writer->fail = true;
+    }
+    bool res = !writer->fail;
+    if (res)
+    {
+        remove(writer->file);
+        if (rename(writer->tmpFile, writer->file) != 0)
+        {
+            WARNING("logindex: Failed writing %s: %s", writer->file, strerror(errno));
+            res = false;
+        }
+    }
+    else
+    {
+        WARNING("logindex: Failed writing %s!", writer->tmpFile);
+    }
+    if (!res)
+    {
+        remove(writer->tmpFile);
+    }
+
+    LOGINDEX_DEBUG("finish %s: %u msgs, %u epochs, %d names, %" PRIu64 " bytes, res=%d",
+        writer->file, writer->nMsgs, writer->nEpochs, writer->nNames, writer->offset, res);
+    if (nMsgs != NULL)
+    {
+        *nMsgs = writer->nMsgs;
+    }
+    if (nEpochs != NULL)
+    {
+        *nEpochs = writer->nEpochs;
+    }
+    free(writer->epochs);
+    free(writer->names);
+    free(writer->fileBuf);
+    free(writer);
+    return res;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static int64_t _logIndexFileSize(FILE *fh)
+{
+#ifdef _WIN32
+    if (_fseeki64(fh, 0, SEEK_END) != 0)
+    {
+        return -1;
+    }
+    return _ftelli64(fh);
+#else
+    if (fseeko(fh, 0, SEEK_END) != 0)
+    {
+        return -1;
+    }
+    return ftello(fh);
+#endif
+}
+
+static bool _logIndexCheckLog(const char *logFile, const uint64_t logSize, const uint32_t logHash)
+{
+    FILE *fh = fopen(logFile, "rb");
+    if (fh == NULL)
+    {
+        WARNING("logindex: Failed opening %s: %s", logFile, strerror(errno));
+        return false;
+    }
+    // The logfile may have grown since it was indexed (e.g. it is still being written)
+    const int64_t size = _logIndexFileSize(fh);
+    bool res = (size >= 0) && ((uint64_t)size >= logSize);
+    if (res)
+    {
+        const int hashSize = logSize < LOGINDEX_HASH_SIZE ? (int)logSize : LOGINDEX_HASH_SIZE;
+        uint8_t *buf = malloc(LOGINDEX_HASH_SIZE);
+        res = (buf != NULL) && (LOGINDEX_FSEEK(fh, 0) == 0) && ((int)fread(buf, 1, hashSize, fh) == hashSize) &&
+            (_logIndexHash(LOGINDEX_HASH_INIT, buf, hashSize) == logHash);
+        free(buf);
+    }
+    fclose(fh);
+    return res;
+}
+
+LOG_INDEX_t *logIndexOpen(const char *file, const char *logFile)
+{
+    if ( (file == NULL) || (file[0] == '\0') )
+    {
+        WARNING("logindex: Bad parameters!");
+        return NULL;
+    }
+
+    FILE *fh = fopen(file, "rb");
+    if (fh == NULL)
+    {
+        WARNING("logindex: Failed opening %s: %s", file, strerror(errno));
+        return NULL;
+    }
+
+    // Check footer
+    uint8_t footer[LOG_INDEX_FOOTER_SIZE];
+    const int64_t size = _logIndexFileSize(fh);
+    if ( (size < LOG_INDEX_FOOTER_SIZE) || (LOGINDEX_FSEEK(fh, size - LOG_INDEX_FOOTER_SIZE) != 0) ||
+         (fread(footer, sizeof(footer), 1, fh) != 1) || (memcmp(&footer[40], LOGINDEX_MAGIC, 8) != 0) ||
+         (_logIndexGet32(&footer[36]) != LOG_INDEX_VERSION) )
+    {
+        WARNING("logindex: Bad index %s!", file);
+        fclose(fh);
+        return NULL;
+    }
+    const uint32_t nMsgs     = _logIndexGet32(&footer[ 0]);
+    const uint32_t nEpochs   = _logIndexGet32(&footer[ 4]);
+    const uint32_t nNames    = _logIndexGet32(&footer[ 8]);
+    const uint32_t namesSize = _logIndexGet32(&footer[12]);
+    const uint64_t logSize   = _logIndexGet64(&footer[16]);
+    const uint32_t logHash   = _logIndexGet32(&footer[24]);
+    const uint64_t epochsOffs = (uint64_t)nMsgs * LOG_INDEX_MSG_SIZE;
+    const uint64_t namesOffs  = epochsOffs + ((uint64_t)nEpochs * LOG_INDEX_EPOCH_SIZE);
+    if ( ((namesOffs + namesSize + LOG_INDEX_FOOTER_SIZE) != (uint64_t)size) || (nNames > namesSize) )
+    {
+        WARNING("logindex: Bad index %s!", file);
+        fclose(fh);
+        return NULL;
+    }
+    if ( (logFile != NULL) && !_logIndexCheckLog(logFile, logSize, logHash) )
+    {
+        WARNING("logindex: Index %s does not match %s!", file, logFile);
+        fclose(fh);
+        return NULL;
+    }
+
+    // Load epochs and names
+    LOG_INDEX_t *idx = calloc(1, sizeof(LOG_INDEX_t));
+    uint8_t *buf = malloc(namesSize > LOG_INDEX_EPOCH_SIZE ? namesSize : LOG_INDEX_EPOCH_SIZE);
+    char *names = malloc(namesSize + nNames + 1);
+    const char **namePtrs = malloc((nNames + 1) * sizeof(*namePtrs));
+    LOG_INDEX_EPOCH_t *epochs = malloc((nEpochs + 1) * sizeof(*epochs));
+    bool res = (idx != NULL) && (buf != NULL) && (names != NULL) && (namePtrs != NULL) && (epochs != NULL);
+    if (!res)
+    {
+        WARNING("logindex: malloc fail!");
+    }
+    res = res && (LOGINDEX_FSEEK(fh, epochsOffs) == 0);
+    for (uint32_t ix = 0; res && (ix < nEpochs); ix++)
+    {
+        res = (fread(buf, LOG_INDEX_EPOCH_SIZE, 1, fh) == 1);
+        if (res)
+        {
+            _logIndexGetEpoch(buf, &epochs[ix]);
+        }
+    }
+    res = res && ( (namesSize == 0) || (fread(buf, namesSize, 1, fh) == 1) );
+    uint32_t offs = 0;
+    uint32_t nameOffs = 0;
+    for (uint32_t ix = 0; res && (ix < nNames); ix++)
+    {
+        const uint32_t len = buf[offs];
+        if ((offs + 1 + len) > namesSize)
+        {
+            WARNING("logindex: Bad index %s!", file);
+            res = false;
+            break;
+        }
+        memcpy(&names[nameOffs], &buf[offs + 1], len);
+        names[nameOffs + len] = '\0';
+        namePtrs[ix] = &names[nameOffs];
+        nameOffs += len + 1;
+        offs += len + 1;
+    }
+    free(buf);
+
+    if (!res)
+    {
+        free(idx);
+        free(names);
+        free(namePtrs);
+        free(epochs);
+        fclose(fh);
+        return NULL;
+    }
+
+    idx->logSize = logSize;
+    idx->nMsgs   = nMsgs;
+    idx->nEpochs = nEpochs;
+    idx->epochs  = epochs;
+    idx->nNames  = nNames;
+    idx->names   = namePtrs;
+    idx->_file   = fh;
+    idx->_names  = names;
+    LOGINDEX_DEBUG("open %s: %u msgs, %u epochs, %u names", file, nMsgs, nEpochs, nNames);
+    return idx;
+}
+
+int logIndexGetMsgs(LOG_INDEX_t *idx, const uint32_t msgIx, LOG_INDEX_MSG_t *msgs, const int maxMsgs)
+{
+    if ( (idx == NULL) || (msgs == NULL) || (maxMsgs < 1) )
+    {
+        return -1;
+    }
+    if (msgIx >= idx->nMsgs)
+    {
+        return 0;
+    }
+    const uint32_t num = (idx->nMsgs - msgIx) < (uint32_t)maxMsgs ? (idx->nMsgs - msgIx) : (uint32_t)maxMsgs;
+    FILE *fh = idx->_file;
+    if (LOGINDEX_FSEEK(fh, (uint64_t)msgIx * LOG_INDEX_MSG_SIZE) != 0)
+    {
+        return -1;
+    }
+    uint8_t buf[LOG_INDEX_MSG_SIZE * 100];
+    uint32_t n = 0;
+    while (n < num)
+    {
+        const uint32_t chunk = (num - n) < 100 ? (num - n) : 100;
+        if (fread(buf, LOG_INDEX_MSG_SIZE, chunk, fh) != chunk)
+        {
+            return -1;
+        }
+        for (uint32_t ix = 0; ix < chunk; ix++)
+        {
+            _logIndexGetMsg(&buf[ix * LOG_INDEX_MSG_SIZE], &msgs[n + ix]);
+        }
+        n += chunk;
+    }
+    return (int)num;
+}
+
+static int64_t _logIndexEpochTime(const LOG_INDEX_EPOCH_t *epoch)
+{
+    return (int64_t)epoch->gpsWeek * (7 * 86400 * 1000) + epoch->gpsTowMs;
+}
+
+int logIndexFindTime(const LOG_INDEX_t *idx, const int gpsWeek, const uint32_t gpsTowMs)
+{
+    if ( (idx == NULL) || (idx->nEpochs == 0) )
+    {
+        return -1;
+    }
+
+    // Time of week only
+    if (gpsWeek < 0)
+    {
+        for (uint32_t ix = 0; ix < idx->nEpochs; ix++)
+        {
+            if ( ((idx->epochs[ix].flags & LOG_INDEX_FLAG_TOW) != 0) && (idx->epochs[ix].gpsTowMs >= gpsTowMs) )
+            {
+                return (int)ix;
+            }
+        }
+        return -1;
+    }
+    const int64_t time = (int64_t)gpsWeek * (7 * 86400 * 1000) + gpsTowMs;
+
+    // Binary search, skipping over epochs without time
+    uint32_t lo = 0;
+    uint32_t hi = idx->nEpochs;
+    while (lo < hi)
+    {
+        const uint32_t mid = lo + ((hi - lo) / 2);
+        uint32_t ix = mid;
+        while ( (ix < hi) && ((idx->epochs[ix].flags & LOG_INDEX_FLAG_TIME) == 0) )
+        {
+            ix++;
+        }
+        if (ix >= hi)
+        {
+            hi = mid;
+        }
+        else if (_logIndexEpochTime(&idx->epochs[ix]) < time)
+        {
+            lo = ix + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    while ( (lo < idx->nEpochs) && ((idx->epochs[lo].flags & LOG_INDEX_FLAG_TIME) == 0) )
+    {
+        lo++;
+    }
+    return lo < idx->nEpochs ? (int)lo : -1;
+}
+
+int logIndexFindEpoch(const LOG_INDEX_t *idx, const uint32_t epoch)
+{
+    if (idx == NULL)
+    {
+        return -1;
+    }
+    uint32_t lo = 0;
+    uint32_t hi = idx->nEpochs;
+    while (lo < hi)
+    {
+        const uint32_t mid = lo + ((hi - lo) / 2);
+        if (idx->epochs[mid].epoch < epoch)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return (lo < idx->nEpochs) && (idx->epochs[lo].epoch == epoch) ? (int)lo : -1;
+}
+
+int logIndexFindName(const LOG_INDEX_t *idx, const char *name)
+{
+    if ( (idx == NULL) || (name == NULL) )
+    {
+        return -1;
+    }
+    for (int ix = 0; ix < idx->nNames; ix++)
+    {
+        if (strcmp(idx->names[ix], name) == 0)
+        {
+            return ix;
+        }
+    }
+    return -1;
+}
+
+void logIndexClose(LOG_INDEX_t *idx)
+{
+    if (idx == NULL)
+    {
+        return;
+    }
+    if (idx->_file != NULL)
+    {
+        fclose(idx->_file);
+    }
+    free(idx->epochs);
+    free(idx->_names);
+    free(idx->names);
+    free(idx);
+}
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,225 @@
+/*!
+    \file
+    \brief Logfile message and epoch index
+
+    - Copyright (c) 2020-2021 Philippe Kehl (flipflip at oinkzwurgl dot org),
+      https://oinkzwurgl.org/hacking/ubloxcfg
+
+    This program is free software: you can redistribute it and/or modify it under the terms of the GNU General Public
+    License as published by the Free Software Foundation, either version 3 of the License, or (at your option) any later
+    version.
+
+    This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without even the implied
+    warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+    details.
+
+    You should have received a copy of the GNU General Public License along with this program.
+    If not, see <https://www.gnu.org/licenses/>.
+
+    \defgroup FF_LOGINDEX Logfile index
+
+    \b Concept
+
+    - A logfile (raw receiver data, e.g. a .ubx file) is scanned once through the parser (see \ref FF_PARSER) and the
+      epoch collector (see \ref FF_EPOCH), and an index is written to a sidecar file (e.g. log.ubx.idx)
+    - The index has one record per message (frame), with its offset and size in the logfile, its name, and the epoch
+      (sequence number and GPS time) it belongs to, as well as one record per epoch
+    - The GPS time of week is stored even if the week number is not known (e.g. logs with UBX-NAV-PVT but without
+      UBX-NAV-TIMEGPS), see #LOG_INDEX_FLAG_TOW
+    - Tools can use the index to jump directly to a time, an epoch or to the messages of a certain kind, instead of
+      parsing the logfile from the beginning (currently 'cfgtool extract')
+    - The index stores the size of the logfile and a hash of its beginning, so that a stale index (e.g. from a
+      logfile that has since been overwritten) is detected
+
+    \b Format
+
+    All values are little-endian:
+
+    - Message records (#LOG_INDEX_MSG_SIZE bytes each): offset (8), size (2), name index (2), epoch (4), GPS
+      time of week [ms] (4), GPS week (2), message type (1), flags (1)
+    - Epoch records (#LOG_INDEX_EPOCH_SIZE bytes each): offset (8), message index (4), epoch (4), GPS time of
+      week [ms] (4), GPS week (2), fix (1), flags (1)
+    - Message names: length (1) and characters (no nul termination) for each name
+    - Footer (#LOG_INDEX_FOOTER_SIZE bytes): number of messages (4), number of epochs (4), number of names (4), size
+      of the names (4), logfile size (8), logfile hash (4), version (4), magic (8)
+
+    \b Example
+
+    \code{.c}
+    #include "ff_logindex.h"
+
+    LOG_INDEX_t *idx = logIndexOpen("log.ubx.idx", "log.ubx");
+    const int epochIx = logIndexFindTime(idx, 2150, 345600000);
+    if (epochIx >= 0)
+    {
+        printf("epoch %u at offset %" PRIu64 "\n", idx->epochs[epochIx].epoch, idx->epochs[epochIx].offset);
+    }
+    logIndexClose(idx);
+    \endcode
+
+    @{
+*/
+
+#ifndef __FF_LOGINDEX_H__
+#define __FF_LOGINDEX_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ff_parser.h"
+#include "ff_epoch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ****************************************************************************************************************** */
+
+#define LOG_INDEX_VERSION      2   //!< Format version, increment on any change
+#define LOG_INDEX_MSG_SIZE     24  //!< Size of a message record
+#define LOG_INDEX_EPOCH_SIZE   24  //!< Size of an epoch record
+#define LOG_INDEX_FOOTER_SIZE  48  //!< Size of the footer
+#define LOG_INDEX_NO_NAME      0xffff //!< Name index for messages whose name could not be stored
+
+#define LOG_INDEX_FLAG_TIME    0x01 //!< Record has GPS time (week and time of week)
+#define LOG_INDEX_FLAG_TOW     0x02 //!< Record has GPS time of week (the week may be unknown)
+
+//! Message record
+typedef struct LOG_INDEX_MSG_s
+{
+    uint64_t  offset;    //!< Offset of the message in the logfile [bytes]
+    uint16_t  size;      //!< Size of the message [bytes]
+    uint16_t  nameIx;    //!< Index into LOG_INDEX_t.names, or #LOG_INDEX_NO_NAME
+    uint32_t  epoch;     //!< Epoch the message belongs to (EPOCH_t.seq), 0 if none
+    uint32_t  gpsTowMs;  //!< GPS time of week of the epoch [ms] (valid with #LOG_INDEX_FLAG_TOW)
+    uint16_t  gpsWeek;   //!< GPS week number of the epoch (valid with #LOG_INDEX_FLAG_TIME)
+    uint8_t   type;      //!< Message type (PARSER_MSGTYPE_t)
+    uint8_t   flags;     //!< LOG_INDEX_FLAG_...
+} LOG_INDEX_MSG_t;
+
+//! Epoch record
+typedef struct LOG_INDEX_EPOCH_s
+{
+    uint64_t  offset;    //!< Offset of the first message of the epoch in the logfile [bytes]
+    uint32_t  msgIx;     //!< Index of the first message of the epoch
+    uint32_t  epoch;     //!< Epoch sequence number (EPOCH_t.seq)
+    uint32_t  gpsTowMs;  //!< GPS time of week [ms] (valid with #LOG_INDEX_FLAG_TOW)
+    uint16_t  gpsWeek;   //!< GPS week number (valid with #LOG_INDEX_FLAG_TIME)
+    uint8_t   fix;       //!< Fix type (EPOCH_FIX_t)
+    uint8_t   flags;     //!< LOG_INDEX_FLAG_...
+} LOG_INDEX_EPOCH_t;
+
+//! Logfile index (reader)
+typedef struct LOG_INDEX_s
+{
+    uint64_t            logSize;  //!< Size of the logfile [bytes]
+    uint32_t            nMsgs;    //!< Number of message records
+    uint32_t            nEpochs;  //!< Number of epochs
+    LOG_INDEX_EPOCH_t  *epochs;   //!< Epochs
+    int                 nNames;   //!< Number of message names
+    const char        **names;    //!< Message names
+    void               *_file;    //!< Internal
+    void               *_names;   //!< Internal
+} LOG_INDEX_t;
+
+//! Logfile index writer (opaque)
+typedef struct LOG_INDEX_WRITER_s LOG_INDEX_WRITER_t;
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+//! Create index file
+/*!
+    \param[in]  file       Index file name
+    \param[in]  overwrite  Overwrite the index file if it exists
+
+    \returns a handle, or NULL on error
+*/
+LOG_INDEX_WRITER_t *logIndexCreate(const char *file, const bool overwrite);
+
+//! Add message to index
+/*!
+    Messages must be added in the order they appear in the logfile, and all of them, including GARBAGE messages, so
+    that the offsets are correct.
+
+    \param[in]  writer  Handle from logIndexCreate()
+    \param[in]  msg     The message (from parserProcess())
+    \param[in]  epoch   The epoch if epochCollect() returned one for this message, NULL otherwise
+
+    \returns true on success, false otherwise
+*/
+bool logIndexAdd(LOG_INDEX_WRITER_t *writer, const PARSER_MSG_t *msg, const EPOCH_t *epoch);
+
+//! Finish and close index file
+/*!
+    \param[in]  writer  Handle from logIndexCreate(), which is invalid after this call
+    \param[out] nMsgs   Number of messages indexed (optional, can be NULL)
+    \param[out] nEpochs Number of epochs indexed (optional, can be NULL)
+
+    \returns true on success, false otherwise (in which case the incomplete index file is removed)
+*/
+bool logIndexFinish(LOG_INDEX_WRITER_t *writer, uint32_t *nMsgs, uint32_t *nEpochs);
+
+//! Open index
+/*!
+    \param[in]  file     Index file name
+    \param[in]  logFile  Logfile the index belongs to (or NULL to skip the check if the index matches the logfile)
+
+    \returns a handle, or NULL on error (no or invalid index file, index does not match logfile)
+*/
+LOG_INDEX_t *logIndexOpen(const char *file, const char *logFile);
+
+//! Get message records
+/*!
+    \param[in]  idx      Handle from logIndexOpen()
+    \param[in]  msgIx    Index of the first message record to get
+    \param[out] msgs     Message records
+    \param[in]  maxMsgs  Maximum number of message records to get
+
+    \returns the number of message records, 0 at the end of the index, -1 on error
+*/
+int logIndexGetMsgs(LOG_INDEX_t *idx, const uint32_t msgIx, LOG_INDEX_MSG_t *msgs, const int maxMsgs);
+
+//! Find epoch by time
+/*!
+    With a week number this does a binary search over the epochs with #LOG_INDEX_FLAG_TIME. Without (gpsWeek < 0) it
+    searches the epochs with #LOG_INDEX_FLAG_TOW linearly, as the time of week wraps at the end of the week, and
+    returns the first epoch whose time of week is at or after the given one.
+
+    \param[in]  idx       Handle from logIndexOpen()
+    \param[in]  gpsWeek   GPS week number, or -1 to search by time of week only
+    \param[in]  gpsTowMs  GPS time of week [ms]
+
+    \returns the index into LOG_INDEX_t.epochs of the first epoch at or after the given time, or -1 if there is none
+*/
+int logIndexFindTime(const LOG_INDEX_t *idx, const int gpsWeek, const uint32_t gpsTowMs);
+
+//! Find epoch by sequence number
+/*!
+    \param[in]  idx    Handle from logIndexOpen()
+    \param[in]  epoch  Epoch sequence number (EPOCH_t.seq)
+
+    \returns the index into LOG_INDEX_t.epochs of the epoch, or -1 if there is no such epoch
+*/
+int logIndexFindEpoch(const LOG_INDEX_t *idx, const uint32_t epoch);
+
+//! Find message name
+/*!
+    \param[in]  idx    Handle from logIndexOpen()
+    \param[in]  name   Message name (e.g. "UBX-NAV-PVT")
+
+    \returns the index into LOG_INDEX_t.names, or -1 if no such message is in the index
+*/
+int logIndexFindName(const LOG_INDEX_t *idx, const char *name);
+
+//! Close index
+/*!
+    \param[in]  idx  Handle from logIndexOpen()
+*/
+void logIndexClose(LOG_INDEX_t *idx);
+
+/* ****************************************************************************************************************** */
+#ifdef __cplusplus
+}
+#endif
+#endif // __FF_LOGINDEX_H__
+///@}
@@ -51,16 +51,53 @@ void parserInit(PARSER_t *parser)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+void parserReset(PARSER_t *parser)
+{
+    parser->size = 0;
+    parser->offs = 0;
+    parser->tsHead = 0;
+    parser->tsCount = 0;
+    PARSER_XTRA_TRACE("reset");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 bool parserAdd(PARSER_t *parser, const uint8_t *data, const int size)
+{
+    return parserAddTs(parser, data, size, TIME_NS(), 0);
+}
+
+bool parserAddTs(PARSER_t *parser, const uint8_t *data, const int size, const uint64_t ts, const uint64_t tsReal)
 {
     // Overflow, discard all
     if ((parser->offs + parser->size + size) > (int)sizeof(parser->buf))
     {
         return false;
     }
+    if (size <= 0)
+    {
+        return true;
+    }
     // Add to buffer
     memcpy(&parser->buf[parser->offs + parser->size], data, size);
     parser->size += size;
+
+    // Remember when the data arrived. The buf[0] is at stream position parser->tot.
+    const uint32_t end = parser->tot + parser->offs + parser->size;
+    if (parser->tsCount < PARSER_MAX_TS)
+    {
+        PARSER_TS_t *chunk = &parser->ts[(parser->tsHead + parser->tsCount) % PARSER_MAX_TS];
+        chunk->end    = end;
+        chunk->ts     = ts;
+        chunk->tsReal = tsReal;
+        parser->tsCount++;
+    }
+    // Too many small chunks, add to the last one. The data will appear to have arrived a bit earlier than it did.
+    else
+    {
+        parser->ts[(parser->tsHead + parser->tsCount - 1) % PARSER_MAX_TS].end = end;
+    }
+
     PARSER_XTRA_TRACE("add: size=%d ", size);
     return true;
 }
@@ -80,6 +117,19 @@ const char *parserMsgtypeName(const PARSER_MSGTYPE_t type)
     return "UNKNOWN";
 }
 
+bool parserMessageInfo(char *info, const int size, const PARSER_MSGTYPE_t type, const uint8_t *msg, const int msgSize)
+{
+    switch (type)
+    {
+        case PARSER_MSGTYPE_UBX:     return ubxMessageInfo(info, size, msg, msgSize);
+        case PARSER_MSGTYPE_NMEA:    return nmeaMessageInfo(info, size, msg, msgSize);
+        case PARSER_MSGTYPE_RTCM3:   return rtcm3MessageInfo(info, size, msg, msgSize);
+        case PARSER_MSGTYPE_NOVATEL: return novatelMessageInfo(info, size, msg, msgSize);
+        case PARSER_MSGTYPE_GARBAGE: break;
+    }
+    return false;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 static int _isUbxMessage(const uint8_t *buf, const int size);
@@ -87,6 +137,7 @@ static int _isNmeaMessage(const uint8_t *buf, const int size);
 static int _isRtcm3Message(const uint8_t *buf, const int size);
 static int _isNovatelMessage(const uint8_t *buf, const int size);
 static void _emitGarbage(PARSER_t *parser, PARSER_MSG_t *msg);
+static void _emitTs(PARSER_t *parser, PARSER_MSG_t *msg, const int size);
 static void _emitMessage(PARSER_t *parser, PARSER_MSG_t *msg, const int msgSize, const PARSER_MSGTYPE_t msgType, const bool info);
 
 typedef struct PARSER_FUNC_s
@@ -183,15 +234,59 @@ bool parserProcess(PARSER_t *parser, PARSER_MSG_t *msg, const bool info)
 
 /* ****************************************************************************************************************** */
 
+static void _emitTs(PARSER_t *parser, PARSER_MSG_t *msg, const int size)
+{
+    // The message is at stream positions [parser->tot, parser->tot + size)
+    const uint32_t posFirst = parser->tot;
+    const uint32_t posLast  = parser->tot + size - 1;
+    const uint32_t posNext  = parser->tot + size;
+    bool haveFirst = false;
+    bool haveLast  = false;
+    for (int n = 0; n < parser->tsCount; n++)
+    {
+        const PARSER_TS_t *chunk = &parser->ts[(parser->tsHead + n) % PARSER_MAX_TS];
+        if (!haveFirst && ((int32_t)(chunk->end - posFirst) > 0))
+        {
+            msg->tsFirst = chunk->ts;
+            haveFirst = true;
+        }
+        if ((int32_t)(chunk->end - posLast) > 0)
+        {
+            msg->tsLast = chunk->ts;
+            msg->tsReal = chunk->tsReal;
+            haveLast = true;
+            break;
+        }
+    }
+    if (!haveLast) // should not happen
+    {
+        msg->tsLast = TIME_NS();
+        msg->tsReal = 0;
+    }
+    if (!haveFirst)
+    {
+        msg->tsFirst = msg->tsLast;
+    }
+    // Same thing in the TIME() reference
+    msg->ts = TIME() - (uint32_t)((TIME_NS() - msg->tsLast) / 1000000);
+
+    // Forget chunks that have now been consumed entirely
+    while ( (parser->tsCount > 0) && ((int32_t)(parser->ts[parser->tsHead].end - posNext) <= 0) )
+    {
+        parser->tsHead = (parser->tsHead + 1) % PARSER_MAX_TS;
+        parser->tsCount--;
+    }
+}
+
 static void _emitGarbage(PARSER_t *parser, PARSER_MSG_t *msg)
 {
-    uint32_t now = TIME();
     // Copy garbage to msg buf and move data in parser buf
     //     buf: GGGGGGGGGGGGG???????????????........ (p->offs > 0, p->size >= 0)
     //          ---p->offs--><-- p->size -->
     // --> tmp: GGGGGGGGGGGG......
     // --> buf  ???????????????..................... (p->offs = 0, p->size >= 0)
     const int size = parser->offs;
+    _emitTs(parser, msg, size);
     //PARSER_XTRA_TRACE("garb copy tmp %d ", size);
     memcpy(parser->tmp, parser->buf, size);
     //PARSER_XTRA_TRACE("garb move 0 <- %d (%d) ", size, parser->size);
@@ -205,7 +300,6 @@ static void _emitGarbage(PARSER_t *parser, PARSER_MSG_t *msg)
     msg->size = size;
     msg->data = parser->tmp;
     msg->seq  = parser->msg;
-    msg->ts   = now;
     msg->src  = PARSER_MSGSRC_UNKN;
     msg->name = "GARBAGE";
     msg->info = NULL;
@@ -215,7 +309,7 @@ static void _emitGarbage(PARSER_t *parser, PARSER_MSG_t *msg)
 
 static void _emitMessage(PARSER_t *parser, PARSER_MSG_t *msg, const int msgSize, const PARSER_MSGTYPE_t msgType, const bool info)
 {
-    uint32_t now = TIME();
+    _emitTs(parser, msg, msgSize);
 
     // Copy message to tmp, move remaining data to beginning of buf
     //     buf: MMMMMMMMMMMMMMM????????............. (p->offs = 0)
@@ -239,7 +333,6 @@ static void _emitMessage(PARSER_t *parser, PARSER_MSG_t *msg, const int msgSize,
     msg->size = msgSize;
     msg->data = parser->tmp;
     msg->seq  = parser->msg;
-    msg->ts   = now;
     msg->src  = PARSER_MSGSRC_UNKN;
     parser->name[0] = '\0';
     parser->info[0] = '\0';
@@ -248,44 +341,28 @@ static void _emitMessage(PARSER_t *parser, PARSER_MSG_t *msg, const int msgSize,
         case PARSER_MSGTYPE_UBX:
             msg->name = (ubxMessageName(parser->name, sizeof(parser->name), parser->tmp, msgSize) ?
                 parser->name : "UBX-?-?");
-            if (info)
-            {
-                msg->info = (ubxMessageInfo(parser->info, sizeof(parser->info), parser->tmp, msgSize) ?
-                    parser->info : NULL);
-            }
             break;
         case PARSER_MSGTYPE_NMEA:
             msg->name = (nmeaMessageName(parser->name, sizeof(parser->name), parser->tmp, msgSize) ?
                 parser->name : "NMEA-?-?");
-            if (info)
-            {
-                msg->info = (nmeaMessageInfo(parser->info, sizeof(parser->info), parser->tmp, msgSize) ?
-                    parser->info : NULL);
-            }
             break;
         case PARSER_MSGTYPE_RTCM3:
             msg->name = (rtcm3MessageName(parser->name, sizeof(parser->name), parser->tmp, msgSize) ?
                 parser->name : "RTCM3-?");
-            if (info)
-            {
-                msg->info = (rtcm3MessageInfo(parser->info, sizeof(parser->info), parser->tmp, msgSize) ?
-                    parser->info : NULL);
-            }
             break;
         case PARSER_MSGTYPE_NOVATEL:
             msg->name = (novatelMessageName(parser->name, sizeof(parser->name), parser->tmp, msgSize) ?
                 parser->name : "NOVATEL-?");
-            if (info)
-            {
-                msg->info = (novatelMessageInfo(parser->info, sizeof(parser->info), parser->tmp, msgSize) ?
-                    parser->info : NULL);
-            }
             break;
         default:
             msg->name = "?";
-            msg->info = NULL;
             break;
     }
+    msg->info = NULL;
+    if (info && parserMessageInfo(parser->info, sizeof(parser->info), msgType, parser->tmp, msgSize))
+    {
+        msg->info = parser->info;
+    }
     PARSER_XTRA_TRACE("process: emit %s, size %d, type %d ", msg->name, msgSize, msgType);
 }
 
@@ -41,6 +41,14 @@ extern "C" {
 #define PARSER_MAX_ANY_SIZE    16384 // the largest of the above
 #define PARSER_MAX_NAME_SIZE     100
 #define PARSER_MAX_INFO_SIZE    1000
+#define PARSER_MAX_TS             64 // number of timestamped chunks of data tracked
+
+typedef struct PARSER_TS_s
+{
+    uint32_t  end;      // stream position (see PARSER_t.tot) after the last byte of the chunk
+    uint64_t  ts;       // arrival time of the chunk (TIME_NS())
+    uint64_t  tsReal;   // arrival time of the chunk (TIME_NS_REAL()), 0 if unknown
+} PARSER_TS_t;
 
 typedef struct PARSER_s
 {
@@ -51,6 +59,9 @@ typedef struct PARSER_s
     uint8_t   tmp[PARSER_MAX_ANY_SIZE];
     char      name[PARSER_MAX_NAME_SIZE];
     char      info[PARSER_MAX_INFO_SIZE];
+    PARSER_TS_t ts[PARSER_MAX_TS]; // timestamps of the data in buf (ring buffer)
+    int       tsHead;
+    int       tsCount;
     // Statistics
     uint32_t  msg;
     uint32_t  tot;
@@ -85,14 +96,32 @@ typedef struct PARSER_MSG_s
     PARSER_MSGSRC_t  src;
     const char      *name;
     const char      *info; // may be NULL
+    uint64_t         tsFirst; // arrival time of the first byte of the message (TIME_NS()) [ns]
+    uint64_t         tsLast;  // arrival time of the last byte of the message (TIME_NS()) [ns]
+    uint64_t         tsReal;  // arrival time of the last byte of the message (TIME_NS_REAL()) [ns], 0 if unknown
 } PARSER_MSG_t;
 
 void parserInit(PARSER_t *parser);
+
+// Discard all data in the parser (but keep the statistics), much cheaper than parserInit()
+void parserReset(PARSER_t *parser);
+
+// Add data to the parser, the data is timestamped with the current time (TIME_NS())
 bool parserAdd(PARSER_t *parser, const uint8_t *data, const int size);
+
+// Add data to the parser, with the time the data has arrived, e.g. PORT_t.readTs (and .readTsReal)
+bool parserAddTs(PARSER_t *parser, const uint8_t *data, const int size, const uint64_t ts, const uint64_t tsReal);
+
+// Get next message, the message timestamps (tsFirst, tsLast, tsReal) are those of the data that contained the first
+// and last byte of the message. PARSER_MSG_t.ts is the tsLast in the TIME() reference.
 bool parserProcess(PARSER_t *parser, PARSER_MSG_t *msg, const bool info);
 
 const char *parserMsgtypeName(const PARSER_MSGTYPE_t type);
 
+// Make message info string, like parserProcess() does if info is requested. This is useful where the (expensive)
+// stringification is done elsewhere than the parsing, e.g. in another thread.
+bool parserMessageInfo(char *info, const int size, const PARSER_MSGTYPE_t type, const uint8_t *msg, const int msgSize);
+
 /* ****************************************************************************************************************** */
 #ifdef __cplusplus
 }
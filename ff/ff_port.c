@@ -14,6 +14,9 @@
 // You should have received a copy of the GNU General Public License along with this program.
 // If not, see <https://www.gnu.org/licenses/>.
 
+#ifndef _GNU_SOURCE
+#  define _GNU_SOURCE // recvmmsg()
+#endif
 #include <string.h>
 #include <stddef.h>
 #include <stdlib.h>
@@ -21,6 +24,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdarg.h>
+#include <ctype.h>
 #include <unistd.h>
 #include <fcntl.h>
 #include <fcntl.h>
@@ -39,10 +43,20 @@
 #  include <termios.h>
 #  include <netinet/in.h>
 #  include <netinet/tcp.h>
+#  include <arpa/inet.h>
+#  include <sys/ioctl.h>
+#endif
+#ifdef __linux__
+#  include <linux/serial.h>
+#endif
+#ifndef O_BINARY
+#  define O_BINARY 0
 #endif
 
 #include "ff_debug.h"
 #include "ff_stuff.h"
+#include "ff_parser.h"
+#include "ff_ubx.h"
 #include "ff_port.h"
 
 /* ****************************************************************************************************************** */
@@ -74,14 +88,37 @@ static const char *portSpecStr(PORT_t *port)
     switch (port->type)
     {
         case PORT_TYPE_SER:
-            snprintf(port->tmp, sizeof(port->tmp), "ser://%s@%d", port->file, port->baudrate);
+            snprintf(port->tmp, sizeof(port->tmp), "ser://%s@%d%s", port->file, port->baudrate,
+                port->lowLatency ? ",lowlat" : "");
             break;
         case PORT_TYPE_TCP:
             snprintf(port->tmp, sizeof(port->tmp), "tcp://%s:%u", port->file, port->port);
             break;
+        case PORT_TYPE_UDP:
+            snprintf(port->tmp, sizeof(port->tmp), strchr(port->file, ':') != NULL ? "udp://[%s]:%u" : "udp://%s:%u",
+                port->file, port->port);
+            break;
         case PORT_TYPE_TELNET:
             snprintf(port->tmp, sizeof(port->tmp), "telnet://%s:%u@%d", port->file, port->port, port->baudrate);
             break;
+        case PORT_TYPE_FILE:
+        case PORT_TYPE_STDIN:
+        case PORT_TYPE_SIM:
+        {
+            char speed[20];
+            if (port->speed > 0.0)
+            {
+                snprintf(speed, sizeof(speed), "%g", port->speed);
+            }
+            else
+            {
+                snprintf(speed, sizeof(speed), "max");
+            }
+            snprintf(port->tmp, sizeof(port->tmp), "%s://%s@%s",
+                port->type == PORT_TYPE_FILE ? "file" : (port->type == PORT_TYPE_STDIN ? "stdin" : "sim"),
+                port->file, speed);
+            break;
+        }
     }
     return port->tmp;
 }
@@ -151,6 +188,22 @@ bool portInit(PORT_t *port, const char *spec)
         {
             port->type = PORT_TYPE_TELNET;
         }
+        else if (strcmp(type, "file") == 0)
+        {
+            port->type = PORT_TYPE_FILE;
+        }
+        else if (strcmp(type, "stdin") == 0)
+        {
+            port->type = PORT_TYPE_STDIN;
+        }
+        else if (strcmp(type, "sim") == 0)
+        {
+            port->type = PORT_TYPE_SIM;
+        }
+        else if (strcmp(type, "udp") == 0)
+        {
+            port->type = PORT_TYPE_UDP;
+        }
         else
         {
             WARNING("%s: Bad port type %s!", spec, type);
@@ -165,6 +218,21 @@ bool portInit(PORT_t *port, const char *spec)
         {
             case PORT_TYPE_SER:
             {
+                char *opt = strrchr(addr, ',');
+                if (opt != NULL)
+                {
+                    opt[0] = '\0';
+                    if (strcmp(&opt[1], "lowlat") == 0)
+                    {
+                        port->lowLatency = true;
+                    }
+                    else
+                    {
+                        WARNING("%s: Bad option %s!", spec, &opt[1]);
+                        res = false;
+                        break;
+                    }
+                }
                 addr = strtok(addr, "@");
                 char *arg = strtok(NULL, "@");
 #ifdef _WIN32
@@ -233,6 +301,81 @@ bool portInit(PORT_t *port, const char *spec)
                 }
                 break;
             }
+            case PORT_TYPE_UDP:
+            {
+                char *arg = strrchr(addr, ':');
+                const int portnr = arg == NULL ? -1 : atoi(&arg[1]);
+                if ( (portnr < 1) || (portnr > UINT16_MAX))
+                {
+                    WARNING("%s: Missing or bad port number!", spec);
+                    res = false;
+                }
+                else
+                {
+                    arg[0] = '\0';
+                    // IPv6 addresses are in brackets, e.g. "[ff02::1]"
+                    const int len = strlen(addr);
+                    if ( (len >= 2) && (addr[0] == '[') && (addr[len - 1] == ']') )
+                    {
+                        addr[len - 1] = '\0';
+                        addr++;
+                    }
+                    else if ( (strchr(addr, ':') != NULL) || (strchr(addr, '[') != NULL) || (strchr(addr, ']') != NULL) )
+                    {
+                        WARNING("%s: Bad address, IPv6 addresses must be in brackets!", spec);
+                        res = false;
+                        break;
+                    }
+                    port->port = (uint16_t)portnr;
+                    strcat(port->file, addr);
+                    port->baudrate = 921600;
+                }
+                break;
+            }
+            case PORT_TYPE_FILE:
+            case PORT_TYPE_STDIN:
+            case PORT_TYPE_SIM:
+            {
+                port->baudrate = 921600;
+                port->speed = port->type == PORT_TYPE_SIM ? 1.0 : 0.0;
+                char *script = port->type == PORT_TYPE_SIM ? strchr(addr, ',') : NULL;
+                if (script != NULL)
+                {
+                    script[0] = '\0';
+                    snprintf(port->script, sizeof(port->script), "%s", &script[1]);
+                }
+                char *arg = strrchr(addr, '@');
+                if (arg != NULL)
+                {
+                    arg[0] = '\0';
+                    arg++;
+                    char *end = NULL;
+                    const double speed = strtod(arg, &end);
+                    if (strcmp(arg, "max") == 0)
+                    {
+                        port->speed = 0.0;
+                    }
+                    else if ( (end != NULL) && (end != arg) && (*end == '\0') && (speed > 0.0) )
+                    {
+                        port->speed = speed;
+                    }
+                    else
+                    {
+                        WARNING("%s: Bad speed %s!", spec, arg);
+                        res = false;
+                    }
+                }
+                if ( (port->type != PORT_TYPE_STDIN) && (addr[0] == '\0') )
+                {
+                    WARNING("%s: Missing file!", spec);
+                    res = false;
+                }
+                else
+                {
+                    strcat(port->file, addr);
+                }
+                break;
+            }
         }
     }
 
@@ -247,6 +390,8 @@ bool portInit(PORT_t *port, const char *spec)
 static bool _portOpenSer(PORT_t *port);
 static bool _portOpenTcp(PORT_t *port);
 static bool _portOpenTelnet(PORT_t *port);
+static bool _portOpenReplay(PORT_t *port);
+static bool _portOpenUdp(PORT_t *port);
 
 bool portOpen(PORT_t *port)
 {
@@ -264,6 +409,14 @@ bool portOpen(PORT_t *port)
             case PORT_TYPE_TELNET:
                 res = _portOpenTelnet(port);
                 break;
+            case PORT_TYPE_FILE:
+            case PORT_TYPE_STDIN:
+            case PORT_TYPE_SIM:
+                res = _portOpenReplay(port);
+                break;
+            case PORT_TYPE_UDP:
+                res = _portOpenUdp(port);
+                break;
         }
     }
 
@@ -281,6 +434,8 @@ bool portOpen(PORT_t *port)
 static void _portCloseSer(PORT_t *port);
 static void _portCloseTcp(PORT_t *port);
 static void _portCloseTelnet(PORT_t *port);
+static void _portCloseReplay(PORT_t *port);
+static void _portCloseUdp(PORT_t *port);
 
 void portClose(PORT_t *port)
 {
@@ -297,6 +452,14 @@ void portClose(PORT_t *port)
             case PORT_TYPE_TELNET:
                 _portCloseTelnet(port);
                 break;
+            case PORT_TYPE_FILE:
+            case PORT_TYPE_STDIN:
+            case PORT_TYPE_SIM:
+                _portCloseReplay(port);
+                break;
+            case PORT_TYPE_UDP:
+                _portCloseUdp(port);
+                break;
         }
         PORT_DEBUG("closed (rx=%u, tx=%u)", port->numRx, port->numTx);
         port->portOk = false;
@@ -308,6 +471,8 @@ void portClose(PORT_t *port)
 static bool _portWriteSer(PORT_t *port, const uint8_t *data, const int size);
 static bool _portWriteTcp(PORT_t *port, const uint8_t *data, const int size);
 static bool _portWriteTelnet(PORT_t *port, const uint8_t *data, const int size);
+static bool _portWriteReplay(PORT_t *port, const uint8_t *data, const int size);
+static bool _portWriteUdp(PORT_t *port, const uint8_t *data, const int size);
 
 bool portWrite(PORT_t *port, const uint8_t *data, const int size)
 {
@@ -325,6 +490,14 @@ bool portWrite(PORT_t *port, const uint8_t *data, const int size)
             case PORT_TYPE_TELNET:
                 res = _portWriteTelnet(port, data, size);
                 break;
+            case PORT_TYPE_FILE:
+            case PORT_TYPE_STDIN:
+            case PORT_TYPE_SIM:
+                res = _portWriteReplay(port, data, size);
+                break;
+            case PORT_TYPE_UDP:
+                res = _portWriteUdp(port, data, size);
+                break;
         }
     }
     PORT_TRACE("write %d %s", size, res ? "ok" : "fail");
@@ -340,6 +513,8 @@ bool portWrite(PORT_t *port, const uint8_t *data, const int size)
 static bool _portReadSer(PORT_t *port, uint8_t *data, const int size, int *nRead);
 static bool _portReadTcp(PORT_t *port, uint8_t *data, const int size, int *nRead);
 static bool _portReadTelnet(PORT_t *port, uint8_t *data, const int size, int *nRead);
+static bool _portReadReplay(PORT_t *port, uint8_t *data, const int size, int *nRead);
+static bool _portReadUdp(PORT_t *port, uint8_t *data, const int size, int *nRead);
 
 bool portRead(PORT_t *port, uint8_t *data, const int size, int *nRead)
 {
@@ -358,6 +533,14 @@ bool portRead(PORT_t *port, uint8_t *data, const int size, int *nRead)
             case PORT_TYPE_TELNET:
                 res = _portReadTelnet(port, data, size, nRead);
                 break;
+            case PORT_TYPE_FILE:
+            case PORT_TYPE_STDIN:
+            case PORT_TYPE_SIM:
+                res = _portReadReplay(port, data, size, nRead);
+                break;
+            case PORT_TYPE_UDP:
+                res = _portReadUdp(port, data, size, nRead);
+                break;
         }
     }
     if ((*nRead > 0) || !res)
@@ -367,15 +550,40 @@ bool portRead(PORT_t *port, uint8_t *data, const int size, int *nRead)
     if (res)
     {
         port->numRx += *nRead;
+        if (*nRead > 0)
+        {
+            port->readTs = TIME_NS();
+            port->readTsReal = TIME_NS_REAL();
+            PORT_READ_t *read = &port->readLog[port->numReads % PORT_READ_LOG_SIZE];
+            read->ts   = port->readTs;
+            read->size = *nRead;
+            port->numReads++;
+        }
     }
     return res;
 }
 
+int portGetReadLog(PORT_t *port, PORT_READ_t *reads, const int maxNum)
+{
+    if ( (port == NULL) || (reads == NULL) || (maxNum <= 0) )
+    {
+        return 0;
+    }
+    const int num = MIN(maxNum, (int)MIN(port->numReads, PORT_READ_LOG_SIZE));
+    for (int ix = 0; ix < num; ix++)
+    {
+        reads[ix] = port->readLog[(port->numReads - num + ix) % PORT_READ_LOG_SIZE];
+    }
+    return num;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 static bool _portCanBaudrateSer(PORT_t *port);
 static bool _portCanBaudrateTcp(PORT_t *port);
 static bool _portCanBaudrateTelnet(PORT_t *port);
+static bool _portCanBaudrateReplay(PORT_t *port);
+static bool _portCanBaudrateUdp(PORT_t *port);
 
 bool portCanBaudrate(PORT_t *port)
 {
@@ -393,6 +601,14 @@ bool portCanBaudrate(PORT_t *port)
             case PORT_TYPE_TELNET:
                 res = _portCanBaudrateTelnet(port);
                 break;
+            case PORT_TYPE_FILE:
+            case PORT_TYPE_STDIN:
+            case PORT_TYPE_SIM:
+                res = _portCanBaudrateReplay(port);
+                break;
+            case PORT_TYPE_UDP:
+                res = _portCanBaudrateUdp(port);
+                break;
         }
     }
     return res;
@@ -403,6 +619,8 @@ bool portCanBaudrate(PORT_t *port)
 static bool _portSetBaudrateSer(PORT_t *port, const int baudrate);
 static bool _portSetBaudrateTcp(PORT_t *port, const int baudrate);
 static bool _portSetBaudrateTelnet(PORT_t *port, const int baudrate);
+static bool _portSetBaudrateReplay(PORT_t *port, const int baudrate);
+static bool _portSetBaudrateUdp(PORT_t *port, const int baudrate);
 
 bool portSetBaudrate(PORT_t *port, const int baudrate)
 {
@@ -420,6 +638,14 @@ bool portSetBaudrate(PORT_t *port, const int baudrate)
             case PORT_TYPE_TELNET:
                 res = _portSetBaudrateTelnet(port, baudrate);
                 break;
+            case PORT_TYPE_FILE:
+            case PORT_TYPE_STDIN:
+            case PORT_TYPE_SIM:
+                res = _portSetBaudrateReplay(port, baudrate);
+                break;
+            case PORT_TYPE_UDP:
+                res = _portSetBaudrateUdp(port, baudrate);
+                break;
         }
     }
     PORT_TRACE("baudrate %d %s", baudrate, res ? "ok" : "fail");
@@ -431,6 +657,8 @@ bool portSetBaudrate(PORT_t *port, const int baudrate)
 static int _portGetBaudrateSer(PORT_t *port);
 static int _portGetBaudrateTcp(PORT_t *port);
 static int _portGetBaudrateTelnet(PORT_t *port);
+static int _portGetBaudrateReplay(PORT_t *port);
+static int _portGetBaudrateUdp(PORT_t *port);
 
 int portGetBaudrate(PORT_t *port)
 {
@@ -448,13 +676,95 @@ int portGetBaudrate(PORT_t *port)
             case PORT_TYPE_TELNET:
                 res = _portGetBaudrateTelnet(port);
                 break;
+            case PORT_TYPE_FILE:
+            case PORT_TYPE_STDIN:
+            case PORT_TYPE_SIM:
+                res = _portGetBaudrateReplay(port);
+                break;
+            case PORT_TYPE_UDP:
+                res = _portGetBaudrateUdp(port);
+                break;
         }
     }
     return res;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+int portGetFd(PORT_t *port)
+{
+#ifdef _WIN32
+    (void)port;
+    return -1;
+#else
+    // Replay ports are driven by reading from them, waiting for their fd won't work
+    if ( (port == NULL) || !port->portOk ||
+         (port->type == PORT_TYPE_FILE) || (port->type == PORT_TYPE_STDIN) || (port->type == PORT_TYPE_SIM) )
+    {
+        return -1;
+    }
+    return port->fd;
+#endif
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool portSetTxQueue(PORT_t *port, const int size, const PORT_TXQ_POLICY_t policy)
+{
+    if ( (port == NULL) || port->portOk || (size < 0) )
+    {
+        return false;
+    }
+    port->txqSize = size;
+    port->txqPolicy = policy;
+    return true;
+}
+
+static int _portTxqDepth(PORT_t *port);
+
+int portGetTxQueueDepth(PORT_t *port)
+{
+    return port != NULL ? _portTxqDepth(port) : 0;
+}
+
+static int _portTxqDelay(PORT_t *port);
+
+int portGetTxQueueDelay(PORT_t *port)
+{
+    return (port != NULL) && port->portOk ? _portTxqDelay(port) : -1;
+}
+
+static bool _portTxqDrain(PORT_t *port);
+
+bool portTxQueueDrain(PORT_t *port)
+{
+    return (port != NULL) && port->portOk ? _portTxqDrain(port) : false;
+}
+
+static bool _portFlushTcp(PORT_t *port, const uint32_t timeout);
+
+bool portFlush(PORT_t *port, const uint32_t timeout)
+{
+    if ( (port == NULL) || !port->portOk )
+    {
+        return false;
+    }
+    switch (port->type)
+    {
+        case PORT_TYPE_TCP:
+        case PORT_TYPE_TELNET:
+            return _portFlushTcp(port, timeout);
+        default:
+            return true;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 /* ***** serial ports *************************************************************************** */
 
+static void _portSetLowLatencySer(PORT_t *port);
+
 static bool _portOpenSer(PORT_t *port)
 {
 #ifdef _WIN32
@@ -520,6 +830,8 @@ static bool _portOpenSer(PORT_t *port)
     memset(&settings, 0, sizeof(settings));
     settings.c_iflag = IGNBRK | IGNPAR;
     settings.c_cflag = CS8 | CLOCAL | CREAD;
+    // Note that VMIN/VTIME are left at 0. They have no effect as we open the device non-blocking (O_NDELAY) and
+    // read() returns whatever is available. The latency is determined by the driver, see _portSetLowLatencySer().
     cfsetispeed(&settings, _portBaudrateValue(port->baudrate));
     cfsetospeed(&settings, _portBaudrateValue(port->baudrate));
 
@@ -533,11 +845,37 @@ static bool _portOpenSer(PORT_t *port)
 
     port->fd = fileno;
 
+    if (port->lowLatency)
+    {
+        _portSetLowLatencySer(port);
+    }
+
 #endif
 
     return true;
 }
 
+static void _portSetLowLatencySer(PORT_t *port)
+{
+#if defined(__linux__) && defined(ASYNC_LOW_LATENCY)
+    // Ask the driver to pass on received data immediately. For USB-serial adapters (e.g. FTDI) this sets the latency
+    // timer to 1 ms instead of the default 16 ms.
+    struct serial_struct serial;
+    if (ioctl(port->fd, TIOCGSERIAL, &serial) == 0)
+    {
+        serial.flags |= ASYNC_LOW_LATENCY;
+        if (ioctl(port->fd, TIOCSSERIAL, &serial) == 0)
+        {
+            PORT_DEBUG("low-latency mode enabled");
+            return;
+        }
+    }
+    PORT_DEBUG("low-latency mode not supported by driver: %s", _portErrStr(port, 0));
+#else
+    PORT_DEBUG("low-latency mode not supported on this platform");
+#endif
+}
+
 static uint32_t _portBaudrateValue(const int baudrate)
 {
     const int      rates[]  = { PORT_BAUDRATES };
@@ -704,6 +1042,77 @@ typedef int SOCKET;
 #  define SOCKET_ERROR -1
 #endif
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+typedef struct PORT_TXQ_s
+{
+    uint8_t *buf;
+    int      size;    // capacity
+    int      head;    // next byte to send
+    int      num;     // number of bytes in queue
+    double   tokens;  // token bucket [bytes]
+} PORT_TXQ_t;
+
+static bool _portTxqInit(PORT_t *port)
+{
+    const int size = port->txqSize > 0 ? port->txqSize : PORT_TXQ_DEFAULT_SIZE;
+    PORT_TXQ_t *txq = (PORT_TXQ_t *)malloc(sizeof(PORT_TXQ_t));
+    uint8_t *buf = (uint8_t *)malloc(size);
+    if ( (txq == NULL) || (buf == NULL) )
+    {
+        PORT_WARNING("malloc fail!");
+        free(txq);
+        free(buf);
+        return false;
+    }
+    memset(txq, 0, sizeof(*txq));
+    txq->buf = buf;
+    txq->size = size;
+    port->txq = txq;
+    port->lastTime = TIME();
+    return true;
+}
+
+static void _portTxqFree(PORT_t *port)
+{
+    PORT_TXQ_t *txq = (PORT_TXQ_t *)port->txq;
+    if (txq != NULL)
+    {
+        free(txq->buf);
+        free(txq);
+        port->txq = NULL;
+    }
+}
+
+static int _portTxqDepth(PORT_t *port)
+{
+    const PORT_TXQ_t *txq = (const PORT_TXQ_t *)port->txq;
+    return txq != NULL ? txq->num : 0;
+}
+
+// Don't send faster than the remote serial port at this baudrate can transmit, as the remote device will not have
+// infinite buffers. Assume 11 bits per character to be on the safe side.
+static double _portTxqRate(PORT_t *port)
+{
+    return port->baudrate > 0 ? (double)port->baudrate / 11.0 : 1e9; // [bytes/s]
+}
+
+static int _portTxqDelay(PORT_t *port)
+{
+    const PORT_TXQ_t *txq = (const PORT_TXQ_t *)port->txq;
+    if ( (txq == NULL) || (txq->num <= 0) )
+    {
+        return -1;
+    }
+    // Wait until we can send a reasonable chunk (5ms worth of data), rather than trickling out single bytes
+    const double rate = _portTxqRate(port);
+    const double tokens = txq->tokens + ((double)(TIME() - port->lastTime) * rate * 1e-3);
+    const double want = MIN((double)txq->num, MAX(1.0, rate * 0.005));
+    return tokens >= want ? 0 : (int)((want - tokens) / (rate * 1e-3)) + 1;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 #ifdef _WIN32
 static int gWinTcpSocketsOpen;
 
@@ -897,6 +1306,18 @@ static bool _portOpenTcp(PORT_t *port)
     port->fd = fd;
 #endif
 
+    // Transmit queue
+    if (!_portTxqInit(port))
+    {
+#ifdef _WIN32
+        closesocket(fd);
+        _winsockDeinit(port);
+#else
+        close(fd);
+#endif
+        return false;
+    }
+
     return true;
 }
 
@@ -904,6 +1325,14 @@ static bool _portOpenTcp(PORT_t *port)
 
 static void _portCloseTcp(PORT_t *port)
 {
+    // Send remaining queued data
+    const int depth = portGetTxQueueDepth(port);
+    if (depth > 0)
+    {
+        const int rate = port->baudrate > 0 ? port->baudrate / 11 : 1000000;
+        _portFlushTcp(port, MIN(((uint32_t)depth * 1000 / rate) + 1000, 10000));
+    }
+    _portTxqFree(port);
 #ifdef _WIN32
     closesocket((SOCKET)port->handle);
     _winsockDeinit(port);
@@ -914,42 +1343,129 @@ static void _portCloseTcp(PORT_t *port)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
-static bool _portWriteTcp(PORT_t *port, const uint8_t *data, const int size)
+// Send as much of the queue as the token bucket allows
+static bool _portTxqDrain(PORT_t *port)
 {
-    int rem = size;
-    int offs = 0;
-    while (rem > 0)
+    PORT_TXQ_t *txq = (PORT_TXQ_t *)port->txq;
+    if ( (txq == NULL) || (txq->num <= 0) )
     {
-        const int sendSize = rem > TCPIP_MAX_PACKET_SIZE ? TCPIP_MAX_PACKET_SIZE : rem;
+        return true;
+    }
 
-        // Throttle. The remote device will not have infinite buffers. So don't send faster than the remote
-        // serial port at this baudrate can transmit. Assume 11 bits per character to be on the safe side.
-        const int dt = TIME() - port->lastTime;
-        const int reqDt = port->baudrate != 0 ? (port->lastCount * 1000 / (port->baudrate / 11)) : 0;
-        const int wait = reqDt - dt;
-        if (wait > 0)
-        {
-            SLEEP(wait);
-        }
+    // Refill. Allow bursts of 50ms worth of data so that callers that read (and therefore drain) at a low rate can still
+    // use the full bandwidth.
+    const uint32_t tNow = TIME();
+    const double rate = _portTxqRate(port);
+    const double burst = MAX(rate * 0.05, TCPIP_MAX_PACKET_SIZE);
+    txq->tokens += (double)(tNow - port->lastTime) * rate * 1e-3;
+    if (txq->tokens > burst)
+    {
+        txq->tokens = burst;
+    }
+    port->lastTime = tNow;
 
+    while ( (txq->num > 0) && (txq->tokens >= 1.0) )
+    {
+        const int contig = MIN(txq->num, txq->size - txq->head);
+        const int sendSize = MIN(MIN(contig, (int)txq->tokens), TCPIP_MAX_PACKET_SIZE);
+#ifdef _WIN32
+        const int res = send((SOCKET)port->handle, (const char *)&txq->buf[txq->head], sendSize, 0);
+#else
+        const int res = send(port->fd, &txq->buf[txq->head], sendSize, MSG_DONTWAIT | MSG_NOSIGNAL);
+#endif
+        PORT_XTRA_TRACE("tcp send %d -> %d (queue %d, tokens %.0f)", sendSize, res, txq->num, txq->tokens);
+        if (res < 0)
+        {
 #ifdef _WIN32
-        const int res = send((SOCKET)port->handle, (const char *)&data[offs], sendSize, 0);
+            if (GetLastError() == WSAEWOULDBLOCK)
 #else
-        const int res = send(port->fd, &data[offs], sendSize, 0);
+            if ( (errno == EAGAIN) || (errno == EWOULDBLOCK) )
 #endif
+            {
+                break; // try again later
+            }
+            PORT_WARNING_THROTTLE("tcp send fail (%d, %d): %s", sendSize, res, _portErrStr(port, 0));
+            return false;
+        }
+        txq->tokens -= res;
+        txq->head = (txq->head + res) % txq->size;
+        txq->num -= res;
+        if (res < sendSize)
+        {
+            break;
+        }
+    }
+    return true;
+}
 
-        port->lastTime = TIME();
-        port->lastCount = sendSize;
+static bool _portWriteTcp(PORT_t *port, const uint8_t *data, const int size)
+{
+    PORT_TXQ_t *txq = (PORT_TXQ_t *)port->txq;
+    if (!_portTxqDrain(port))
+    {
+        return false;
+    }
 
-        PORT_XTRA_TRACE("tcp send (delay %d) %d -> %d", wait > 0 ? wait : 0, sendSize, res);
-        // FIXME: handle EAGAIN?
-        if ( (res < 0) || (res != sendSize) )
+    // Not enough space in queue
+    if ((txq->size - txq->num) < size)
+    {
+        switch (port->txqPolicy)
         {
-            PORT_WARNING_THROTTLE("tcp send fail (%d, %d): %s", sendSize, res, _portErrStr(port, 0));
+            case PORT_TXQ_POLICY_DROP:
+                port->numTxDropped += size;
+                PORT_WARNING_THROTTLE("tx queue full, dropping %d bytes (total %u)", size, port->numTxDropped);
+                return true;
+            case PORT_TXQ_POLICY_FAIL:
+                PORT_XTRA_TRACE("tx queue full (%d/%d), write %d fail", txq->num, txq->size, size);
+                return false;
+            case PORT_TXQ_POLICY_BLOCK:
+                break;
+        }
+    }
+
+    // Add to queue, waiting for space as necessary
+    int offs = 0;
+    while (offs < size)
+    {
+        const int space = txq->size - txq->num;
+        if (space <= 0)
+        {
+            SLEEP(5);
+            if (!_portTxqDrain(port))
+            {
+                return false;
+            }
+            continue;
+        }
+        const int tail = (txq->head + txq->num) % txq->size;
+        const int n = MIN(MIN(space, size - offs), txq->size - tail);
+        memcpy(&txq->buf[tail], &data[offs], n);
+        txq->num += n;
+        offs += n;
+    }
+
+    return _portTxqDrain(port);
+}
+
+static bool _portFlushTcp(PORT_t *port, const uint32_t timeout)
+{
+    const uint32_t t1 = TIME() + timeout;
+    while (portGetTxQueueDepth(port) > 0)
+    {
+        if (!_portTxqDrain(port))
+        {
+            return false;
+        }
+        if (portGetTxQueueDepth(port) == 0)
+        {
+            break;
+        }
+        if (TIME() > t1)
+        {
+            PORT_WARNING("tx queue flush timeout, %d bytes left", portGetTxQueueDepth(port));
             return false;
         }
-        offs += sendSize;
-        rem  -= sendSize;
+        SLEEP(5);
     }
     return true;
 }
@@ -958,6 +1474,13 @@ static bool _portWriteTcp(PORT_t *port, const uint8_t *data, const int size)
 
 static bool _portReadTcp(PORT_t *port, uint8_t *data, const int size, int *nRead)
 {
+    // Send queued data
+    if (!_portTxqDrain(port))
+    {
+        *nRead = 0;
+        return false;
+    }
+
 #ifdef _WIN32
     const int res = recv((SOCKET)port->handle, (char *)data, size, 0);
 #else
@@ -980,6 +1503,17 @@ static bool _portReadTcp(PORT_t *port, uint8_t *data, const int size, int *nRead
         *nRead = 0;
         return true;
     }
+    // Connection closed by remote end
+    else if (res == 0)
+    {
+        if (!port->eof)
+        {
+            PORT_WARNING("Connection closed");
+            port->eof = true;
+        }
+        *nRead = 0;
+        return false;
+    }
     // Error
     else
     {
@@ -1553,6 +2087,981 @@ static int _portGetBaudrateTelnet(PORT_t *port)
     return port->baudrate;
 }
 
+/* ***** UDP ************************************************************************************ */
+
+// Datagrams are received in batches (recvmmsg()) into a buffer and then handed out to the reader as a contiguous
+// stream. Drops due to socket buffer overflow are counted using SO_RXQ_OVFL (Linux). Data written to the port is sent
+// to the source of the last received datagram, or discarded if nothing has been received yet.
+
+#define PORT_UDP_BATCH     16
+#define PORT_UDP_MAX_SIZE  4096
+
+typedef struct PORT_UDP_s
+{
+#ifndef _WIN32
+    uint8_t                 buf[PORT_UDP_BATCH][PORT_UDP_MAX_SIZE];
+    int                     size[PORT_UDP_BATCH];
+    int                     num;       // number of datagrams in buf
+    int                     ix;        // current datagram
+    int                     offs;      // offset into current datagram
+    bool                    haveOvfl;
+    uint32_t                lastOvfl;  // last SO_RXQ_OVFL count
+    bool                    havePeer;
+    struct sockaddr_storage peer;      // source of last datagram
+    socklen_t               peerLen;
+#endif
+} PORT_UDP_t;
+
+static bool _portOpenUdp(PORT_t *port)
+{
+#ifdef _WIN32
+    PORT_WARNING("Not supported on this platform!");
+    return false;
+#else
+    struct addrinfo *result;
+    {
+        struct addrinfo hints;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family   = AF_UNSPEC;  // IPv4 or IPv6
+        hints.ai_socktype = SOCK_DGRAM;
+        hints.ai_flags    = AI_PASSIVE;
+        char portNrStr[20];
+        snprintf(portNrStr, sizeof(portNrStr), "%d", port->port);
+        const int res = getaddrinfo(port->file[0] != '\0' ? port->file : NULL, portNrStr, &hints, &result);
+        if (res != 0)
+        {
+            PORT_WARNING("Failed getting address: %s", gai_strerror(res));
+            return false;
+        }
+    }
+
+    int fd = -1;
+    for (struct addrinfo *rp = result; rp != NULL; rp = rp->ai_next)
+    {
+        fd = socket(rp->ai_family, rp->ai_socktype, rp->ai_protocol);
+        if (fd < 0)
+        {
+            continue;
+        }
+
+        // Allow several consumers of the same (multicast) stream
+        const int one = 1;
+        setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        // Large receive buffer for high data rates
+        const int rcvBuf = 1024 * 1024;
+        setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &rcvBuf, sizeof(rcvBuf));
+#  ifdef SO_RXQ_OVFL
+        if (setsockopt(fd, SOL_SOCKET, SO_RXQ_OVFL, &one, sizeof(one)) != 0)
+        {
+            PORT_DEBUG("Failed setting SO_RXQ_OVFL option: %s", _portErrStr(port, 0));
+        }
+#  endif
+
+        if (bind(fd, rp->ai_addr, rp->ai_addrlen) != 0)
+        {
+            PORT_WARNING("Failed binding: %s", _portErrStr(port, 0));
+            close(fd);
+            fd = -1;
+            continue;
+        }
+
+        // Join multicast group
+        bool joinOk = true;
+        if (rp->ai_family == AF_INET)
+        {
+            const struct sockaddr_in *sa = (const struct sockaddr_in *)rp->ai_addr;
+            if (IN_MULTICAST(ntohl(sa->sin_addr.s_addr)))
+            {
+                struct ip_mreq mreq;
+                memset(&mreq, 0, sizeof(mreq));
+                mreq.imr_multiaddr = sa->sin_addr;
+                mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+                joinOk = setsockopt(fd, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) == 0;
+            }
+        }
+        else if (rp->ai_family == AF_INET6)
+        {
+            const struct sockaddr_in6 *sa = (const struct sockaddr_in6 *)rp->ai_addr;
+            if (IN6_IS_ADDR_MULTICAST(&sa->sin6_addr))
+            {
+                struct ipv6_mreq mreq;
+                memset(&mreq, 0, sizeof(mreq));
+                mreq.ipv6mr_multiaddr = sa->sin6_addr;
+                mreq.ipv6mr_interface = sa->sin6_scope_id; // e.g. "[ff02::1%eth0]", 0 = default
+                joinOk = setsockopt(fd, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0;
+            }
+        }
+        if (!joinOk)
+        {
+            PORT_WARNING("Failed joining multicast group: %s", _portErrStr(port, 0));
+            close(fd);
+            fd = -1;
+            continue;
+        }
+        break;
+    }
+    freeaddrinfo(result);
+
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    const int flags = fcntl(fd, F_GETFL, 0);
+    if ( (flags < 0) || (fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) )
+    {
+        PORT_WARNING("Failed setting flags: %s", _portErrStr(port, 0));
+        close(fd);
+        return false;
+    }
+
+    PORT_UDP_t *udp = (PORT_UDP_t *)malloc(sizeof(PORT_UDP_t));
+    if (udp == NULL)
+    {
+        PORT_WARNING("malloc fail!");
+        close(fd);
+        return false;
+    }
+    memset(udp, 0, sizeof(*udp));
+
+    port->fd = fd;
+    port->state = udp;
+    return true;
+#endif
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _portCloseUdp(PORT_t *port)
+{
+#ifndef _WIN32
+    PORT_DEBUG("datagrams: %u received, %u lost, %u truncated",
+        port->numDgrams, port->numDgramsLost, port->numDgramsTrunc);
+    close(port->fd);
+    free(port->state);
+    port->state = NULL;
+#else
+    (void)port;
+#endif
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _portWriteUdp(PORT_t *port, const uint8_t *data, const int size)
+{
+#ifndef _WIN32
+    PORT_UDP_t *udp = (PORT_UDP_t *)port->state;
+    if (!udp->havePeer)
+    {
+        return true;
+    }
+    const int res = sendto(port->fd, data, size, 0, (const struct sockaddr *)&udp->peer, udp->peerLen);
+    if (res != size)
+    {
+        PORT_WARNING_THROTTLE("udp send fail (%d, %d): %s", size, res, _portErrStr(port, 0));
+        return false;
+    }
+#else
+    (void)port;
+    (void)data;
+    (void)size;
+#endif
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef _WIN32
+static bool _portRecvUdp(PORT_t *port, PORT_UDP_t *udp)
+{
+    struct mmsghdr msgs[PORT_UDP_BATCH];
+    struct iovec iovecs[PORT_UDP_BATCH];
+    struct sockaddr_storage addrs[PORT_UDP_BATCH];
+    union { char buf[CMSG_SPACE(sizeof(uint32_t))]; struct cmsghdr align; } ctrls[PORT_UDP_BATCH];
+    memset(msgs, 0, sizeof(msgs));
+    for (int ix = 0; ix < PORT_UDP_BATCH; ix++)
+    {
+        iovecs[ix].iov_base             = udp->buf[ix];
+        iovecs[ix].iov_len              = sizeof(udp->buf[ix]);
+        msgs[ix].msg_hdr.msg_iov        = &iovecs[ix];
+        msgs[ix].msg_hdr.msg_iovlen     = 1;
+        msgs[ix].msg_hdr.msg_name       = &addrs[ix];
+        msgs[ix].msg_hdr.msg_namelen    = sizeof(addrs[ix]);
+        msgs[ix].msg_hdr.msg_control    = ctrls[ix].buf;
+        msgs[ix].msg_hdr.msg_controllen = sizeof(ctrls[ix].buf);
+    }
+
+    const int num = recvmmsg(port->fd, msgs, PORT_UDP_BATCH, MSG_DONTWAIT, NULL);
+    PORT_XTRA_TRACE("udp recvmmsg %d -> %d", PORT_UDP_BATCH, num);
+    if (num < 0)
+    {
+        if ( (errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR) )
+        {
+            return true;
+        }
+        PORT_WARNING_THROTTLE("udp recv fail (%d): %s", num, _portErrStr(port, 0));
+        return false;
+    }
+
+    for (int ix = 0; ix < num; ix++)
+    {
+        udp->size[ix] = msgs[ix].msg_len;
+        if ((msgs[ix].msg_hdr.msg_flags & MSG_TRUNC) != 0)
+        {
+            port->numDgramsTrunc++;
+        }
+#  ifdef SO_RXQ_OVFL
+        for (struct cmsghdr *cmsg = CMSG_FIRSTHDR(&msgs[ix].msg_hdr); cmsg != NULL;
+                cmsg = CMSG_NXTHDR(&msgs[ix].msg_hdr, cmsg))
+        {
+            if ( (cmsg->cmsg_level == SOL_SOCKET) && (cmsg->cmsg_type == SO_RXQ_OVFL) )
+            {
+                uint32_t ovfl;
+                memcpy(&ovfl, CMSG_DATA(cmsg), sizeof(ovfl));
+                if (udp->haveOvfl && (ovfl != udp->lastOvfl))
+                {
+                    port->numDgramsLost += ovfl - udp->lastOvfl;
+                    PORT_WARNING_THROTTLE("udp lost %u datagrams (total %u)", ovfl - udp->lastOvfl, port->numDgramsLost);
+                }
+                udp->lastOvfl = ovfl;
+                udp->haveOvfl = true;
+            }
+        }
+#  endif
+    }
+    if (num > 0)
+    {
+        memcpy(&udp->peer, &addrs[num - 1], msgs[num - 1].msg_hdr.msg_namelen);
+        udp->peerLen = msgs[num - 1].msg_hdr.msg_namelen;
+        udp->havePeer = true;
+    }
+    port->numDgrams += num;
+    udp->num = num;
+    udp->ix = 0;
+    udp->offs = 0;
+    return true;
+}
+#endif
+
+static bool _portReadUdp(PORT_t *port, uint8_t *data, const int size, int *nRead)
+{
+#ifndef _WIN32
+    PORT_UDP_t *udp = (PORT_UDP_t *)port->state;
+    int offs = 0;
+    while (offs < size)
+    {
+        // Get more datagrams
+        if (udp->ix >= udp->num)
+        {
+            if (!_portRecvUdp(port, udp))
+            {
+                *nRead = offs;
+                return false;
+            }
+            if (udp->num == 0)
+            {
+                break;
+            }
+        }
+        // Copy (part of) current datagram
+        const int rem = udp->size[udp->ix] - udp->offs;
+        const int n = rem < (size - offs) ? rem : (size - offs);
+        memcpy(&data[offs], &udp->buf[udp->ix][udp->offs], n);
+        offs += n;
+        udp->offs += n;
+        if (udp->offs >= udp->size[udp->ix])
+        {
+            udp->ix++;
+            udp->offs = 0;
+            if (udp->ix >= udp->num)
+            {
+                udp->num = 0;
+                udp->ix = 0;
+            }
+        }
+    }
+    *nRead = offs;
+    return true;
+#else
+    (void)port;
+    (void)data;
+    (void)size;
+    (void)nRead;
+    return false;
+#endif
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _portCanBaudrateUdp(PORT_t *port)
+{
+    (void)port;
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _portSetBaudrateUdp(PORT_t *port, const int baudrate)
+{
+    (void)port;
+    (void)baudrate;
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static int _portGetBaudrateUdp(PORT_t *port)
+{
+    return port->baudrate;
+}
+
+/* ***** replay (file, stdin) and simulated receiver (sim) ************************************** */
+
+// All three types replay a log. The log is split into messages (using the parser) and messages are released
+// according to the replay speed. The timing is derived from the iTOW of UBX-NAV-* messages in the log. Other messages
+// are released as soon as the preceding navigation message has been released.
+// For file:// and stdin:// the data is passed directly to the reader and any data written is discarded.
+// For sim:// the data goes through a pseudo-terminal. Data written to the port is parsed and UBX polls are answered
+// from the script (if any), from the last message of the same kind seen in the log, or from built-in responses. UBX-CFG
+// messages are acknowledged.
+
+#define PORT_SIM_MAX_SEEN 100
+
+typedef struct PORT_SIM_ENTRY_s
+{
+    uint8_t    *poll;     // poll message (prefix) to match
+    int         pollSize;
+    uint8_t    *resp;     // response message(s)
+    int         respSize;
+} PORT_SIM_ENTRY_t;
+
+typedef struct PORT_REPLAY_s
+{
+    int               fd;          // log file (or stdin)
+    bool              eof;
+    PARSER_t          parser;      // splits the log into messages
+    uint8_t           msg[PARSER_MAX_ANY_SIZE]; // next message to release
+    int               msgSize;     // size of message, 0 = no message
+    int               msgOffs;     // part of message already released
+    bool              msgHasItow;
+    uint32_t          msgItow;
+    bool              haveRef;     // reference for replay timing
+    uint32_t          refItow;
+    uint64_t          refTs;
+    uint32_t          nMsgs;
+    // sim
+    int               master;      // pseudo-terminal master side (port->fd is the slave side)
+    PARSER_t          cmdParser;   // parses messages sent to the simulated receiver
+    uint8_t           resp[PARSER_BUF_SIZE]; // pending responses
+    int               respSize;
+    int               respOffs;
+    PORT_SIM_ENTRY_t *script;
+    int               nScript;
+    PORT_SIM_ENTRY_t  seen[PORT_SIM_MAX_SEEN]; // last seen UBX messages (other than UBX-NAV-*) in the log
+    int               nSeen;
+} PORT_REPLAY_t;
+
+static bool _portSimLoadScript(PORT_t *port, PORT_REPLAY_t *replay);
+static void _portReplayFree(PORT_REPLAY_t *replay);
+
+static bool _portOpenReplay(PORT_t *port)
+{
+    PORT_REPLAY_t *replay = (PORT_REPLAY_t *)malloc(sizeof(PORT_REPLAY_t));
+    if (replay == NULL)
+    {
+        PORT_WARNING("malloc fail!");
+        return false;
+    }
+    memset(replay, 0, sizeof(*replay));
+    replay->fd = -1;
+    replay->master = -1;
+    parserInit(&replay->parser);
+    parserInit(&replay->cmdParser);
+
+    // Input
+    if (port->type == PORT_TYPE_STDIN)
+    {
+        replay->fd = STDIN_FILENO;
+    }
+    else
+    {
+        replay->fd = open(port->file, O_RDONLY | O_BINARY);
+        if (replay->fd < 0)
+        {
+            PORT_WARNING("Failed opening file: %s", _portErrStr(port, 0));
+            _portReplayFree(replay);
+            return false;
+        }
+    }
+
+    if (port->type == PORT_TYPE_SIM)
+    {
+#ifdef _WIN32
+        PORT_WARNING("Not supported on this platform!");
+        _portReplayFree(replay);
+        return false;
+#else
+        if ( (port->script[0] != '\0') && !_portSimLoadScript(port, replay) )
+        {
+            _portReplayFree(replay);
+            return false;
+        }
+
+        // Pseudo-terminal, the master side is the simulated receiver, the slave side is our port
+        replay->master = open("/dev/ptmx", O_RDWR | O_NOCTTY | O_NONBLOCK);
+        int unlock = 0;
+        int ptyNum = -1;
+        if ( (replay->master < 0) || (ioctl(replay->master, TIOCSPTLCK, &unlock) != 0) ||
+             (ioctl(replay->master, TIOCGPTN, &ptyNum) != 0) )
+        {
+            PORT_WARNING("Failed creating pseudo-terminal: %s", _portErrStr(port, 0));
+            _portReplayFree(replay);
+            return false;
+        }
+        char slave[100];
+        snprintf(slave, sizeof(slave), "/dev/pts/%d", ptyNum);
+        port->fd = open(slave, O_RDWR | O_NOCTTY | O_NDELAY);
+        if (port->fd < 0)
+        {
+            PORT_WARNING("Failed opening %s: %s", slave, _portErrStr(port, 0));
+            _portReplayFree(replay);
+            return false;
+        }
+        // Raw mode for both sides, no echo, no line processing
+        struct termios settings;
+        if ( (tcgetattr(port->fd, &settings) == 0) )
+        {
+            cfmakeraw(&settings);
+            tcsetattr(port->fd, TCSANOW, &settings);
+        }
+        PORT_DEBUG("simulated receiver on %s", slave);
+#endif
+    }
+
+    port->state = replay;
+    return true;
+}
+
+static void _portReplayFree(PORT_REPLAY_t *replay)
+{
+    if ( (replay->fd >= 0) && (replay->fd != STDIN_FILENO) )
+    {
+        close(replay->fd);
+    }
+    if (replay->master >= 0)
+    {
+        close(replay->master);
+    }
+    for (int ix = 0; ix < replay->nScript; ix++)
+    {
+        free(replay->script[ix].poll);
+        free(replay->script[ix].resp);
+    }
+    free(replay->script);
+    for (int ix = 0; ix < replay->nSeen; ix++)
+    {
+        free(replay->seen[ix].resp);
+    }
+    free(replay);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _portCloseReplay(PORT_t *port)
+{
+    PORT_REPLAY_t *replay = (PORT_REPLAY_t *)port->state;
+    if (replay != NULL)
+    {
+        PORT_DEBUG("replayed %u messages", replay->nMsgs);
+#ifndef _WIN32
+        if (port->type == PORT_TYPE_SIM)
+        {
+            close(port->fd);
+        }
+#endif
+        _portReplayFree(replay);
+        port->state = NULL;
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _portSimRemember(PORT_REPLAY_t *replay);
+
+// Get iTOW from UBX-NAV-* and UBX-NAV2-* messages that have it, returns false for those that don't
+static bool _portReplayItow(const uint8_t *msg, const int size, uint32_t *iTow)
+{
+    int offs = -1;
+    switch (UBX_MSGID(msg))
+    {
+        case UBX_NAV_ATT_MSGID:
+        case UBX_NAV_CLOCK_MSGID:
+        case UBX_NAV_COV_MSGID:
+        case UBX_NAV_DOP_MSGID:
+        case UBX_NAV_EELL_MSGID:
+        case UBX_NAV_EOE_MSGID:
+        case UBX_NAV_GEOFENCE_MSGID:
+        case UBX_NAV_ORB_MSGID:
+        case UBX_NAV_POSECEF_MSGID:
+        case UBX_NAV_POSLLH_MSGID:
+        case UBX_NAV_PVAT_MSGID:
+        case UBX_NAV_PVT_MSGID:
+        case UBX_NAV_SAT_MSGID:
+        case UBX_NAV_SBAS_MSGID:
+        case UBX_NAV_SIG_MSGID:
+        case UBX_NAV_SLAS_MSGID:
+        case UBX_NAV_STATUS_MSGID:
+        case UBX_NAV_TIMEBDS_MSGID:
+        case UBX_NAV_TIMEGAL_MSGID:
+        case UBX_NAV_TIMEGLO_MSGID:
+        case UBX_NAV_TIMEGPS_MSGID:
+        case UBX_NAV_TIMELS_MSGID:
+        case UBX_NAV_TIMEQZSS_MSGID:
+        case UBX_NAV_TIMEUTC_MSGID:
+        case UBX_NAV_VELECEF_MSGID:
+        case UBX_NAV_VELNED_MSGID:
+            offs = 0;
+            break;
+        // These start with version and reserved fields
+        case UBX_NAV_HPPOSECEF_MSGID:
+        case UBX_NAV_HPPOSLLH_MSGID:
+        case UBX_NAV_ODO_MSGID:
+        case UBX_NAV_RELPOSNED_MSGID:
+        case UBX_NAV_SVIN_MSGID:
+            offs = 4;
+            break;
+    }
+    if ( (offs < 0) || (size < (UBX_FRAME_SIZE + offs + 4)) )
+    {
+        return false;
+    }
+    const uint8_t *p = &msg[UBX_HEAD_SIZE + offs];
+    *iTow = (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+    return true;
+}
+
+// Get next message from the log, returns false if there's none (yet)
+static bool _portReplayNext(PORT_t *port, PORT_REPLAY_t *replay)
+{
+    while (replay->msgSize == 0)
+    {
+        PARSER_MSG_t msg;
+        if (parserProcess(&replay->parser, &msg, false))
+        {
+            memcpy(replay->msg, msg.data, msg.size);
+            replay->msgSize = msg.size;
+            replay->msgOffs = 0;
+            const bool isNav = (msg.type == PARSER_MSGTYPE_UBX) &&
+                ((UBX_CLSID(msg.data) == UBX_NAV_CLSID) || (UBX_CLSID(msg.data) == UBX_NAV2_CLSID));
+            replay->msgHasItow = isNav && _portReplayItow(msg.data, msg.size, &replay->msgItow);
+            if ( !isNav && (port->type == PORT_TYPE_SIM) && (msg.type == PARSER_MSGTYPE_UBX) )
+            {
+                _portSimRemember(replay);
+            }
+            replay->nMsgs++;
+            break;
+        }
+        if (replay->eof)
+        {
+            return false;
+        }
+
+        // Load more data
+        uint8_t buf[4096];
+        const int space = (int)sizeof(replay->parser.buf) - replay->parser.offs - replay->parser.size;
+        const int res = read(replay->fd, buf, space < (int)sizeof(buf) ? space : (int)sizeof(buf));
+        if (res > 0)
+        {
+            parserAdd(&replay->parser, buf, res);
+        }
+        else if ( (res == 0) || ((errno != EAGAIN) && (errno != EINTR)) )
+        {
+            PORT_DEBUG("end of input after %u messages", replay->nMsgs);
+            replay->eof = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Check if the current message is due for release
+static bool _portReplayDue(PORT_t *port, PORT_REPLAY_t *replay)
+{
+    if ( (port->speed <= 0.0) || !replay->msgHasItow || (replay->msgOffs > 0) )
+    {
+        return true;
+    }
+    const uint64_t now = TIME_NS();
+    const int64_t dtLog = (int64_t)replay->msgItow - (int64_t)replay->refItow;
+    // (Re-)start timing on the first message, on week rollover and on large gaps in the log
+    if ( !replay->haveRef || (dtLog < 0) || (dtLog > 60000) )
+    {
+        replay->haveRef = true;
+        replay->refItow = replay->msgItow;
+        replay->refTs = now;
+        return true;
+    }
+    return ((double)(now - replay->refTs) * port->speed) >= ((double)dtLog * 1e6);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _portWriteReplay(PORT_t *port, const uint8_t *data, const int size)
+{
+#ifndef _WIN32
+    if (port->type == PORT_TYPE_SIM)
+    {
+        return _portWriteSer(port, data, size);
+    }
+#endif
+    // Discard
+    (void)port;
+    (void)data;
+    (void)size;
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _portSimProcessCommands(PORT_t *port, PORT_REPLAY_t *replay);
+static void _portSimPump(PORT_t *port, PORT_REPLAY_t *replay);
+
+static bool _portReadReplay(PORT_t *port, uint8_t *data, const int size, int *nRead)
+{
+    PORT_REPLAY_t *replay = (PORT_REPLAY_t *)port->state;
+
+    // Simulated receiver: handle commands, feed responses and log to the pseudo-terminal, read from there
+    if (port->type == PORT_TYPE_SIM)
+    {
+        _portSimProcessCommands(port, replay);
+        _portSimPump(port, replay);
+        return _portReadSer(port, data, size, nRead);
+    }
+
+    // Replay: copy log to caller directly
+    int offs = 0;
+    while ( (offs < size) && _portReplayNext(port, replay) && _portReplayDue(port, replay) )
+    {
+        const int rem = replay->msgSize - replay->msgOffs;
+        const int n = rem < (size - offs) ? rem : (size - offs);
+        memcpy(&data[offs], &replay->msg[replay->msgOffs], n);
+        offs += n;
+        replay->msgOffs += n;
+        if (replay->msgOffs >= replay->msgSize)
+        {
+            replay->msgSize = 0;
+        }
+    }
+    *nRead = offs;
+
+    // Everything delivered, tell the caller
+    if ( (offs == 0) && replay->eof && (replay->msgSize == 0) )
+    {
+        port->eof = true;
+        return false;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _portCanBaudrateReplay(PORT_t *port)
+{
+    (void)port;
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _portSetBaudrateReplay(PORT_t *port, const int baudrate)
+{
+    (void)port;
+    (void)baudrate;
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static int _portGetBaudrateReplay(PORT_t *port)
+{
+    return port->baudrate;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifdef _WIN32
+
+static void _portSimProcessCommands(PORT_t *port, PORT_REPLAY_t *replay)
+{
+    (void)port;
+    (void)replay;
+}
+
+static void _portSimPump(PORT_t *port, PORT_REPLAY_t *replay)
+{
+    (void)port;
+    (void)replay;
+}
+
+#else
+
+static void _portSimQueue(PORT_t *port, PORT_REPLAY_t *replay, const uint8_t *data, const int size)
+{
+    if ( (replay->respOffs > 0) && (replay->respOffs >= replay->respSize) )
+    {
+        replay->respOffs = 0;
+        replay->respSize = 0;
+    }
+    if ((replay->respSize + size) > (int)sizeof(replay->resp))
+    {
+        PORT_WARNING_THROTTLE("sim response overflow, dropping %d bytes", size);
+        return;
+    }
+    memcpy(&replay->resp[replay->respSize], data, size);
+    replay->respSize += size;
+}
+
+static void _portSimAck(PORT_t *port, PORT_REPLAY_t *replay, const uint8_t *msg, const bool ack)
+{
+    const UBX_ACK_ACK_V0_GROUP0_t payload = { .clsId = UBX_CLSID(msg), .msgId = UBX_MSGID(msg) };
+    uint8_t buf[UBX_ACK_ACK_V0_SIZE];
+    const int size = ubxMakeMessage(UBX_ACK_CLSID, ack ? UBX_ACK_ACK_MSGID : UBX_ACK_NAK_MSGID,
+        (const uint8_t *)&payload, sizeof(payload), buf);
+    _portSimQueue(port, replay, buf, size);
+}
+
+static bool _portSimRespondMonVer(PORT_t *port, PORT_REPLAY_t *replay)
+{
+    struct
+    {
+        UBX_MON_VER_V0_GROUP0_t head;
+        UBX_MON_VER_V0_GROUP1_t ext[2];
+    } payload;
+    memset(&payload, 0, sizeof(payload));
+    snprintf(payload.head.swVersion, sizeof(payload.head.swVersion), "ROM SIM");
+    snprintf(payload.head.hwVersion, sizeof(payload.head.hwVersion), "00190000");
+    snprintf(payload.ext[0].extension, sizeof(payload.ext[0].extension), "FWVER=SIM 0.00");
+    snprintf(payload.ext[1].extension, sizeof(payload.ext[1].extension), "PROTVER=27.00");
+    uint8_t buf[sizeof(payload) + UBX_FRAME_SIZE];
+    const int size = ubxMakeMessage(UBX_MON_CLSID, UBX_MON_VER_MSGID, (const uint8_t *)&payload, sizeof(payload), buf);
+    _portSimQueue(port, replay, buf, size);
+    return true;
+}
+
+static void _portSimRespond(PORT_t *port, PORT_REPLAY_t *replay, const uint8_t *msg, const int size)
+{
+    const uint8_t clsId = UBX_CLSID(msg);
+    const uint8_t msgId = UBX_MSGID(msg);
+    const bool isPoll = (size == UBX_FRAME_SIZE) || ((clsId == UBX_CFG_CLSID) && (msgId == UBX_CFG_VALGET_MSGID));
+    bool answered = false;
+
+    // Scripted response
+    for (int ix = 0; ix < replay->nScript; ix++)
+    {
+        const PORT_SIM_ENTRY_t *entry = &replay->script[ix];
+        if ( (size >= entry->pollSize) && (memcmp(msg, entry->poll, entry->pollSize) == 0) )
+        {
+            _portSimQueue(port, replay, entry->resp, entry->respSize);
+            answered = true;
+            break;
+        }
+    }
+
+    // Message from log, or built-in response
+    if (!answered && isPoll)
+    {
+        for (int ix = 0; ix < replay->nSeen; ix++)
+        {
+            const PORT_SIM_ENTRY_t *entry = &replay->seen[ix];
+            if ( (UBX_CLSID(entry->resp) == clsId) && (UBX_MSGID(entry->resp) == msgId) &&
+                 (clsId != UBX_CFG_CLSID) )
+            {
+                _portSimQueue(port, replay, entry->resp, entry->respSize);
+                answered = true;
+                break;
+            }
+        }
+        if (!answered && (clsId == UBX_MON_CLSID) && (msgId == UBX_MON_VER_MSGID))
+        {
+            answered = _portSimRespondMonVer(port, replay);
+        }
+    }
+
+    // Acknowledge configuration
+    if (clsId == UBX_CFG_CLSID)
+    {
+        _portSimAck(port, replay, msg, answered || !isPoll);
+    }
+
+    PORT_TRACE("sim: %s 0x%02x 0x%02x, size %d", answered ? "answered" : "ignored", clsId, msgId, size);
+}
+
+static void _portSimProcessCommands(PORT_t *port, PORT_REPLAY_t *replay)
+{
+    uint8_t buf[1024];
+    int res = 0;
+    while ( (res = read(replay->master, buf, sizeof(buf))) > 0 )
+    {
+        if (!parserAdd(&replay->cmdParser, buf, res))
+        {
+            parserInit(&replay->cmdParser);
+        }
+    }
+    PARSER_MSG_t msg;
+    while (parserProcess(&replay->cmdParser, &msg, false))
+    {
+        if (msg.type == PARSER_MSGTYPE_UBX)
+        {
+            _portSimRespond(port, replay, msg.data, msg.size);
+        }
+    }
+}
+
+static void _portSimPump(PORT_t *port, PORT_REPLAY_t *replay)
+{
+    // Responses first
+    while (replay->respOffs < replay->respSize)
+    {
+        const int res = write(replay->master, &replay->resp[replay->respOffs], replay->respSize - replay->respOffs);
+        if (res <= 0)
+        {
+            return; // pseudo-terminal full, try again later
+        }
+        replay->respOffs += res;
+    }
+
+    // Then the log
+    while (_portReplayNext(port, replay) && _portReplayDue(port, replay))
+    {
+        const int res = write(replay->master, &replay->msg[replay->msgOffs], replay->msgSize - replay->msgOffs);
+        if (res <= 0)
+        {
+            return;
+        }
+        replay->msgOffs += res;
+        if (replay->msgOffs >= replay->msgSize)
+        {
+            replay->msgSize = 0;
+        }
+    }
+}
+
+#endif
+
+// Remember the current message for answering polls
+static void _portSimRemember(PORT_REPLAY_t *replay)
+{
+    const uint8_t clsId = UBX_CLSID(replay->msg);
+    const uint8_t msgId = UBX_MSGID(replay->msg);
+    PORT_SIM_ENTRY_t *entry = NULL;
+    for (int ix = 0; ix < replay->nSeen; ix++)
+    {
+        if ( (UBX_CLSID(replay->seen[ix].resp) == clsId) && (UBX_MSGID(replay->seen[ix].resp) == msgId) )
+        {
+            entry = &replay->seen[ix];
+            break;
+        }
+    }
+    if (entry == NULL)
+    {
+        if (replay->nSeen >= NUMOF(replay->seen))
+        {
+            return;
+        }
+        entry = &replay->seen[replay->nSeen];
+        replay->nSeen++;
+    }
+    uint8_t *resp = (uint8_t *)realloc(entry->resp, replay->msgSize);
+    if (resp != NULL)
+    {
+        memcpy(resp, replay->msg, replay->msgSize);
+        entry->resp = resp;
+        entry->respSize = replay->msgSize;
+    }
+}
+
+// Parse hex string into bytes, returns malloc()ed buffer
+static uint8_t *_portSimParseHex(const char *str, int *size)
+{
+    const int len = strlen(str);
+    if ( (len < 2) || ((len % 2) != 0) )
+    {
+        return NULL;
+    }
+    uint8_t *buf = (uint8_t *)malloc(len / 2);
+    if (buf == NULL)
+    {
+        return NULL;
+    }
+    for (int ix = 0; ix < (len / 2); ix++)
+    {
+        unsigned int byte;
+        if ( !isxdigit((int)str[2 * ix]) || !isxdigit((int)str[(2 * ix) + 1]) ||
+             (sscanf(&str[2 * ix], "%2x", &byte) != 1) )
+        {
+            free(buf);
+            return NULL;
+        }
+        buf[ix] = (uint8_t)byte;
+    }
+    *size = len / 2;
+    return buf;
+}
+
+// Script format, one poll/response pair per line:
+//    <poll> <response>
+// where both are hex strings (e.g. "b5620a04"). The <poll> is matched against the start of the polls, the
+// <response> is one or more complete messages. Empty lines and lines starting with '#' are ignored.
+static bool _portSimLoadScript(PORT_t *port, PORT_REPLAY_t *replay)
+{
+    FILE *file = fopen(port->script, "r");
+    if (file == NULL)
+    {
+        PORT_WARNING("Failed opening %s: %s", port->script, _portErrStr(port, 0));
+        return false;
+    }
+    bool res = true;
+    int lineNr = 0;
+    char line[8192];
+    while (res && (fgets(line, sizeof(line), file) != NULL))
+    {
+        lineNr++;
+        char *poll = strtok(line, " \t\r\n");
+        if ( (poll == NULL) || (poll[0] == '#') )
+        {
+            continue;
+        }
+        char *resp = strtok(NULL, " \t\r\n");
+        PORT_SIM_ENTRY_t entry = { .poll = NULL, .resp = NULL };
+        if ( (resp == NULL) ||
+             ((entry.poll = _portSimParseHex(poll, &entry.pollSize)) == NULL) ||
+             ((entry.resp = _portSimParseHex(resp, &entry.respSize)) == NULL) )
+        {
+            PORT_WARNING("%s:%d: bad line", port->script, lineNr);
+            free(entry.poll);
+            res = false;
+            break;
+        }
+        PORT_SIM_ENTRY_t *script = (PORT_SIM_ENTRY_t *)realloc(replay->script, (replay->nScript + 1) * sizeof(*script));
+        if (script == NULL)
+        {
+            free(entry.poll);
+            free(entry.resp);
+            res = false;
+            break;
+        }
+        replay->script = script;
+        replay->script[replay->nScript] = entry;
+        replay->nScript++;
+    }
+    fclose(file);
+    PORT_DEBUG("loaded %d responses from %s", replay->nScript, port->script);
+    return res;
+}
+
 #if 0
 /* ***** template ******************************************************************************* */
 
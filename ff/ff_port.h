@@ -37,12 +37,32 @@ extern "C" {
 
 typedef enum PORT_TYPE_e
 {
-    PORT_TYPE_SER,    // Serial ports: ser://<device>[@baudrate]
+    PORT_TYPE_SER,    // Serial ports: ser://<device>[@baudrate][,lowlat]
     PORT_TYPE_TCP,    // TCP/IP sockets: tcp://<host>:<port>
-    PORT_TYPE_TELNET  // TCP/IP sockets with telnet (RFC854 etc.) and com port control (RFC2217): telnet://<host>:<port>[@<baudrate>]
-  //PORT_TYPE_HANDLE  // Use existing file handle (or pair of file handles, such as stdin/stdout)
+    PORT_TYPE_TELNET, // TCP/IP sockets with telnet (RFC854 etc.) and com port control (RFC2217): telnet://<host>:<port>[@<baudrate>]
+    PORT_TYPE_FILE,   // Replay log file (read-only): file://<file>[@<speed>]
+    PORT_TYPE_STDIN,  // Replay from standard input (read-only): stdin://[@<speed>]
+    PORT_TYPE_SIM,    // Simulated receiver (pseudo-terminal) replaying a log and answering polls: sim://<file>[@<speed>][,<script>]
+    PORT_TYPE_UDP     // UDP datagrams (optionally multicast): udp://[<addr>]:<port>
 } PORT_TYPE_t;
 
+typedef enum PORT_TXQ_POLICY_e
+{
+    PORT_TXQ_POLICY_FAIL = 0,  // Fail write if the queue is full (caller must retry later) (default)
+    PORT_TXQ_POLICY_DROP,      // Drop data if the queue is full
+    PORT_TXQ_POLICY_BLOCK      // Wait for space in queue
+} PORT_TXQ_POLICY_t;
+
+#define PORT_TXQ_DEFAULT_SIZE 65536
+
+#define PORT_READ_LOG_SIZE 64
+
+typedef struct PORT_READ_s
+{
+    uint64_t    ts;          // TIME_NS() of the read
+    int         size;        // number of bytes read
+} PORT_READ_t;
+
 typedef struct PORT_s
 {
     PORT_TYPE_t type;
@@ -56,10 +76,31 @@ typedef struct PORT_s
 #else
     int         fd;
 #endif
+    // serial
+    bool        lowLatency;  // low-latency mode (",lowlat" option)
+    // read statistics
+    uint32_t    numReads;    // number of reads that returned data
+    uint64_t    readTs;      // TIME_NS() of last read that returned data
+    uint64_t    readTsReal;  // TIME_NS_REAL() of last read that returned data
+    PORT_READ_t readLog[PORT_READ_LOG_SIZE]; // last reads that returned data, see portGetReadLog()
+    // replay (file, stdin, sim)
+    double      speed;       // replay speed: 1.0 = real-time, 0.0 = as fast as possible
+    bool        eof;         // end of input reached (file, stdin, tcp/telnet connection closed), portRead() fails from now on
+    char        script[PORT_SPEC_MAX_LEN]; // sim: poll responses script
+    // udp
+    uint32_t    numDgrams;      // number of datagrams received
+    uint32_t    numDgramsLost;  // number of datagrams dropped (socket buffer overflow)
+    uint32_t    numDgramsTrunc; // number of datagrams truncated (too large)
+    // type specific state (replay, udp)
+    void       *state;
     // tcp
     uint16_t    port;
     uint32_t    lastTime;
-    int         lastCount;
+    // transmit queue (tcp, telnet)
+    int         txqSize;      // queue size [bytes], 0 = default (PORT_TXQ_DEFAULT_SIZE)
+    PORT_TXQ_POLICY_t txqPolicy;
+    uint32_t    numTxDropped; // number of bytes dropped
+    void       *txq;
     // telnet
     int         tnState;
     uint8_t     tnInband[12];
@@ -76,6 +117,21 @@ bool portRead(PORT_t *port, uint8_t *data, const int size, int *read);
 bool portCanBaudrate(PORT_t *port);
 bool portSetBaudrate(PORT_t *port, const int baudrate);
 int portGetBaudrate(PORT_t *port);
+int portGetFd(PORT_t *port); // file descriptor suitable for select(), poll() and friends, -1 if not available
+
+// Get the most recent reads that returned data (oldest first), e.g. to measure the latency of USB-serial adapters.
+// Returns the number of entries stored to reads (at most PORT_READ_LOG_SIZE).
+int portGetReadLog(PORT_t *port, PORT_READ_t *reads, const int maxNum);
+
+// Transmit queue for network ports (tcp, telnet). Data written is queued and sent at the rate of the remote serial port
+// (baudrate) while reading from or writing to the port. Writes never block, unless the policy is PORT_TXQ_POLICY_BLOCK.
+// Event loops (see portGetFd()) should wait for the fd to become writable when portGetTxQueueDelay() returns 0, wait
+// at most the returned time if it is > 0, and then call portTxQueueDrain().
+bool portSetTxQueue(PORT_t *port, const int size, const PORT_TXQ_POLICY_t policy); // call before portOpen()
+int portGetTxQueueDepth(PORT_t *port); // number of bytes in queue
+int portGetTxQueueDelay(PORT_t *port); // -1 = queue empty, 0 = can send now, > 0 = time [ms] until rate limit allows sending
+bool portTxQueueDrain(PORT_t *port); // send queued data, as far as the rate limit allows
+bool portFlush(PORT_t *port, const uint32_t timeout); // wait until queue is empty
 
 /* ****************************************************************************************************************** */
 #ifdef __cplusplus
@@ -20,6 +20,9 @@
 #include <stdlib.h>
 #include <ctype.h>
 #include <unistd.h>
+#ifndef _WIN32
+#  include <sys/stat.h>
+#endif
 
 #include "ff_debug.h"
 #include "ff_stuff.h"
@@ -49,7 +52,9 @@ typedef struct RX_s
 {
     PORT_t       port;
     PARSER_t     parser;
-    uint8_t      readBuf[1024];
+    PARSER_t     txParser;
+    uint32_t     txSeq;
+    uint8_t      readBuf[4096];
     uint8_t      pollBuf[PARSER_MAX_ANY_SIZE];
     PARSER_MSG_t msg;
     char         name[100];
@@ -59,6 +64,9 @@ typedef struct RX_s
     void       (*msgcb)(PARSER_MSG_t *, void *arg);
     void        *cbarg;
     bool         abort;
+    bool         cfgcache;
+    bool         msginfo;
+    char         verStr[100];
 } RX_t;
 
 RX_t *rxInit(const char *port, const RX_ARGS_t *args)
@@ -77,9 +85,9 @@ RX_t *rxInit(const char *port, const RX_ARGS_t *args)
     }
     memset(rx, 0, sizeof(*rx));
 
+    const RX_ARGS_t rxArgsDefault = RX_ARGS_DEFAULT();
+    const RX_ARGS_t *rxArgs = args == NULL ? &rxArgsDefault : args;
     {
-        const RX_ARGS_t rxArgsDefault = RX_ARGS_DEFAULT();
-        const RX_ARGS_t *rxArgs = args == NULL ? &rxArgsDefault : args;
         rx->verbose  = rxArgs->verbose;
         rx->detect   = rxArgs->detect;
         rx->autobaud = rxArgs->autobaud; // but see below
@@ -94,15 +102,18 @@ RX_t *rxInit(const char *port, const RX_ARGS_t *args)
         }
         rx->msgcb = rxArgs->msgcb;
         rx->cbarg = rxArgs->cbarg;
+        rx->cfgcache = rxArgs->cfgcache;
+        rx->msginfo  = rxArgs->msginfo;
         instCnt++;
     }
     RX_PRINT("Connecting to receiver at port %s", port);
 
-    // Initialise parser
+    // Initialise parsers
     parserInit(&rx->parser);
+    parserInit(&rx->txParser);
 
     // Initialise port
-    if (!portInit(&rx->port, port))
+    if (!portInit(&rx->port, port) || !portSetTxQueue(&rx->port, rxArgs->txqSize, rxArgs->txqPolicy))
     {
         free(rx);
         return NULL;
@@ -120,6 +131,7 @@ bool rxOpen(RX_t *rx)
     {
         return false;
     }
+    rx->verStr[0] = '\0';
 
     if (!portOpen(&rx->port))
     {
@@ -139,9 +151,10 @@ bool rxOpen(RX_t *rx)
 
 static bool _rxOpenDetect(RX_t *rx)
 {
-    // Quick first try, which may just work..
+    // Quick first try, which may just work.. Unless we're autobauding, which tries the current baudrate first, too, but
+    // without waiting for the poll timeouts if the receiver is talking at another baudrate.
     char verStr[100];
-    if (rxGetVerStr(rx, verStr, sizeof(verStr)))
+    if (!rx->autobaud && rxGetVerStr(rx, verStr, sizeof(verStr)))
     {
         RX_PRINT("Receiver detected: %s", verStr);
         return true;
@@ -188,15 +201,16 @@ static void _rxCallbackData(RX_t *rx, const PARSER_MSGSRC_t src, const uint8_t *
 {
     if (rx->msgcb != NULL)
     {
-        PARSER_t p;
-        parserInit(&p);
-        if (!parserAdd(&p, buf, size))
+        // Re-use the persistent parser, discarding any leftovers from the previous call. Clearing (parserInit()) the
+        // entire parser state (~50kB) for every sent message is expensive and not necessary.
+        PARSER_t *p = &rx->txParser;
+        parserReset(p);
+        if (!parserAdd(p, buf, size))
         {
             RX_WARNING("Parser overflow!");
-            parserInit(&p);
         }
         PARSER_MSG_t msg;
-        if (parserProcess(&p, &msg, true))
+        if (parserProcess(p, &msg, true))
         {
             msg.src = src;
             rx->msgcb(&msg, rx->cbarg);
@@ -205,6 +219,33 @@ static void _rxCallbackData(RX_t *rx, const PARSER_MSGSRC_t src, const uint8_t *
     }
 }
 
+static void _rxCallbackFramed(RX_t *rx, const PARSER_MSGSRC_t src, const uint8_t *buf, const int size,
+    const PARSER_MSGTYPE_t type, const char *name)
+{
+    if (rx->msgcb != NULL)
+    {
+        rx->txSeq++;
+        const uint64_t tsNs = TIME_NS();
+        // Only the (cheap) framing is skipped, the callback gets the same info as for parsed messages
+        char info[PARSER_MAX_INFO_SIZE];
+        PARSER_MSG_t msg =
+        {
+            .type    = type,
+            .data    = buf,
+            .size    = size,
+            .seq     = rx->txSeq,
+            .ts      = TIME(),
+            .src     = src,
+            .name    = name,
+            .info    = parserMessageInfo(info, sizeof(info), type, buf, size) ? info : NULL,
+            .tsFirst = tsNs,
+            .tsLast  = tsNs,
+            .tsReal  = TIME_NS_REAL(),
+        };
+        rx->msgcb(&msg, rx->cbarg);
+    }
+}
+
 static void _rxCallbackMsg(RX_t *rx, PARSER_MSG_t *msg)
 {
     if (rx->msgcb != NULL)
@@ -234,6 +275,18 @@ void rxAbort(RX_t *rx)
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+PORT_t *rxGetPort(RX_t *rx)
+{
+    return rx != NULL ? &rx->port : NULL;
+}
+
+bool rxIsEof(RX_t *rx)
+{
+    return (rx != NULL) && rx->port.eof;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 bool rxSend(RX_t *rx, const uint8_t *data, const int size)
 {
     if ( (rx != NULL) && !rx->abort )
@@ -244,6 +297,23 @@ bool rxSend(RX_t *rx, const uint8_t *data, const int size)
     return false;
 }
 
+bool rxSendMsg(RX_t *rx, const uint8_t *data, const int size, const PARSER_MSGTYPE_t type, const char *name)
+{
+    if ( (rx != NULL) && !rx->abort )
+    {
+        if (name == NULL)
+        {
+            _rxCallbackData(rx, PARSER_MSGSRC_TO_RX, data, size);
+        }
+        else
+        {
+            _rxCallbackFramed(rx, PARSER_MSGSRC_TO_RX, data, size, type, name);
+        }
+        return portWrite(&rx->port, data, size);
+    }
+    return false;
+}
+
 // ---------------------------------------------------------------------------------------------------------------------
 
 int rxGetBaudrate(RX_t *rx)
@@ -274,13 +344,17 @@ PARSER_MSG_t *rxGetNextMessage(RX_t *rx)
     PARSER_MSG_t *msg = NULL;
     if (rx != NULL)
     {
+        // Read only as much as the parser can take, a fast source (e.g. file:// replay) may always have more data
         int readSize;
-        while ( !rx->abort && portRead(&rx->port, rx->readBuf, sizeof(rx->readBuf), &readSize) && (readSize > 0) )
+        int space;
+        while ( !rx->abort &&
+                ((space = (int)sizeof(rx->parser.buf) - rx->parser.offs - rx->parser.size) > 0) &&
+                portRead(&rx->port, rx->readBuf, MIN(space, (int)sizeof(rx->readBuf)), &readSize) && (readSize > 0) )
         {
-            parserAdd(&rx->parser, rx->readBuf, readSize);
+            parserAddTs(&rx->parser, rx->readBuf, readSize, rx->port.readTs, rx->port.readTsReal);
         }
 
-        if (parserProcess(&rx->parser, &rx->msg, true))
+        if (parserProcess(&rx->parser, &rx->msg, rx->msginfo))
         {
             msg = &rx->msg;
             msg->src = PARSER_MSGSRC_FROM_RX;
@@ -343,7 +417,7 @@ PARSER_MSG_t *rxPollUbx(RX_t *rx, const RX_POLL_UBX_t *param, bool *pollNak)
             pollName, pollSize, timeout, attempt, isUbxCfg, retries);
 
         // Send request
-        if (!rxSend(rx, rx->pollBuf, pollSize))
+        if (!rxSendMsg(rx, rx->pollBuf, pollSize, PARSER_MSGTYPE_UBX, pollName))
         {
             return NULL;
         }
@@ -425,7 +499,7 @@ bool rxSendUbxCfg(RX_t *rx, const uint8_t *msg, const int size, const uint32_t t
     const uint8_t clsId = UBX_CLSID(msg);
     const uint8_t msgId = UBX_MSGID(msg);
 
-    if (!rxSend(rx, msg, size))
+    if (!rxSendMsg(rx, msg, size, PARSER_MSGTYPE_UBX, sendName))
     {
         return false;
     }
@@ -495,6 +569,11 @@ bool rxGetVerStr(RX_t *rx, char *str, const int size)
     if (ubxMonVer != NULL)
     {
         _rxCallbackMsg(rx, ubxMonVer);
+        // Remember for the config cache
+        if (!ubxMonVerToVerStr(rx->verStr, sizeof(rx->verStr), ubxMonVer->data, ubxMonVer->size))
+        {
+            rx->verStr[0] = '\0';
+        }
         return ubxMonVerToVerStr(str, size, ubxMonVer->data, ubxMonVer->size);
     }
     return false;
@@ -525,6 +604,216 @@ static bool _rxFlushTx(RX_t *rx)
     return rxSend(rx, flushSeq, sizeof(flushSeq));
 }
 
+// Passively listen to the receiver at the current baudrate and score the data. Returns the percentage [0..100] of
+// bytes that were part of valid (checksum-correct) messages, or -1 if no data was received at all (e.g. the receiver
+// has all output disabled). At a wrong baudrate the parser sees only garbage, so this takes a few tens of milliseconds
+// for a talkative receiver, which is much quicker than polling and waiting for the timeout.
+static int _rxAutobaudSniff(RX_t *rx)
+{
+    // Discard data received before the baudrate change
+    _rxFlushRx(rx);
+    parserReset(&rx->parser);
+
+    // Listen for the time it takes to receive ~1000 bytes, but stop as soon as the result is conclusive
+    const int baudrate = rxGetBaudrate(rx);
+    const uint32_t duration = baudrate > 0 ? CLIP((1000 * 10 * 1000) / baudrate, 50, 250) : 250;
+    const uint32_t t1 = TIME() + duration;
+    int nGood = 0;
+    int sizeGood = 0;
+    int sizeBad = 0;
+    while ( !rx->abort && (TIME() < t1) )
+    {
+        int readSize = 0;
+        if (!portRead(&rx->port, rx->readBuf, sizeof(rx->readBuf), &readSize))
+        {
+            break;
+        }
+        if (readSize <= 0)
+        {
+            SLEEP(5);
+            continue;
+        }
+        parserAdd(&rx->parser, rx->readBuf, readSize);
+        PARSER_MSG_t msg;
+        while (parserProcess(&rx->parser, &msg, false))
+        {
+            if (msg.type == PARSER_MSGTYPE_GARBAGE)
+            {
+                sizeBad += msg.size;
+            }
+            else
+            {
+                sizeGood += msg.size;
+                nGood++;
+            }
+        }
+        // Conclusive?
+        if ( (nGood >= 2) || ((nGood == 0) && (sizeBad >= 256)) )
+        {
+            break;
+        }
+    }
+    sizeBad += rx->parser.size; // Unprocessed leftovers
+    parserReset(&rx->parser);
+
+    const int sizeTot = sizeGood + sizeBad;
+    const int score = sizeTot > 0 ? (nGood > 0 ? (sizeGood * 100) / sizeTot : 0) : -1;
+    RX_DEBUG("autobaud %d (sniff): good=%d/%d bad=%d score=%d", baudrate, nGood, sizeGood, sizeBad, score);
+    return score;
+}
+
+// Path to a file in the cache directory
+static bool _rxCacheFile(char *path, const int size, const char *name)
+{
+#ifdef _WIN32
+    const char *dir = getenv("LOCALAPPDATA");
+    if ( (dir == NULL) || (dir[0] == '\0') )
+    {
+        return false;
+    }
+    return snprintf(path, size, "%s\\%s", dir, name) < size;
+#else
+    const char *xdg = getenv("XDG_CACHE_HOME");
+    const char *home = getenv("HOME");
+    int len;
+    if ( (xdg != NULL) && (xdg[0] != '\0') )
+    {
+        len = snprintf(path, size, "%s", xdg);
+    }
+    else if ( (home != NULL) && (home[0] != '\0') )
+    {
+        len = snprintf(path, size, "%s/.cache", home);
+    }
+    else
+    {
+        return false;
+    }
+    if (len >= size)
+    {
+        return false;
+    }
+    mkdir(path, 0755); // may fail if it exists, which is fine
+    return snprintf(&path[len], size - len, "/%s", name) < (size - len);
+#endif
+}
+
+// Baudrate cache: the last baudrate autobauding succeeded at for a port, one "<baudrate> <port>" line per port, most
+// recently used first. The receiver is likely still at that baudrate after it has been disconnected (e.g. USB
+// re-enumeration), so we try it first.
+#define RX_BAUDCACHE_MAX_LINES 50
+
+static bool _rxBaudCacheFile(char *path, const int size)
+{
+#ifdef _WIN32
+    return _rxCacheFile(path, size, "ubloxcfg-baudrates.txt");
+#else
+    return _rxCacheFile(path, size, "ubloxcfg-baudrates");
+#endif
+}
+
+static bool _rxBaudCacheKey(RX_t *rx, char *key, const int size)
+{
+    switch (rx->port.type)
+    {
+        case PORT_TYPE_SER:
+            return snprintf(key, size, "ser://%s", rx->port.file) < size;
+        case PORT_TYPE_TELNET:
+            return snprintf(key, size, "telnet://%s:%u", rx->port.file, rx->port.port) < size;
+        default:
+            return false;
+    }
+}
+
+static int _rxBaudCacheGet(RX_t *rx)
+{
+    char path[1000];
+    char key[PORT_SPEC_MAX_LEN + 20];
+    if (!_rxBaudCacheFile(path, sizeof(path)) || !_rxBaudCacheKey(rx, key, sizeof(key)))
+    {
+        return 0;
+    }
+    FILE *fh = fopen(path, "r");
+    if (fh == NULL)
+    {
+        return 0;
+    }
+    int baudrate = 0;
+    char line[sizeof(key) + 20];
+    while (fgets(line, sizeof(line), fh) != NULL)
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        int b = 0;
+        int n = 0;
+        if ( (sscanf(line, "%d %n", &b, &n) == 1) && (n > 0) && (strcmp(&line[n], key) == 0) )
+        {
+            baudrate = b;
+            break;
+        }
+    }
+    fclose(fh);
+    RX_DEBUG("autobaud cache %s: %s %d", path, key, baudrate);
+    return baudrate;
+}
+
+static void _rxBaudCachePut(RX_t *rx, const int baudrate)
+{
+    char path[1000];
+    char key[PORT_SPEC_MAX_LEN + 20];
+    if (!_rxBaudCacheFile(path, sizeof(path)) || !_rxBaudCacheKey(rx, key, sizeof(key)))
+    {
+        return;
+    }
+
+    // Read other ports' entries
+    char line[sizeof(key) + 20];
+    char *lines[RX_BAUDCACHE_MAX_LINES];
+    int nLines = 0;
+    FILE *fh = fopen(path, "r");
+    if (fh != NULL)
+    {
+        while ( (nLines < (NUMOF(lines) - 1)) && (fgets(line, sizeof(line), fh) != NULL) )
+        {
+            line[strcspn(line, "\r\n")] = '\0';
+            int b = 0;
+            int n = 0;
+            if ( (sscanf(line, "%d %n", &b, &n) == 1) && (n > 0) && (strcmp(&line[n], key) != 0) )
+            {
+                lines[nLines] = strdup(line);
+                if (lines[nLines] != NULL)
+                {
+                    nLines++;
+                }
+            }
+        }
+        fclose(fh);
+    }
+
+    // Write new file, replace old file
+    char tmpPath[sizeof(path) + 10];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    fh = fopen(tmpPath, "w");
+    bool ok = false;
+    if (fh != NULL)
+    {
+        ok = fprintf(fh, "%d %s\n", baudrate, key) > 0;
+        for (int ix = 0; ok && (ix < nLines); ix++)
+        {
+            ok = fprintf(fh, "%s\n", lines[ix]) > 0;
+        }
+        ok = (fclose(fh) == 0) && ok;
+        ok = ok && (rename(tmpPath, path) == 0);
+        if (!ok)
+        {
+            remove(tmpPath);
+        }
+    }
+    for (int ix = 0; ix < nLines; ix++)
+    {
+        free(lines[ix]);
+    }
+    RX_DEBUG("autobaud cache %s: %s %d %s", path, key, baudrate, ok ? "stored" : "failed");
+}
+
 bool rxAutobaud(RX_t *rx)
 {
     if (rx == NULL)
@@ -534,19 +823,59 @@ bool rxAutobaud(RX_t *rx)
 
     int baudrate = 0;
     const int currentBaudrate = rxGetBaudrate(rx);
-    int baudrates[] = { currentBaudrate, 9600, 38400, 115200, 230400, 460800, 921600 };
+    const int cachedBaudrate = _rxBaudCacheGet(rx);
+    int baudrates[] = { cachedBaudrate, currentBaudrate, 9600, 38400, 115200, 230400, 460800, 921600 };
+    // Remove invalid and duplicate baudrates
+    for (int ix = 0; ix < NUMOF(baudrates); ix++)
+    {
+        for (int ix2 = 0; (baudrates[ix] > 0) && (ix2 < ix); ix2++)
+        {
+            if (baudrates[ix2] == baudrates[ix])
+            {
+                baudrates[ix] = 0;
+            }
+        }
+    }
     PARSER_MSG_t *ubxMonVer = NULL;
 
-    // First, try quickly..
+    // First, listen to what the receiver says and only poll at the baudrate(s) where it looks promising
     {
-        RX_POLL_UBX_t pollParam = { .clsId = UBX_MON_CLSID, .msgId = UBX_MON_VER_MSGID, .retries = 1, .timeout = 1000 };
+        RX_POLL_UBX_t pollParam = { .clsId = UBX_MON_CLSID, .msgId = UBX_MON_VER_MSGID, .retries = 1, .timeout = 500 };
+        bool first = true;
         for (int ix = 0; !rx->abort && (ix < NUMOF(baudrates)); ix++)
         {
-            if ( (ix > 0) && (baudrates[ix] == currentBaudrate) )
+            if ( (baudrates[ix] <= 0) || !rxSetBaudrate(rx, baudrates[ix]) )
             {
                 continue;
             }
-            if (!rxSetBaudrate(rx, baudrates[ix]))
+            const int score = _rxAutobaudSniff(rx);
+            // Receiver talks at this baudrate, or it's silent (output disabled) and this is our best guess
+            if ( (score >= 25) || (first && (score < 0)) )
+            {
+                RX_DEBUG("autobaud %d (sniff)", baudrates[ix]);
+                ubxMonVer = rxPollUbx(rx, &pollParam, NULL);
+                if (ubxMonVer != NULL)
+                {
+                    _rxCallbackMsg(rx, ubxMonVer);
+                    baudrate = baudrates[ix];
+                    break;
+                }
+            }
+            // Receiver is silent, or it outputs so little that listening doesn't help, so poll instead (below)
+            if (!first && (score < 0))
+            {
+                break;
+            }
+            first = false;
+        }
+    }
+    // Try quickly..
+    if (baudrate == 0)
+    {
+        RX_POLL_UBX_t pollParam = { .clsId = UBX_MON_CLSID, .msgId = UBX_MON_VER_MSGID, .retries = 1, .timeout = 1000 };
+        for (int ix = 0; !rx->abort && (ix < NUMOF(baudrates)); ix++)
+        {
+            if ( (baudrates[ix] <= 0) || !rxSetBaudrate(rx, baudrates[ix]) )
             {
                 continue;
             }
@@ -566,11 +895,7 @@ bool rxAutobaud(RX_t *rx)
         RX_POLL_UBX_t pollParam = { .clsId = UBX_MON_CLSID, .msgId = UBX_MON_VER_MSGID, .retries = 2, .timeout = 2500 };
         for (int ix = 0; !rx->abort && (ix < NUMOF(baudrates)); ix++)
         {
-            if ( (ix > 0) && (baudrates[ix] == currentBaudrate) )
-            {
-                continue;
-            }
-            if (!rxSetBaudrate(rx, baudrates[ix]))
+            if ( (baudrates[ix] <= 0) || !rxSetBaudrate(rx, baudrates[ix]) )
             {
                 continue;
             }
@@ -596,6 +921,10 @@ bool rxAutobaud(RX_t *rx)
             verStr[1] = '\0';
         }
         RX_DEBUG("autobaud %d success: %s", baudrate, verStr);
+        if (baudrate != cachedBaudrate)
+        {
+            _rxBaudCachePut(rx, baudrate);
+        }
         return true;
     }
     else
@@ -605,7 +934,6 @@ bool rxAutobaud(RX_t *rx)
     }
 }
 
-
 /* ****************************************************************************************************************** */
 
 bool rxReset(RX_t *rx, const RX_RESET_t reset)
@@ -717,9 +1045,11 @@ bool rxReset(RX_t *rx, const RX_RESET_t reset)
     }
     uint8_t msg[UBX_CFG_RST_V0_SIZE];
     int msgSize = 0;
+    const char *msgName = "UBX-CFG-RST";
     if (reset == RX_RESET_SAFEBOOT)
     {
         msgSize = ubxMakeMessage(UBX_UPD_CLSID, UBX_UPD_SAFEBOOT_MSGID, NULL, 0, msg);
+        msgName = "UBX-UPD-SAFEBOOT";
         RX_DEBUG("Sending UBX-UPD-SAFEBOOT, size %d", msgSize);
     }
     else
@@ -731,7 +1061,7 @@ bool rxReset(RX_t *rx, const RX_RESET_t reset)
             msgSize, payload.navBbrMask, payload.resetMode);
     }
     // Send the reset command...
-    if (!rxSend(rx, msg, msgSize))
+    if (!rxSendMsg(rx, msg, msgSize, PARSER_MSGTYPE_UBX, msgName))
     {
         RX_WARNING("Failed sending reset command!");
         return false;
@@ -825,6 +1155,155 @@ const char *rxResetStr(const RX_RESET_t reset)
 
 /* ****************************************************************************************************************** */
 
+// Config cache: snapshots of the Default layer, which only depends on the firmware. One file per receiver version
+// (rxGetVerStr()), layer and list of requested keys. The file has a header (RX_CFGCACHE_HEAD_t) followed by the key-value
+// pairs (4 bytes ID and 8 bytes value each). The files are not portable between machines, which is fine for a cache.
+#define RX_CFGCACHE_MAGIC   "ubloxcfg-config"
+#define RX_CFGCACHE_VERSION 1
+
+typedef struct RX_CFGCACHE_HEAD_s
+{
+    char     magic[16];
+    uint32_t version;
+    uint32_t layer;
+    uint32_t nKeys;
+    uint32_t keysHash;
+    uint32_t nKv;
+    char     verStr[100];
+} RX_CFGCACHE_HEAD_t;
+
+// FNV-1a
+static uint32_t _rxCfgCacheHash(uint32_t hash, const void *data, const int size)
+{
+    const uint8_t *pData = (const uint8_t *)data;
+    for (int ix = 0; ix < size; ix++)
+    {
+        hash ^= pData[ix];
+        hash *= UINT32_C(16777619);
+    }
+    return hash;
+}
+
+static bool _rxCfgCacheFile(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, const int numKeys,
+    char *path, const int size, RX_CFGCACHE_HEAD_t *head)
+{
+    if (rx->verStr[0] == '\0')
+    {
+        char verStr[sizeof(rx->verStr)];
+        if (!rxGetVerStr(rx, verStr, sizeof(verStr)))
+        {
+            return false;
+        }
+    }
+
+    memset(head, 0, sizeof(*head));
+    snprintf(head->magic, sizeof(head->magic), "%s", RX_CFGCACHE_MAGIC);
+    head->version  = RX_CFGCACHE_VERSION;
+    head->layer    = layer;
+    head->nKeys    = numKeys;
+    head->keysHash = _rxCfgCacheHash(UINT32_C(2166136261), keys, numKeys * sizeof(*keys));
+    snprintf(head->verStr, sizeof(head->verStr), "%s", rx->verStr);
+
+    uint32_t hash = UINT32_C(2166136261);
+    hash = _rxCfgCacheHash(hash, head->verStr, strlen(head->verStr));
+    hash = _rxCfgCacheHash(hash, &head->layer, sizeof(head->layer));
+    hash = _rxCfgCacheHash(hash, &head->keysHash, sizeof(head->keysHash));
+    char name[100];
+#ifdef _WIN32
+    snprintf(name, sizeof(name), "ubloxcfg-config-%08x.bin", hash);
+#else
+    snprintf(name, sizeof(name), "ubloxcfg-config-%08x", hash);
+#endif
+    return _rxCacheFile(path, size, name);
+}
+
+static int _rxCfgCacheGet(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, const int numKeys,
+    UBLOXCFG_KEYVAL_t *kv, const int maxKv)
+{
+    char path[1000];
+    RX_CFGCACHE_HEAD_t want;
+    if (!_rxCfgCacheFile(rx, layer, keys, numKeys, path, sizeof(path), &want))
+    {
+        return -1;
+    }
+    FILE *fh = fopen(path, "rb");
+    if (fh == NULL)
+    {
+        RX_DEBUG("config cache %s: %s %s miss", path, want.verStr, ubloxcfg_layerName(layer));
+        return -1;
+    }
+
+    int nKv = -1;
+    RX_CFGCACHE_HEAD_t head;
+    memset(&head, 0, sizeof(head));
+    if (fread(&head, sizeof(head), 1, fh) == 1)
+    {
+        want.nKv = head.nKv;
+        if ( (memcmp(&head, &want, sizeof(head)) == 0) && ((int)head.nKv <= maxKv) )
+        {
+            nKv = head.nKv;
+            for (int ix = 0; ix < nKv; ix++)
+            {
+                uint8_t rec[4 + 8];
+                if (fread(rec, sizeof(rec), 1, fh) != 1)
+                {
+                    nKv = -1;
+                    break;
+                }
+                memcpy(&kv[ix].id, &rec[0], sizeof(kv[ix].id));
+                memcpy(kv[ix].val._bytes, &rec[4], sizeof(kv[ix].val._bytes));
+            }
+            if ( (nKv >= 0) && (fgetc(fh) != EOF) )
+            {
+                nKv = -1;
+            }
+        }
+    }
+    fclose(fh);
+    RX_DEBUG("config cache %s: %s %s %s (%d items)", path, want.verStr, ubloxcfg_layerName(layer),
+        nKv >= 0 ? "hit" : "bad", nKv);
+    return nKv;
+}
+
+static void _rxCfgCachePut(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, const int numKeys,
+    const UBLOXCFG_KEYVAL_t *kv, const int nKv)
+{
+    char path[1000];
+    RX_CFGCACHE_HEAD_t head;
+    if (!_rxCfgCacheFile(rx, layer, keys, numKeys, path, sizeof(path), &head))
+    {
+        return;
+    }
+    head.nKv = nKv;
+
+    // Write new file, replace old file
+    char tmpPath[sizeof(path) + 10];
+    snprintf(tmpPath, sizeof(tmpPath), "%s.tmp", path);
+    FILE *fh = fopen(tmpPath, "wb");
+    bool ok = false;
+    if (fh != NULL)
+    {
+        ok = fwrite(&head, sizeof(head), 1, fh) == 1;
+        for (int ix = 0; ok && (ix < nKv); ix++)
+        {
+            uint8_t rec[4 + 8];
+            memcpy(&rec[0], &kv[ix].id, sizeof(kv[ix].id));
+            memcpy(&rec[4], kv[ix].val._bytes, sizeof(kv[ix].val._bytes));
+            ok = fwrite(rec, sizeof(rec), 1, fh) == 1;
+        }
+        ok = (fclose(fh) == 0) && ok;
+        ok = ok && (rename(tmpPath, path) == 0);
+        if (!ok)
+        {
+            remove(tmpPath);
+        }
+    }
+    RX_DEBUG("config cache %s: %s %s %d items %s", path, head.verStr, ubloxcfg_layerName(layer), nKv,
+        ok ? "stored" : "failed");
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 int rxGetConfig(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, const int numKeys, UBLOXCFG_KEYVAL_t *kv, const int maxKv)
 {
     if ( (rx == NULL) || (keys == NULL) || (numKeys < 1) || (kv == NULL) || (maxKv < 1) )
@@ -833,6 +1312,19 @@ int rxGetConfig(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, co
     }
 
     const char *layerName = ubloxcfg_layerName(layer);
+
+    // The Default layer only depends on the firmware
+    const bool useCache = rx->cfgcache && (layer == UBLOXCFG_LAYER_DEFAULT);
+    if (useCache)
+    {
+        const int nKv = _rxCfgCacheGet(rx, layer, keys, numKeys, kv, maxKv);
+        if (nKv >= 0)
+        {
+            RX_DEBUG("Total %d items for layer %s (from cache)", nKv, layerName);
+            return nKv;
+        }
+    }
+
     RX_DEBUG("Polling receiver configuration for layer %s", layerName);
 
     uint8_t pollLayer = UBLOXCFG_LAYER_DEFAULT;
@@ -971,13 +1463,12 @@ int rxGetConfig(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, co
             numKv, position, layerName, done ? "yes" : "no");
         if (isTRACE())
         {
-            for (int ix = totNumKv - numKv; ix < totNumKv; ix++)
+            char str[UBX_CFG_VALGET_V1_MAX_KV * 200];
+            const char *strs[UBX_CFG_VALGET_V1_MAX_KV];
+            const int numStrs = ubloxcfg_stringifyKeyVals(str, sizeof(str), &kv[totNumKv - numKv], NULL, numKv, strs);
+            for (int ix = 0; ix < numStrs; ix++)
             {
-                char str[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
-                if (ubloxcfg_stringifyKeyVal(str, sizeof(str), &kv[ix]))
-                {
-                    RX_TRACE("kv[%d]: %s", ix, str);
-                }
+                RX_TRACE("kv[%d]: %s", totNumKv - numKv + ix, strs[ix]);
             }
         }
 
@@ -993,6 +1484,11 @@ int rxGetConfig(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, co
     // while 64 left, not complete, ...
     RX_DEBUG("Total %d items for layer %s (poll duration %ums), res=%d", totNumKv, layerName, TIME() - t0, res);
 
+    if (useCache && res && done && (totNumKv > 0))
+    {
+        _rxCfgCachePut(rx, layer, keys, numKeys, kv, totNumKv);
+    }
+
     return res ? totNumKv : -1;
 }
 
@@ -1027,6 +1523,37 @@ bool rxSetConfig(RX_t *rx, const UBLOXCFG_KEYVAL_t *kv, const int nKv, const boo
     return res;
 }
 
+bool rxDelConfig(RX_t *rx, const uint32_t *keys, const int nKeys, const bool bbr, const bool flash)
+{
+    if ( (rx == NULL) || (keys == NULL) || !(bbr || flash) )
+    {
+        return false;
+    }
+
+    int nMsgs = 0;
+    UBX_CFG_VALSET_MSG_t *msgs = ubxKeysToUbxCfgValdel(keys, nKeys, bbr, flash, &nMsgs);
+    if (msgs == NULL)
+    {
+        return false;
+    }
+
+    RX_PRINT("Deleting %d items in %d UBX-CFG-VALDEL messages", nKeys, nMsgs);
+    bool res = true;
+    for (int ix = 0; ix < nMsgs; ix++)
+    {
+        RX_PRINT("Sending UBX-CFG-VALDEL %d/%d (%s)", ix + 1, nMsgs, msgs[ix].info);
+        if (!rxSendUbxCfg(rx, msgs[ix].msg, msgs[ix].size, 2500))
+        {
+            RX_WARNING("Failed deleting receiver configuration!");
+            res = false;
+            break;
+        }
+    }
+
+    free(msgs);
+    return res;
+}
+
 
 /* ****************************************************************************************************************** */
 // eof
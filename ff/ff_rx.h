@@ -22,6 +22,7 @@
 
 #include "ubloxcfg.h"
 #include "ff_parser.h"
+#include "ff_port.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -39,9 +40,14 @@ typedef struct RX_ARGS_s
     char    *name;        // default: automatic
     void   (*msgcb)(PARSER_MSG_t *, void *arg); // default: NULL
     void    *cbarg;       // default: NULL
+    bool     cfgcache;    // default: true, see rxGetConfig()
+    int      txqSize;     // default: 0 (PORT_TXQ_DEFAULT_SIZE), see portSetTxQueue()
+    PORT_TXQ_POLICY_t txqPolicy; // default: PORT_TXQ_POLICY_FAIL, see portSetTxQueue()
+    bool     msginfo;     // default: true, false = messages from rxGetNextMessage() have no info (NULL)
 } RX_ARGS_t;
 
-#define RX_ARGS_DEFAULT() { .autobaud = true, .detect = true, .verbose = true, .name = NULL, .msgcb = NULL, .cbarg = NULL }
+#define RX_ARGS_DEFAULT() { .autobaud = true, .detect = true, .verbose = true, .name = NULL, .msgcb = NULL, .cbarg = NULL, \
+    .cfgcache = true, .txqSize = 0, .txqPolicy = PORT_TXQ_POLICY_FAIL, .msginfo = true }
 
 RX_t *rxInit(const char *port, const RX_ARGS_t *args);
 
@@ -51,14 +57,28 @@ void rxClose(RX_t *rx);
 PARSER_MSG_t *rxGetNextMessage(RX_t *rx);
 PARSER_MSG_t *rxGetNextMessageTimeout(RX_t *rx, const uint32_t timeout);
 
+// Send data to the receiver. Note that rxSend() and rxSendMsg() are not reentrant: they use a per-receiver parser
+// for the message callback and must not be called concurrently for the same receiver handle.
 bool rxSend(RX_t *rx, const uint8_t *data, const int size);
 
+// Like rxSend() but for an already framed message of known type and name. This skips parsing the message again for the
+// message callback. If name is NULL this is the same as rxSend().
+bool rxSendMsg(RX_t *rx, const uint8_t *data, const int size, const PARSER_MSGTYPE_t type, const char *name);
+
+// Find the receiver's baudrate. The last baudrate found for the port is remembered (in $XDG_CACHE_HOME or
+// ~/.cache/ubloxcfg-baudrates, resp. %LOCALAPPDATA%\ubloxcfg-baudrates.txt) and tried first.
 bool rxAutobaud(RX_t *rx);
 int rxGetBaudrate(RX_t *rx);
 bool rxSetBaudrate(RX_t *rx, const int baudrate);
 
 void rxAbort(RX_t *rx);
 
+PORT_t *rxGetPort(RX_t *rx);
+
+// Check if the end of input has been reached (replay ports, such as file://, or closed network connection), i.e. if
+// there will be no more messages after rxGetNextMessage() returned NULL
+bool rxIsEof(RX_t *rx);
+
 /* ****************************************************************************************************************** */
 
 bool rxGetVerStr(RX_t *rx, char *str, const int size);
@@ -98,10 +118,15 @@ bool rxReset(RX_t *rx, const RX_RESET_t reset);
 
 const char *rxResetStr(const RX_RESET_t reset);
 
+// Get configuration from a layer. The Default layer is the same for all receivers with the same firmware. Unless
+// disabled (RX_ARGS_t.cfgcache), it is polled only once and stored (in $XDG_CACHE_HOME or ~/.cache/ubloxcfg-config-*,
+// resp. %LOCALAPPDATA%\ubloxcfg-config-*.bin), keyed by the version (rxGetVerStr()) and the requested keys.
 int rxGetConfig(RX_t *rx, const UBLOXCFG_LAYER_t layer, const uint32_t *keys, const int numKeys, UBLOXCFG_KEYVAL_t *kv, const int maxKv);
 
 bool rxSetConfig(RX_t *rx, const UBLOXCFG_KEYVAL_t *kv, const int nKv, const bool ram, const bool bbr, const bool flash);
 
+bool rxDelConfig(RX_t *rx, const uint32_t *keys, const int nKeys, const bool bbr, const bool flash);
+
 /* ****************************************************************************************************************** */
 #ifdef __cplusplus
 }
@@ -0,0 +1,577 @@
+// flipflip's u-blox positioning receiver control library: multi-receiver I/O hub
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <string.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#  include <sys/epoll.h>
+#  include <sys/eventfd.h>
+#endif
+
+#include "ff_debug.h"
+#include "ff_stuff.h"
+#include "ff_parser.h"
+#include "ff_port.h"
+#include "ff_rx.h"
+#include "ff_rxhub.h"
+
+/* ****************************************************************************************************************** */
+
+#define RX_HUB_WARNING(fmt, ...) WARNING("%s: " fmt, hub->name, ## __VA_ARGS__)
+#define RX_HUB_DEBUG(fmt, ...)   DEBUG(  "%s: " fmt, hub->name, ## __VA_ARGS__)
+#define RX_HUB_TRACE(fmt, ...)   TRACE(  "%s: " fmt, hub->name, ## __VA_ARGS__)
+
+#define RX_HUB_MAX_EVENTS       64   // Max. number of epoll events handled per rxHubRun() iteration
+#define RX_HUB_MAX_READS         8   // Max. number of reads per port and iteration (fairness)
+#define RX_HUB_READ_SIZE      4096   // Read chunk size
+
+typedef struct RX_HUB_PORT_s
+{
+    PORT_t     *port;
+    RX_t       *rx;
+    PARSER_t   *parser;    // NULL if no data pending
+    uint32_t    seq;       // Our own message counter, as parsers are shared
+    void      (*msgcb)(PARSER_MSG_t *, void *arg);
+    void       *cbarg;
+    bool        removed;
+    bool        wantOut;   // Waiting for the port to become writable (tx queue)
+    struct RX_HUB_PORT_s *next;
+} RX_HUB_PORT_t;
+
+typedef struct RX_HUB_s
+{
+    char            name[100];
+    int             epfd;
+    int             evfd;
+    RX_HUB_PORT_t  *ports;
+    PARSER_t      **pool;
+    int             nPool;     // Number of free parsers in pool
+    int             maxPool;   // Size of pool array
+    int             nParsers;  // Number of parsers allocated
+    uint8_t         readBuf[RX_HUB_READ_SIZE];
+    uint32_t        nMsgs;
+    uint32_t        nBytes;
+    volatile bool   abort;
+    bool            running;
+} RX_HUB_t;
+
+#ifdef __linux__
+
+RX_HUB_t *rxHubInit(const char *name)
+{
+    RX_HUB_t *hub = (RX_HUB_t *)malloc(sizeof(RX_HUB_t));
+    if (hub == NULL)
+    {
+        WARNING("rxHubInit() malloc fail!");
+        return NULL;
+    }
+    memset(hub, 0, sizeof(*hub));
+    static int instCnt;
+    if ( (name != NULL) && (name[0] != '\0') )
+    {
+        snprintf(hub->name, sizeof(hub->name), "%s", name);
+    }
+    else
+    {
+        snprintf(hub->name, sizeof(hub->name), "rxhub%d", instCnt);
+    }
+    instCnt++;
+
+    hub->epfd = epoll_create1(EPOLL_CLOEXEC);
+    hub->evfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    struct epoll_event ev = { .events = EPOLLIN, .data.ptr = NULL };
+    if ( (hub->epfd < 0) || (hub->evfd < 0) || (epoll_ctl(hub->epfd, EPOLL_CTL_ADD, hub->evfd, &ev) != 0) )
+    {
+        RX_HUB_WARNING("Failed creating epoll: %s", strerror(errno));
+        if (hub->epfd >= 0)
+        {
+            close(hub->epfd);
+        }
+        if (hub->evfd >= 0)
+        {
+            close(hub->evfd);
+        }
+        free(hub);
+        return NULL;
+    }
+
+    RX_HUB_DEBUG("Hub created");
+    return hub;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _rxHubReleaseParser(RX_HUB_t *hub, RX_HUB_PORT_t *hp);
+static void _rxHubCleanup(RX_HUB_t *hub);
+
+void rxHubDestroy(RX_HUB_t *hub)
+{
+    if (hub == NULL)
+    {
+        return;
+    }
+    for (RX_HUB_PORT_t *hp = hub->ports; hp != NULL; hp = hp->next)
+    {
+        hp->removed = true;
+    }
+    _rxHubCleanup(hub);
+    for (int ix = 0; ix < hub->nPool; ix++)
+    {
+        free(hub->pool[ix]);
+    }
+    free(hub->pool);
+    close(hub->evfd);
+    close(hub->epfd);
+    RX_HUB_DEBUG("Hub destroyed (%u messages, %u bytes, %d parsers)", hub->nMsgs, hub->nBytes, hub->nParsers);
+    free(hub);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static bool _rxHubAdd(RX_HUB_t *hub, PORT_t *port, RX_t *rx, void (*msgcb)(PARSER_MSG_t *, void *arg), void *cbarg)
+{
+    if ( (hub == NULL) || (port == NULL) || (msgcb == NULL) )
+    {
+        return false;
+    }
+    const int fd = portGetFd(port);
+    if (fd < 0)
+    {
+        RX_HUB_WARNING("Port not open!");
+        return false;
+    }
+
+    RX_HUB_PORT_t *hp = (RX_HUB_PORT_t *)malloc(sizeof(RX_HUB_PORT_t));
+    if (hp == NULL)
+    {
+        RX_HUB_WARNING("malloc fail!");
+        return false;
+    }
+    memset(hp, 0, sizeof(*hp));
+    hp->port  = port;
+    hp->rx    = rx;
+    hp->msgcb = msgcb;
+    hp->cbarg = cbarg;
+
+    struct epoll_event ev = { .events = EPOLLIN, .data.ptr = hp };
+    if (epoll_ctl(hub->epfd, EPOLL_CTL_ADD, fd, &ev) != 0)
+    {
+        RX_HUB_WARNING("Failed adding fd %d: %s", fd, strerror(errno));
+        free(hp);
+        return false;
+    }
+
+    hp->next = hub->ports;
+    hub->ports = hp;
+    RX_HUB_DEBUG("Added port %s (fd %d)", port->file, fd);
+    return true;
+}
+
+bool rxHubAddRx(RX_HUB_t *hub, RX_t *rx, void (*msgcb)(PARSER_MSG_t *, void *arg), void *cbarg)
+{
+    return _rxHubAdd(hub, rxGetPort(rx), rx, msgcb, cbarg);
+}
+
+bool rxHubAddPort(RX_HUB_t *hub, PORT_t *port, void (*msgcb)(PARSER_MSG_t *, void *arg), void *cbarg)
+{
+    return _rxHubAdd(hub, port, NULL, msgcb, cbarg);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void _rxHubDetach(RX_HUB_t *hub, RX_HUB_PORT_t *hp)
+{
+    const int fd = portGetFd(hp->port);
+    if (fd >= 0)
+    {
+        epoll_ctl(hub->epfd, EPOLL_CTL_DEL, fd, NULL);
+    }
+    hp->removed = true;
+    _rxHubReleaseParser(hub, hp);
+}
+
+bool rxHubRemovePort(RX_HUB_t *hub, PORT_t *port)
+{
+    if ( (hub == NULL) || (port == NULL) )
+    {
+        return false;
+    }
+    for (RX_HUB_PORT_t *hp = hub->ports; hp != NULL; hp = hp->next)
+    {
+        if ( (hp->port == port) && !hp->removed )
+        {
+            RX_HUB_DEBUG("Removing port %s", port->file);
+            _rxHubDetach(hub, hp);
+            // Entries are freed later, we may be called from a message callback
+            if (!hub->running)
+            {
+                _rxHubCleanup(hub);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+bool rxHubRemoveRx(RX_HUB_t *hub, RX_t *rx)
+{
+    return rxHubRemovePort(hub, rxGetPort(rx));
+}
+
+static void _rxHubCleanup(RX_HUB_t *hub)
+{
+    RX_HUB_PORT_t **pHp = &hub->ports;
+    while (*pHp != NULL)
+    {
+        RX_HUB_PORT_t *hp = *pHp;
+        if (hp->removed)
+        {
+            _rxHubReleaseParser(hub, hp);
+            *pHp = hp->next;
+            free(hp);
+        }
+        else
+        {
+            pHp = &hp->next;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static PARSER_t *_rxHubAcquireParser(RX_HUB_t *hub)
+{
+    PARSER_t *parser = NULL;
+    if (hub->nPool > 0)
+    {
+        hub->nPool--;
+        parser = hub->pool[hub->nPool];
+    }
+    else
+    {
+        parser = (PARSER_t *)malloc(sizeof(PARSER_t));
+        if (parser == NULL)
+        {
+            RX_HUB_WARNING("malloc fail!");
+            return NULL;
+        }
+        parserInit(parser);
+        hub->nParsers++;
+        RX_HUB_DEBUG("Parser pool grows to %d", hub->nParsers);
+    }
+    // Cheap reset, there's no need to clear all the buffers
+    parserReset(parser);
+    return parser;
+}
+
+static void _rxHubReleaseParser(RX_HUB_t *hub, RX_HUB_PORT_t *hp)
+{
+    if (hp->parser == NULL)
+    {
+        return;
+    }
+    if (hub->nPool >= hub->maxPool)
+    {
+        const int maxPool = hub->maxPool > 0 ? 2 * hub->maxPool : 8;
+        PARSER_t **pool = (PARSER_t **)realloc(hub->pool, maxPool * sizeof(PARSER_t *));
+        if (pool == NULL)
+        {
+            RX_HUB_WARNING("malloc fail!");
+            free(hp->parser);
+            hub->nParsers--;
+            hp->parser = NULL;
+            return;
+        }
+        hub->pool = pool;
+        hub->maxPool = maxPool;
+    }
+    hub->pool[hub->nPool] = hp->parser;
+    hub->nPool++;
+    hp->parser = NULL;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Wait for the port to become writable only while there is queued data that the rate limit allows to be sent now.
+// Otherwise we'd spin on the (almost always) writable fd. Returns how long to wait at most for the rate limit.
+static int _rxHubUpdateTx(RX_HUB_t *hub, RX_HUB_PORT_t *hp)
+{
+    const int delay = portGetTxQueueDelay(hp->port);
+    const bool wantOut = (delay == 0);
+    if (wantOut != hp->wantOut)
+    {
+        struct epoll_event ev = { .events = EPOLLIN | (wantOut ? EPOLLOUT : 0), .data.ptr = hp };
+        if (epoll_ctl(hub->epfd, EPOLL_CTL_MOD, portGetFd(hp->port), &ev) == 0)
+        {
+            hp->wantOut = wantOut;
+        }
+    }
+    return delay;
+}
+
+// Read and process data from a port, returns number of messages dispatched or -1 on port failure
+static int _rxHubHandlePort(RX_HUB_t *hub, RX_HUB_PORT_t *hp)
+{
+    int nMsgs = 0;
+    for (int readIx = 0; !hp->removed && (readIx < RX_HUB_MAX_READS); readIx++)
+    {
+        if (hp->parser == NULL)
+        {
+            hp->parser = _rxHubAcquireParser(hub);
+            if (hp->parser == NULL)
+            {
+                return -1;
+            }
+        }
+        PARSER_t *parser = hp->parser;
+
+        // Read as much as the parser can take
+        const int space = (int)sizeof(parser->buf) - parser->offs - parser->size;
+        const int readSize = space < (int)sizeof(hub->readBuf) ? space : (int)sizeof(hub->readBuf);
+        int nRead = 0;
+        if (!portRead(hp->port, hub->readBuf, readSize, &nRead))
+        {
+            return -1;
+        }
+        if (nRead <= 0)
+        {
+            break;
+        }
+        hub->nBytes += nRead;
+        parserAddTs(parser, hub->readBuf, nRead, hp->port->readTs, hp->port->readTsReal);
+
+        PARSER_MSG_t msg;
+        while (!hp->removed && parserProcess(parser, &msg, true))
+        {
+            hp->seq++;
+            msg.seq = hp->seq;
+            msg.src = PARSER_MSGSRC_FROM_RX;
+            hp->msgcb(&msg, hp->cbarg);
+            nMsgs++;
+        }
+
+        if (nRead < readSize)
+        {
+            break;
+        }
+    }
+
+    // Return parser to pool if there's no pending data
+    if ( (hp->parser != NULL) && (hp->parser->size == 0) && (hp->parser->offs == 0) )
+    {
+        _rxHubReleaseParser(hub, hp);
+    }
+
+    return nMsgs;
+}
+
+int rxHubRun(RX_HUB_t *hub, const uint32_t timeout)
+{
+    if (hub == NULL)
+    {
+        return -1;
+    }
+
+    // Drain transmit queues (tcp, telnet) without waiting for data to arrive on the port
+    int waitTime = (int)timeout;
+    for (RX_HUB_PORT_t *hp = hub->ports; hp != NULL; hp = hp->next)
+    {
+        const int delay = hp->removed ? -1 : _rxHubUpdateTx(hub, hp);
+        if ( (delay > 0) && (delay < waitTime) )
+        {
+            waitTime = delay;
+        }
+    }
+
+    struct epoll_event events[RX_HUB_MAX_EVENTS];
+    const int nEvents = epoll_wait(hub->epfd, events, NUMOF(events), waitTime);
+    if (nEvents < 0)
+    {
+        if (errno == EINTR)
+        {
+            return 0;
+        }
+        RX_HUB_WARNING("epoll_wait() fail: %s", strerror(errno));
+        return -1;
+    }
+
+    hub->running = true;
+    int nMsgs = 0;
+    for (int evIx = 0; evIx < nEvents; evIx++)
+    {
+        RX_HUB_PORT_t *hp = (RX_HUB_PORT_t *)events[evIx].data.ptr;
+
+        // Wakeup (rxHubAbort())
+        if (hp == NULL)
+        {
+            uint64_t val;
+            if (read(hub->evfd, &val, sizeof(val)) < 0) { /* we don't care */ }
+            continue;
+        }
+        if (hp->removed || hub->abort)
+        {
+            continue;
+        }
+
+        int res = 0;
+        if ( ((events[evIx].events & EPOLLOUT) != 0) && !portTxQueueDrain(hp->port) )
+        {
+            res = -1;
+        }
+        if ( (res >= 0) && ((events[evIx].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) != 0) )
+        {
+            res = _rxHubHandlePort(hub, hp);
+        }
+        if (res < 0)
+        {
+            RX_HUB_WARNING("Port %s failed, removing it", hp->port->file);
+            _rxHubDetach(hub, hp);
+            hp->msgcb(NULL, hp->cbarg);
+        }
+        else
+        {
+            nMsgs += res;
+        }
+    }
+    hub->running = false;
+
+    _rxHubCleanup(hub);
+    hub->nMsgs += nMsgs;
+    return nMsgs;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+void rxHubLoop(RX_HUB_t *hub)
+{
+    if (hub == NULL)
+    {
+        return;
+    }
+    RX_HUB_DEBUG("Loop start");
+    while (!hub->abort)
+    {
+        if (rxHubRun(hub, 1000) < 0)
+        {
+            break;
+        }
+    }
+    hub->abort = false;
+    RX_HUB_DEBUG("Loop stop");
+}
+
+void rxHubAbort(RX_HUB_t *hub)
+{
+    if (hub != NULL)
+    {
+        hub->abort = true;
+        const uint64_t val = 1;
+        if (write(hub->evfd, &val, sizeof(val)) < 0) { /* we don't care */ }
+    }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+bool rxHubGetStats(RX_HUB_t *hub, RX_HUB_STATS_t *stats)
+{
+    if ( (hub == NULL) || (stats == NULL) )
+    {
+        return false;
+    }
+    memset(stats, 0, sizeof(*stats));
+    for (RX_HUB_PORT_t *hp = hub->ports; hp != NULL; hp = hp->next)
+    {
+        if (!hp->removed)
+        {
+            stats->nPorts++;
+        }
+    }
+    stats->nParsers     = hub->nParsers;
+    stats->nParsersUsed = hub->nParsers - hub->nPool;
+    stats->nMsgs        = hub->nMsgs;
+    stats->nBytes       = hub->nBytes;
+    return true;
+}
+
+#else // __linux__
+
+RX_HUB_t *rxHubInit(const char *name)
+{
+    (void)name;
+    WARNING("rxHub not available on this platform!");
+    return NULL;
+}
+
+void rxHubDestroy(RX_HUB_t *hub)
+{
+    (void)hub;
+}
+
+bool rxHubAddRx(RX_HUB_t *hub, RX_t *rx, void (*msgcb)(PARSER_MSG_t *, void *arg), void *cbarg)
+{
+    (void)hub; (void)rx; (void)msgcb; (void)cbarg;
+    return false;
+}
+
+bool rxHubAddPort(RX_HUB_t *hub, PORT_t *port, void (*msgcb)(PARSER_MSG_t *, void *arg), void *cbarg)
+{
+    (void)hub; (void)port; (void)msgcb; (void)cbarg;
+    return false;
+}
+
+bool rxHubRemoveRx(RX_HUB_t *hub, RX_t *rx)
+{
+    (void)hub; (void)rx;
+    return false;
+}
+
+bool rxHubRemovePort(RX_HUB_t *hub, PORT_t *port)
+{
+    (void)hub; (void)port;
+    return false;
+}
+
+int rxHubRun(RX_HUB_t *hub, const uint32_t timeout)
+{
+    (void)hub; (void)timeout;
+    return -1;
+}
+
+void rxHubLoop(RX_HUB_t *hub)
+{
+    (void)hub;
+}
+
+void rxHubAbort(RX_HUB_t *hub)
+{
+    (void)hub;
+}
+
+bool rxHubGetStats(RX_HUB_t *hub, RX_HUB_STATS_t *stats)
+{
+    (void)hub; (void)stats;
+    return false;
+}
+
+#endif // __linux__
+
+/* ****************************************************************************************************************** */
+// eof
@@ -0,0 +1,78 @@
+// flipflip's u-blox positioning receiver control library: multi-receiver I/O hub
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY; without
+// even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#ifndef __FF_RXHUB_H__
+#define __FF_RXHUB_H__
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ff_parser.h"
+#include "ff_port.h"
+#include "ff_rx.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ****************************************************************************************************************** */
+
+// The hub serves many receivers (RX_t) or plain ports (PORT_t) from a single thread. It waits for data on all
+// registered ports (epoll) and dispatches the parsed messages to the per-port callbacks. Parsers are taken from a
+// shared pool when data arrives and are returned once all data has been consumed, so that memory use scales with the
+// number of ports that have a partial message pending rather than with the number of ports. The callback is called
+// with msg = NULL if the port failed, in which case the port has been removed from the hub. Transmit queues of network
+// ports (see portSetTxQueue()) are drained by the hub as well, also when no data arrives.
+//
+// The hub is not thread-safe. rxHubAdd*(), rxHubRemove*() and rxHubRun() must be called from the same thread (or
+// from a message callback). rxHubAbort() can be called from any thread. While a receiver is registered with the hub
+// rxGetNextMessage() etc. must not be used on it. Only available on Linux.
+
+typedef struct RX_HUB_s RX_HUB_t;
+
+RX_HUB_t *rxHubInit(const char *name);
+void rxHubDestroy(RX_HUB_t *hub);
+
+bool rxHubAddRx(RX_HUB_t *hub, RX_t *rx, void (*msgcb)(PARSER_MSG_t *, void *arg), void *cbarg);
+bool rxHubAddPort(RX_HUB_t *hub, PORT_t *port, void (*msgcb)(PARSER_MSG_t *, void *arg), void *cbarg);
+bool rxHubRemoveRx(RX_HUB_t *hub, RX_t *rx);
+bool rxHubRemovePort(RX_HUB_t *hub, PORT_t *port);
+
+// Wait up to timeout [ms] for data and dispatch messages, returns number of messages dispatched or -1 on error
+int rxHubRun(RX_HUB_t *hub, const uint32_t timeout);
+
+// Run until aborted
+void rxHubLoop(RX_HUB_t *hub);
+
+// Abort rxHubRun() and rxHubLoop()
+void rxHubAbort(RX_HUB_t *hub);
+
+typedef struct RX_HUB_STATS_s
+{
+    int      nPorts;        // Number of registered ports
+    int      nParsers;      // Number of parsers allocated (pool size)
+    int      nParsersUsed;  // Number of parsers currently in use
+    uint32_t nMsgs;         // Number of messages dispatched
+    uint32_t nBytes;        // Number of bytes read
+} RX_HUB_STATS_t;
+
+bool rxHubGetStats(RX_HUB_t *hub, RX_HUB_STATS_t *stats);
+
+/* ****************************************************************************************************************** */
+#ifdef __cplusplus
+}
+#endif
+#endif // __FF_RXHUB_H__
@@ -27,6 +27,8 @@ extern "C" {
 /* ****************************************************************************************************************** */
 
 uint32_t TIME(void);
+uint64_t TIME_NS(void); // monotonic time [ns], arbitrary reference
+uint64_t TIME_NS_REAL(void); // wall clock time [ns] since 1970-01-01 00:00:00 UTC
 void SLEEP(uint32_t dur);
 
 uint32_t timeOfDay(void);
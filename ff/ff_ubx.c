@@ -64,20 +64,157 @@ int ubxMakeMessage(const uint8_t clsId, const uint8_t msgId, const uint8_t *payl
 
 #define UBX_CFG_VALSET_MSG_MAX 20
 
+// Size of key-value pair in UBX-CFG-VALSET.cfgData
+static int _ubxCfgValsetKvSize(const UBLOXCFG_KEYVAL_t *kv)
+{
+    switch (UBLOXCFG_ID2SIZE(kv->id))
+    {
+        case UBLOXCFG_SIZE_BIT:
+        case UBLOXCFG_SIZE_ONE:
+            return 4 + 1;
+        case UBLOXCFG_SIZE_TWO:
+            return 4 + 2;
+        case UBLOXCFG_SIZE_FOUR:
+            return 4 + 4;
+        case UBLOXCFG_SIZE_EIGHT:
+            return 4 + 8;
+    }
+    return 0;
+}
+
+// Assign items to messages in input order, returns number of messages
+static int _ubxCfgValsetSplit(const int *kvSize, const int nKv, const int maxCfgData, int *kvMsg)
+{
+    int nMsgs = 0;
+    int msgKv = 0;
+    int msgSize = 0;
+    for (int kvIx = 0; kvIx < nKv; kvIx++)
+    {
+        if ( (nMsgs == 0) || (msgKv >= UBX_CFG_VALSET_V1_MAX_KV) || ((msgSize + kvSize[kvIx]) > maxCfgData) )
+        {
+            nMsgs++;
+            msgKv = 0;
+            msgSize = 0;
+        }
+        kvMsg[kvIx] = nMsgs - 1;
+        msgKv++;
+        msgSize += kvSize[kvIx];
+    }
+    return nMsgs;
+}
+
+// Assign items to messages using first-fit decreasing bin packing, returns number of messages (or more than
+// UBX_CFG_VALSET_MSG_MAX if they don't fit)
+static int _ubxCfgValsetPack(const int *kvSize, const int nKv, const int maxCfgData, int *kvMsg)
+{
+    int msgKv[UBX_CFG_VALSET_MSG_MAX];
+    int msgSize[UBX_CFG_VALSET_MSG_MAX];
+    int nMsgs = 0;
+    // There are only four different sizes, so we can do without sorting the items: place all largest items first,
+    // then all the next smaller items, etc., each into the first message that has room left.
+    const int sizes[] = { 4 + 8, 4 + 4, 4 + 2, 4 + 1 };
+    for (int sizeIx = 0; sizeIx < NUMOF(sizes); sizeIx++)
+    {
+        for (int kvIx = 0; kvIx < nKv; kvIx++)
+        {
+            if (kvSize[kvIx] != sizes[sizeIx])
+            {
+                continue;
+            }
+            int msgIx = 0;
+            while ( (msgIx < nMsgs) &&
+                    ((msgKv[msgIx] >= UBX_CFG_VALSET_V1_MAX_KV) || ((msgSize[msgIx] + kvSize[kvIx]) > maxCfgData)) )
+            {
+                msgIx++;
+            }
+            if (msgIx >= nMsgs)
+            {
+                if (nMsgs >= UBX_CFG_VALSET_MSG_MAX)
+                {
+                    return UBX_CFG_VALSET_MSG_MAX + 1;
+                }
+                msgKv[nMsgs] = 0;
+                msgSize[nMsgs] = 0;
+                nMsgs++;
+            }
+            kvMsg[kvIx] = msgIx;
+            msgKv[msgIx]++;
+            msgSize[msgIx] += kvSize[kvIx];
+        }
+    }
+    return nMsgs;
+}
+
 UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const int nKv, const bool ram, const bool bbr, const bool flash, int *nValset)
 {
-    if (nValset == NULL)
+    return ubxKeyValToUbxCfgValsetOpts(kv, nKv, ram, bbr, flash, NULL, nValset, NULL);
+}
+
+UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValsetOpts(const UBLOXCFG_KEYVAL_t *kv, const int nKv, const bool ram, const bool bbr, const bool flash,
+    const UBX_CFG_VALSET_OPTS_t *opts, int *nValset, int *nValsetUnpacked)
+{
+    if ( (nValset == NULL) || (nKv < 0) || ((kv == NULL) && (nKv > 0)) )
     {
         return NULL;
     }
 
-    const int nMsgs = (nKv / (UBX_CFG_VALSET_V1_MAX_KV)) + ((nKv % UBX_CFG_VALSET_V1_MAX_KV) != 0 ? 1 : 0) ;
+    const UBX_CFG_VALSET_OPTS_t defOpts = { .pack = false, .noTransaction = false, .maxSize = 0 };
+    if (opts == NULL)
+    {
+        opts = &defOpts;
+    }
+    const int maxSize = opts->maxSize > 0 ? opts->maxSize : UBX_CFG_VALSET_V1_MAX_SIZE;
+    const int maxCfgData = maxSize - (int)sizeof(UBX_CFG_VALSET_V1_GROUP0_t) - UBX_FRAME_SIZE;
+    if ( (maxSize > UBX_CFG_VALSET_V1_MAX_SIZE) || (maxCfgData < (4 + 8)) )
+    {
+        WARNING("ubxKeyValToUbxCfgValset() bad message size %d", maxSize);
+        return NULL;
+    }
+    const bool useTransaction = !opts->noTransaction;
+
+    // Assign items to messages
+    int *kvSize = malloc(3 * (nKv > 0 ? nKv : 1) * sizeof(int));
+    if (kvSize == NULL)
+    {
+        WARNING("ubxKeyValToUbxCfgValset() malloc fail");
+        return NULL;
+    }
+    int *kvMsgSplit = &kvSize[nKv];
+    int *kvMsgPack  = &kvSize[2 * nKv];
+    for (int kvIx = 0; kvIx < nKv; kvIx++)
+    {
+        kvSize[kvIx] = _ubxCfgValsetKvSize(&kv[kvIx]);
+        if (kvSize[kvIx] == 0)
+        {
+            WARNING("ubxKeyValToUbxCfgValset() bad item 0x%08x", kv[kvIx].id);
+            free(kvSize);
+            return NULL;
+        }
+    }
+    const int nMsgsSplit = _ubxCfgValsetSplit(kvSize, nKv, maxCfgData, kvMsgSplit);
+    const int nMsgsPack = opts->pack ? _ubxCfgValsetPack(kvSize, nKv, maxCfgData, kvMsgPack) : nMsgsSplit;
+    // Only use the packing if it helps, otherwise keep the items in the original order
+    const bool packed = (nMsgsPack < nMsgsSplit);
+    const int nMsgs = packed ? nMsgsPack : nMsgsSplit;
+    const int *kvMsg = packed ? kvMsgPack : kvMsgSplit;
+    if (opts->pack)
+    {
+        DEBUG("ubxKeyValToUbxCfgValset() %d items: %d messages in order, %d messages packed",
+            nKv, nMsgsSplit, nMsgsPack);
+    }
+    if (nValsetUnpacked != NULL)
+    {
+        *nValsetUnpacked = nMsgsSplit;
+    }
+
 #ifdef NEED_EMPTY_TRANSACTION_END
-    if (nMsgs > (UBX_CFG_VALSET_MSG_MAX - 1))
+    if (nMsgs > (useTransaction ? (UBX_CFG_VALSET_MSG_MAX - 1) : UBX_CFG_VALSET_MSG_MAX))
 #else
     if (nMsgs > UBX_CFG_VALSET_MSG_MAX)
 #endif
     {
+        WARNING("ubxKeyValToUbxCfgValset() too many items (%d messages)", nMsgs);
+        free(kvSize);
         return NULL;
     }
 
@@ -86,6 +223,7 @@ UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const
                            (flash ? UBX_CFG_VALSET_V1_LAYER_FLASH : 0x00);
     if (layers == 0x00)
     {
+        free(kvSize);
         return NULL;
     }
     char layersStr[100];
@@ -108,6 +246,7 @@ UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const
     if (msgs == NULL)
     {
         WARNING("ubxKeyValToUbxCfgValset() malloc fail");
+        free(kvSize);
         return NULL;
     }
     memset(msgs, 0, msgsSize);
@@ -116,15 +255,27 @@ UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const
     bool res = true;
     for (int msgIx = 0; msgIx < nMsgs; msgIx++)
     {
-        const int kvOffs = msgIx * UBX_CFG_VALSET_V1_MAX_KV;
-        const int remKv = nKv - kvOffs;
-        const int nKvThisMsg = remKv > UBX_CFG_VALSET_V1_MAX_KV ? UBX_CFG_VALSET_V1_MAX_KV : remKv;
-        //DEBUG("msgIx=%d nMsgs=%d nKv=%d kvOffs=%d remKv=%d nKvThisMsg=%d", msgIx, nMsgs, nKv, kvOffs, remKv, nKvThisMsg);
+        // Collect the items for this message, keeping their relative order
+        UBLOXCFG_KEYVAL_t kvThisMsg[UBX_CFG_VALSET_V1_MAX_KV];
+        int nKvThisMsg = 0;
+        for (int kvIx = 0; kvIx < nKv; kvIx++)
+        {
+            if (kvMsg[kvIx] == msgIx)
+            {
+                msgs[msgIx].kvIx[nKvThisMsg] = kvIx;
+                kvThisMsg[nKvThisMsg] = kv[kvIx];
+                nKvThisMsg++;
+            }
+        }
+        msgs[msgIx].nKv = nKvThisMsg;
+        const int kvFirst = msgs[msgIx].kvIx[0];
+        const int kvLast = msgs[msgIx].kvIx[nKvThisMsg - 1];
+        //DEBUG("msgIx=%d nMsgs=%d nKv=%d kvFirst=%d kvLast=%d nKvThisMsg=%d", msgIx, nMsgs, nKv, kvFirst, kvLast, nKvThisMsg);
 
         // Message header
         uint8_t transaction = UBX_CFG_VALSET_V1_TRANSACTION_NONE;
         const char *transactionStr = "no transaction";
-        if (nMsgs > 1)
+        if ( useTransaction && (nMsgs > 1) )
         {
             if (msgIx == 0)
             {
@@ -147,8 +298,15 @@ UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const
             }
 #endif
         }
-        DEBUG("Creating UBX-CFG-VALSET %d items (%d..%d/%d, %s)",
-            nKvThisMsg, kvOffs + 1, kvOffs + nKvThisMsg, nKv, transactionStr);
+        if (packed)
+        {
+            DEBUG("Creating UBX-CFG-VALSET %d items (packed, %s)", nKvThisMsg, transactionStr);
+        }
+        else
+        {
+            DEBUG("Creating UBX-CFG-VALSET %d items (%d..%d/%d, %s)",
+                nKvThisMsg, kvFirst + 1, kvLast + 1, nKv, transactionStr);
+        }
 
         uint8_t *pUbxData = msgs[msgIx].msg;
 
@@ -166,7 +324,7 @@ UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const
         // Add config data
         int cfgDataSize = 0;
         if (!ubloxcfg_makeData(&pUbxData[payloadHeadSize], UBX_CFG_VALGET_V1_MAX_SIZE,
-                &kv[kvOffs], nKvThisMsg, &cfgDataSize))
+                kvThisMsg, nKvThisMsg, &cfgDataSize))
         {
             WARNING("UBX-CFG-VALSET.cfgData encode fail!");
             res = false;
@@ -179,10 +337,19 @@ UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const
 
         msgs[msgIx].size = msgSize;
 
-        snprintf(msgs[msgIx].info, sizeof(msgs[msgIx].info), "%d items: %d..%d/%d, %d bytes, %s, %s",
-            nKvThisMsg, kvOffs + 1, kvOffs + nKvThisMsg, nKv, msgSize, &layersStr[1], transactionStr);
+        if (packed)
+        {
+            snprintf(msgs[msgIx].info, sizeof(msgs[msgIx].info), "%d items: packed, %d bytes, %s, %s",
+                nKvThisMsg, msgSize, &layersStr[1], transactionStr);
+        }
+        else
+        {
+            snprintf(msgs[msgIx].info, sizeof(msgs[msgIx].info), "%d items: %d..%d/%d, %d bytes, %s, %s",
+                nKvThisMsg, kvFirst + 1, kvLast + 1, nKv, msgSize, &layersStr[1], transactionStr);
+        }
     }
 
+    free(kvSize);
     if (!res)
     {
         free(msgs);
@@ -191,7 +358,7 @@ UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const
 
 #ifdef NEED_EMPTY_TRANSACTION_END
     // Add empty transaction-complete message
-    if (nMsgs > 1)
+    if ( useTransaction && (nMsgs > 1) )
     {
         const UBX_CFG_VALSET_V1_GROUP0_t payload =
         {
@@ -214,6 +381,239 @@ UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const
     return msgs;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+UBX_CFG_VALSET_MSG_t *ubxKeysToUbxCfgValdel(const uint32_t *keys, const int nKeys, const bool bbr, const bool flash, int *nValdel)
+{
+    if ( (keys == NULL) || (nValdel == NULL) )
+    {
+        return NULL;
+    }
+
+    const int nMsgs = (nKeys / (UBX_CFG_VALDEL_V1_MAX_K)) + ((nKeys % UBX_CFG_VALDEL_V1_MAX_K) != 0 ? 1 : 0) ;
+#ifdef NEED_EMPTY_TRANSACTION_END
+    if (nMsgs > (UBX_CFG_VALSET_MSG_MAX - 1))
+#else
+    if (nMsgs > UBX_CFG_VALSET_MSG_MAX)
+#endif
+    {
+        return NULL;
+    }
+
+    const uint8_t layers = (bbr   ? UBX_CFG_VALDEL_V1_LAYER_BBR   : 0x00) |
+                           (flash ? UBX_CFG_VALDEL_V1_LAYER_FLASH : 0x00);
+    if (layers == 0x00)
+    {
+        return NULL;
+    }
+    const char *layersStr = bbr && flash ? "BBR,Flash" : (bbr ? "BBR" : "Flash");
+
+    const int msgsSize = (UBX_CFG_VALSET_MSG_MAX + 1) * sizeof(UBX_CFG_VALSET_MSG_t);
+    UBX_CFG_VALSET_MSG_t *msgs = malloc(msgsSize);
+    if (msgs == NULL)
+    {
+        WARNING("ubxKeysToUbxCfgValdel() malloc fail");
+        return NULL;
+    }
+    memset(msgs, 0, msgsSize);
+
+    // Create as many UBX-CFG-VALDEL as required
+    for (int msgIx = 0; msgIx < nMsgs; msgIx++)
+    {
+        const int keyOffs = msgIx * UBX_CFG_VALDEL_V1_MAX_K;
+        const int remKeys = nKeys - keyOffs;
+        const int nKeysThisMsg = remKeys > UBX_CFG_VALDEL_V1_MAX_K ? UBX_CFG_VALDEL_V1_MAX_K : remKeys;
+
+        // Message header
+        uint8_t transaction = UBX_CFG_VALDEL_V1_TRANSACTION_NONE;
+        const char *transactionStr = "no transaction";
+        if (nMsgs > 1)
+        {
+            if (msgIx == 0)
+            {
+                transaction = UBX_CFG_VALDEL_V1_TRANSACTION_BEGIN;
+                transactionStr = "transaction begin";
+            }
+            else
+#ifndef NEED_EMPTY_TRANSACTION_END
+                  if (msgIx < (nMsgs - 1))
+#endif
+            {
+                transaction = UBX_CFG_VALDEL_V1_TRANSACTION_CONTINUE;
+                transactionStr = "transaction continue";
+            }
+#ifndef NEED_EMPTY_TRANSACTION_END
+            else
+            {
+                transaction = UBX_CFG_VALDEL_V1_TRANSACTION_END;
+                transactionStr = "transaction end";
+            }
+#endif
+        }
+        DEBUG("Creating UBX-CFG-VALDEL %d items (%d..%d/%d, %s)",
+            nKeysThisMsg, keyOffs + 1, keyOffs + nKeysThisMsg, nKeys, transactionStr);
+
+        uint8_t *pUbxData = msgs[msgIx].msg;
+        const UBX_CFG_VALDEL_V1_GROUP0_t payloadHead =
+        {
+            .version     = UBX_CFG_VALDEL_V1_VERSION,
+            .layers      = layers,
+            .transaction = transaction,
+            .reserved    = UBX_CFG_VALDEL_V1_RESERVED
+        };
+        const int payloadHeadSize = sizeof(payloadHead);
+        memcpy(pUbxData, &payloadHead, payloadHeadSize);
+        const int keysSize = nKeysThisMsg * sizeof(uint32_t);
+        memcpy(&pUbxData[payloadHeadSize], &keys[keyOffs], keysSize);
+
+        const int msgSize = ubxMakeMessage(UBX_CFG_CLSID, UBX_CFG_VALDEL_MSGID,
+            pUbxData, payloadHeadSize + keysSize, pUbxData);
+        msgs[msgIx].size = msgSize;
+
+        snprintf(msgs[msgIx].info, sizeof(msgs[msgIx].info), "%d items: %d..%d/%d, %d bytes, %s, %s",
+            nKeysThisMsg, keyOffs + 1, keyOffs + nKeysThisMsg, nKeys, msgSize, layersStr, transactionStr);
+    }
+
+#ifdef NEED_EMPTY_TRANSACTION_END
+    // Add empty transaction-complete message
+    if (nMsgs > 1)
+    {
+        const UBX_CFG_VALDEL_V1_GROUP0_t payload =
+        {
+            .version     = UBX_CFG_VALDEL_V1_VERSION,
+            .layers      = layers,
+            .transaction = UBX_CFG_VALDEL_V1_TRANSACTION_END,
+            .reserved    = UBX_CFG_VALDEL_V1_RESERVED
+        };
+        msgs[nMsgs].size = ubxMakeMessage(UBX_CFG_CLSID, UBX_CFG_VALDEL_MSGID,
+            (const uint8_t *)&payload, sizeof(payload), msgs[nMsgs].msg);
+        snprintf(msgs[nMsgs].info, sizeof(msgs[nMsgs].info), "no items, %d bytes, %s, transaction end",
+            msgs[nMsgs].size, layersStr);
+        *nValdel = nMsgs + 1;
+    }
+    else
+#endif
+    {
+        *nValdel = nMsgs;
+    }
+    return msgs;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static int _ubxCfgDiffCmp(const void *a, const void *b)
+{
+    const uint32_t idA = ((const UBLOXCFG_KEYVAL_t *)a)->id;
+    const uint32_t idB = ((const UBLOXCFG_KEYVAL_t *)b)->id;
+    return idA < idB ? -1 : (idA > idB ? 1 : 0);
+}
+
+static const UBLOXCFG_KEYVAL_t *_ubxCfgDiffFind(const UBLOXCFG_KEYVAL_t *sorted, const int num, const uint32_t id)
+{
+    const UBLOXCFG_KEYVAL_t key = { .id = id };
+    return num > 0 ? bsearch(&key, sorted, num, sizeof(*sorted), _ubxCfgDiffCmp) : NULL;
+}
+
+bool ubxCfgDiff(const UBLOXCFG_KEYVAL_t *want, const int nWant, const UBLOXCFG_KEYVAL_t *have, const int nHave,
+    const UBLOXCFG_KEYVAL_t *def, const int nDef, UBLOXCFG_KEYVAL_t *set, const int maxSet, int *nSet,
+    uint32_t *del, const int maxDel, int *nDel)
+{
+    if ( (want == NULL) || (nWant < 0) || ((have == NULL) && (nHave > 0)) || (nHave < 0) ||
+         ((def == NULL) && (nDef > 0)) || (set == NULL) || (nSet == NULL) || ((del != NULL) && (nDel == NULL)) )
+    {
+        return false;
+    }
+
+    // Sorted copies of all lists for quick lookup
+    const int nDefUse = def != NULL ? nDef : 0;
+    UBLOXCFG_KEYVAL_t *sorted = malloc((nWant + nHave + nDefUse + 1) * sizeof(UBLOXCFG_KEYVAL_t));
+    if (sorted == NULL)
+    {
+        WARNING("ubxCfgDiff() malloc fail");
+        return false;
+    }
+    UBLOXCFG_KEYVAL_t *sWant = &sorted[0];
+    UBLOXCFG_KEYVAL_t *sHave = &sorted[nWant];
+    UBLOXCFG_KEYVAL_t *sDef  = &sorted[nWant + nHave];
+    memcpy(sWant, want, nWant * sizeof(*want));
+    memcpy(sHave, have, nHave * sizeof(*have));
+    memcpy(sDef,  def,  nDefUse * sizeof(*def));
+    qsort(sWant, nWant,   sizeof(*sWant), _ubxCfgDiffCmp);
+    qsort(sHave, nHave,   sizeof(*sHave), _ubxCfgDiffCmp);
+    qsort(sDef,  nDefUse, sizeof(*sDef),  _ubxCfgDiffCmp);
+
+    bool res = true;
+    *nSet = 0;
+    if (nDel != NULL)
+    {
+        *nDel = 0;
+    }
+
+    // Desired items that are missing or have a different value (in the original order)
+    for (int ix = 0; res && (ix < nWant); ix++)
+    {
+        const UBLOXCFG_KEYVAL_t *kvHave = _ubxCfgDiffFind(sHave, nHave, want[ix].id);
+        if ( (kvHave == NULL) || (kvHave->val._raw != want[ix].val._raw) )
+        {
+            if (*nSet < maxSet)
+            {
+                set[*nSet] = want[ix];
+                (*nSet)++;
+            }
+            else
+            {
+                res = false;
+            }
+        }
+    }
+
+    // Current items that are not desired
+    for (int ix = 0; res && (ix < nHave); ix++)
+    {
+        if (_ubxCfgDiffFind(sWant, nWant, have[ix].id) != NULL)
+        {
+            continue;
+        }
+        // Delete
+        if (del != NULL)
+        {
+            if (*nDel < maxDel)
+            {
+                del[*nDel] = have[ix].id;
+                (*nDel)++;
+            }
+            else
+            {
+                res = false;
+            }
+        }
+        // Revert to default
+        else if (nDefUse > 0)
+        {
+            const UBLOXCFG_KEYVAL_t *kvDef = _ubxCfgDiffFind(sDef, nDefUse, have[ix].id);
+            if ( (kvDef != NULL) && (kvDef->val._raw != have[ix].val._raw) )
+            {
+                if (*nSet < maxSet)
+                {
+                    set[*nSet] = *kvDef;
+                    (*nSet)++;
+                }
+                else
+                {
+                    res = false;
+                }
+            }
+        }
+    }
+
+    free(sorted);
+    if (!res)
+    {
+        WARNING("ubxCfgDiff() too many items");
+    }
+    return res;
+}
+
 /* ****************************************************************************************************************** */
 
 static bool _ubxMessageName(char *name, const int size, const uint8_t clsId, const uint8_t msgId);
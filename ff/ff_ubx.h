@@ -1698,11 +1698,74 @@ typedef struct UBX_CFG_VALSET_MSG_s
     uint8_t msg[UBX_CFG_VALSET_V1_MAX_SIZE];
     int     size;
     char    info[200];
+    int     nKv;                             //!< Number of items in the message (UBX-CFG-VALSET only)
+    int     kvIx[UBX_CFG_VALSET_V1_MAX_KV];  //!< Indices into the input list of the items (UBX-CFG-VALSET only)
 } UBX_CFG_VALSET_MSG_t;
 
+//! UBX-CFG-VALSET creation options
+typedef struct UBX_CFG_VALSET_OPTS_s
+{
+    bool pack;           //!< Group items into as few messages as possible instead of keeping the input order
+    bool noTransaction;  //!< Do not use a transaction for multiple messages (they are not applied atomically then)
+    int  maxSize;        //!< Maximum message size (0 = #UBX_CFG_VALSET_V1_MAX_SIZE)
+} UBX_CFG_VALSET_OPTS_t;
+
 //! Make series of UBX-CFG-VALSET messages
 UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValset(const UBLOXCFG_KEYVAL_t *kv, const int nKv, const bool ram, const bool bbr, const bool flash, int *nValset);
 
+//! Make series of UBX-CFG-VALSET messages, with options
+/*!
+    Like ubxKeyValToUbxCfgValset(), which keeps the items in input order and fills each message up to the limits
+    (#UBX_CFG_VALSET_V1_MAX_KV items, maximum message size) before starting the next one. With the \c pack option the
+    items are instead grouped (first-fit decreasing by item size) so that as few messages as possible are needed. This
+    only makes a difference if the message size is limited, as the item count limit is reached before the size limit
+    otherwise. The packed order is used only if it results in fewer messages. Multiple messages are sent as a
+    transaction (all items are applied at once at the end), unless the \c noTransaction option is given.
+
+    \param[in]   kv               List of key-value pairs
+    \param[in]   nKv              Number of key-value pairs
+    \param[in]   ram              Set items in RAM layer
+    \param[in]   bbr              Set items in BBR layer
+    \param[in]   flash            Set items in Flash layer
+    \param[in]   opts             Options (can be NULL for the defaults)
+    \param[out]  nValset          Number of messages
+    \param[out]  nValsetUnpacked  Number of messages that would be needed in input order (optional, can be NULL)
+
+    \returns a list of messages (to be free()d by the caller), or NULL on error (e.g. too many items)
+*/
+UBX_CFG_VALSET_MSG_t *ubxKeyValToUbxCfgValsetOpts(const UBLOXCFG_KEYVAL_t *kv, const int nKv, const bool ram, const bool bbr, const bool flash,
+    const UBX_CFG_VALSET_OPTS_t *opts, int *nValset, int *nValsetUnpacked);
+
+//! Make series of UBX-CFG-VALDEL messages
+UBX_CFG_VALSET_MSG_t *ubxKeysToUbxCfgValdel(const uint32_t *keys, const int nKeys, const bool bbr, const bool flash, int *nValdel);
+
+//! Calculate configuration difference
+/*!
+    Determines the changes required to bring a configuration layer from its current state (\c have, e.g. from
+    rxGetConfig()) to the desired configuration (\c want). Items in \c want that are missing in \c have or that have a
+    different value there go to \c set. Items that are in \c have but not in \c want are handled as follows: If \c del
+    is given (BBR and Flash layers), they go to \c del. Otherwise, if \c def (the Default layer) is given (RAM layer),
+    the items go to \c set with their default value, unless they already have that value. Otherwise they are ignored.
+
+    \param[in]   want     Desired configuration
+    \param[in]   nWant    Number of items in \c want
+    \param[in]   have     Current configuration (can be NULL if \c nHave is 0)
+    \param[in]   nHave    Number of items in \c have
+    \param[in]   def      Default configuration (can be NULL)
+    \param[in]   nDef     Number of items in \c def
+    \param[out]  set      Items to set (UBX-CFG-VALSET)
+    \param[in]   maxSet   Size of \c set
+    \param[out]  nSet     Number of items in \c set
+    \param[out]  del      Items to delete (UBX-CFG-VALDEL) (can be NULL)
+    \param[in]   maxDel   Size of \c del
+    \param[out]  nDel     Number of items in \c del (can be NULL if \c del is NULL)
+
+    \returns true on success, false otherwise (bad parameters, not enough space in \c set or \c del)
+*/
+bool ubxCfgDiff(const UBLOXCFG_KEYVAL_t *want, const int nWant, const UBLOXCFG_KEYVAL_t *have, const int nHave,
+    const UBLOXCFG_KEYVAL_t *def, const int nDef, UBLOXCFG_KEYVAL_t *set, const int maxSet, int *nSet,
+    uint32_t *del, const int maxDel, int *nDel);
+
 //! Get UBX message name
 /*!
     Generates a name (string) in the form "UBX-CLSID-MSGID", where CLSID and MSGID are suitable stringifications of the
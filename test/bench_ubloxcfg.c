@@ -0,0 +1,172 @@
+// u-blox 9 positioning receivers configuration library benchmark program
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+
+#include "ubloxcfg.h"
+
+#define NUMOF(array)    (sizeof(array)/sizeof(*(array)))
+
+// All items with (somewhat) realistic values, as in a UBX-CFG-VALGET response (sorted by ID)
+static UBLOXCFG_KEYVAL_t gKeyVal[2000];
+static const UBLOXCFG_ITEM_t *gItems[NUMOF(gKeyVal)];
+static int gNumKeyVal;
+static uint8_t gData[NUMOF(gKeyVal) * (4 + 8)];
+static int gDataSize;
+
+static char gStr[NUMOF(gKeyVal) * UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+static const char *gStrs[NUMOF(gKeyVal)];
+static char gValStrs[NUMOF(gKeyVal)][UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+
+static int _cmpKeyVal(const void *a, const void *b)
+{
+    const uint32_t idA = ((const UBLOXCFG_KEYVAL_t *)a)->id;
+    const uint32_t idB = ((const UBLOXCFG_KEYVAL_t *)b)->id;
+    return idA < idB ? -1 : (idA > idB ? 1 : 0);
+}
+
+static void _init(void)
+{
+    int numItems = 0;
+    const UBLOXCFG_ITEM_t **allItems = ubloxcfg_getAllItems(&numItems);
+    for (int ix = 0; (ix < numItems) && (gNumKeyVal < (int)NUMOF(gKeyVal)); ix++)
+    {
+        const UBLOXCFG_ITEM_t *item = allItems[ix];
+        UBLOXCFG_KEYVAL_t *kv = &gKeyVal[gNumKeyVal++];
+        kv->id = item->id;
+        kv->val._raw = item->nConsts > 0 ? item->consts[ix % item->nConsts].val.X : (uint64_t)ix;
+        switch (item->size)
+        {
+            case UBLOXCFG_SIZE_BIT:   kv->val._raw &= 0x01;       break;
+            case UBLOXCFG_SIZE_ONE:   kv->val._raw &= 0xff;       break;
+            case UBLOXCFG_SIZE_TWO:   kv->val._raw &= 0xffff;     break;
+            case UBLOXCFG_SIZE_FOUR:  kv->val._raw &= 0xffffffff; break;
+            case UBLOXCFG_SIZE_EIGHT:                             break;
+        }
+        if (item->type == UBLOXCFG_TYPE_R4)
+        {
+            kv->val.R4 = (float)ix / 3.0f;
+        }
+        else if (item->type == UBLOXCFG_TYPE_R8)
+        {
+            kv->val.R8 = (double)ix / 3.0;
+        }
+    }
+    qsort(gKeyVal, gNumKeyVal, sizeof(*gKeyVal), _cmpKeyVal);
+    ubloxcfg_makeData(gData, sizeof(gData), gKeyVal, gNumKeyVal, &gDataSize);
+}
+
+// Run the benchmark function for about a second, returns the time per key-value pair [ns]
+static double _bench(void (*func)(void))
+{
+    int numRuns = 0;
+    const clock_t t0 = clock();
+    clock_t t1 = t0;
+    while ((t1 - t0) < CLOCKS_PER_SEC)
+    {
+        func();
+        numRuns++;
+        t1 = clock();
+    }
+    return ((double)(t1 - t0) / (double)CLOCKS_PER_SEC) * 1e9 / (double)numRuns / (double)gNumKeyVal;
+}
+
+static void _parseData(void)
+{
+    int nKv = 0;
+    ubloxcfg_parseData(gData, gDataSize, gKeyVal, NUMOF(gKeyVal), &nKv);
+    for (int ix = 0; ix < nKv; ix++)
+    {
+        gItems[ix] = ubloxcfg_getItemById(gKeyVal[ix].id);
+    }
+}
+
+static void _parseDataItems(void)
+{
+    int nKv = 0;
+    ubloxcfg_parseDataItems(gData, gDataSize, gKeyVal, gItems, NUMOF(gKeyVal), &nKv);
+}
+
+static void _stringifyKeyVal(void)
+{
+    for (int ix = 0; ix < gNumKeyVal; ix++)
+    {
+        ubloxcfg_stringifyKeyVal(gValStrs[ix], sizeof(gValStrs[ix]), &gKeyVal[ix]);
+    }
+}
+
+static void _stringifyKeyVals(void)
+{
+    ubloxcfg_stringifyKeyVals(gStr, sizeof(gStr), gKeyVal, gItems, gNumKeyVal, gStrs);
+}
+
+static void _stringifyValue(void)
+{
+    for (int ix = 0; ix < gNumKeyVal; ix++)
+    {
+        ubloxcfg_stringifyValue(gValStrs[ix], sizeof(gValStrs[ix]), gItems[ix]->type, gItems[ix], &gKeyVal[ix].val);
+    }
+}
+
+static void _stringifyValues(void)
+{
+    ubloxcfg_stringifyValues(gStr, sizeof(gStr), gKeyVal, gItems, gNumKeyVal, gStrs);
+}
+
+static void _valueFromString(void)
+{
+    for (int ix = 0; ix < gNumKeyVal; ix++)
+    {
+        UBLOXCFG_VALUE_t value;
+        ubloxcfg_valueFromString(gValStrs[ix], gItems[ix]->type, gItems[ix], &value);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    _init();
+    _parseData();
+
+    printf("%d items, %d bytes\n", gNumKeyVal, gDataSize);
+    printf("parseData() + getItemById()     %6.1f ns/item\n", _bench(_parseData));
+    printf("parseDataItems()                %6.1f ns/item\n", _bench(_parseDataItems));
+    printf("stringifyKeyVal()               %6.1f ns/item\n", _bench(_stringifyKeyVal));
+    printf("stringifyKeyVals()              %6.1f ns/item\n", _bench(_stringifyKeyVals));
+    printf("stringifyValue()                %6.1f ns/item\n", _bench(_stringifyValue));
+    printf("stringifyValues()               %6.1f ns/item\n", _bench(_stringifyValues));
+
+    // Values as they appear in config files (pretty value where available)
+    for (int ix = 0; ix < gNumKeyVal; ix++)
+    {
+        char *valueStr;
+        char *prettyStr;
+        ubloxcfg_stringifyValue(gValStrs[ix], sizeof(gValStrs[ix]), gItems[ix]->type, gItems[ix], &gKeyVal[ix].val);
+        if (ubloxcfg_splitValueStr(gValStrs[ix], &valueStr, &prettyStr))
+        {
+            memmove(gValStrs[ix], prettyStr != NULL ? prettyStr : valueStr, strlen(prettyStr != NULL ? prettyStr : valueStr) + 1);
+        }
+    }
+    printf("valueFromString()               %6.1f ns/item\n", _bench(_valueFromString));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,295 @@
+// flipflip's epoch shared memory test program
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+
+#include "ff_stuff.h"
+#include "ff_epoch.h"
+#include "ff_epochshm.h"
+
+// Shared memory layout, see ff_epochshm.c: 64 bytes header (magic, version, slot size, ...), then the slots, each
+// starting with the sequence lock
+#define SHM_HEAD_SIZE    64
+#define SHM_MAGIC        0x48534245
+#define SHM_STRESS_NUM   200000
+
+// Assertion with result printing
+#define TEST(descr, predicate) do { numTests++; \
+        if (predicate) { numPass++; } \
+        else { numFail++; printf("%03d FAIL %s: %s [%s:%d]\n", numTests, descr, # predicate, __FILE__, __LINE__); } \
+    } while (0)
+
+static int numTests = 0;
+static int numPass = 0;
+static int numFail = 0;
+
+// Epoch with all fields we check derived from the sequence number
+static void _makeEpoch(EPOCH_t *epoch, const uint32_t seq)
+{
+    memset(epoch, 0, sizeof(*epoch));
+    epoch->valid     = true;
+    epoch->seq       = seq;
+    epoch->haveNumSv = true;
+    epoch->numSv     = seq % 100;
+    epoch->havePos   = true;
+    epoch->llh[0]    = (double)seq;
+    epoch->llh[1]    = -(double)seq;
+    epoch->llh[2]    = (double)seq * 0.5;
+    snprintf(epoch->str, sizeof(epoch->str), "epoch %u", seq);
+}
+
+static bool _checkEpoch(const EPOCH_SHM_EPOCH_t *epoch, const uint32_t seq)
+{
+    char str[sizeof(epoch->str)];
+    snprintf(str, sizeof(str), "epoch %u", epoch->seq);
+    return (epoch->seq == seq) && (epoch->numSv == (int32_t)(seq % 100)) && (epoch->llh[0] == (double)seq) &&
+        (epoch->llh[1] == -(double)seq) && (epoch->llh[2] == ((double)seq * 0.5)) && (strcmp(epoch->str, str) == 0);
+}
+
+static void _publish(EPOCH_SHM_t *shm, const uint32_t seq)
+{
+    EPOCH_t epoch;
+    _makeEpoch(&epoch, seq);
+    TEST("publish", epochShmPublish(shm, &epoch));
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+typedef struct LOCK_TEST_s
+{
+    uint32_t *lock;
+    uint32_t  holdMs;
+} LOCK_TEST_t;
+
+// Pretend to be a publisher that takes a while to update a slot
+static void *_lockThread(void *arg)
+{
+    LOCK_TEST_t *test = (LOCK_TEST_t *)arg;
+    usleep(test->holdMs * 1000);
+    __atomic_store_n(test->lock, *test->lock + 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void _testBasic(const char *name)
+{
+    EPOCH_SHM_t *pub = epochShmCreate(name, 4);
+    TEST("create", pub != NULL);
+    if (pub == NULL)
+    {
+        return;
+    }
+    TEST("create in use", epochShmCreate(name, 4) == NULL);
+
+    EPOCH_SHM_t *sub = epochShmOpen(name);
+    TEST("open", sub != NULL);
+    if (sub == NULL)
+    {
+        epochShmClose(pub);
+        return;
+    }
+    TEST("alive", epochShmIsAlive(sub));
+    EPOCH_SHM_EPOCH_t epoch;
+    uint64_t cursor = 0;
+    uint32_t nLost = 0;
+    TEST("empty", !epochShmGetLatest(sub, &epoch) && !epochShmGetNext(sub, &cursor, &epoch, &nLost));
+
+    // Publish a few, get them in order
+    for (uint32_t seq = 1; seq <= 3; seq++)
+    {
+        _publish(pub, seq);
+    }
+    for (uint32_t seq = 1; seq <= 3; seq++)
+    {
+        TEST("next", epochShmGetNext(sub, &cursor, &epoch, &nLost) && _checkEpoch(&epoch, seq) && (nLost == 0));
+    }
+    TEST("next", !epochShmGetNext(sub, &cursor, &epoch, &nLost));
+    TEST("latest", epochShmGetLatest(sub, &epoch) && _checkEpoch(&epoch, 3));
+
+    // Publish more than there are slots, the oldest are lost. The slot the publisher writes next is not available.
+    for (uint32_t seq = 4; seq <= 13; seq++)
+    {
+        _publish(pub, seq);
+    }
+    TEST("lost", epochShmGetNext(sub, &cursor, &epoch, &nLost) && _checkEpoch(&epoch, 11) && (nLost == 7));
+    TEST("lost", epochShmGetNext(sub, &cursor, &epoch, &nLost) && _checkEpoch(&epoch, 12) && (nLost == 0));
+
+    // Torn read: while a slot is locked (odd sequence) readers don't get it. They retry until the publisher is done.
+    const int fd = shm_open(name, O_RDWR, 0);
+    uint8_t *mem = fd >= 0 ? mmap(NULL, SHM_HEAD_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    TEST("torn", mem != MAP_FAILED);
+    if (mem != MAP_FAILED)
+    {
+        uint32_t head[3];
+        memcpy(head, mem, sizeof(head));
+        TEST("torn layout", (head[0] == SHM_MAGIC) && (head[2] > 0));
+        uint8_t *slots = mmap(NULL, SHM_HEAD_SIZE + (4 * head[2]), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if ( (head[0] == SHM_MAGIC) && (slots != MAP_FAILED) )
+        {
+            // Latest epoch (seq 13, index 12) is in slot 0
+            LOCK_TEST_t test = { .lock = (uint32_t *)&slots[SHM_HEAD_SIZE], .holdMs = 50 };
+            __atomic_store_n(test.lock, *test.lock + 1, __ATOMIC_RELEASE);
+            TEST("torn locked", !epochShmGetLatest(sub, &epoch));
+            pthread_t thread;
+            TEST("torn", pthread_create(&thread, NULL, _lockThread, &test) == 0);
+            const uint64_t t0 = TIME_NS();
+            int nRetries = 0;
+            while (!epochShmGetLatest(sub, &epoch) && ((TIME_NS() - t0) < 1000000000))
+            {
+                nRetries++;
+            }
+            pthread_join(thread, NULL);
+            const double dt = (double)(TIME_NS() - t0) * 1e-6;
+            TEST("torn retry", (nRetries > 0) && (dt >= 45.0) && (dt < 1000.0) && _checkEpoch(&epoch, 13));
+            TEST("torn next", epochShmGetNext(sub, &cursor, &epoch, &nLost) && _checkEpoch(&epoch, 13));
+            munmap(slots, SHM_HEAD_SIZE + (4 * head[2]));
+        }
+        munmap(mem, SHM_HEAD_SIZE);
+    }
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    // Publisher gone
+    epochShmClose(pub);
+    TEST("closed", !epochShmIsAlive(sub));
+    epochShmClose(sub);
+    TEST("closed", epochShmOpen(name) == NULL);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+static void *_publishThread(void *arg)
+{
+    EPOCH_SHM_t *shm = (EPOCH_SHM_t *)arg;
+    for (uint32_t seq = 1; seq <= SHM_STRESS_NUM; seq++)
+    {
+        EPOCH_t epoch;
+        _makeEpoch(&epoch, seq);
+        epochShmPublish(shm, &epoch);
+        sched_yield();
+    }
+    return NULL;
+}
+
+// Publisher as fast as possible into two slots, the reader must never get a torn epoch
+static void _testStress(const char *name)
+{
+    EPOCH_SHM_t *pub = epochShmCreate(name, 2);
+    EPOCH_SHM_t *sub = epochShmOpen(name);
+    TEST("stress", (pub != NULL) && (sub != NULL));
+    if ( (pub == NULL) || (sub == NULL) )
+    {
+        epochShmClose(pub);
+        epochShmClose(sub);
+        return;
+    }
+    pthread_t thread;
+    TEST("stress", pthread_create(&thread, NULL, _publishThread, pub) == 0);
+
+    uint64_t cursor = 0;
+    uint32_t nRead = 0;
+    uint32_t nBad = 0;
+    uint32_t nLostTotal = 0;
+    uint32_t lastSeq = 0;
+    while (lastSeq < SHM_STRESS_NUM)
+    {
+        EPOCH_SHM_EPOCH_t epoch;
+        uint32_t nLost = 0;
+        if (epochShmGetNext(sub, &cursor, &epoch, &nLost))
+        {
+            // The first one is the oldest available, the ones before are not reported as lost
+            if (nRead == 0)
+            {
+                nLost = epoch.seq - 1;
+            }
+            if (!_checkEpoch(&epoch, epoch.seq) || (epoch.seq != (lastSeq + 1 + nLost)))
+            {
+                nBad++;
+            }
+            lastSeq = epoch.seq;
+            nLostTotal += nLost;
+            nRead++;
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+    pthread_join(thread, NULL);
+    TEST("stress", nBad == 0);
+    TEST("stress", (nRead + nLostTotal) == SHM_STRESS_NUM);
+    printf("stress: read %u, lost %u, bad %u\n", nRead, nLostTotal, nBad);
+
+    epochShmClose(pub);
+    epochShmClose(sub);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Publisher that crashed, i.e. did not remove the shared memory
+static void _testStale(const char *name)
+{
+    const pid_t pid = fork();
+    if (pid == 0)
+    {
+        EPOCH_SHM_t *shm = epochShmCreate(name, 4);
+        _exit(shm != NULL ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+    int status = -1;
+    TEST("stale", (pid > 0) && (waitpid(pid, &status, 0) == pid) && WIFEXITED(status) &&
+        (WEXITSTATUS(status) == EXIT_SUCCESS));
+
+    EPOCH_SHM_t *sub = epochShmOpen(name);
+    TEST("stale", (sub != NULL) && !epochShmIsAlive(sub));
+    EPOCH_SHM_t *pub = epochShmCreate(name, 4);
+    TEST("stale replaced", pub != NULL);
+    EPOCH_SHM_t *sub2 = epochShmOpen(name);
+    TEST("stale replaced", (sub2 != NULL) && epochShmIsAlive(sub2));
+    TEST("stale", !epochShmIsAlive(sub));
+    epochShmClose(sub);
+    epochShmClose(sub2);
+    epochShmClose(pub);
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    char name[100];
+    snprintf(name, sizeof(name), "/ff_test_epochshm_%d", (int)getpid());
+
+    _testBasic(name);
+    _testStress(name);
+    _testStale(name);
+
+    shm_unlink(name);
+
+    printf("%d tests: %d passed, %d failed\n", numTests, numPass, numFail);
+    return numFail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,182 @@
+// flipflip's logfile index test program
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// Usage: test_logindex [<dir>], writes the test logfiles (weekless.ubx, week.ubx) and their indexes to <dir>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "ff_ubx.h"
+#include "ff_parser.h"
+#include "ff_epoch.h"
+#include "ff_logindex.h"
+
+#define TEST_EPOCHS   100
+#define TEST_TOW0_MS  345600000
+#define TEST_WEEK     2149
+
+// Assertion with result printing
+#define TEST(descr, predicate) do { numTests++; \
+        if (predicate) { numPass++; } \
+        else { numFail++; printf("%03d FAIL %s: %s [%s:%d]\n", numTests, descr, # predicate, __FILE__, __LINE__); } \
+    } while (0)
+
+static int numTests = 0;
+static int numPass = 0;
+static int numFail = 0;
+
+// Make a 1 Hz log of UBX-NAV-PVT (time of week only), optionally UBX-NAV-TIMEGPS (week), and UBX-NAV-EOE
+static bool _makeLog(const char *file, const bool week)
+{
+    FILE *fh = fopen(file, "wb");
+    if (fh == NULL)
+    {
+        return false;
+    }
+    uint8_t msg[UBX_FRAME_SIZE + sizeof(UBX_NAV_PVT_V1_GROUP0_t)];
+    for (int ix = 0; ix < TEST_EPOCHS; ix++)
+    {
+        const uint32_t iTow = TEST_TOW0_MS + (ix * 1000);
+        UBX_NAV_PVT_V1_GROUP0_t pvt;
+        memset(&pvt, 0, sizeof(pvt));
+        pvt.iTOW    = iTow;
+        pvt.year    = 2021;
+        pvt.month   = 3;
+        pvt.day     = 17;
+        pvt.hour    = (iTow / 3600000) % 24;
+        pvt.min     = (iTow / 60000) % 60;
+        pvt.sec     = (iTow / 1000) % 60;
+        pvt.valid   = 0x07;
+        pvt.fixType = 3;
+        pvt.flags   = 0x01;
+        pvt.numSV   = 12;
+        int size = ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_PVT_MSGID, (const uint8_t *)&pvt, sizeof(pvt), msg);
+        fwrite(msg, size, 1, fh);
+        if (week)
+        {
+            UBX_NAV_TIMEGPS_V0_GROUP0_t time;
+            memset(&time, 0, sizeof(time));
+            time.iTow  = iTow;
+            time.week  = TEST_WEEK;
+            time.leapS = 18;
+            time.valid = 0x07;
+            size = ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_TIMEGPS_MSGID, (const uint8_t *)&time, sizeof(time), msg);
+            fwrite(msg, size, 1, fh);
+        }
+        size = ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_EOE_MSGID, (const uint8_t *)&iTow, sizeof(iTow), msg);
+        fwrite(msg, size, 1, fh);
+    }
+    return fclose(fh) == 0;
+}
+
+// Same as the 'index' command
+static bool _makeIndex(const char *file, const char *idxFile)
+{
+    FILE *fh = fopen(file, "rb");
+    LOG_INDEX_WRITER_t *writer = logIndexCreate(idxFile, true);
+    bool res = (fh != NULL) && (writer != NULL);
+    PARSER_t parser;
+    EPOCH_t coll;
+    EPOCH_t epoch;
+    parserInit(&parser);
+    epochInit(&coll);
+    uint8_t buf[1000];
+    int num;
+    while (res && ((num = fread(buf, 1, sizeof(buf), fh)) > 0))
+    {
+        parserAdd(&parser, buf, num);
+        PARSER_MSG_t msg;
+        while (res && parserProcess(&parser, &msg, false))
+        {
+            const bool haveEpoch = epochCollect(&coll, &msg, &epoch);
+            res = logIndexAdd(writer, &msg, haveEpoch ? &epoch : NULL);
+        }
+    }
+    if (fh != NULL)
+    {
+        fclose(fh);
+    }
+    return logIndexFinish(writer, NULL, NULL) && res;
+}
+
+static void _testLog(const char *dir, const bool week)
+{
+    char file[1000];
+    char idxFile[1010];
+    snprintf(file, sizeof(file), "%s/%s.ubx", dir, week ? "week" : "weekless");
+    snprintf(idxFile, sizeof(idxFile), "%s.idx", file);
+    const char *descr = week ? "week" : "weekless";
+
+    TEST(descr, _makeLog(file, week));
+    TEST(descr, _makeIndex(file, idxFile));
+    LOG_INDEX_t *idx = logIndexOpen(idxFile, file);
+    TEST(descr, idx != NULL);
+    if (idx == NULL)
+    {
+        return;
+    }
+    TEST(descr, idx->nEpochs == TEST_EPOCHS);
+    TEST(descr, idx->nMsgs == (uint32_t)(TEST_EPOCHS * (week ? 3 : 2)));
+
+    const uint8_t flags = week ? (LOG_INDEX_FLAG_TIME | LOG_INDEX_FLAG_TOW) : LOG_INDEX_FLAG_TOW;
+    bool flagsOk = true;
+    bool towOk = true;
+    for (uint32_t ix = 0; ix < idx->nEpochs; ix++)
+    {
+        flagsOk = flagsOk && (idx->epochs[ix].flags == flags);
+        towOk = towOk && (idx->epochs[ix].gpsTowMs == (TEST_TOW0_MS + (ix * 1000)));
+    }
+    TEST(descr, flagsOk);
+    TEST(descr, towOk);
+
+    // Search by time of week works in both cases
+    int ix = logIndexFindTime(idx, -1, TEST_TOW0_MS + 10000);
+    TEST(descr, (ix == 10) && (idx->epochs[ix].gpsTowMs == (TEST_TOW0_MS + 10000)));
+    ix = logIndexFindTime(idx, -1, TEST_TOW0_MS + 10500);
+    TEST(descr, ix == 11);
+    ix = logIndexFindTime(idx, -1, TEST_TOW0_MS + (TEST_EPOCHS * 1000));
+    TEST(descr, ix == -1);
+
+    // Search by week and time of week only with week
+    ix = logIndexFindTime(idx, TEST_WEEK, TEST_TOW0_MS + 10000);
+    TEST(descr, week ? (ix == 10) : (ix == -1));
+
+    // Messages carry the epoch's time
+    LOG_INDEX_MSG_t msgs[3];
+    const int nMsgs = logIndexGetMsgs(idx, idx->epochs[10].msgIx, msgs, week ? 3 : 2);
+    TEST(descr, nMsgs == (week ? 3 : 2));
+    for (int msgIx = 0; msgIx < nMsgs; msgIx++)
+    {
+        TEST(descr, (msgs[msgIx].flags == flags) && (msgs[msgIx].gpsTowMs == (TEST_TOW0_MS + 10000)) &&
+            (msgs[msgIx].epoch == idx->epochs[10].epoch));
+    }
+
+    logIndexClose(idx);
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 1 ? argv[1] : ".";
+
+    _testLog(dir, false);
+    _testLog(dir, true);
+
+    printf("%d tests: %d passed, %d failed\n", numTests, numPass, numFail);
+    return numFail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
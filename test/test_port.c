@@ -0,0 +1,190 @@
+// flipflip's port library test program
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// Usage: test_port [<dir>], writes the test logfile (replay.ubx) to <dir>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "ff_stuff.h"
+#include "ff_ubx.h"
+#include "ff_port.h"
+
+#define TEST_EPOCHS   10
+#define TEST_RATE_MS  100
+#define TEST_TOW0_MS  345600000
+
+// Assertion with result printing
+#define TEST(descr, predicate) do { numTests++; \
+        if (predicate) { numPass++; } \
+        else { numFail++; printf("%03d FAIL %s: %s [%s:%d]\n", numTests, descr, # predicate, __FILE__, __LINE__); } \
+    } while (0)
+
+static int numTests = 0;
+static int numPass = 0;
+static int numFail = 0;
+
+// Make a 10 Hz log of UBX-NAV-HPPOSLLH (iTOW at offset 4) and UBX-NAV-PVT (iTOW at offset 0)
+static int _makeLog(const char *file)
+{
+    FILE *fh = fopen(file, "wb");
+    if (fh == NULL)
+    {
+        return 0;
+    }
+    int logSize = 0;
+    uint8_t msg[UBX_FRAME_SIZE + sizeof(UBX_NAV_PVT_V1_GROUP0_t)];
+    for (int ix = 0; ix < TEST_EPOCHS; ix++)
+    {
+        const uint32_t iTow = TEST_TOW0_MS + (ix * TEST_RATE_MS);
+        UBX_NAV_HPPOSLLH_V0_GROUP0_t hpposllh;
+        memset(&hpposllh, 0, sizeof(hpposllh));
+        hpposllh.iTOW = iTow;
+        int size = ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_HPPOSLLH_MSGID,
+            (const uint8_t *)&hpposllh, sizeof(hpposllh), msg);
+        fwrite(msg, size, 1, fh);
+        logSize += size;
+        UBX_NAV_PVT_V1_GROUP0_t pvt;
+        memset(&pvt, 0, sizeof(pvt));
+        pvt.iTOW = iTow;
+        size = ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_PVT_MSGID, (const uint8_t *)&pvt, sizeof(pvt), msg);
+        fwrite(msg, size, 1, fh);
+        logSize += size;
+    }
+    return fclose(fh) == 0 ? logSize : 0;
+}
+
+// Replay the log, returns the number of bytes read, and the time it took [ms]
+static int _replay(const char *file, const char *speed, double *dt)
+{
+    char spec[PORT_SPEC_MAX_LEN];
+    snprintf(spec, sizeof(spec), "file://%s%s", file, speed);
+    PORT_t port;
+    if (!portInit(&port, spec) || !portOpen(&port))
+    {
+        return -1;
+    }
+    int total = 0;
+    const uint64_t t0 = TIME_NS();
+    while (true)
+    {
+        uint8_t buf[1000];
+        int num = 0;
+        if (!portRead(&port, buf, sizeof(buf), &num))
+        {
+            break;
+        }
+        total += num;
+        if (num == 0)
+        {
+            usleep(1000);
+        }
+    }
+    *dt = (double)(TIME_NS() - t0) * 1e-6;
+
+    TEST(speed, port.eof);
+
+    portClose(&port);
+    return total;
+}
+
+// Read the log in small chunks, so that the read log wraps around
+static void _testReadLog(const char *file, const int logSize)
+{
+    char spec[PORT_SPEC_MAX_LEN];
+    PORT_t port;
+    if ( (snprintf(spec, sizeof(spec), "file://%s@max", file) >= (int)sizeof(spec)) ||
+         !portInit(&port, spec) || !portOpen(&port) )
+    {
+        TEST("readlog open", false);
+        return;
+    }
+    int sizes[1000];
+    int nReads = 0;
+    int total = 0;
+    while (nReads < NUMOF(sizes))
+    {
+        uint8_t buf[10];
+        int num = 0;
+        if (!portRead(&port, buf, sizeof(buf), &num))
+        {
+            break;
+        }
+        if (num > 0)
+        {
+            sizes[nReads++] = num;
+            total += num;
+        }
+    }
+    TEST("readlog reads", (total == logSize) && (port.numReads == (uint32_t)nReads) && (nReads > PORT_READ_LOG_SIZE));
+
+    // Most recent reads, oldest first
+    PORT_READ_t reads[PORT_READ_LOG_SIZE + 1];
+    const int num = portGetReadLog(&port, reads, NUMOF(reads));
+    TEST("readlog num", num == PORT_READ_LOG_SIZE);
+    bool ok = true;
+    for (int ix = 0; ok && (ix < num); ix++)
+    {
+        ok = (reads[ix].size == sizes[nReads - num + ix]) && ((ix == 0) || (reads[ix].ts >= reads[ix - 1].ts));
+    }
+    TEST("readlog order", ok);
+    TEST("readlog last", (num > 0) && (reads[num - 1].ts == port.readTs));
+
+    // Fewer than available
+    PORT_READ_t last[3];
+    TEST("readlog maxNum", (portGetReadLog(&port, last, NUMOF(last)) == NUMOF(last)) &&
+        (memcmp(last, &reads[num - NUMOF(last)], sizeof(last)) == 0));
+
+    // Bad parameters
+    TEST("readlog bad", portGetReadLog(&port, reads, 0) == 0);
+    TEST("readlog bad", portGetReadLog(&port, NULL, NUMOF(reads)) == 0);
+    TEST("readlog bad", portGetReadLog(NULL, reads, NUMOF(reads)) == 0);
+
+    portClose(&port);
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 1 ? argv[1] : ".";
+    char file[1000];
+    snprintf(file, sizeof(file), "%s/replay.ubx", dir);
+
+    const int logSize = _makeLog(file);
+    TEST("log", logSize > 0);
+
+    // Log spans 900 ms, as fast as possible takes (almost) no time
+    double dt = 0.0;
+    TEST("@max", _replay(file, "@max", &dt) == logSize);
+    TEST("@max", dt < 100.0);
+
+    // At 2x speed it should take 450 ms, UBX-NAV-HPPOSLLH must not restart the timing
+    const double dtExp = (double)((TEST_EPOCHS - 1) * TEST_RATE_MS) / 2.0;
+    TEST("@2", _replay(file, "@2", &dt) == logSize);
+    TEST("@2", (dt > (dtExp - 20.0)) && (dt < (dtExp + 200.0)));
+    if ( (dt <= (dtExp - 20.0)) || (dt >= (dtExp + 200.0)) )
+    {
+        printf("replay @2 took %.1fms, expected %.1fms\n", dt, dtExp);
+    }
+
+    _testReadLog(file, logSize);
+
+    printf("%d tests: %d passed, %d failed\n", numTests, numPass, numFail);
+    return numFail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
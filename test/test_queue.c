@@ -0,0 +1,279 @@
+// u-blox 9 positioning receivers configuration tool: queue test program
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+
+#include "cfgtool_queue.h"
+
+// Assertion with result printing
+#define TEST(descr, predicate) do { numTests++; \
+        if (predicate) { numPass++; } \
+        else { numFail++; printf("%03d FAIL %s: %s [%s:%d]\n", numTests, descr, # predicate, __FILE__, __LINE__); } \
+    } while (0)
+
+static int numTests = 0;
+static int numPass = 0;
+static int numFail = 0;
+
+// Entry content: sequence number, followed by a pattern depending on it
+static int _entrySize(const uint32_t seq)
+{
+    return sizeof(seq) + ((seq * 7919) % 300);
+}
+
+static void _entryFill(uint8_t *entry, const uint32_t seq)
+{
+    memcpy(entry, &seq, sizeof(seq));
+    const int size = _entrySize(seq);
+    for (int ix = sizeof(seq); ix < size; ix++)
+    {
+        entry[ix] = (uint8_t)(seq + ix);
+    }
+}
+
+static bool _entryCheck(const uint8_t *entry, const int size, uint32_t *seq)
+{
+    if (size < (int)sizeof(*seq))
+    {
+        return false;
+    }
+    memcpy(seq, entry, sizeof(*seq));
+    if (size != _entrySize(*seq))
+    {
+        return false;
+    }
+    for (int ix = sizeof(*seq); ix < size; ix++)
+    {
+        if (entry[ix] != (uint8_t)(*seq + ix))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void _testSingle(void)
+{
+    QUEUE_t *queue = queueCreate(1000);
+    TEST("create", queue != NULL);
+    if (queue == NULL)
+    {
+        return;
+    }
+    QUEUE_STATS_t stats;
+    queueGetStats(queue, &stats);
+    TEST("size", stats.size == 1024);
+
+    // Empty
+    int size = -1;
+    TEST("empty", queuePopBegin(queue, &size) == NULL);
+
+    // Too large
+    TEST("too large", queuePushBegin(queue, 600) == NULL);
+
+    // Fill with 100 bytes entries (112 bytes in the ring buffer, incl. header and alignment)
+    int nPushed = 0;
+    uint8_t *entry;
+    while ( (entry = queuePushBegin(queue, 100)) != NULL )
+    {
+        memset(entry, nPushed, 100);
+        queuePushEnd(queue);
+        nPushed++;
+    }
+    TEST("full", nPushed == (1024 / 112));
+    queueDrop(queue, 100);
+    queueDrop(queue, 50);
+    queueGetStats(queue, &stats);
+    TEST("stats", (stats.nPushed == (uint32_t)nPushed) && (stats.maxFill == (uint32_t)(nPushed * 112)));
+    TEST("stats drop", (stats.nDropped == 2) && (stats.sDropped == 150));
+
+    // Empty it
+    int nPopped = 0;
+    const uint8_t *pop;
+    bool popOk = true;
+    while ( (pop = queuePopBegin(queue, &size)) != NULL )
+    {
+        popOk = popOk && (size == 100) && (pop[0] == nPopped) && (pop[99] == nPopped);
+        queuePopEnd(queue);
+        nPopped++;
+    }
+    TEST("pop", popOk && (nPopped == nPushed));
+
+    // The ring buffer is now at 1008, an entry of 400 bytes (408) doesn't fit at the end: padding, then at the beginning
+    entry = queuePushBegin(queue, 400);
+    TEST("wrap", entry != NULL);
+    if (entry != NULL)
+    {
+        memset(entry, 0x55, 400);
+        queuePushEnd(queue);
+        pop = queuePopBegin(queue, &size);
+        TEST("wrap", (pop == entry) && (size == 400) && (pop[0] == 0x55) && (pop[399] == 0x55));
+        queuePopEnd(queue);
+    }
+    TEST("wrap empty", queuePopBegin(queue, &size) == NULL);
+
+    // Now at 408: another 400 bytes entry fits, and the next one with padding (208) as well, which fills the queue
+    entry = queuePushBegin(queue, 400);
+    TEST("wrap full", entry != NULL);
+    if (entry != NULL)
+    {
+        memset(entry, 0x11, 400);
+        queuePushEnd(queue);
+    }
+    entry = queuePushBegin(queue, 400);
+    TEST("wrap full", entry != NULL);
+    if (entry != NULL)
+    {
+        memset(entry, 0x22, 400);
+        queuePushEnd(queue);
+    }
+    TEST("wrap full", queuePushBegin(queue, 0) == NULL);
+    queueGetStats(queue, &stats);
+    TEST("wrap full", stats.maxFill == stats.size);
+    pop = queuePopBegin(queue, &size);
+    TEST("wrap full", (pop != NULL) && (size == 400) && (pop[0] == 0x11) && (pop[399] == 0x11));
+    queuePopEnd(queue);
+    pop = queuePopBegin(queue, &size);
+    TEST("wrap full", (pop != NULL) && (size == 400) && (pop[0] == 0x22) && (pop[399] == 0x22));
+    queuePopEnd(queue);
+    TEST("wrap full", queuePopBegin(queue, &size) == NULL);
+
+    queueDestroy(queue);
+}
+
+#define NUM_ENTRIES 200000
+
+typedef struct THREAD_TEST_s
+{
+    QUEUE_t *queue;
+    bool     drop;
+    uint32_t nDropped;
+} THREAD_TEST_t;
+
+static void *_producer(void *arg)
+{
+    THREAD_TEST_t *test = (THREAD_TEST_t *)arg;
+    for (uint32_t seq = 0; seq < NUM_ENTRIES; seq++)
+    {
+        const int size = _entrySize(seq);
+        uint8_t *entry;
+        while ( (entry = queuePushBegin(test->queue, size)) == NULL )
+        {
+            if (test->drop)
+            {
+                queueDrop(test->queue, size);
+                test->nDropped++;
+                sched_yield(); // give the consumer a chance, so that we get both drops and wraparounds
+                break;
+            }
+            sched_yield();
+        }
+        if (entry != NULL)
+        {
+            _entryFill(entry, seq);
+            queuePushEnd(test->queue);
+        }
+    }
+    // End marker
+    while (queuePushBegin(test->queue, 0) == NULL)
+    {
+        sched_yield();
+    }
+    queuePushEnd(test->queue);
+    return NULL;
+}
+
+static void _testThreads(const bool drop)
+{
+    const char *descr = drop ? "threads drop" : "threads";
+    THREAD_TEST_t test = { .queue = queueCreate(4096), .drop = drop, .nDropped = 0 };
+    TEST(descr, test.queue != NULL);
+    if (test.queue == NULL)
+    {
+        return;
+    }
+    pthread_t thread;
+    TEST(descr, pthread_create(&thread, NULL, _producer, &test) == 0);
+
+    // Consume until end marker, check integrity and order of entries
+    uint32_t nReceived = 0;
+    uint32_t nBad = 0;
+    uint32_t nUnordered = 0;
+    uint32_t nextSeq = 0;
+    while (true)
+    {
+        int size = 0;
+        const uint8_t *entry = queuePopBegin(test.queue, &size);
+        if (entry == NULL)
+        {
+            sched_yield();
+            continue;
+        }
+        if (size == 0)
+        {
+            queuePopEnd(test.queue);
+            break;
+        }
+        uint32_t seq = 0;
+        if (!_entryCheck(entry, size, &seq))
+        {
+            nBad++;
+        }
+        else if ( (drop && (seq < nextSeq)) || (!drop && (seq != nextSeq)) )
+        {
+            nUnordered++;
+        }
+        nextSeq = seq + 1;
+        nReceived++;
+        queuePopEnd(test.queue);
+    }
+    pthread_join(thread, NULL);
+
+    QUEUE_STATS_t stats;
+    queueGetStats(test.queue, &stats);
+    TEST(descr, nBad == 0);
+    TEST(descr, nUnordered == 0);
+    TEST(descr, (nReceived + test.nDropped) == NUM_ENTRIES);
+    TEST(descr, stats.nPushed == (nReceived + 1));
+    TEST(descr, stats.nDropped == test.nDropped);
+    TEST(descr, stats.maxFill <= stats.size);
+    if (!drop)
+    {
+        TEST(descr, nReceived == NUM_ENTRIES);
+    }
+    printf("%s: received %u, dropped %u, max fill %u/%u\n", descr, nReceived, test.nDropped, stats.maxFill, stats.size);
+
+    queueDestroy(test.queue);
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    _testSingle();
+    _testThreads(false);
+    _testThreads(true);
+
+    printf("%d tests: %d passed, %d failed\n", numTests, numPass, numFail);
+    return numFail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
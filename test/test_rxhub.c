@@ -0,0 +1,213 @@
+// flipflip's receiver hub test program
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+#include "ff_stuff.h"
+#include "ff_ubx.h"
+#include "ff_port.h"
+#include "ff_rxhub.h"
+
+#define TEST_MSGS 100
+
+// Assertion with result printing
+#define TEST(descr, predicate) do { numTests++; \
+        if (predicate) { numPass++; } \
+        else { numFail++; printf("%03d FAIL %s: %s [%s:%d]\n", numTests, descr, # predicate, __FILE__, __LINE__); } \
+    } while (0)
+
+static int numTests = 0;
+static int numPass = 0;
+static int numFail = 0;
+
+// Consumer, checks that it gets all messages of the source in order
+typedef struct CONSUMER_s
+{
+    PORT_t   port;
+    int      fd;      // Our (server) end of the connection
+    uint32_t nMsgs;
+    uint32_t nBad;
+    bool     failed;
+} CONSUMER_t;
+
+static void _msgCb(PARSER_MSG_t *msg, void *arg)
+{
+    CONSUMER_t *cons = (CONSUMER_t *)arg;
+    if (msg == NULL)
+    {
+        cons->failed = true;
+        return;
+    }
+    UBX_NAV_PVT_V1_GROUP0_t pvt;
+    memcpy(&pvt, &msg->data[UBX_HEAD_SIZE], sizeof(pvt));
+    if ( (msg->size != (int)(UBX_FRAME_SIZE + sizeof(pvt))) || (strcmp(msg->name, "UBX-NAV-PVT") != 0) ||
+         (pvt.iTOW != cons->nMsgs) || (msg->seq != (cons->nMsgs + 1)) )
+    {
+        cons->nBad++;
+    }
+    cons->nMsgs++;
+}
+
+// Run the hub until all consumers have the expected number of messages (or timeout)
+static void _runHub(RX_HUB_t *hub, CONSUMER_t *cons, const int nCons, const uint32_t nMsgs)
+{
+    const uint64_t t0 = TIME_NS();
+    while ((TIME_NS() - t0) < 2000000000)
+    {
+        bool done = true;
+        for (int ix = 0; ix < nCons; ix++)
+        {
+            done = done && (cons[ix].failed || (cons[ix].nMsgs >= nMsgs));
+        }
+        if (done)
+        {
+            break;
+        }
+        rxHubRun(hub, 100);
+    }
+}
+
+// Source, the same data goes to all consumers
+static void _send(CONSUMER_t *cons, const int nCons, const uint8_t *data, const int size)
+{
+    for (int ix = 0; ix < nCons; ix++)
+    {
+        if (!cons[ix].failed && (cons[ix].fd >= 0))
+        {
+            TEST("send", write(cons[ix].fd, data, size) == size);
+        }
+    }
+}
+
+static void *_abortThread(void *arg)
+{
+    usleep(100000);
+    rxHubAbort((RX_HUB_t *)arg);
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    // Source: TCP/IP server on some free port
+    const int srv = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    socklen_t addrLen = sizeof(addr);
+    TEST("server", (srv >= 0) && (bind(srv, (struct sockaddr *)&addr, sizeof(addr)) == 0) && (listen(srv, 5) == 0) &&
+        (getsockname(srv, (struct sockaddr *)&addr, &addrLen) == 0));
+
+    // Three consumers, connected to the source
+    CONSUMER_t cons[3];
+    memset(cons, 0, sizeof(cons));
+    RX_HUB_t *hub = rxHubInit("test");
+    TEST("hub", hub != NULL);
+    for (int ix = 0; ix < (int)NUMOF(cons); ix++)
+    {
+        char spec[100];
+        snprintf(spec, sizeof(spec), "tcp://127.0.0.1:%u", ntohs(addr.sin_port));
+        TEST("port", portInit(&cons[ix].port, spec) && portOpen(&cons[ix].port));
+        cons[ix].fd = accept(srv, NULL, NULL);
+        TEST("port", cons[ix].fd >= 0);
+        TEST("add", rxHubAddPort(hub, &cons[ix].port, _msgCb, &cons[ix]));
+    }
+    RX_HUB_STATS_t stats;
+    TEST("stats", rxHubGetStats(hub, &stats) && (stats.nPorts == 3) && (stats.nParsers == 0));
+
+    // Messages
+    uint8_t data[TEST_MSGS][UBX_FRAME_SIZE + sizeof(UBX_NAV_PVT_V1_GROUP0_t)];
+    for (uint32_t ix = 0; ix < TEST_MSGS; ix++)
+    {
+        UBX_NAV_PVT_V1_GROUP0_t pvt;
+        memset(&pvt, 0, sizeof(pvt));
+        pvt.iTOW = ix;
+        ubxMakeMessage(UBX_NAV_CLSID, UBX_NAV_PVT_MSGID, (const uint8_t *)&pvt, sizeof(pvt), data[ix]);
+    }
+    const int msgSize = sizeof(data[0]);
+
+    // Half a message: all consumers have a parser with pending data
+    _send(cons, NUMOF(cons), data[0], msgSize / 2);
+    for (int ix = 0; ix < 10; ix++)
+    {
+        rxHubRun(hub, 10);
+    }
+    TEST("pending", rxHubGetStats(hub, &stats) && (stats.nParsers == 3) && (stats.nParsersUsed == 3));
+    TEST("pending", (cons[0].nMsgs == 0) && (cons[1].nMsgs == 0) && (cons[2].nMsgs == 0));
+
+    // Rest of the message, and more messages: all consumers get all of them, parsers go back to the pool
+    _send(cons, NUMOF(cons), &data[0][msgSize / 2], msgSize - (msgSize / 2));
+    _send(cons, NUMOF(cons), data[1], (TEST_MSGS / 2 - 1) * msgSize);
+    _runHub(hub, cons, NUMOF(cons), TEST_MSGS / 2);
+    for (int ix = 0; ix < (int)NUMOF(cons); ix++)
+    {
+        TEST("messages", (cons[ix].nMsgs == (TEST_MSGS / 2)) && (cons[ix].nBad == 0) && !cons[ix].failed);
+    }
+    TEST("pool", rxHubGetStats(hub, &stats) && (stats.nParsersUsed == 0) && (stats.nParsers <= 3));
+    TEST("pool", (stats.nMsgs == (3 * TEST_MSGS / 2)) && (stats.nBytes == (uint32_t)(3 * (TEST_MSGS / 2) * msgSize)));
+
+    // Source drops the first consumer, the others continue
+    close(cons[0].fd);
+    cons[0].fd = -1;
+    _send(cons, NUMOF(cons), data[TEST_MSGS / 2], (TEST_MSGS / 2) * msgSize);
+    _runHub(hub, cons, NUMOF(cons), TEST_MSGS);
+    TEST("remove", cons[0].failed && (cons[0].nMsgs == (TEST_MSGS / 2)));
+    TEST("remove", rxHubGetStats(hub, &stats) && (stats.nPorts == 2));
+    for (int ix = 1; ix < (int)NUMOF(cons); ix++)
+    {
+        TEST("messages", (cons[ix].nMsgs == TEST_MSGS) && (cons[ix].nBad == 0) && !cons[ix].failed);
+    }
+
+    // Abort loop from another thread
+    pthread_t thread;
+    TEST("abort", pthread_create(&thread, NULL, _abortThread, hub) == 0);
+    const uint64_t t0 = TIME_NS();
+    rxHubLoop(hub);
+    TEST("abort", (TIME_NS() - t0) < 1000000000);
+    pthread_join(thread, NULL);
+
+    // Remove ports
+    TEST("remove", !rxHubRemovePort(hub, &cons[0].port));
+    TEST("remove", rxHubRemovePort(hub, &cons[1].port));
+    TEST("remove", rxHubGetStats(hub, &stats) && (stats.nPorts == 1));
+    rxHubDestroy(hub);
+    for (int ix = 0; ix < (int)NUMOF(cons); ix++)
+    {
+        portClose(&cons[ix].port);
+        if (cons[ix].fd >= 0)
+        {
+            close(cons[ix].fd);
+        }
+    }
+    close(srv);
+
+    printf("%d tests: %d passed, %d failed\n", numTests, numPass, numFail);
+    return numFail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -126,6 +126,44 @@ int main(int argc, char **argv)
         TEST("lookup item by ID", (fail == NULL));
     }
 
+    // Lookup all items and message rate configs (binary search in the generated lookup tables)
+    {
+        int numItems = 0;
+        const UBLOXCFG_ITEM_t **allItems = ubloxcfg_getAllItems(&numItems);
+        int numOkByName = 0;
+        int numOkById = 0;
+        for (int ix = 0; ix < numItems; ix++)
+        {
+            if (ubloxcfg_getItemByName(allItems[ix]->name) == allItems[ix])
+            {
+                numOkByName++;
+            }
+            if (ubloxcfg_getItemById(allItems[ix]->id) == allItems[ix])
+            {
+                numOkById++;
+            }
+        }
+        TEST("lookup all items by name", (numItems > 0) && (numOkByName == numItems));
+        TEST("lookup all items by ID", (numItems > 0) && (numOkById == numItems));
+        TEST("lookup item by name (first)", (ubloxcfg_getItemByName("AAA") == NULL));
+        TEST("lookup item by name (last)", (ubloxcfg_getItemByName("ZZZ") == NULL));
+        TEST("lookup item by name (case)", (ubloxcfg_getItemByName("cfg-ubloxcfgtest-u1") == NULL));
+        TEST("lookup item by ID (first)", (ubloxcfg_getItemById(0x00000000) == NULL));
+
+        int numRates = 0;
+        const UBLOXCFG_MSGRATE_t **allRates = ubloxcfg_getAllMsgRateCfgs(&numRates);
+        int numOkRates = 0;
+        for (int ix = 0; ix < numRates; ix++)
+        {
+            if (ubloxcfg_getMsgRateCfg(allRates[ix]->msgName) == allRates[ix])
+            {
+                numOkRates++;
+            }
+        }
+        TEST("lookup all msg rate cfgs by name", (numRates > 0) && (numOkRates == numRates));
+        TEST("lookup msg rate cfg by name (fail)", (ubloxcfg_getMsgRateCfg("UBX-NOPE-NOPE") == NULL));
+    }
+
     // Message output rate configs
     {
         const UBLOXCFG_MSGRATE_t *rates = ubloxcfg_getMsgRateCfg(UBLOXCFG_UBX_NAV_PVT_STR);
@@ -709,6 +747,107 @@ int main(int argc, char **argv)
         }
     }
 
+    // Bulk stringification, must be the same as ubloxcfg_stringifyKeyVal() and ubloxcfg_stringifyValue()
+    {
+        int numItems = 0;
+        const UBLOXCFG_ITEM_t **allItems = ubloxcfg_getAllItems(&numItems);
+        static UBLOXCFG_KEYVAL_t keyVal[4 * 1000];
+        static const UBLOXCFG_ITEM_t *items[NUMOF(keyVal)];
+        int numKeyVal = 0;
+        const uint64_t vals[] = { 0x0000000000000000, 0x0000000000000001, 0xffffffffffffffff, 0x8000000000000081 };
+        for (int ix = 0; (ix < numItems) && (numKeyVal < ((int)NUMOF(keyVal) - 10)); ix++)
+        {
+            for (int valIx = 0; valIx < (int)NUMOF(vals); valIx++)
+            {
+                keyVal[numKeyVal].id = allItems[ix]->id;
+                keyVal[numKeyVal].val._raw = vals[valIx];
+                // unused bytes shall be 0x00
+                switch (allItems[ix]->size)
+                {
+                    case UBLOXCFG_SIZE_BIT:   keyVal[numKeyVal].val._raw &= 0x01;       break;
+                    case UBLOXCFG_SIZE_ONE:   keyVal[numKeyVal].val._raw &= 0xff;       break;
+                    case UBLOXCFG_SIZE_TWO:   keyVal[numKeyVal].val._raw &= 0xffff;     break;
+                    case UBLOXCFG_SIZE_FOUR:  keyVal[numKeyVal].val._raw &= 0xffffffff; break;
+                    case UBLOXCFG_SIZE_EIGHT:                                           break;
+                }
+                numKeyVal++;
+            }
+        }
+        const UBLOXCFG_KEYVAL_t unknownKeyVal[] =
+        {
+            { .id = 0x10fe0ff1, .val = { .L  = true               } },
+            { .id = 0x20fe0ff2, .val = { .X1 = 0x12               } },
+            { .id = 0x30fe0ff3, .val = { .X2 = 0x1234             } },
+            { .id = 0x40fe0ff4, .val = { .X4 = 0x12345678         } },
+            { .id = 0x50fe0ff5, .val = { .X8 = 0x1234567890abcdef } },
+        };
+        for (int ix = 0; ix < (int)NUMOF(unknownKeyVal); ix++)
+        {
+            keyVal[numKeyVal++] = unknownKeyVal[ix];
+        }
+
+        static char str[NUMOF(keyVal) * UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+        static const char *strs[NUMOF(keyVal)];
+        const int numStrKv = ubloxcfg_stringifyKeyVals(str, sizeof(str), keyVal, NULL, numKeyVal, strs);
+        TEST("stringifyKeyVals num", (numStrKv == numKeyVal));
+        int numBadKv = 0;
+        for (int ix = 0; ix < numKeyVal; ix++)
+        {
+            char exp[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+            if ( !ubloxcfg_stringifyKeyVal(exp, sizeof(exp), &keyVal[ix]) || (strs[ix] == NULL) || (strcmp(exp, strs[ix]) != 0) )
+            {
+                numBadKv++;
+                if (gVerbosity > 0)
+                {
+                    printf("stringifyKeyVals: %s != %s\n", exp, strs[ix] != NULL ? strs[ix] : "NULL");
+                }
+            }
+        }
+        TEST("stringifyKeyVals strings", (numBadKv == 0));
+
+        for (int ix = 0; ix < numKeyVal; ix++)
+        {
+            items[ix] = ubloxcfg_getItemById(keyVal[ix].id);
+        }
+        const int numStrVal = ubloxcfg_stringifyValues(str, sizeof(str), keyVal, items, numKeyVal, strs);
+        TEST("stringifyValues num", (numStrVal == numKeyVal));
+        int numBadVal = 0;
+        for (int ix = 0; ix < numKeyVal; ix++)
+        {
+            char exp[UBLOXCFG_MAX_KEYVAL_STR_SIZE];
+            const UBLOXCFG_TYPE_t types[] = { UBLOXCFG_TYPE_X8, UBLOXCFG_TYPE_L, UBLOXCFG_TYPE_X1, UBLOXCFG_TYPE_X2,
+                UBLOXCFG_TYPE_X4, UBLOXCFG_TYPE_X8, UBLOXCFG_TYPE_X8, UBLOXCFG_TYPE_X8 };
+            const UBLOXCFG_TYPE_t type = items[ix] != NULL ? items[ix]->type : types[UBLOXCFG_ID2SIZE(keyVal[ix].id)];
+            if ( !ubloxcfg_stringifyValue(exp, sizeof(exp), type, items[ix], &keyVal[ix].val) ||
+                 (strs[ix] == NULL) || (strcmp(exp, strs[ix]) != 0) )
+            {
+                numBadVal++;
+                if (gVerbosity > 0)
+                {
+                    printf("stringifyValues: %s != %s\n", exp, strs[ix] != NULL ? strs[ix] : "NULL");
+                }
+            }
+        }
+        TEST("stringifyValues strings", (numBadVal == 0));
+
+        // Buffer too small
+        char smallStr[100];
+        const int numSmall = ubloxcfg_stringifyKeyVals(smallStr, sizeof(smallStr), keyVal, NULL, numKeyVal, strs);
+        TEST("stringifyKeyVals small", (numSmall > 0) && (numSmall < numKeyVal) && (strs[numSmall - 1] != NULL) && (strs[numSmall] == NULL));
+
+        // Parse with item lookup
+        static uint8_t data[NUMOF(keyVal) * (4 + 8)];
+        int dataSize = 0;
+        static UBLOXCFG_KEYVAL_t keyVal2[NUMOF(keyVal)];
+        static const UBLOXCFG_ITEM_t *items2[NUMOF(keyVal)];
+        int numKeyVal2 = 0;
+        const bool res = ubloxcfg_makeData(data, sizeof(data), keyVal, numKeyVal, &dataSize) &&
+            ubloxcfg_parseDataItems(data, dataSize, keyVal2, items2, NUMOF(keyVal2), &numKeyVal2);
+        TEST("parseDataItems res", (res) && (numKeyVal2 == numKeyVal));
+        TEST("parseDataItems keyVal", (memcmp(keyVal, keyVal2, numKeyVal * sizeof(*keyVal)) == 0));
+        TEST("parseDataItems items", (memcmp(items, items2, numKeyVal * sizeof(*items)) == 0));
+    }
+
     // Analyse results
     printf("%d tests: %d passed, %d failed\n", numTests, numPass, numFail);
     if (numFail != 0)
@@ -0,0 +1,113 @@
+// u-blox 9 positioning receivers configuration library test program: typed C++ interface
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// Building with -DTEST_FAIL=<n> (n = 1..TEST_FAIL_NUM) must fail, see the test_hpp target in the Makefile.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+
+#include "ubloxcfg.hpp"
+
+using namespace ubloxcfg;
+
+#define TEST_FAIL_NUM 8
+
+#if defined(TEST_FAIL)
+void testFail(const int i, const double d, const uint32_t u4)
+{
+    Config<decltype(CFG_RATE_MEAS)> cfg;
+    (void)i; (void)d; (void)u4; (void)cfg;
+#  if   TEST_FAIL == 1
+    keyVal(CFG_RATE_MEAS, 1.5);                                  // double for U2
+#  elif TEST_FAIL == 2
+    keyVal(CFG_RATE_MEAS, d);                                    // double for U2
+#  elif TEST_FAIL == 3
+    keyVal(CFG_RATE_MEAS, u4);                                   // uint32_t for U2
+#  elif TEST_FAIL == 4
+    keyVal<100000>(CFG_RATE_MEAS);                               // out of range for U2
+#  elif TEST_FAIL == 5
+    keyVal(CFG_NAVSPG_DYNMODEL, 4);                              // int for enum
+#  elif TEST_FAIL == 6
+    keyVal(CFG_NAVSPG_USE_PPP, 1);                               // int for bool
+#  elif TEST_FAIL == 7
+    keyVal<-1>(CFG_RATE_MEAS);                                   // negative for U2
+#  elif TEST_FAIL == 8
+    cfg.set(CFG_RATE_MEAS, i);                                   // int for U2
+#  endif
+}
+#endif
+
+#define TEST(descr, predicate) do { numTests++; \
+        if (predicate) { numPass++; } \
+        else { numFail++; std::printf("%03d FAIL %s: %s [%s:%d]\n", numTests, descr, # predicate, __FILE__, __LINE__); } \
+    } while (0)
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    int numTests = 0;
+    int numPass = 0;
+    int numFail = 0;
+
+    // keyVal()
+    {
+        const UBLOXCFG_KEYVAL_t kv1 = keyVal<100>(CFG_RATE_MEAS);
+        TEST("keyVal<100>(CFG_RATE_MEAS) id", kv1.id == UBLOXCFG_CFG_RATE_MEAS_ID);
+        TEST("keyVal<100>(CFG_RATE_MEAS) val", kv1.val.U2 == 100);
+        const UBLOXCFG_KEYVAL_t kv2 = keyVal(CFG_RATE_MEAS, uint16_t{200});
+        TEST("keyVal(CFG_RATE_MEAS, uint16_t)", kv2.val.U2 == 200);
+        const uint8_t u1 = 5;
+        const UBLOXCFG_KEYVAL_t kv3 = keyVal(CFG_RATE_MEAS, u1);
+        TEST("keyVal(CFG_RATE_MEAS, uint8_t)", kv3.val.U2 == 5);
+        const UBLOXCFG_KEYVAL_t kv4 = keyVal(CFG_NAVSPG_DYNMODEL, UBLOXCFG_CFG_NAVSPG_DYNMODEL_AUTOMOT);
+        TEST("keyVal(CFG_NAVSPG_DYNMODEL, enum)", kv4.val.E1 == UBLOXCFG_CFG_NAVSPG_DYNMODEL_AUTOMOT);
+        const UBLOXCFG_KEYVAL_t kv5 = keyVal<UBLOXCFG_CFG_NAVSPG_DYNMODEL_AUTOMOT>(CFG_NAVSPG_DYNMODEL);
+        TEST("keyVal<enum>(CFG_NAVSPG_DYNMODEL)", kv5.val.E1 == UBLOXCFG_CFG_NAVSPG_DYNMODEL_AUTOMOT);
+        const UBLOXCFG_KEYVAL_t kv6 = keyVal(CFG_NAVSPG_USE_PPP, true);
+        TEST("keyVal(CFG_NAVSPG_USE_PPP, bool)", kv6.val.L);
+        const UBLOXCFG_KEYVAL_t kv7 = keyVal(CFG_NAVSPG_USRDAT_MAJA, 6378137.0);
+        TEST("keyVal(CFG_NAVSPG_USRDAT_MAJA, double)", kv7.val.R8 == 6378137.0);
+        const UBLOXCFG_KEYVAL_t kv8 = keyVal<-10>(CFG_NAVSPG_CONSTR_ALT);
+        TEST("keyVal<-10>(CFG_NAVSPG_CONSTR_ALT)", kv8.val.I4 == -10);
+        const UBLOXCFG_KEYVAL_t kv9 = keyVal<1>(UBX_NAV_PVT_UART1);
+        TEST("keyVal<1>(UBX_NAV_PVT_UART1)", (kv9.id == UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVT_UART1_ID) && (kv9.val.U1 == 1));
+
+        uint16_t meas = 0;
+        const UBLOXCFG_KEYVAL_t kvs[] = { kv4, kv1 };
+        TEST("getValue(CFG_RATE_MEAS)", getValue(kvs, 2, CFG_RATE_MEAS, meas) && (meas == 100));
+    }
+
+    // Config<>
+    {
+        Config<decltype(CFG_NAVSPG_DYNMODEL), decltype(CFG_RATE_MEAS)> cfg;
+        TEST("Config<>::have() empty", !cfg.have(CFG_RATE_MEAS));
+        cfg.set(CFG_RATE_MEAS, uint16_t{250});
+        TEST("Config<>::set()", cfg.have(CFG_RATE_MEAS) && (cfg.get(CFG_RATE_MEAS) == 250));
+        UBLOXCFG_KEYVAL_t kv[2];
+        TEST("Config<>::keyVals()", (cfg.keyVals(kv, 2) == 1) && (kv[0].val.U2 == 250));
+
+        const uint8_t data[] = { 0x01, 0x00, 0x21, 0x30, 0xe8, 0x03,   0x21, 0x00, 0x11, 0x20, 0x04 };
+        Config<decltype(CFG_NAVSPG_DYNMODEL), decltype(CFG_RATE_MEAS)> cfg2;
+        TEST("Config<>::parseData()", cfg2.parseData(data, sizeof(data)));
+        TEST("Config<>::parseData() U2", cfg2.get(CFG_RATE_MEAS) == 1000);
+        TEST("Config<>::parseData() E1", cfg2.get(CFG_NAVSPG_DYNMODEL) == UBLOXCFG_CFG_NAVSPG_DYNMODEL_AUTOMOT);
+    }
+
+    std::printf("%d tests: %d passed, %d failed\n", numTests, numPass, numFail);
+    return numFail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
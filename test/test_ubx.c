@@ -0,0 +1,184 @@
+// flipflip's UBX library test program
+//
+// Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "ff_stuff.h"
+#include "ff_ubx.h"
+
+// Assertion with result printing
+#define TEST(descr, predicate) do { numTests++; \
+        if (predicate) { numPass++; } \
+        else { numFail++; printf("%03d FAIL %s: %s [%s:%d]\n", numTests, descr, # predicate, __FILE__, __LINE__); } \
+    } while (0)
+
+static int numTests = 0;
+static int numPass = 0;
+static int numFail = 0;
+
+#define KV(_id, _val) { .id = (_id), .val = { ._raw = (_val) } }
+
+static void _testCfgDiff(void)
+{
+    const UBLOXCFG_KEYVAL_t want[] = { KV(0x10000003, 3), KV(0x10000001, 1), KV(0x10000002, 2) };
+    const UBLOXCFG_KEYVAL_t have[] = { KV(0x10000004, 7), KV(0x10000002, 5), KV(0x10000001, 1), KV(0x10000005, 0) };
+    const UBLOXCFG_KEYVAL_t def[]  = { KV(0x10000004, 0), KV(0x10000005, 0) };
+    UBLOXCFG_KEYVAL_t set[10];
+    uint32_t del[10];
+    int nSet = -1;
+    int nDel = -1;
+
+    // BBR/Flash: changed and missing items to set (in want order), undesired ones to delete (in have order)
+    TEST("diff del", ubxCfgDiff(want, 3, have, 4, NULL, 0, set, 10, &nSet, del, 10, &nDel));
+    TEST("diff del", (nSet == 2) &&
+        (set[0].id == 0x10000003) && (set[0].val._raw == 3) && (set[1].id == 0x10000002) && (set[1].val._raw == 2));
+    TEST("diff del", (nDel == 2) && (del[0] == 0x10000004) && (del[1] == 0x10000005));
+
+    // RAM: undesired items revert to default, unless they have the default value already
+    TEST("diff def", ubxCfgDiff(want, 3, have, 4, def, 2, set, 10, &nSet, NULL, 0, NULL));
+    TEST("diff def", (nSet == 3) && (set[2].id == 0x10000004) && (set[2].val._raw == 0));
+
+    // Undesired items without default and without del are ignored
+    TEST("diff ignore", ubxCfgDiff(want, 3, have, 4, NULL, 0, set, 10, &nSet, NULL, 0, NULL) && (nSet == 2));
+
+    // Nothing wanted: delete everything
+    TEST("diff empty", ubxCfgDiff(want, 0, have, 4, NULL, 0, set, 10, &nSet, del, 10, &nDel));
+    TEST("diff empty", (nSet == 0) && (nDel == 4));
+
+    // Nothing there: set everything
+    TEST("diff none", ubxCfgDiff(want, 3, NULL, 0, NULL, 0, set, 10, &nSet, del, 10, &nDel));
+    TEST("diff none", (nSet == 3) && (nDel == 0) && (set[0].id == 0x10000003));
+
+    // Same: nothing to do
+    TEST("diff same", ubxCfgDiff(want, 3, want, 3, def, 2, set, 10, &nSet, del, 10, &nDel));
+    TEST("diff same", (nSet == 0) && (nDel == 0));
+
+    // Not enough space
+    TEST("diff maxSet", !ubxCfgDiff(want, 3, have, 4, NULL, 0, set, 1, &nSet, del, 10, &nDel));
+    TEST("diff maxDel", !ubxCfgDiff(want, 3, have, 4, NULL, 0, set, 10, &nSet, del, 1, &nDel));
+
+    // Bad parameters
+    TEST("diff bad", !ubxCfgDiff(NULL, 0, have, 4, NULL, 0, set, 10, &nSet, del, 10, &nDel));
+    TEST("diff bad", !ubxCfgDiff(want, 3, NULL, 4, NULL, 0, set, 10, &nSet, del, 10, &nDel));
+    TEST("diff bad", !ubxCfgDiff(want, 3, have, 4, NULL, 2, set, 10, &nSet, del, 10, &nDel));
+    TEST("diff bad", !ubxCfgDiff(want, 3, have, 4, NULL, 0, NULL, 10, &nSet, del, 10, &nDel));
+    TEST("diff bad", !ubxCfgDiff(want, 3, have, 4, NULL, 0, set, 10, &nSet, del, 10, NULL));
+}
+
+// Check a UBX-CFG-VALDEL message, returns the number of keys in it
+static int _checkValdel(const UBX_CFG_VALSET_MSG_t *msg, const uint8_t layers, const uint8_t transaction,
+    const uint32_t *keys)
+{
+    const int payloadSize = msg->size - UBX_FRAME_SIZE - (int)sizeof(UBX_CFG_VALDEL_V1_GROUP0_t);
+    if ( (payloadSize < 0) || ((payloadSize % 4) != 0) )
+    {
+        return -1;
+    }
+    // Header, checksum
+    UBX_CFG_VALDEL_V1_GROUP0_t head;
+    memcpy(&head, &msg->msg[UBX_HEAD_SIZE], sizeof(head));
+    uint8_t check[UBX_CFG_VALDEL_V1_MAX_SIZE];
+    const int checkSize = ubxMakeMessage(UBX_CFG_CLSID, UBX_CFG_VALDEL_MSGID,
+        &msg->msg[UBX_HEAD_SIZE], msg->size - UBX_FRAME_SIZE, check);
+    if ( (head.version != UBX_CFG_VALDEL_V1_VERSION) || (head.layers != layers) ||
+         (head.transaction != transaction) || (checkSize != msg->size) || (memcmp(check, msg->msg, msg->size) != 0) )
+    {
+        return -1;
+    }
+    // Keys
+    const int nKeys = payloadSize / 4;
+    if (memcmp(&msg->msg[UBX_HEAD_SIZE + sizeof(head)], keys, nKeys * 4) != 0)
+    {
+        return -1;
+    }
+    return nKeys;
+}
+
+static void _testValdel(void)
+{
+    uint32_t keys[UBX_CFG_VALDEL_V1_MAX_K * 20];
+    for (int ix = 0; ix < (int)NUMOF(keys); ix++)
+    {
+        keys[ix] = 0x10000000 + ix;
+    }
+    int nValdel = -1;
+    UBX_CFG_VALSET_MSG_t *msgs;
+
+    // Single message, no transaction
+    msgs = ubxKeysToUbxCfgValdel(keys, 10, true, false, &nValdel);
+    TEST("valdel 10", (msgs != NULL) && (nValdel == 1));
+    if (msgs != NULL)
+    {
+        TEST("valdel 10", _checkValdel(&msgs[0], UBX_CFG_VALDEL_V1_LAYER_BBR, UBX_CFG_VALDEL_V1_TRANSACTION_NONE,
+            keys) == 10);
+        free(msgs);
+    }
+
+    // Full message, no transaction
+    msgs = ubxKeysToUbxCfgValdel(keys, UBX_CFG_VALDEL_V1_MAX_K, false, true, &nValdel);
+    TEST("valdel 64", (msgs != NULL) && (nValdel == 1));
+    if (msgs != NULL)
+    {
+        TEST("valdel 64", _checkValdel(&msgs[0], UBX_CFG_VALDEL_V1_LAYER_FLASH, UBX_CFG_VALDEL_V1_TRANSACTION_NONE,
+            keys) == UBX_CFG_VALDEL_V1_MAX_K);
+        free(msgs);
+    }
+
+    // Several messages in a transaction, ending with an empty message
+    const uint8_t layers = UBX_CFG_VALDEL_V1_LAYER_BBR | UBX_CFG_VALDEL_V1_LAYER_FLASH;
+    msgs = ubxKeysToUbxCfgValdel(keys, 150, true, true, &nValdel);
+    TEST("valdel 150", (msgs != NULL) && (nValdel == 4));
+    if ( (msgs != NULL) && (nValdel == 4) )
+    {
+        TEST("valdel 150", _checkValdel(&msgs[0], layers, UBX_CFG_VALDEL_V1_TRANSACTION_BEGIN, &keys[0]) == 64);
+        TEST("valdel 150", _checkValdel(&msgs[1], layers, UBX_CFG_VALDEL_V1_TRANSACTION_CONTINUE, &keys[64]) == 64);
+        TEST("valdel 150", _checkValdel(&msgs[2], layers, UBX_CFG_VALDEL_V1_TRANSACTION_CONTINUE, &keys[128]) == 22);
+        TEST("valdel 150", _checkValdel(&msgs[3], layers, UBX_CFG_VALDEL_V1_TRANSACTION_END, &keys[150]) == 0);
+    }
+    free(msgs);
+
+    // Nothing to delete
+    msgs = ubxKeysToUbxCfgValdel(keys, 0, true, true, &nValdel);
+    TEST("valdel 0", (msgs != NULL) && (nValdel == 0));
+    free(msgs);
+
+    // Maximum number of messages, one more is too many
+    msgs = ubxKeysToUbxCfgValdel(keys, UBX_CFG_VALDEL_V1_MAX_K * 19, true, true, &nValdel);
+    TEST("valdel max", (msgs != NULL) && (nValdel == 20));
+    free(msgs);
+    TEST("valdel too many", ubxKeysToUbxCfgValdel(keys, (UBX_CFG_VALDEL_V1_MAX_K * 19) + 1, true, true, &nValdel) == NULL);
+
+    // Bad parameters
+    TEST("valdel no layer", ubxKeysToUbxCfgValdel(keys, 10, false, false, &nValdel) == NULL);
+    TEST("valdel bad", ubxKeysToUbxCfgValdel(NULL, 10, true, false, &nValdel) == NULL);
+    TEST("valdel bad", ubxKeysToUbxCfgValdel(keys, 10, true, false, NULL) == NULL);
+}
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+
+    _testCfgDiff();
+    _testValdel();
+
+    printf("%d tests: %d passed, %d failed\n", numTests, numPass, numFail);
+    return numFail == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
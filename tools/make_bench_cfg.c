@@ -0,0 +1,108 @@
+// u-blox 9 positioning receivers configuration tool: config file generator for benchmarking
+//
+// Copyright (c) 2022 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+// This program is free software: you can redistribute it and/or modify it under the terms of the
+// GNU General Public License as published by the Free Software Foundation, either version 3 of the
+// License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+// without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+// See the GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License along with this program.
+// If not, see <https://www.gnu.org/licenses/>.
+//
+// Generates a config file with 5000 lines for benchmarking loading config files: all known items (by name, by ID
+// and as message rates), unknown items (by ID) to fill the maximum number of items, comments and empty lines.
+//
+// Usage: make_bench_cfg > bench.cfg, or see the bench_cfg target in the Makefile
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "ubloxcfg.h"
+
+#define NUM_LINES 5000
+#define MAX_ITEMS 1216 // 19 UBX-CFG-VALSET (plus empty transaction end)
+
+int main(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    int numItems = 0;
+    const UBLOXCFG_ITEM_t **items = ubloxcfg_getAllItems(&numItems);
+    int numRates = 0;
+    const UBLOXCFG_MSGRATE_t **rates = ubloxcfg_getAllMsgRateCfgs(&numRates);
+    int numLines = 0;
+    int numKv = 0;
+
+    // Message rates (on all ports)
+    for (int ix = 0; ix < numRates; ix++)
+    {
+        const UBLOXCFG_MSGRATE_t *r = rates[ix];
+        printf("%-30s %s %s %s %s %s\n", r->msgName,
+            r->itemUart1 ? "1" : "-", r->itemUart2 ? "1" : "-", r->itemSpi ? "1" : "-",
+            r->itemI2c ? "1" : "-", r->itemUsb ? "1" : "-");
+        numLines++;
+        numKv += (r->itemUart1 ? 1 : 0) + (r->itemUart2 ? 1 : 0) + (r->itemSpi ? 1 : 0) + (r->itemI2c ? 1 : 0) + (r->itemUsb ? 1 : 0);
+    }
+
+    // All other known items, every other by name resp. by ID
+    for (int ix = 0; ix < numItems; ix++)
+    {
+        const UBLOXCFG_ITEM_t *item = items[ix];
+        if (strncmp(item->name, "CFG-MSGOUT-", 11) == 0)
+        {
+            bool isRate = false;
+            for (int rIx = 0; !isRate && (rIx < numRates); rIx++)
+            {
+                const UBLOXCFG_MSGRATE_t *r = rates[rIx];
+                isRate = (r->itemUart1 == item) || (r->itemUart2 == item) || (r->itemSpi == item) ||
+                         (r->itemI2c == item) || (r->itemUsb == item);
+            }
+            if (isRate)
+            {
+                continue;
+            }
+        }
+        const char *value = (item->nConsts > 0) && (item->type == UBLOXCFG_TYPE_E1) ? item->consts[0].name : "0";
+        if ((ix % 2) == 0)
+        {
+            printf("%-50s %-20s # %s\n", item->name, value, item->title);
+        }
+        else
+        {
+            printf("0x%08x %s\n", item->id, "0");
+        }
+        numLines++;
+        numKv++;
+    }
+
+    // Unknown items
+    for (uint32_t id = 0x10ff0001; numKv < MAX_ITEMS; id++)
+    {
+        printf("0x%08x 1\n", id);
+        numLines++;
+        numKv++;
+    }
+
+    // Comments and empty lines
+    while (numLines < NUM_LINES)
+    {
+        if ((numLines % 3) == 0)
+        {
+            printf("\n");
+        }
+        else
+        {
+            printf("# comment line %d\n", numLines);
+        }
+        numLines++;
+    }
+
+    return 0;
+}
@@ -55,37 +55,88 @@ const UBLOXCFG_ITEM_t *ubloxcfg_getItemByName(const char *name)
             item = ubloxcfg_getItemById(id);
         }
     }
-    // Find by name
+    // Find by name (binary search in the lookup table, which is sorted by name)
     else
     {
         const UBLOXCFG_ITEM_t **allItems = (const UBLOXCFG_ITEM_t **)_ubloxcfg_allItems();
-        for (int ix = 0; ix < _UBLOXCFG_NUM_ITEMS; ix++)
+        const uint16_t *itemsByName = _ubloxcfg_itemsByName();
+        int lo = 0;
+        int hi = _UBLOXCFG_NUM_ITEMS - 1;
+        while (lo <= hi)
         {
-            if (strcmp(allItems[ix]->name, name) == 0)
+            const int mid = lo + ((hi - lo) / 2);
+            const UBLOXCFG_ITEM_t *cand = allItems[ itemsByName[mid] ];
+            const int cmp = strcmp(cand->name, name);
+            if (cmp == 0)
             {
-                item = allItems[ix];
+                item = cand;
                 break;
             }
+            else if (cmp < 0)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid - 1;
+            }
         }
     }
     return item;
 }
 
-const UBLOXCFG_ITEM_t *ubloxcfg_getItemById(const uint32_t id)
+// Find item by ID, *hint is the position in the lookup table of the previously found item (or -1), which makes the
+// lookup of consecutive IDs (e.g. from a UBX-CFG-VALGET response, which is sorted by ID) cheap
+static const UBLOXCFG_ITEM_t *getItemByIdHint(const uint32_t id, int *hint)
 {
-    const UBLOXCFG_ITEM_t *item = NULL;
     const UBLOXCFG_ITEM_t **allItems = (const UBLOXCFG_ITEM_t **)_ubloxcfg_allItems();
-    for (int ix = 0; ix < _UBLOXCFG_NUM_ITEMS; ix++)
+    const uint16_t *itemsById = _ubloxcfg_itemsById();
+
+    // Same or next item as last time?
+    for (int ix = *hint; (ix >= 0) && (ix < _UBLOXCFG_NUM_ITEMS) && (ix <= (*hint + 1)); ix++)
     {
-        if (allItems[ix]->id == id)
+        const UBLOXCFG_ITEM_t *cand = allItems[ itemsById[ix] ];
+        if (cand->id == id)
         {
-            item = allItems[ix];
+            *hint = ix;
+            return cand;
+        }
+    }
+
+    // Binary search in the lookup table, which is sorted by ID
+    const UBLOXCFG_ITEM_t *item = NULL;
+    int lo = 0;
+    int hi = _UBLOXCFG_NUM_ITEMS - 1;
+    while (lo <= hi)
+    {
+        const int mid = lo + ((hi - lo) / 2);
+        const UBLOXCFG_ITEM_t *cand = allItems[ itemsById[mid] ];
+        if (cand->id == id)
+        {
+            item = cand;
+            lo = mid;
             break;
         }
+        else if (cand->id < id)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
     }
+    // Found item resp. the one before where it would be
+    *hint = item != NULL ? lo : lo - 1;
     return item;
 }
 
+const UBLOXCFG_ITEM_t *ubloxcfg_getItemById(const uint32_t id)
+{
+    int hint = -1;
+    return getItemByIdHint(id, &hint);
+}
+
 const UBLOXCFG_ITEM_t **ubloxcfg_getAllItems(int *num)
 {
     *num = _UBLOXCFG_NUM_ITEMS;
@@ -98,15 +149,28 @@ const UBLOXCFG_MSGRATE_t *ubloxcfg_getMsgRateCfg(const char *msgName)
     {
         return NULL;
     }
+    // Binary search, the list is sorted by name
     const UBLOXCFG_MSGRATE_t *rates = NULL;
     const UBLOXCFG_MSGRATE_t **allRates = (const UBLOXCFG_MSGRATE_t **)_ubloxcfg_allRates();
-    for (int ix = 0; ix < _UBLOXCFG_NUM_RATES; ix++)
+    int lo = 0;
+    int hi = _UBLOXCFG_NUM_RATES - 1;
+    while (lo <= hi)
     {
-        if (strcmp(allRates[ix]->msgName, msgName) == 0)
+        const int mid = lo + ((hi - lo) / 2);
+        const int cmp = strcmp(allRates[mid]->msgName, msgName);
+        if (cmp == 0)
         {
-            rates = allRates[ix];
+            rates = allRates[mid];
             break;
         }
+        else if (cmp < 0)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
     }
     return rates;
 }
@@ -333,6 +397,21 @@ bool ubloxcfg_parseData(const uint8_t *data, const int size, UBLOXCFG_KEYVAL_t *
     return res;
 }
 
+bool ubloxcfg_parseDataItems(const uint8_t *data, const int size, UBLOXCFG_KEYVAL_t *keyVal, const UBLOXCFG_ITEM_t **items,
+    const int maxKeyVal, int *nKeyVal)
+{
+    if ( (items == NULL) || !ubloxcfg_parseData(data, size, keyVal, maxKeyVal, nKeyVal) )
+    {
+        return false;
+    }
+    int hint = -1;
+    for (int ix = 0; ix < *nKeyVal; ix++)
+    {
+        items[ix] = getItemByIdHint(keyVal[ix].id, &hint);
+    }
+    return true;
+}
+
 const char *ubloxcfg_typeStr(UBLOXCFG_TYPE_t type)
 {
     switch (type)
@@ -667,10 +746,318 @@ bool ubloxcfg_stringifyKeyVal(char *str, const int size, const UBLOXCFG_KEYVAL_t
     return true;
 }
 
+// ---------------------------------------------------------------------------------------------------------------------
+
+// String buffer for the bulk stringification functions. Adding stops (and ok becomes false) once the string (and the
+// nul termination) would no longer fit.
+typedef struct STRBUF_s
+{
+    char *str;
+    int   size;
+    int   len;
+    bool  ok;
+} STRBUF_t;
+
+static void strBufAdd(STRBUF_t *buf, const char *str, const int len)
+{
+    if ( buf->ok && ((buf->len + len) < buf->size) )
+    {
+        memcpy(&buf->str[buf->len], str, len);
+        buf->len += len;
+    }
+    else
+    {
+        buf->ok = false;
+    }
+}
+
+static void strBufAddStr(STRBUF_t *buf, const char *str)
+{
+    strBufAdd(buf, str, strlen(str));
+}
+
+static void strBufAddUnsigned(STRBUF_t *buf, uint64_t val)
+{
+    char tmp[20];
+    int ix = sizeof(tmp);
+    do
+    {
+        tmp[--ix] = '0' + (val % 10);
+        val /= 10;
+    }
+    while (val != 0);
+    strBufAdd(buf, &tmp[ix], sizeof(tmp) - ix);
+}
+
+static void strBufAddSigned(STRBUF_t *buf, const int64_t val)
+{
+    if (val < 0)
+    {
+        strBufAdd(buf, "-", 1);
+        strBufAddUnsigned(buf, (uint64_t)0 - (uint64_t)val);
+    }
+    else
+    {
+        strBufAddUnsigned(buf, (uint64_t)val);
+    }
+}
+
+// "0x" and nDigits hex digits, or as many as necessary for nDigits = 0
+static void strBufAddHex(STRBUF_t *buf, uint64_t val, const int nDigits)
+{
+    const char i2hex[] = "0123456789abcdef";
+    char tmp[18];
+    int ix = sizeof(tmp);
+    do
+    {
+        tmp[--ix] = i2hex[val & 0xf];
+        val >>= 4;
+    }
+    while ( (ix > 2) && ((val != 0) || (((int)sizeof(tmp) - ix) < nDigits)) );
+    tmp[--ix] = 'x';
+    tmp[--ix] = '0';
+    strBufAdd(buf, &tmp[ix], sizeof(tmp) - ix);
+}
+
+// Same as ubloxcfg_stringifyValue()
+static void strBufAddValue(STRBUF_t *buf, const UBLOXCFG_TYPE_t type, const UBLOXCFG_ITEM_t *item, const UBLOXCFG_VALUE_t *val)
+{
+    switch (type)
+    {
+        case UBLOXCFG_TYPE_U1: strBufAddUnsigned(buf, val->U1); break;
+        case UBLOXCFG_TYPE_U2: strBufAddUnsigned(buf, val->U2); break;
+        case UBLOXCFG_TYPE_U4: strBufAddUnsigned(buf, val->U4); break;
+        case UBLOXCFG_TYPE_U8: strBufAddUnsigned(buf, val->U8); break;
+        case UBLOXCFG_TYPE_I1: strBufAddSigned(buf, val->I1);   break;
+        case UBLOXCFG_TYPE_I2: strBufAddSigned(buf, val->I2);   break;
+        case UBLOXCFG_TYPE_I4: strBufAddSigned(buf, val->I4);   break;
+        case UBLOXCFG_TYPE_I8: strBufAddSigned(buf, val->I8);   break;
+        case UBLOXCFG_TYPE_X1:
+        case UBLOXCFG_TYPE_X2:
+        case UBLOXCFG_TYPE_X4:
+        case UBLOXCFG_TYPE_X8:
+        {
+            int nDigits = 0;
+            uint64_t valX = 0;
+            switch (type)
+            {
+                case UBLOXCFG_TYPE_X1: nDigits =  2; valX = val->X1; break;
+                case UBLOXCFG_TYPE_X2: nDigits =  4; valX = val->X2; break;
+                case UBLOXCFG_TYPE_X4: nDigits =  8; valX = val->X4; break;
+                case UBLOXCFG_TYPE_X8: nDigits = 16; valX = val->X8; break;
+                default: break;
+            }
+            strBufAddHex(buf, valX, nDigits);
+            // constant names for known bits
+            const char *sep = " (";
+            uint64_t usedBits = 0;
+            if (item != NULL)
+            {
+                for (int ix = 0; ix < item->nConsts; ix++)
+                {
+                    if ((item->consts[ix].val.X & valX) != 0)
+                    {
+                        strBufAddStr(buf, sep);
+                        strBufAddStr(buf, item->consts[ix].name);
+                        usedBits |= item->consts[ix].val.X;
+                        sep = "|";
+                    }
+                }
+            }
+            // hex value of remaining bits (for which no constant was defined)
+            const uint64_t unusedBits = valX & (~usedBits);
+            if (unusedBits == valX)
+            {
+                strBufAddStr(buf, " (n/a");
+            }
+            else if (unusedBits != 0)
+            {
+                strBufAddStr(buf, sep);
+                strBufAddHex(buf, unusedBits, nDigits);
+            }
+            strBufAdd(buf, ")", 1);
+            break;
+        }
+        case UBLOXCFG_TYPE_E1:
+        case UBLOXCFG_TYPE_E2:
+        case UBLOXCFG_TYPE_E4:
+        {
+            int32_t valE = 0;
+            switch (type)
+            {
+                case UBLOXCFG_TYPE_E1: valE = val->E1; break;
+                case UBLOXCFG_TYPE_E2: valE = val->E2; break;
+                case UBLOXCFG_TYPE_E4: valE = val->E4; break;
+                default: break;
+            }
+            const UBLOXCFG_CONST_t *c = NULL;
+            for (int ix = 0; (item != NULL) && (ix < item->nConsts); ix++)
+            {
+                if ((int8_t)item->consts[ix].val.E == valE)
+                {
+                    c = &item->consts[ix];
+                    break;
+                }
+            }
+            if (c != NULL)
+            {
+                strBufAddStr(buf, c->value);
+                strBufAdd(buf, " (", 2);
+                strBufAddStr(buf, c->name);
+                strBufAdd(buf, ")", 1);
+            }
+            else
+            {
+                strBufAddSigned(buf, valE);
+                strBufAdd(buf, " (n/a)", 6);
+            }
+            break;
+        }
+        case UBLOXCFG_TYPE_R4:
+        case UBLOXCFG_TYPE_R8:
+        {
+            char tmp[100];
+            const int len = type == UBLOXCFG_TYPE_R4 ?
+                snprintf(tmp, sizeof(tmp), "%.24g", val->R4) : snprintf(tmp, sizeof(tmp), "%.54g", val->R8);
+            strBufAdd(buf, tmp, len);
+            break;
+        }
+        case UBLOXCFG_TYPE_L:
+            if (val->L)
+            {
+                strBufAdd(buf, "1 (true)", 8);
+            }
+            else
+            {
+                strBufAdd(buf, "0 (false)", 9);
+            }
+            break;
+    }
+}
+
+// Same as ubloxcfg_stringifyKeyVal()
+static void strBufAddKeyVal(STRBUF_t *buf, const UBLOXCFG_KEYVAL_t *keyVal, const UBLOXCFG_ITEM_t *item)
+{
+    if (item == NULL)
+    {
+        const UBLOXCFG_SIZE_t valSize = UBLOXCFG_ID2SIZE(keyVal->id);
+        const char *sizeStr = NULL;
+        uint64_t val = 0;
+        int nDigits = 0;
+        switch (valSize)
+        {
+            case UBLOXCFG_SIZE_BIT:   sizeStr = ", ?0) = "; val = keyVal->val.X1; nDigits =  0; break;
+            case UBLOXCFG_SIZE_ONE:   sizeStr = ", ?1) = "; val = keyVal->val.X1; nDigits =  2; break;
+            case UBLOXCFG_SIZE_TWO:   sizeStr = ", ?2) = "; val = keyVal->val.X2; nDigits =  4; break;
+            case UBLOXCFG_SIZE_FOUR:  sizeStr = ", ?4) = "; val = keyVal->val.X4; nDigits =  8; break;
+            case UBLOXCFG_SIZE_EIGHT: sizeStr = ", ?8) = "; val = keyVal->val.X8; nDigits = 16; break;
+        }
+        if (sizeStr != NULL)
+        {
+            strBufAdd(buf, "CFG-?-? (", 9);
+            strBufAddHex(buf, keyVal->id, 2);
+            strBufAddStr(buf, sizeStr);
+            strBufAddHex(buf, val, nDigits);
+        }
+        return;
+    }
+
+    const char *type = ubloxcfg_typeStr(item->type);
+    strBufAddStr(buf, item->name);
+    strBufAdd(buf, " (", 2);
+    strBufAddHex(buf, item->id, 8);
+    strBufAdd(buf, ", ", 2);
+    strBufAddStr(buf, type != NULL ? type : "?");
+    strBufAdd(buf, ") = ", 4);
+    strBufAddValue(buf, item->type, item, &keyVal->val);
+    if ( (item->scale != NULL) || (item->unit != NULL) )
+    {
+        strBufAdd(buf, " [", 2);
+        if (item->scale != NULL)
+        {
+            strBufAddStr(buf, item->scale);
+        }
+        if (item->unit != NULL)
+        {
+            strBufAddStr(buf, item->unit);
+        }
+        strBufAdd(buf, "]", 1);
+    }
+}
+
+static int stringifyBulk(char *str, const int size, const UBLOXCFG_KEYVAL_t *keyVal, const UBLOXCFG_ITEM_t **items,
+    const int nKeyVal, const char **strs, const bool withKey)
+{
+    if ( (str == NULL) || (size <= 0) || (keyVal == NULL) || (nKeyVal < 0) || (strs == NULL) )
+    {
+        return 0;
+    }
+
+    STRBUF_t buf = { .str = str, .size = size, .len = 0, .ok = true };
+    int hint = -1;
+    int num = 0;
+    for (int ix = 0; ix < nKeyVal; ix++)
+    {
+        strs[ix] = NULL;
+    }
+    for (int ix = 0; ix < nKeyVal; ix++)
+    {
+        const UBLOXCFG_ITEM_t *item = items != NULL ? items[ix] : getItemByIdHint(keyVal[ix].id, &hint);
+        const int start = buf.len;
+        if (withKey)
+        {
+            strBufAddKeyVal(&buf, &keyVal[ix], item);
+        }
+        else if (item != NULL)
+        {
+            strBufAddValue(&buf, item->type, item, &keyVal[ix].val);
+        }
+        // Unknown items stringify to X type (or L type) according to their size
+        else
+        {
+            UBLOXCFG_TYPE_t type = UBLOXCFG_TYPE_X8;
+            switch (UBLOXCFG_ID2SIZE(keyVal[ix].id))
+            {
+                case UBLOXCFG_SIZE_BIT:   type = UBLOXCFG_TYPE_L;  break;
+                case UBLOXCFG_SIZE_ONE:   type = UBLOXCFG_TYPE_X1; break;
+                case UBLOXCFG_SIZE_TWO:   type = UBLOXCFG_TYPE_X2; break;
+                case UBLOXCFG_SIZE_FOUR:  type = UBLOXCFG_TYPE_X4; break;
+                case UBLOXCFG_SIZE_EIGHT: type = UBLOXCFG_TYPE_X8; break;
+            }
+            strBufAddValue(&buf, type, NULL, &keyVal[ix].val);
+        }
+        // nul terminate (strBufAdd() leaves space for that)
+        strBufAdd(&buf, "", 0);
+        if (!buf.ok)
+        {
+            break;
+        }
+        buf.str[buf.len++] = '\0';
+        strs[ix] = &buf.str[start];
+        num++;
+    }
+    return num;
+}
+
+int ubloxcfg_stringifyKeyVals(char *str, const int size, const UBLOXCFG_KEYVAL_t *keyVal, const UBLOXCFG_ITEM_t **items,
+    const int nKeyVal, const char **strs)
+{
+    return stringifyBulk(str, size, keyVal, items, nKeyVal, strs, true);
+}
+
+int ubloxcfg_stringifyValues(char *str, const int size, const UBLOXCFG_KEYVAL_t *keyVal, const UBLOXCFG_ITEM_t **items,
+    const int nKeyVal, const char **strs)
+{
+    return stringifyBulk(str, size, keyVal, items, nKeyVal, strs, false);
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 static bool strToValUnsigned(const char *str, const UBLOXCFG_TYPE_t type, uint64_t *val);
 static bool strToValSigned(const char *str, const UBLOXCFG_TYPE_t type, int64_t *val);
 static bool findEnumValue(const char *str, const UBLOXCFG_ITEM_t *item, int64_t *val);
 static bool findConstValue(const char *str, const UBLOXCFG_ITEM_t *item, uint64_t *val);
+static bool strToValDec(const char *str, const int len, uint64_t *val);
 
 bool ubloxcfg_valueFromString(const char *str, UBLOXCFG_TYPE_t type, const UBLOXCFG_ITEM_t *item, UBLOXCFG_VALUE_t *value)
 {
@@ -873,6 +1260,27 @@ bool ubloxcfg_valueFromString(const char *str, UBLOXCFG_TYPE_t type, const UBLOX
     return res;
 }
 
+// Plain decimal number (the most common case) without the overhead of sscanf(). Anything else (leading zeros, signs,
+// more than 18 digits) is left to sscanf().
+static bool strToValDec(const char *str, const int len, uint64_t *val)
+{
+    if ( (len < 1) || (len > 18) || (str[0] < '1') || (str[0] > '9') )
+    {
+        return false;
+    }
+    uint64_t value = 0;
+    for (int ix = 0; ix < len; ix++)
+    {
+        if ( (str[ix] < '0') || (str[ix] > '9') )
+        {
+            return false;
+        }
+        value = (value * 10) + (str[ix] - '0');
+    }
+    *val = value;
+    return true;
+}
+
 static bool strToValUnsigned(const char *str, const UBLOXCFG_TYPE_t type, uint64_t *val)
 {
     if ( (str == NULL) || (val == NULL) )
@@ -931,6 +1339,10 @@ static bool strToValUnsigned(const char *str, const UBLOXCFG_TYPE_t type, uint64
         }
     }
     // dec
+    else if (strToValDec(str, len, &value))
+    {
+        res = true;
+    }
     else
     {
         int numChar = 0;
@@ -1021,8 +1433,19 @@ static bool strToValSigned(const char *str, UBLOXCFG_TYPE_t type, int64_t *val)
     // dec
     else
     {
+        uint64_t valDec = 0;
         int numChar = 0;
-        if ( (sscanf(str, "%" SCNi64"%n", &value, &numChar) == 1) && (numChar == len) )
+        if ( (str[0] == '-') && strToValDec(&str[1], len - 1, &valDec) )
+        {
+            value = -(int64_t)valDec;
+            res = true;
+        }
+        else if (strToValDec(str, len, &valDec))
+        {
+            value = (int64_t)valDec;
+            res = true;
+        }
+        else if ( (sscanf(str, "%" SCNi64"%n", &value, &numChar) == 1) && (numChar == len) )
         {
             res = true;
         }
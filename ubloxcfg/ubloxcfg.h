@@ -385,6 +385,26 @@ bool ubloxcfg_makeData(uint8_t *data, const int size, const UBLOXCFG_KEYVAL_t *k
 */
 bool ubloxcfg_parseData(const uint8_t *data, const int size, UBLOXCFG_KEYVAL_t *keyVal, const int maxKeyVal, int *nKeyVal);
 
+//! Key-value list and items from configuration data
+/*!
+    Same as ubloxcfg_parseData() but additionally looks up the items.
+
+    \param[in]  data       Buffer to read the binary configuration data from
+    \param[in]  size       Size of data buffer
+    \param[out] keyVal     List of key-value pairs to populate
+    \param[out] items      List of items to populate (NULL for unknown items), same length as \c keyVal
+    \param[in]  maxKeyVal  Maximum number of key-value pairs (length of key-value list)
+    \param[out] nKeyVal    Number of key-value pairs written to list
+
+    \returns true if \c keyVal was big enough to fit all key-value pairs, false otherwise
+             (in which case neither \c keyVal, \c items nor \c nKeyVal are valid)
+
+    The lookup is faster than calling ubloxcfg_getItemById() for each key-value pair if the data is sorted by item ID
+    (as is the case for UBX-CFG-VALGET responses).
+*/
+bool ubloxcfg_parseDataItems(const uint8_t *data, const int size, UBLOXCFG_KEYVAL_t *keyVal, const UBLOXCFG_ITEM_t **items,
+    const int maxKeyVal, int *nKeyVal);
+
 //! Stringify item type
 /*!
     \param[in] type  Type
@@ -493,6 +513,42 @@ bool ubloxcfg_stringifyKeyVal(char *str, const int size, const UBLOXCFG_KEYVAL_t
                                       19 +                        /* "|0x................"    (remaining bits X8) */ \
                                       10)
 
+//! Stringify many key-value pairs
+/*!
+    \param[out] str      Buffer for all strings
+    \param[in]  size     Size of the \c str buffer
+    \param[in]  keyVal   List of key-value pairs
+    \param[in]  items    List of items for the key-value pairs (NULL for unknown items, see ubloxcfg_parseDataItems()),
+                         or NULL to look them up
+    \param[in]  nKeyVal  Number of key-value pairs
+    \param[out] strs     List of \c nKeyVal strings, pointing into \c str (NULL for the ones that did not fit)
+
+    \returns the number of key-value pairs stringified, which is less than \c nKeyVal if \c str was too small
+
+    The strings are the same as those from ubloxcfg_stringifyKeyVal(), but this is considerably faster for many
+    key-value pairs. About 100 bytes per key-value pair is usually enough.
+*/
+int ubloxcfg_stringifyKeyVals(char *str, const int size, const UBLOXCFG_KEYVAL_t *keyVal, const UBLOXCFG_ITEM_t **items,
+    const int nKeyVal, const char **strs);
+
+//! Stringify many values
+/*!
+    \param[out] str      Buffer for all strings
+    \param[in]  size     Size of the \c str buffer
+    \param[in]  keyVal   List of key-value pairs
+    \param[in]  items    List of items for the key-value pairs (NULL for unknown items, see ubloxcfg_parseDataItems()),
+                         or NULL to look them up
+    \param[in]  nKeyVal  Number of key-value pairs
+    \param[out] strs     List of \c nKeyVal strings, pointing into \c str (NULL for the ones that did not fit)
+
+    \returns the number of values stringified, which is less than \c nKeyVal if \c str was too small
+
+    The strings are the same as those from ubloxcfg_stringifyValue() for the item type. Values of unknown items
+    stringify as L, X1, X2, X4 or X8 type, depending on the size given by their ID.
+*/
+int ubloxcfg_stringifyValues(char *str, const int size, const UBLOXCFG_KEYVAL_t *keyVal, const UBLOXCFG_ITEM_t **items,
+    const int nKeyVal, const char **strs);
+
 //! Convert string to value
 /*!
     \param[in]  str    String to convert
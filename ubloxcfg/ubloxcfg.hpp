@@ -0,0 +1,389 @@
+/* ************************************************************************************************/ // clang-format off
+/*!
+    \file
+    \brief u-blox 9 positioning receivers configuration library: typed C++ interface
+
+    - Copyright (c) 2020 Philippe Kehl (flipflip at oinkzwurgl dot org),
+      https://oinkzwurgl.org/hacking/ubloxcfg
+
+    This program is free software: you can redistribute it and/or modify it under the terms of the
+    GNU Lesser General Public License as published by the Free Software Foundation, either version 3
+    of the License, or (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+    without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+    See the GNU Lesser General Public License for more details.
+
+    You should have received a copy of the GNU Lesser General Public License along with this
+    program. If not, see <https://www.gnu.org/licenses/>.
+
+    \defgroup UBLOXCFG_CPP Typed C++ interface
+    \ingroup UBLOXCFG
+
+    Every configuration item is available as a constexpr object (see ubloxcfg_gen.hpp) of its own type, which carries
+    the item ID, size and value type. Items are named like their C macros without the UBLOXCFG_ prefix, e.g.
+    ubloxcfg::CFG_NAVSPG_DYNMODEL. Output message rate items are also available by message and port name, e.g.
+    ubloxcfg::UBX_NAV_PVT_UART1. Enum (E1, E2, E4) items use the corresponding C enum as value type.
+
+    All lookups are resolved at compile time. Unknown item names and values that do not convert losslessly to the
+    item's value type are compile errors: an int for an enum or bool item, a double for an integer item, or an int
+    variable for a uint16_t item. Integer constants can be given as template argument, which rejects values out of
+    range for the item (e.g. keyVal<100000>(CFG_RATE_MEAS)). Requires C++17.
+
+    \b Example
+    \code{.cpp}
+        #include "ubloxcfg.hpp"
+        using namespace ubloxcfg;
+
+        // Make key-value list for UBX-CFG-VALSET
+        const UBLOXCFG_KEYVAL_t keyVal[] =
+        {
+            keyVal(CFG_NAVSPG_DYNMODEL, UBLOXCFG_CFG_NAVSPG_DYNMODEL_AUTOMOT),
+            keyVal<100>(CFG_RATE_MEAS),
+            keyVal(UBX_NAV_PVT_UART1, uint8_t{1})
+        };
+
+        // Typed configuration, e.g. from a UBX-CFG-VALGET response
+        Config<decltype(CFG_NAVSPG_DYNMODEL), decltype(CFG_RATE_MEAS)> cfg;
+        cfg.parse(kv, nKv);      // or: cfg.parseData(&msg[UBX_HEAD_SIZE + sizeof(UBX_CFG_VALGET_V1_GROUP0_t)], size)
+        if (cfg.have(CFG_RATE_MEAS))
+        {
+            const uint16_t meas = cfg.get(CFG_RATE_MEAS);
+        }
+        // Config<...>::ids lists the IDs of the items, e.g. for polling the configuration with UBX-CFG-VALGET
+    \endcode
+
+    @{
+*/
+
+#ifndef __UBLOXCFG_HPP__
+#define __UBLOXCFG_HPP__
+
+#include <cstdint>
+#include <array>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+#include "ubloxcfg.h"
+
+namespace ubloxcfg {
+
+/* ****************************************************************************************************************** */
+
+//! Value type traits (storage in UBLOXCFG_VALUE_t)
+template<UBLOXCFG_TYPE_t TYPE> struct TypeTraits;
+
+#ifndef _DOXYGEN_
+#define _UBLOXCFG_TYPETRAITS(_type_, _ctype_, _size_) \
+    template<> struct TypeTraits<UBLOXCFG_TYPE_ ## _type_> \
+    { \
+        using type = _ctype_; \
+        static constexpr UBLOXCFG_SIZE_t size = _size_; \
+        static void set(UBLOXCFG_VALUE_t &val, const type value) { val._raw = 0; val._type_ = value; } \
+        static type get(const UBLOXCFG_VALUE_t &val) { return val._type_; } \
+    }
+_UBLOXCFG_TYPETRAITS(U1, uint8_t,  UBLOXCFG_SIZE_ONE);
+_UBLOXCFG_TYPETRAITS(U2, uint16_t, UBLOXCFG_SIZE_TWO);
+_UBLOXCFG_TYPETRAITS(U4, uint32_t, UBLOXCFG_SIZE_FOUR);
+_UBLOXCFG_TYPETRAITS(U8, uint64_t, UBLOXCFG_SIZE_EIGHT);
+_UBLOXCFG_TYPETRAITS(I1, int8_t,   UBLOXCFG_SIZE_ONE);
+_UBLOXCFG_TYPETRAITS(I2, int16_t,  UBLOXCFG_SIZE_TWO);
+_UBLOXCFG_TYPETRAITS(I4, int32_t,  UBLOXCFG_SIZE_FOUR);
+_UBLOXCFG_TYPETRAITS(I8, int64_t,  UBLOXCFG_SIZE_EIGHT);
+_UBLOXCFG_TYPETRAITS(X1, uint8_t,  UBLOXCFG_SIZE_ONE);
+_UBLOXCFG_TYPETRAITS(X2, uint16_t, UBLOXCFG_SIZE_TWO);
+_UBLOXCFG_TYPETRAITS(X4, uint32_t, UBLOXCFG_SIZE_FOUR);
+_UBLOXCFG_TYPETRAITS(X8, uint64_t, UBLOXCFG_SIZE_EIGHT);
+_UBLOXCFG_TYPETRAITS(R4, float,    UBLOXCFG_SIZE_FOUR);
+_UBLOXCFG_TYPETRAITS(R8, double,   UBLOXCFG_SIZE_EIGHT);
+_UBLOXCFG_TYPETRAITS(E1, int8_t,   UBLOXCFG_SIZE_ONE);
+_UBLOXCFG_TYPETRAITS(E2, int16_t,  UBLOXCFG_SIZE_TWO);
+_UBLOXCFG_TYPETRAITS(E4, int32_t,  UBLOXCFG_SIZE_FOUR);
+_UBLOXCFG_TYPETRAITS(L,  bool,     UBLOXCFG_SIZE_BIT);
+#undef _UBLOXCFG_TYPETRAITS
+#endif
+
+//! Configuration item
+/*!
+    \tparam ID    Item ID
+    \tparam TYPE  Storage type
+    \tparam T     Value type (e.g. the enum for E types)
+*/
+template<uint32_t ID, UBLOXCFG_TYPE_t TYPE, typename T = typename TypeTraits<TYPE>::type>
+struct Item
+{
+    using Type = T;                                             //!< Value type
+    static constexpr uint32_t        id   = ID;                 //!< Item ID
+    static constexpr UBLOXCFG_TYPE_t type = TYPE;               //!< Storage type
+    static constexpr UBLOXCFG_SIZE_t size = UBLOXCFG_ID2SIZE(ID); //!< Item size
+    static_assert(size == TypeTraits<TYPE>::size, "Item ID and type mismatch");
+
+    //! Encode value
+    static UBLOXCFG_VALUE_t encode(const T value)
+    {
+        UBLOXCFG_VALUE_t val;
+        TypeTraits<TYPE>::set(val, static_cast<typename TypeTraits<TYPE>::type>(value));
+        return val;
+    }
+
+    //! Decode value
+    static T decode(const UBLOXCFG_VALUE_t &val)
+    {
+        return static_cast<T>(TypeTraits<TYPE>::get(val));
+    }
+};
+
+#ifndef _DOXYGEN_
+// Value of type V converts to value type T without narrowing (brace-init rules), enums and bool must match exactly
+template<typename T, typename V, typename = void>
+struct _IsLossless : std::false_type { };
+template<typename T, typename V>
+struct _IsLossless<T, V, std::void_t<decltype(T{ std::declval<V>() })>> : std::bool_constant<
+    (std::is_enum_v<T> || std::is_enum_v<V> || std::is_same_v<T, bool> || std::is_same_v<V, bool>) ?
+        std::is_same_v<T, V> : true> { };
+#endif
+
+//! Make key-value pair
+/*!
+    \param[in]  item   The configuration item (e.g. ubloxcfg::CFG_RATE_MEAS)
+    \param[in]  value  The value, must convert to the item's value type without narrowing
+
+    \returns the key-value pair
+*/
+template<typename ItemT, typename V>
+inline UBLOXCFG_KEYVAL_t keyVal(const ItemT &item, const V value)
+{
+    static_assert(_IsLossless<typename ItemT::Type, std::remove_cv_t<V>>::value,
+        "Value type does not match item type (or narrowing conversion)");
+    (void)item;
+    UBLOXCFG_KEYVAL_t kv;
+    kv.id = ItemT::id;
+    kv.val = ItemT::encode(static_cast<typename ItemT::Type>(value));
+    return kv;
+}
+
+//! Make key-value pair from a constant value
+/*!
+    \tparam     VALUE  The value, must be representable in the item's value type (e.g. keyVal<100>(CFG_RATE_MEAS))
+    \param[in]  item   The configuration item (e.g. ubloxcfg::CFG_RATE_MEAS)
+
+    \returns the key-value pair
+*/
+template<auto VALUE, typename ItemT>
+inline UBLOXCFG_KEYVAL_t keyVal(const ItemT &item)
+{
+    using T = typename ItemT::Type;
+    using V = std::remove_cv_t<decltype(VALUE)>;
+    static_assert( !(std::is_enum_v<T> || std::is_enum_v<V> || std::is_same_v<T, bool> || std::is_same_v<V, bool>) ||
+        std::is_same_v<T, V>, "Value type does not match item type");
+    constexpr T value { VALUE }; // narrowing (value out of range) is an error here
+    return keyVal(item, value);
+}
+
+//! Get value from key-value list
+/*!
+    \param[in]   kv     List of key-value pairs
+    \param[in]   nKv    Number of key-value pairs
+    \param[in]   item   The configuration item (e.g. ubloxcfg::CFG_RATE_MEAS)
+    \param[out]  value  The value
+
+    \returns true if the item was found, false otherwise
+*/
+template<typename ItemT>
+inline bool getValue(const UBLOXCFG_KEYVAL_t *kv, const int nKv, const ItemT &item, typename ItemT::Type &value)
+{
+    (void)item;
+    for (int ix = 0; ix < nKv; ix++)
+    {
+        if (kv[ix].id == ItemT::id)
+        {
+            value = ItemT::decode(kv[ix].val);
+            return true;
+        }
+    }
+    return false;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
+
+#ifndef _DOXYGEN_
+template<typename ItemT, typename... ItemTs>
+struct _IndexOf
+{
+    static_assert(sizeof...(ItemTs) > 0, "Item is not part of this Config<>");
+};
+template<typename ItemT, typename... ItemTs>
+struct _IndexOf<ItemT, ItemT, ItemTs...> : std::integral_constant<std::size_t, 0> { };
+template<typename ItemT, typename FirstT, typename... ItemTs>
+struct _IndexOf<ItemT, FirstT, ItemTs...> : std::integral_constant<std::size_t, 1 + _IndexOf<ItemT, ItemTs...>::value> { };
+#endif
+
+//! Typed configuration (a set of items and their values)
+/*!
+    \tparam ItemTs  The configuration items (e.g. decltype(ubloxcfg::CFG_RATE_MEAS))
+*/
+template<typename... ItemTs>
+class Config
+{
+    public:
+        //! Number of items
+        static constexpr std::size_t num = sizeof...(ItemTs);
+
+        //! Item IDs
+        static constexpr std::array<uint32_t, sizeof...(ItemTs)> ids = { { ItemTs::id... } };
+
+        //! Set value (must convert to the item's value type without narrowing, see keyVal())
+        template<typename ItemT, typename V>
+        void set(const ItemT &item, const V value)
+        {
+            static_assert(_IsLossless<typename ItemT::Type, std::remove_cv_t<V>>::value,
+                "Value type does not match item type (or narrowing conversion)");
+            (void)item;
+            constexpr std::size_t ix = _IndexOf<ItemT, std::remove_cv_t<ItemTs>...>::value;
+            std::get<ix>(_values) = static_cast<typename ItemT::Type>(value);
+            _have[ix] = true;
+        }
+
+        //! Get value (or default value if item is not set)
+        template<typename ItemT>
+        typename ItemT::Type get(const ItemT &item, const typename ItemT::Type def = typename ItemT::Type()) const
+        {
+            (void)item;
+            constexpr std::size_t ix = _IndexOf<ItemT, std::remove_cv_t<ItemTs>...>::value;
+            return _have[ix] ? std::get<ix>(_values) : def;
+        }
+
+        //! Check if value is set
+        template<typename ItemT>
+        bool have(const ItemT &item) const
+        {
+            (void)item;
+            return _have[_IndexOf<ItemT, std::remove_cv_t<ItemTs>...>::value];
+        }
+
+        //! Set values from key-value list (e.g. from rxGetConfig()), items not part of this Config<> are ignored
+        /*!
+            \returns the number of items set
+        */
+        int parse(const UBLOXCFG_KEYVAL_t *kv, const int nKv)
+        {
+            int n = 0;
+            for (int ix = 0; ix < nKv; ix++)
+            {
+                if (_set(kv[ix].id, kv[ix].val, std::index_sequence_for<ItemTs...>()))
+                {
+                    n++;
+                }
+            }
+            return n;
+        }
+
+        //! Set values from configuration data (e.g. UBX-CFG-VALGET.cfgData), items not part of this Config<> are ignored
+        /*!
+            \returns true if the data was valid, false otherwise
+        */
+        bool parseData(const uint8_t *data, const int size)
+        {
+            int offs = 0;
+            while ((offs + 4) <= size)
+            {
+                const uint32_t id = (uint32_t)data[offs] | ((uint32_t)data[offs + 1] << 8) |
+                    ((uint32_t)data[offs + 2] << 16) | ((uint32_t)data[offs + 3] << 24);
+                offs += 4;
+                int valSize = 0;
+                switch (UBLOXCFG_ID2SIZE(id))
+                {
+                    case UBLOXCFG_SIZE_BIT:
+                    case UBLOXCFG_SIZE_ONE:   valSize = 1; break;
+                    case UBLOXCFG_SIZE_TWO:   valSize = 2; break;
+                    case UBLOXCFG_SIZE_FOUR:  valSize = 4; break;
+                    case UBLOXCFG_SIZE_EIGHT: valSize = 8; break;
+                }
+                if ( (valSize == 0) || ((offs + valSize) > size) )
+                {
+                    return false;
+                }
+                UBLOXCFG_VALUE_t val;
+                val._raw = 0;
+                for (int ix = 0; ix < valSize; ix++)
+                {
+                    val._bytes[ix] = data[offs + ix];
+                }
+                offs += valSize;
+                _set(id, val, std::index_sequence_for<ItemTs...>());
+            }
+            return offs == size;
+        }
+
+        //! Make key-value list of the set items (e.g. for ubxKeyValToUbxCfgValset())
+        /*!
+            \param[out]  kv     List of key-value pairs (should have space for #num items)
+            \param[in]   maxKv  Size of the list
+
+            \returns the number of key-value pairs, or -1 if the list is too small
+        */
+        int keyVals(UBLOXCFG_KEYVAL_t *kv, const int maxKv) const
+        {
+            int n = 0;
+            bool ok = true;
+            _keyVals(kv, maxKv, n, ok, std::index_sequence_for<ItemTs...>());
+            return ok ? n : -1;
+        }
+
+    private:
+        std::tuple<typename ItemTs::Type...> _values;
+        bool _have[sizeof...(ItemTs) > 0 ? sizeof...(ItemTs) : 1] = { };
+
+        template<std::size_t... IXs>
+        bool _set(const uint32_t id, const UBLOXCFG_VALUE_t &val, std::index_sequence<IXs...>)
+        {
+            return ( _setOne<IXs, ItemTs>(id, val) || ... );
+        }
+
+        template<std::size_t IX, typename ItemT>
+        bool _setOne(const uint32_t id, const UBLOXCFG_VALUE_t &val)
+        {
+            if (id != ItemT::id)
+            {
+                return false;
+            }
+            std::get<IX>(_values) = ItemT::decode(val);
+            _have[IX] = true;
+            return true;
+        }
+
+        template<std::size_t... IXs>
+        void _keyVals(UBLOXCFG_KEYVAL_t *kv, const int maxKv, int &n, bool &ok, std::index_sequence<IXs...>) const
+        {
+            ( _keyValOne<IXs, ItemTs>(kv, maxKv, n, ok), ... );
+        }
+
+        template<std::size_t IX, typename ItemT>
+        void _keyValOne(UBLOXCFG_KEYVAL_t *kv, const int maxKv, int &n, bool &ok) const
+        {
+            if (!_have[IX])
+            {
+                return;
+            }
+            if (n >= maxKv)
+            {
+                ok = false;
+                return;
+            }
+            kv[n].id = ItemT::id;
+            kv[n].val = ItemT::encode(std::get<IX>(_values));
+            n++;
+        }
+};
+
+///@}
+
+/* ****************************************************************************************************************** */
+
+} // namespace ubloxcfg
+
+#include "ubloxcfg_gen.hpp"
+
+#endif // __UBLOXCFG_HPP__
+// eof
@@ -24,6 +24,7 @@
 // - u-center 20.01, copyright (c) 2020 u-blox AG
 
 #include <stddef.h>
+#include <stdint.h>
 #include "ubloxcfg.h"
 #include "ubloxcfg_gen.h"
 
@@ -8026,6 +8027,129 @@ static const UBLOXCFG_ITEM_t * const ubloxcfg_allItems[925] =
     &ubloxcfg_cfgUbloxcfgtestE4
 };
 
+static const uint16_t ubloxcfg_itemsById[925] =
+{
+    846, 847, 848, 849, 850, 767, 771, 772, 773, 774, 775, 781, 783, 784, 785, 755,
+    651, 653, 656, 657, 682, 683, 706, 707, 708, 709,   2,   5,   9,  13,  17, 787,
+    788, 790, 792, 793, 795, 796, 798, 799, 800, 802, 803, 786, 789, 791, 794, 797,
+    801,   0, 747, 748, 749, 750, 731, 732, 733,  57,  59,  36,  37, 862, 874, 875,
+    806, 807, 808, 809, 883, 884,  38,  39,  40,  41,  42,  43,  44, 863, 864, 865,
+    866, 867, 868, 869, 876, 877, 878, 879, 880, 881, 882, 900, 901, 902, 903, 904,
+    905, 906, 810, 811, 812, 813, 814, 815, 816, 686, 687, 688, 689, 691, 692, 693,
+    694, 695, 696, 697, 698, 699, 700, 701, 702, 853, 854,  21,  22,  23,  24,  25,
+     26,  27,  28, 737, 738, 722, 723, 724, 726, 727, 728, 730,  60,  61,  62, 752,
+    907, 817, 818, 822, 823, 824, 828, 829, 830, 851, 834, 835, 852, 757, 758, 761,
+    762, 765, 766, 780, 746, 650, 654, 655, 667, 668, 669, 670, 671, 672, 680, 681,
+    649, 736, 710, 711, 712, 713, 714,   1,   3,   4,  67,  55,  56,  58,  35, 859,
+    860, 861, 871, 872, 873, 805, 387, 384, 385, 388, 386, 372, 369, 370, 373, 371,
+    402, 399, 400, 403, 401, 422, 419, 420, 423, 421, 322, 319, 320, 323, 321, 377,
+    374, 375, 378, 376, 382, 379, 380, 383, 381, 357, 354, 355, 358, 356, 362, 359,
+    360, 363, 361, 337, 334, 335, 338, 336, 467, 464, 465, 468, 466, 472, 469, 470,
+    473, 471, 447, 444, 445, 448, 446, 442, 439, 440, 443, 441, 432, 429, 430, 433,
+    431, 437, 434, 435, 438, 436, 462, 459, 460, 463, 461, 452, 449, 450, 453, 451,
+    327, 324, 325, 328, 326, 407, 404, 405, 408, 406, 317, 314, 315, 318, 316, 367,
+    364, 365, 368, 366, 332, 329, 330, 333, 331, 427, 424, 425, 428, 426, 397, 394,
+    395, 398, 396, 642, 639, 640, 643, 641, 352, 349, 350, 353, 351,  72,  69,  70,
+     73,  71, 122, 119, 120, 123, 121, 137, 134, 135, 138, 136,  92,  89,  90,  93,
+     91,  82,  79,  80,  83,  81, 102,  99, 100, 103, 101, 112, 109, 110, 113, 111,
+     87,  84,  85,  88,  86,  97,  94,  95,  98,  96, 107, 104, 105, 108, 106, 142,
+    139, 140, 143, 141,  77,  74,  75,  78,  76, 127, 124, 125, 128, 126, 132, 129,
+    130, 133, 131, 147, 144, 145, 148, 146, 152, 149, 150, 153, 151, 157, 154, 155,
+    158, 156, 242, 239, 240, 243, 241, 222, 219, 220, 223, 221, 227, 224, 225, 228,
+    226, 347, 344, 345, 348, 346, 632, 629, 630, 633, 631, 637, 634, 635, 638, 636,
+    292, 289, 290, 293, 291, 277, 274, 275, 278, 276, 312, 309, 310, 313, 311, 287,
+    284, 285, 288, 286, 272, 269, 270, 273, 271, 267, 264, 265, 268, 266, 257, 254,
+    255, 258, 256, 602, 599, 600, 603, 601, 622, 619, 620, 623, 621, 247, 244, 245,
+    248, 246, 612, 609, 610, 613, 611, 617, 614, 615, 618, 616, 232, 229, 230, 233,
+    231, 237, 234, 235, 238, 236, 607, 604, 605, 608, 606, 162, 159, 160, 163, 161,
+    172, 169, 170, 173, 171, 182, 179, 180, 183, 181, 202, 199, 200, 203, 201, 212,
+    209, 210, 213, 211, 207, 204, 205, 208, 206, 343, 339, 340, 342, 341, 192, 189,
+    190, 193, 191, 307, 304, 305, 308, 306, 417, 414, 415, 418, 416, 412, 409, 410,
+    413, 411, 252, 249, 250, 253, 251, 262, 259, 260, 263, 261, 282, 279, 280, 283,
+    281, 167, 164, 165, 168, 166, 177, 174, 175, 178, 176, 187, 184, 185, 188, 186,
+    197, 194, 195, 198, 196, 217, 214, 215, 218, 216, 457, 454, 455, 458, 456, 297,
+    294, 295, 298, 296, 117, 114, 115, 118, 116, 477, 474, 475, 478, 476, 482, 479,
+    480, 483, 481, 487, 484, 485, 488, 486, 492, 489, 490, 493, 491, 502, 499, 500,
+    503, 501, 507, 504, 505, 508, 506, 512, 509, 510, 513, 511, 517, 514, 515, 518,
+    516, 522, 519, 520, 523, 521, 527, 524, 525, 528, 526, 532, 529, 530, 533, 531,
+    537, 534, 535, 538, 536, 542, 539, 540, 543, 541, 547, 544, 545, 548, 546, 552,
+    549, 550, 553, 551, 557, 554, 555, 558, 556, 562, 559, 560, 563, 561, 567, 564,
+    565, 568, 566, 572, 569, 570, 573, 571, 582, 579, 580, 583, 581, 587, 584, 585,
+    588, 586, 592, 589, 590, 593, 591, 497, 494, 495, 498, 496, 577, 574, 575, 578,
+    576, 627, 624, 625, 628, 626, 392, 389, 390, 393, 391, 647, 644, 645, 648, 646,
+    302, 299, 300, 303, 301, 597, 594, 595, 598, 596,  45,  46,  47,  48,  49,  50,
+     51,  52,  53,  54, 684, 685, 690, 703, 704, 855, 857,  29,  30,  31,  32,  33,
+     34, 804, 739, 715, 720, 721, 725, 908, 912, 916, 922, 836, 756, 759, 760, 763,
+    764, 769, 770, 779, 782, 744, 745, 652, 673, 674, 675, 676, 677, 734, 735,  68,
+    885, 886, 887, 705, 856, 719,  63,  64,  65, 753, 754, 909, 913, 917, 923, 819,
+    820, 821, 825, 826, 827, 831, 832, 833, 837, 838, 841, 842, 845, 839, 840, 768,
+    776, 777, 778, 660, 661, 662, 663, 664, 665, 666, 678, 679,   6,   7,   8,  10,
+     11,  12,  14,  15,  16,  18,  19,  20, 858, 870, 716, 717, 718, 729,  66, 910,
+    914, 918, 920, 924, 843, 844, 658, 659, 751, 888, 889, 890, 891, 892, 893, 894,
+    895, 896, 897, 898, 899, 740, 741, 742, 743, 911, 915, 919, 921
+};
+static const uint16_t ubloxcfg_itemsByName[925] =
+{
+      0,   1,   6,   7,   8,  10,  11,  12,  14,  15,  16,  18,  19,  20,   4,   3,
+      5,   9,  13,  17,   2,  24,  25,  26,  27,  28,  22,  23,  21,  32,  31,  34,
+     30,  33,  29,  35,  37,  36,  39,  40,  41,  38,  43,  44,  42,  50,  54,  51,
+     52,  53,  45,  49,  46,  47,  48,  58,  55,  56,  57,  59,  62,  63,  61,  66,
+     60,  65,  64,  68,  67,  72,  71,  69,  70,  73,  77,  76,  74,  75,  78,  82,
+     81,  79,  80,  83,  87,  86,  84,  85,  88,  92,  91,  89,  90,  93,  97,  96,
+     94,  95,  98, 102, 101,  99, 100, 103, 107, 106, 104, 105, 108, 112, 111, 109,
+    110, 113, 117, 116, 114, 115, 118, 122, 121, 119, 120, 123, 127, 126, 124, 125,
+    128, 132, 131, 129, 130, 133, 137, 136, 134, 135, 138, 142, 141, 139, 140, 143,
+    147, 146, 144, 145, 148, 152, 151, 149, 150, 153, 157, 156, 154, 155, 158, 162,
+    161, 159, 160, 163, 167, 166, 164, 165, 168, 172, 171, 169, 170, 173, 177, 176,
+    174, 175, 178, 182, 181, 179, 180, 183, 187, 186, 184, 185, 188, 192, 191, 189,
+    190, 193, 197, 196, 194, 195, 198, 202, 201, 199, 200, 203, 207, 206, 204, 205,
+    208, 212, 211, 209, 210, 213, 217, 216, 214, 215, 218, 222, 221, 219, 220, 223,
+    227, 226, 224, 225, 228, 232, 231, 229, 230, 233, 237, 236, 234, 235, 238, 242,
+    241, 239, 240, 243, 247, 246, 244, 245, 248, 252, 251, 249, 250, 253, 257, 256,
+    254, 255, 258, 262, 261, 259, 260, 263, 267, 266, 264, 265, 268, 272, 271, 269,
+    270, 273, 277, 276, 274, 275, 278, 282, 281, 279, 280, 283, 287, 286, 284, 285,
+    288, 292, 291, 289, 290, 293, 297, 296, 294, 295, 298, 302, 301, 299, 300, 303,
+    307, 306, 304, 305, 308, 312, 311, 309, 310, 313, 482, 481, 479, 480, 483, 487,
+    486, 484, 485, 488, 492, 491, 489, 490, 493, 497, 496, 494, 495, 498, 502, 501,
+    499, 500, 503, 507, 506, 504, 505, 508, 512, 511, 509, 510, 513, 517, 516, 514,
+    515, 518, 522, 521, 519, 520, 523, 527, 526, 524, 525, 528, 532, 531, 529, 530,
+    533, 537, 536, 534, 535, 538, 542, 541, 539, 540, 543, 547, 546, 544, 545, 548,
+    552, 551, 549, 550, 553, 557, 556, 554, 555, 558, 562, 561, 559, 560, 563, 567,
+    566, 564, 565, 568, 572, 571, 569, 570, 573, 577, 576, 574, 575, 578, 582, 581,
+    579, 580, 583, 587, 586, 584, 585, 588, 592, 591, 589, 590, 593, 317, 316, 314,
+    315, 318, 322, 321, 319, 320, 323, 327, 326, 324, 325, 328, 332, 331, 329, 330,
+    333, 337, 336, 334, 335, 338, 343, 341, 339, 340, 342, 347, 346, 344, 345, 348,
+    352, 351, 349, 350, 353, 357, 356, 354, 355, 358, 362, 361, 359, 360, 363, 367,
+    366, 364, 365, 368, 372, 371, 369, 370, 373, 477, 476, 474, 475, 478, 377, 376,
+    374, 375, 378, 382, 381, 379, 380, 383, 392, 391, 389, 390, 393, 387, 386, 384,
+    385, 388, 397, 396, 394, 395, 398, 402, 401, 399, 400, 403, 407, 406, 404, 405,
+    408, 412, 411, 409, 410, 413, 417, 416, 414, 415, 418, 422, 421, 419, 420, 423,
+    427, 426, 424, 425, 428, 432, 431, 429, 430, 433, 437, 436, 434, 435, 438, 442,
+    441, 439, 440, 443, 447, 446, 444, 445, 448, 452, 451, 449, 450, 453, 457, 456,
+    454, 455, 458, 462, 461, 459, 460, 463, 467, 466, 464, 465, 468, 472, 471, 469,
+    470, 473, 597, 596, 594, 595, 598, 602, 601, 599, 600, 603, 607, 606, 604, 605,
+    608, 612, 611, 609, 610, 613, 617, 616, 614, 615, 618, 622, 621, 619, 620, 623,
+    627, 626, 624, 625, 628, 647, 646, 644, 645, 648, 632, 631, 629, 630, 633, 637,
+    636, 634, 635, 638, 642, 641, 639, 640, 643, 682, 683, 649, 656, 678, 679, 680,
+    655, 650, 672, 668, 669, 670, 667, 671, 651, 677, 675, 673, 676, 674, 681, 653,
+    657, 660, 661, 662, 659, 658, 663, 664, 665, 666, 654, 652, 705, 686, 687, 696,
+    693, 695, 691, 694, 692, 704, 689, 688, 703, 685, 702, 700, 697, 699, 698, 701,
+    684, 690, 714, 712, 711, 709, 708, 710, 707, 706, 713, 717, 722, 727, 728, 729,
+    725, 726, 718, 730, 721, 720, 719, 715, 716, 724, 723, 731, 733, 732, 734, 735,
+    736, 738, 740, 741, 742, 743, 739, 737, 745, 746, 744, 751, 749, 750, 748, 747,
+    752, 753, 754, 755, 764, 762, 763, 761, 767, 760, 758, 759, 757, 756, 765, 766,
+    769, 770, 768, 781, 771, 778, 784, 773, 774, 775, 785, 776, 780, 779, 777, 782,
+    772, 783, 795, 796, 794, 792, 793, 791, 801, 802, 803, 786, 787, 788, 797, 798,
+    799, 800, 789, 790, 804, 807, 806, 809, 808, 805, 811, 812, 813, 810, 815, 816,
+    814, 819, 822, 820, 823, 821, 824, 831, 827, 830, 825, 828, 826, 829, 817, 818,
+    833, 832, 849, 836, 852, 844, 843, 840, 839, 842, 841, 838, 837, 850, 834, 835,
+    847, 851, 846, 845, 848, 853, 857, 855, 854, 856, 858, 860, 862, 861, 859, 864,
+    865, 866, 863, 868, 869, 867, 870, 872, 874, 873, 875, 871, 877, 878, 879, 876,
+    881, 882, 880, 922, 923, 924, 912, 913, 914, 915, 907, 920, 921, 908, 909, 910,
+    911, 916, 917, 918, 919, 883, 887, 886, 892, 893, 894, 895, 884, 896, 897, 898,
+    899, 885, 888, 889, 890, 891, 901, 902, 903, 900, 905, 906, 904
+};
+
 static const UBLOXCFG_MSGRATE_t ubloxcfg_nmeaPubxPosition =
 {
     .msgName   = "NMEA-PUBX-POSITION",
@@ -9315,6 +9439,8 @@ static const char * const ubloxcfg_allSources[5] =
 
 #ifndef _DOXYGEN_
 const void **_ubloxcfg_allItems(void) { return (const void **)ubloxcfg_allItems; }
+const uint16_t *_ubloxcfg_itemsById(void) { return ubloxcfg_itemsById; }
+const uint16_t *_ubloxcfg_itemsByName(void) { return ubloxcfg_itemsByName; }
 const void **_ubloxcfg_allRates(void) { return (const void **)ubloxcfg_allRates; }
 const char **_ubloxcfg_allSources(void) { return (const char **)ubloxcfg_allSources; }
 #endif
@@ -11773,6 +11773,8 @@ typedef enum UBLOXCFG_CFG_UBLOXCFGTEST_E4_e
 #ifndef _DOXYGEN_
 #define _UBLOXCFG_NUM_ITEMS 925
 const void **_ubloxcfg_allItems(void);
+const uint16_t *_ubloxcfg_itemsById(void);
+const uint16_t *_ubloxcfg_itemsByName(void);
 #define _UBLOXCFG_NUM_RATES 116
 const void **_ubloxcfg_allRates(void);
 #define _UBLOXCFG_MAX_ITEM_LEN 35
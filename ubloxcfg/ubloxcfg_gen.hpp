@@ -0,0 +1,1861 @@
+// u-blox 9 positioning receivers configuration library
+//
+// Copyright (c) 2020-2021 Philippe Kehl (flipflip at oinkzwurgl dot org),
+// https://oinkzwurgl.org/hacking/ubloxcfg
+//
+//    This program is free software: you can redistribute it and/or modify it under the terms of the
+//    GNU Lesser General Public License as published by the Free Software Foundation, either version 3
+//    of the License, or (at your option) any later version.
+//
+//    This program is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+//    without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+//    See the GNU Lesser General Public License for more details.
+//
+//    You should have received a copy of the GNU Lesser General Public License along with this
+//    program. If not, see <https://www.gnu.org/licenses/>.
+//
+// This file is automatically generated. Do not edit.
+
+
+#ifndef __UBLOXCFG_GEN_HPP__
+#define __UBLOXCFG_GEN_HPP__
+
+#include "ubloxcfg.hpp"
+
+namespace ubloxcfg {
+
+/*!
+    \addtogroup UBLOXCFG_CPP
+    @{
+*/
+
+// CFG-BDS
+inline constexpr Item<UBLOXCFG_CFG_BDS_USE_GEO_PRN_ID, UBLOXCFG_TYPE_L>                                               CFG_BDS_USE_GEO_PRN {};                  //!< CFG-BDS-USE_GEO_PRN (Use BeiDou geostationary satellites (PRN 1-5, 59-63), a.k.a. CFG-BDS-USE_PRN_1_TO_5)
+
+// CFG-GEOFENCE
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_CONFLVL_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_GEOFENCE_CONFLVL_t>            CFG_GEOFENCE_CONFLVL {};                 //!< CFG-GEOFENCE-CONFLVL (Required confidence level for state evaluation)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_USE_PIO_ID, UBLOXCFG_TYPE_L>                                              CFG_GEOFENCE_USE_PIO {};                 //!< CFG-GEOFENCE-USE_PIO (Use PIO combined fence state output)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_PINPOL_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_GEOFENCE_PINPOL_t>              CFG_GEOFENCE_PINPOL {};                  //!< CFG-GEOFENCE-PINPOL (PIO pin polarity)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_PIN_ID, UBLOXCFG_TYPE_U1>                                                 CFG_GEOFENCE_PIN {};                     //!< CFG-GEOFENCE-PIN (PIO pin number)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_USE_FENCE1_ID, UBLOXCFG_TYPE_L>                                           CFG_GEOFENCE_USE_FENCE1 {};              //!< CFG-GEOFENCE-USE_FENCE1 (Use first geofence)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE1_LAT_ID, UBLOXCFG_TYPE_I4>                                          CFG_GEOFENCE_FENCE1_LAT {};              //!< CFG-GEOFENCE-FENCE1_LAT (Latitude of the first geofence circle center)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE1_LON_ID, UBLOXCFG_TYPE_I4>                                          CFG_GEOFENCE_FENCE1_LON {};              //!< CFG-GEOFENCE-FENCE1_LON (Longitude of the first geofence circle center)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE1_RAD_ID, UBLOXCFG_TYPE_U4>                                          CFG_GEOFENCE_FENCE1_RAD {};              //!< CFG-GEOFENCE-FENCE1_RAD (Radius of the first geofence circle)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_USE_FENCE2_ID, UBLOXCFG_TYPE_L>                                           CFG_GEOFENCE_USE_FENCE2 {};              //!< CFG-GEOFENCE-USE_FENCE2 (Use second geofence)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE2_LAT_ID, UBLOXCFG_TYPE_I4>                                          CFG_GEOFENCE_FENCE2_LAT {};              //!< CFG-GEOFENCE-FENCE2_LAT (Latitude of the second geofence circle center)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE2_LON_ID, UBLOXCFG_TYPE_I4>                                          CFG_GEOFENCE_FENCE2_LON {};              //!< CFG-GEOFENCE-FENCE2_LON (Longitude of the second geofence circle center)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE2_RAD_ID, UBLOXCFG_TYPE_U4>                                          CFG_GEOFENCE_FENCE2_RAD {};              //!< CFG-GEOFENCE-FENCE2_RAD (Radius of the second geofence circle)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_USE_FENCE3_ID, UBLOXCFG_TYPE_L>                                           CFG_GEOFENCE_USE_FENCE3 {};              //!< CFG-GEOFENCE-USE_FENCE3 (Use third geofence)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE3_LAT_ID, UBLOXCFG_TYPE_I4>                                          CFG_GEOFENCE_FENCE3_LAT {};              //!< CFG-GEOFENCE-FENCE3_LAT (Latitude of the third geofence circle center)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE3_LON_ID, UBLOXCFG_TYPE_I4>                                          CFG_GEOFENCE_FENCE3_LON {};              //!< CFG-GEOFENCE-FENCE3_LON (Longitude of the third geofence circle center)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE3_RAD_ID, UBLOXCFG_TYPE_U4>                                          CFG_GEOFENCE_FENCE3_RAD {};              //!< CFG-GEOFENCE-FENCE3_RAD (Radius of the third geofence circle)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_USE_FENCE4_ID, UBLOXCFG_TYPE_L>                                           CFG_GEOFENCE_USE_FENCE4 {};              //!< CFG-GEOFENCE-USE_FENCE4 (Use fourth geofence)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE4_LAT_ID, UBLOXCFG_TYPE_I4>                                          CFG_GEOFENCE_FENCE4_LAT {};              //!< CFG-GEOFENCE-FENCE4_LAT (Latitude of the fourth geofence circle center)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE4_LON_ID, UBLOXCFG_TYPE_I4>                                          CFG_GEOFENCE_FENCE4_LON {};              //!< CFG-GEOFENCE-FENCE4_LON (Longitude of the fourth geofence circle center)
+inline constexpr Item<UBLOXCFG_CFG_GEOFENCE_FENCE4_RAD_ID, UBLOXCFG_TYPE_U4>                                          CFG_GEOFENCE_FENCE4_RAD {};              //!< CFG-GEOFENCE-FENCE4_RAD (Radius of the fourth geofence circle)
+
+// CFG-HW
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_CFG_VOLTCTRL_ID, UBLOXCFG_TYPE_L>                                           CFG_HW_ANT_CFG_VOLTCTRL {};              //!< CFG-HW-ANT_CFG_VOLTCTRL (Active antenna voltage control flag)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_CFG_SHORTDET_ID, UBLOXCFG_TYPE_L>                                           CFG_HW_ANT_CFG_SHORTDET {};              //!< CFG-HW-ANT_CFG_SHORTDET (Short antenna detection flag)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_CFG_SHORTDET_POL_ID, UBLOXCFG_TYPE_L>                                       CFG_HW_ANT_CFG_SHORTDET_POL {};          //!< CFG-HW-ANT_CFG_SHORTDET_POL (Short antenna detection polarity)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_CFG_OPENDET_ID, UBLOXCFG_TYPE_L>                                            CFG_HW_ANT_CFG_OPENDET {};               //!< CFG-HW-ANT_CFG_OPENDET (Open antenna detection flag)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_CFG_OPENDET_POL_ID, UBLOXCFG_TYPE_L>                                        CFG_HW_ANT_CFG_OPENDET_POL {};           //!< CFG-HW-ANT_CFG_OPENDET_POL (Open antenna detection polarity)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_CFG_PWRDOWN_ID, UBLOXCFG_TYPE_L>                                            CFG_HW_ANT_CFG_PWRDOWN {};               //!< CFG-HW-ANT_CFG_PWRDOWN (Power down antenna flag)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_CFG_PWRDOWN_POL_ID, UBLOXCFG_TYPE_L>                                        CFG_HW_ANT_CFG_PWRDOWN_POL {};           //!< CFG-HW-ANT_CFG_PWRDOWN_POL (Power down antenna logic polarity)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_CFG_RECOVER_ID, UBLOXCFG_TYPE_L>                                            CFG_HW_ANT_CFG_RECOVER {};               //!< CFG-HW-ANT_CFG_RECOVER (Automatic recovery from short state flag)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_SUP_SWITCH_PIN_ID, UBLOXCFG_TYPE_U1>                                        CFG_HW_ANT_SUP_SWITCH_PIN {};            //!< CFG-HW-ANT_SUP_SWITCH_PIN (ANT1 PIO number)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_SUP_SHORT_PIN_ID, UBLOXCFG_TYPE_U1>                                         CFG_HW_ANT_SUP_SHORT_PIN {};             //!< CFG-HW-ANT_SUP_SHORT_PIN (ANT0 PIO number)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_SUP_OPEN_PIN_ID, UBLOXCFG_TYPE_U1>                                          CFG_HW_ANT_SUP_OPEN_PIN {};              //!< CFG-HW-ANT_SUP_OPEN_PIN (ANT2 PIO number)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_SUP_ENGINE_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_HW_ANT_SUP_ENGINE_t>          CFG_HW_ANT_SUP_ENGINE {};                //!< CFG-HW-ANT_SUP_ENGINE (Antenna supervisor engine selection)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_SUP_SHORT_THR_ID, UBLOXCFG_TYPE_U1>                                         CFG_HW_ANT_SUP_SHORT_THR {};             //!< CFG-HW-ANT_SUP_SHORT_THR (Antenna supervisor MADC engine short detection threshold)
+inline constexpr Item<UBLOXCFG_CFG_HW_ANT_SUP_OPEN_THR_ID, UBLOXCFG_TYPE_U1>                                          CFG_HW_ANT_SUP_OPEN_THR {};              //!< CFG-HW-ANT_SUP_OPEN_THR (Antenna supervisor MADC engine open detection threshold)
+
+// CFG-I2C
+inline constexpr Item<UBLOXCFG_CFG_I2C_ADDRESS_ID, UBLOXCFG_TYPE_U1>                                                  CFG_I2C_ADDRESS {};                      //!< CFG-I2C-ADDRESS (I2C slave address of the receiver (7 bits))
+inline constexpr Item<UBLOXCFG_CFG_I2C_EXTENDEDTIMEOUT_ID, UBLOXCFG_TYPE_L>                                           CFG_I2C_EXTENDEDTIMEOUT {};              //!< CFG-I2C-EXTENDEDTIMEOUT (Flag to disable timeouting the interface after 1.5 s)
+inline constexpr Item<UBLOXCFG_CFG_I2C_ENABLED_ID, UBLOXCFG_TYPE_L>                                                   CFG_I2C_ENABLED {};                      //!< CFG-I2C-ENABLED (Flag to indicate if the I2C interface should be enabled)
+
+// CFG-I2CINPROT
+inline constexpr Item<UBLOXCFG_CFG_I2CINPROT_UBX_ID, UBLOXCFG_TYPE_L>                                                 CFG_I2CINPROT_UBX {};                    //!< CFG-I2CINPROT-UBX (Flag to indicate if UBX should be an input protocol on I2C)
+inline constexpr Item<UBLOXCFG_CFG_I2CINPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                                CFG_I2CINPROT_NMEA {};                   //!< CFG-I2CINPROT-NMEA (Flag to indicate if NMEA should be an input protocol on I2C)
+inline constexpr Item<UBLOXCFG_CFG_I2CINPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                              CFG_I2CINPROT_RTCM3X {};                 //!< CFG-I2CINPROT-RTCM3X (Flag to indicate if RTCM3X should be an input protocol on I2C)
+inline constexpr Item<UBLOXCFG_CFG_I2CINPROT_SPARTN_ID, UBLOXCFG_TYPE_L>                                              CFG_I2CINPROT_SPARTN {};                 //!< CFG-I2CINPROT-SPARTN (Flag to indicate if SPARTN should be an input protocol on I2C)
+
+// CFG-I2COUTPROT
+inline constexpr Item<UBLOXCFG_CFG_I2COUTPROT_UBX_ID, UBLOXCFG_TYPE_L>                                                CFG_I2COUTPROT_UBX {};                   //!< CFG-I2COUTPROT-UBX (Flag to indicate if UBX should be an output protocol on I2C)
+inline constexpr Item<UBLOXCFG_CFG_I2COUTPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                               CFG_I2COUTPROT_NMEA {};                  //!< CFG-I2COUTPROT-NMEA (Flag to indicate if NMEA should be an output protocol on I2C)
+inline constexpr Item<UBLOXCFG_CFG_I2COUTPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                             CFG_I2COUTPROT_RTCM3X {};                //!< CFG-I2COUTPROT-RTCM3X (Flag to indicate if RTCM3X should be an output protocol on I2C)
+
+// CFG-INFMSG
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_UBX_I2C_ID, UBLOXCFG_TYPE_X1>                                               CFG_INFMSG_UBX_I2C {};                   //!< CFG-INFMSG-UBX_I2C (Information message enable flags for the UBX protocol on the I2C interface)
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_UBX_UART1_ID, UBLOXCFG_TYPE_X1>                                             CFG_INFMSG_UBX_UART1 {};                 //!< CFG-INFMSG-UBX_UART1 (Information message enable flags for the UBX protocol on the UART1 interface)
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_UBX_UART2_ID, UBLOXCFG_TYPE_X1>                                             CFG_INFMSG_UBX_UART2 {};                 //!< CFG-INFMSG-UBX_UART2 (Information message enable flags for the UBX protocol on the UART2 interface)
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_UBX_USB_ID, UBLOXCFG_TYPE_X1>                                               CFG_INFMSG_UBX_USB {};                   //!< CFG-INFMSG-UBX_USB (Information message enable flags for the UBX protocol on the USB interface)
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_UBX_SPI_ID, UBLOXCFG_TYPE_X1>                                               CFG_INFMSG_UBX_SPI {};                   //!< CFG-INFMSG-UBX_SPI (Information message enable flags for the UBX protocol on the SPI interface)
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_NMEA_I2C_ID, UBLOXCFG_TYPE_X1>                                              CFG_INFMSG_NMEA_I2C {};                  //!< CFG-INFMSG-NMEA_I2C (Information message enable flags for the NMEA protocol on the I2C interface)
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_NMEA_UART1_ID, UBLOXCFG_TYPE_X1>                                            CFG_INFMSG_NMEA_UART1 {};                //!< CFG-INFMSG-NMEA_UART1 (Information message enable flags for the NMEA protocol on the UART1 interface)
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_NMEA_UART2_ID, UBLOXCFG_TYPE_X1>                                            CFG_INFMSG_NMEA_UART2 {};                //!< CFG-INFMSG-NMEA_UART2 (Information message enable flags for the NMEA protocol on the UART2 interface)
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_NMEA_USB_ID, UBLOXCFG_TYPE_X1>                                              CFG_INFMSG_NMEA_USB {};                  //!< CFG-INFMSG-NMEA_USB (Information message enable flags for the NMEA protocol on the USB interface)
+inline constexpr Item<UBLOXCFG_CFG_INFMSG_NMEA_SPI_ID, UBLOXCFG_TYPE_X1>                                              CFG_INFMSG_NMEA_SPI {};                  //!< CFG-INFMSG-NMEA_SPI (Information message enable flags for the NMEA protocol on the SPI interface)
+
+// CFG-ITFM
+inline constexpr Item<UBLOXCFG_CFG_ITFM_BBTHRESHOLD_ID, UBLOXCFG_TYPE_U1>                                             CFG_ITFM_BBTHRESHOLD {};                 //!< CFG-ITFM-BBTHRESHOLD (Broadband jamming detection threshold)
+inline constexpr Item<UBLOXCFG_CFG_ITFM_CWTHRESHOLD_ID, UBLOXCFG_TYPE_U1>                                             CFG_ITFM_CWTHRESHOLD {};                 //!< CFG-ITFM-CWTHRESHOLD (CW jamming detection threshold)
+inline constexpr Item<UBLOXCFG_CFG_ITFM_ENABLE_ID, UBLOXCFG_TYPE_L>                                                   CFG_ITFM_ENABLE {};                      //!< CFG-ITFM-ENABLE (Enable interference detection)
+inline constexpr Item<UBLOXCFG_CFG_ITFM_ANTSETTING_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_ITFM_ANTSETTING_t>              CFG_ITFM_ANTSETTING {};                  //!< CFG-ITFM-ANTSETTING (Antenna setting)
+inline constexpr Item<UBLOXCFG_CFG_ITFM_ENABLE_AUX_ID, UBLOXCFG_TYPE_L>                                               CFG_ITFM_ENABLE_AUX {};                  //!< CFG-ITFM-ENABLE_AUX (Scan auxiliary bands)
+
+// CFG-LOGFILTER
+inline constexpr Item<UBLOXCFG_CFG_LOGFILTER_RECORD_ENA_ID, UBLOXCFG_TYPE_L>                                          CFG_LOGFILTER_RECORD_ENA {};             //!< CFG-LOGFILTER-RECORD_ENA (Recording enabled)
+inline constexpr Item<UBLOXCFG_CFG_LOGFILTER_ONCE_PER_WAKE_UP_ENA_ID, UBLOXCFG_TYPE_L>                                CFG_LOGFILTER_ONCE_PER_WAKE_UP_ENA {};   //!< CFG-LOGFILTER-ONCE_PER_WAKE_UP_ENA (Once per wake up)
+inline constexpr Item<UBLOXCFG_CFG_LOGFILTER_APPLY_ALL_FILTERS_ID, UBLOXCFG_TYPE_L>                                   CFG_LOGFILTER_APPLY_ALL_FILTERS {};      //!< CFG-LOGFILTER-APPLY_ALL_FILTERS (Apply all filter settings)
+inline constexpr Item<UBLOXCFG_CFG_LOGFILTER_MIN_INTERVAL_ID, UBLOXCFG_TYPE_U2>                                       CFG_LOGFILTER_MIN_INTERVAL {};           //!< CFG-LOGFILTER-MIN_INTERVAL (Minimum time interval between logged positions)
+inline constexpr Item<UBLOXCFG_CFG_LOGFILTER_TIME_THRS_ID, UBLOXCFG_TYPE_U2>                                          CFG_LOGFILTER_TIME_THRS {};              //!< CFG-LOGFILTER-TIME_THRS (Time threshold)
+inline constexpr Item<UBLOXCFG_CFG_LOGFILTER_SPEED_THRS_ID, UBLOXCFG_TYPE_U2>                                         CFG_LOGFILTER_SPEED_THRS {};             //!< CFG-LOGFILTER-SPEED_THRS (Speed threshold)
+inline constexpr Item<UBLOXCFG_CFG_LOGFILTER_POSITION_THRS_ID, UBLOXCFG_TYPE_U4>                                      CFG_LOGFILTER_POSITION_THRS {};          //!< CFG-LOGFILTER-POSITION_THRS (Position threshold)
+
+// CFG-MOT
+inline constexpr Item<UBLOXCFG_CFG_MOT_GNSSSPEED_THRS_ID, UBLOXCFG_TYPE_U1>                                           CFG_MOT_GNSSSPEED_THRS {};               //!< CFG-MOT-GNSSSPEED_THRS (GNSS speed threshold below which platform is considered as stationary (a.k.a. static hold threshold))
+inline constexpr Item<UBLOXCFG_CFG_MOT_GNSSDIST_THRS_ID, UBLOXCFG_TYPE_U2>                                            CFG_MOT_GNSSDIST_THRS {};                //!< CFG-MOT-GNSSDIST_THRS (Distance above which GNSS-based stationary motion is exit (a.k.a. static hold distance threshold))
+
+// CFG-MSGOUT
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_DTM_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_DTM_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_DTM_UART1 (Output rate of the NMEA-STANDARD-DTM message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_DTM_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_DTM_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_DTM_UART2 (Output rate of the NMEA-STANDARD-DTM message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_DTM_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_DTM_SPI {};           //!< CFG-MSGOUT-NMEA_ID_DTM_SPI (Output rate of the NMEA-STANDARD-DTM message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_DTM_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_DTM_I2C {};           //!< CFG-MSGOUT-NMEA_ID_DTM_I2C (Output rate of the NMEA-STANDARD-DTM message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_DTM_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_DTM_USB {};           //!< CFG-MSGOUT-NMEA_ID_DTM_USB (Output rate of the NMEA-STANDARD-DTM message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GBS_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GBS_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_GBS_UART1 (Output rate of the NMEA-STANDARD-GBS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GBS_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GBS_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_GBS_UART2 (Output rate of the NMEA-STANDARD-GBS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GBS_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GBS_SPI {};           //!< CFG-MSGOUT-NMEA_ID_GBS_SPI (Output rate of the NMEA-STANDARD-GBS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GBS_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GBS_I2C {};           //!< CFG-MSGOUT-NMEA_ID_GBS_I2C (Output rate of the NMEA-STANDARD-GBS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GBS_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GBS_USB {};           //!< CFG-MSGOUT-NMEA_ID_GBS_USB (Output rate of the NMEA-STANDARD-GBS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GGA_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GGA_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_GGA_UART1 (Output rate of the NMEA-STANDARD-GGA message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GGA_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GGA_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_GGA_UART2 (Output rate of the NMEA-STANDARD-GGA message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GGA_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GGA_SPI {};           //!< CFG-MSGOUT-NMEA_ID_GGA_SPI (Output rate of the NMEA-STANDARD-GGA message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GGA_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GGA_I2C {};           //!< CFG-MSGOUT-NMEA_ID_GGA_I2C (Output rate of the NMEA-STANDARD-GGA message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GGA_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GGA_USB {};           //!< CFG-MSGOUT-NMEA_ID_GGA_USB (Output rate of the NMEA-STANDARD-GGA message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GLL_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GLL_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_GLL_UART1 (Output rate of the NMEA-STANDARD-GLL message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GLL_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GLL_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_GLL_UART2 (Output rate of the NMEA-STANDARD-GLL message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GLL_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GLL_SPI {};           //!< CFG-MSGOUT-NMEA_ID_GLL_SPI (Output rate of the NMEA-STANDARD-GLL message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GLL_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GLL_I2C {};           //!< CFG-MSGOUT-NMEA_ID_GLL_I2C (Output rate of the NMEA-STANDARD-GLL message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GLL_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GLL_USB {};           //!< CFG-MSGOUT-NMEA_ID_GLL_USB (Output rate of the NMEA-STANDARD-GLL message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GNS_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GNS_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_GNS_UART1 (Output rate of the NMEA-STANDARD-GNS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GNS_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GNS_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_GNS_UART2 (Output rate of the NMEA-STANDARD-GNS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GNS_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GNS_SPI {};           //!< CFG-MSGOUT-NMEA_ID_GNS_SPI (Output rate of the NMEA-STANDARD-GNS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GNS_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GNS_I2C {};           //!< CFG-MSGOUT-NMEA_ID_GNS_I2C (Output rate of the NMEA-STANDARD-GNS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GNS_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GNS_USB {};           //!< CFG-MSGOUT-NMEA_ID_GNS_USB (Output rate of the NMEA-STANDARD-GNS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GRS_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GRS_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_GRS_UART1 (Output rate of the NMEA-STANDARD-GRS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GRS_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GRS_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_GRS_UART2 (Output rate of the NMEA-STANDARD-GRS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GRS_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GRS_SPI {};           //!< CFG-MSGOUT-NMEA_ID_GRS_SPI (Output rate of the NMEA-STANDARD-GRS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GRS_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GRS_I2C {};           //!< CFG-MSGOUT-NMEA_ID_GRS_I2C (Output rate of the NMEA-STANDARD-GRS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GRS_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GRS_USB {};           //!< CFG-MSGOUT-NMEA_ID_GRS_USB (Output rate of the NMEA-STANDARD-GRS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSA_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GSA_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_GSA_UART1 (Output rate of the NMEA-STANDARD-GSA message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSA_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GSA_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_GSA_UART2 (Output rate of the NMEA-STANDARD-GSA message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSA_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GSA_SPI {};           //!< CFG-MSGOUT-NMEA_ID_GSA_SPI (Output rate of the NMEA-STANDARD-GSA message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSA_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GSA_I2C {};           //!< CFG-MSGOUT-NMEA_ID_GSA_I2C (Output rate of the NMEA-STANDARD-GSA message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSA_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GSA_USB {};           //!< CFG-MSGOUT-NMEA_ID_GSA_USB (Output rate of the NMEA-STANDARD-GSA message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GST_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GST_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_GST_UART1 (Output rate of the NMEA-STANDARD-GST message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GST_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GST_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_GST_UART2 (Output rate of the NMEA-STANDARD-GST message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GST_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GST_SPI {};           //!< CFG-MSGOUT-NMEA_ID_GST_SPI (Output rate of the NMEA-STANDARD-GST message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GST_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GST_I2C {};           //!< CFG-MSGOUT-NMEA_ID_GST_I2C (Output rate of the NMEA-STANDARD-GST message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GST_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GST_USB {};           //!< CFG-MSGOUT-NMEA_ID_GST_USB (Output rate of the NMEA-STANDARD-GST message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSV_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GSV_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_GSV_UART1 (Output rate of the NMEA-STANDARD-GSV message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSV_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_GSV_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_GSV_UART2 (Output rate of the NMEA-STANDARD-GSV message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSV_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GSV_SPI {};           //!< CFG-MSGOUT-NMEA_ID_GSV_SPI (Output rate of the NMEA-STANDARD-GSV message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSV_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GSV_I2C {};           //!< CFG-MSGOUT-NMEA_ID_GSV_I2C (Output rate of the NMEA-STANDARD-GSV message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_GSV_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_GSV_USB {};           //!< CFG-MSGOUT-NMEA_ID_GSV_USB (Output rate of the NMEA-STANDARD-GSV message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RLM_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_RLM_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_RLM_UART1 (Output rate of the NMEA-STANDARD-RLM message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RLM_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_RLM_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_RLM_UART2 (Output rate of the NMEA-STANDARD-RLM message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RLM_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_RLM_SPI {};           //!< CFG-MSGOUT-NMEA_ID_RLM_SPI (Output rate of the NMEA-STANDARD-RLM message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RLM_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_RLM_I2C {};           //!< CFG-MSGOUT-NMEA_ID_RLM_I2C (Output rate of the NMEA-STANDARD-RLM message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RLM_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_RLM_USB {};           //!< CFG-MSGOUT-NMEA_ID_RLM_USB (Output rate of the NMEA-STANDARD-RLM message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RMC_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_RMC_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_RMC_UART1 (Output rate of the NMEA-STANDARD-RMC message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RMC_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_RMC_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_RMC_UART2 (Output rate of the NMEA-STANDARD-RMC message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RMC_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_RMC_SPI {};           //!< CFG-MSGOUT-NMEA_ID_RMC_SPI (Output rate of the NMEA-STANDARD-RMC message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RMC_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_RMC_I2C {};           //!< CFG-MSGOUT-NMEA_ID_RMC_I2C (Output rate of the NMEA-STANDARD-RMC message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_RMC_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_RMC_USB {};           //!< CFG-MSGOUT-NMEA_ID_RMC_USB (Output rate of the NMEA-STANDARD-RMC message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_THS_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_THS_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_THS_UART1 (Output rate of the NMEA-STANDARD-THS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_THS_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_THS_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_THS_UART2 (Output rate of the NMEA-STANDARD-THS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_THS_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_THS_SPI {};           //!< CFG-MSGOUT-NMEA_ID_THS_SPI (Output rate of the NMEA-STANDARD-THS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_THS_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_THS_I2C {};           //!< CFG-MSGOUT-NMEA_ID_THS_I2C (Output rate of the NMEA-STANDARD-THS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_THS_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_THS_USB {};           //!< CFG-MSGOUT-NMEA_ID_THS_USB (Output rate of the NMEA-STANDARD-THS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VLW_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_VLW_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_VLW_UART1 (Output rate of the NMEA-STANDARD-VLW message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VLW_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_VLW_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_VLW_UART2 (Output rate of the NMEA-STANDARD-VLW message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VLW_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_VLW_SPI {};           //!< CFG-MSGOUT-NMEA_ID_VLW_SPI (Output rate of the NMEA-STANDARD-VLW message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VLW_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_VLW_I2C {};           //!< CFG-MSGOUT-NMEA_ID_VLW_I2C (Output rate of the NMEA-STANDARD-VLW message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VLW_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_VLW_USB {};           //!< CFG-MSGOUT-NMEA_ID_VLW_USB (Output rate of the NMEA-STANDARD-VLW message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VTG_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_VTG_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_VTG_UART1 (Output rate of the NMEA-STANDARD-VTG message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VTG_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_VTG_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_VTG_UART2 (Output rate of the NMEA-STANDARD-VTG message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VTG_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_VTG_SPI {};           //!< CFG-MSGOUT-NMEA_ID_VTG_SPI (Output rate of the NMEA-STANDARD-VTG message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VTG_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_VTG_I2C {};           //!< CFG-MSGOUT-NMEA_ID_VTG_I2C (Output rate of the NMEA-STANDARD-VTG message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_VTG_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_VTG_USB {};           //!< CFG-MSGOUT-NMEA_ID_VTG_USB (Output rate of the NMEA-STANDARD-VTG message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_ZDA_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_ZDA_UART1 {};         //!< CFG-MSGOUT-NMEA_ID_ZDA_UART1 (Output rate of the NMEA-STANDARD-ZDA message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_ZDA_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_NMEA_ID_ZDA_UART2 {};         //!< CFG-MSGOUT-NMEA_ID_ZDA_UART2 (Output rate of the NMEA-STANDARD-ZDA message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_ZDA_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_ZDA_SPI {};           //!< CFG-MSGOUT-NMEA_ID_ZDA_SPI (Output rate of the NMEA-STANDARD-ZDA message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_ZDA_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_ZDA_I2C {};           //!< CFG-MSGOUT-NMEA_ID_ZDA_I2C (Output rate of the NMEA-STANDARD-ZDA message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_NMEA_ID_ZDA_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_NMEA_ID_ZDA_USB {};           //!< CFG-MSGOUT-NMEA_ID_ZDA_USB (Output rate of the NMEA-STANDARD-ZDA message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYP_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_PUBX_ID_POLYP_UART1 {};       //!< CFG-MSGOUT-PUBX_ID_POLYP_UART1 (Output rate of the NMEA-PUBX-POSITION message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYP_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_PUBX_ID_POLYP_UART2 {};       //!< CFG-MSGOUT-PUBX_ID_POLYP_UART2 (Output rate of the NMEA-PUBX-POSITION message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYP_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_PUBX_ID_POLYP_SPI {};         //!< CFG-MSGOUT-PUBX_ID_POLYP_SPI (Output rate of the NMEA-PUBX-POSITION message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYP_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_PUBX_ID_POLYP_I2C {};         //!< CFG-MSGOUT-PUBX_ID_POLYP_I2C (Output rate of the NMEA-PUBX-POSITION message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYP_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_PUBX_ID_POLYP_USB {};         //!< CFG-MSGOUT-PUBX_ID_POLYP_USB (Output rate of the NMEA-PUBX-POSITION message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYS_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_PUBX_ID_POLYS_UART1 {};       //!< CFG-MSGOUT-PUBX_ID_POLYS_UART1 (Output rate of the NMEA-PUBX-SVSTATUS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYS_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_PUBX_ID_POLYS_UART2 {};       //!< CFG-MSGOUT-PUBX_ID_POLYS_UART2 (Output rate of the NMEA-PUBX-SVSTATUS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYS_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_PUBX_ID_POLYS_SPI {};         //!< CFG-MSGOUT-PUBX_ID_POLYS_SPI (Output rate of the NMEA-PUBX-SVSTATUS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYS_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_PUBX_ID_POLYS_I2C {};         //!< CFG-MSGOUT-PUBX_ID_POLYS_I2C (Output rate of the NMEA-PUBX-SVSTATUS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYS_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_PUBX_ID_POLYS_USB {};         //!< CFG-MSGOUT-PUBX_ID_POLYS_USB (Output rate of the NMEA-PUBX-SVSTATUS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYT_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_PUBX_ID_POLYT_UART1 {};       //!< CFG-MSGOUT-PUBX_ID_POLYT_UART1 (Output rate of the NMEA-PUBX-TIME message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYT_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_PUBX_ID_POLYT_UART2 {};       //!< CFG-MSGOUT-PUBX_ID_POLYT_UART2 (Output rate of the NMEA-PUBX-TIME message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYT_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_PUBX_ID_POLYT_SPI {};         //!< CFG-MSGOUT-PUBX_ID_POLYT_SPI (Output rate of the NMEA-PUBX-TIME message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYT_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_PUBX_ID_POLYT_I2C {};         //!< CFG-MSGOUT-PUBX_ID_POLYT_I2C (Output rate of the NMEA-PUBX-TIME message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_PUBX_ID_POLYT_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_PUBX_ID_POLYT_USB {};         //!< CFG-MSGOUT-PUBX_ID_POLYT_USB (Output rate of the NMEA-PUBX-TIME message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1005_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1005_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1005_UART1 (Output rate of the RTCM-3X-TYPE1005 (Stationary RTK reference station ARP) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1005_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1005_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1005_UART2 (Output rate of the RTCM-3X-TYPE1005 (Stationary RTK reference station ARP) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1005_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1005_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1005_SPI (Output rate of the RTCM-3X-TYPE1005 (Stationary RTK reference station ARP) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1005_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1005_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1005_I2C (Output rate of the RTCM-3X-TYPE1005 (Stationary RTK reference station ARP) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1005_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1005_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1005_USB (Output rate of the RTCM-3X-TYPE1005 (Stationary RTK reference station ARP) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1074_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1074_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1074_UART1 (Output rate of the RTCM-3X-TYPE1074 (GPS MSM4: full C, full L, S) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1074_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1074_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1074_UART2 (Output rate of the RTCM-3X-TYPE1074 (GPS MSM4: full C, full L, S) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1074_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1074_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1074_SPI (Output rate of the RTCM-3X-TYPE1074 (GPS MSM4: full C, full L, S) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1074_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1074_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1074_I2C (Output rate of the RTCM-3X-TYPE1074 (GPS MSM4: full C, full L, S) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1074_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1074_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1074_USB (Output rate of the RTCM-3X-TYPE1074 (GPS MSM4: full C, full L, S) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1077_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1077_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1077_UART1 (Output rate of the RTCM-3X-TYPE1077 (GPS MSM7: ext full C, ext full L, S, D) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1077_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1077_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1077_UART2 (Output rate of the RTCM-3X-TYPE1077 (GPS MSM7: ext full C, ext full L, S, D) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1077_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1077_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1077_SPI (Output rate of the RTCM-3X-TYPE1077 (GPS MSM7: ext full C, ext full L, S, D) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1077_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1077_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1077_I2C (Output rate of the RTCM-3X-TYPE1077 (GPS MSM7: ext full C, ext full L, S, D) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1077_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1077_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1077_USB (Output rate of the RTCM-3X-TYPE1077 (GPS MSM7: ext full C, ext full L, S, D) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1084_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1084_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1084_UART1 (Output rate of the RTCM-3X-TYPE1084 (GLONASS MSM4: full C, full L, S) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1084_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1084_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1084_UART2 (Output rate of the RTCM-3X-TYPE1084 (GLONASS MSM4: full C, full L, S) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1084_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1084_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1084_SPI (Output rate of the RTCM-3X-TYPE1084 (GLONASS MSM4: full C, full L, S) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1084_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1084_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1084_I2C (Output rate of the RTCM-3X-TYPE1084 (GLONASS MSM4: full C, full L, S) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1084_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1084_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1084_USB (Output rate of the RTCM-3X-TYPE1084 (GLONASS MSM4: full C, full L, S) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1087_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1087_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1087_UART1 (Output rate of the RTCM-3X-TYPE1087 (GLONASS MSM7: ext full C, ext full L, S, D) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1087_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1087_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1087_UART2 (Output rate of the RTCM-3X-TYPE1087 (GLONASS MSM7: ext full C, ext full L, S, D) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1087_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1087_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1087_SPI (Output rate of the RTCM-3X-TYPE1087 (GLONASS MSM7: ext full C, ext full L, S, D) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1087_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1087_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1087_I2C (Output rate of the RTCM-3X-TYPE1087 (GLONASS MSM7: ext full C, ext full L, S, D) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1087_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1087_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1087_USB (Output rate of the RTCM-3X-TYPE1087 (GLONASS MSM7: ext full C, ext full L, S, D) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1094_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1094_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1094_UART1 (Output rate of the RTCM-3X-TYPE1094 (Galileo MSM4: full C, full L, S) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1094_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1094_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1094_UART2 (Output rate of the RTCM-3X-TYPE1094 (Galileo MSM4: full C, full L, S) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1094_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1094_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1094_SPI (Output rate of the RTCM-3X-TYPE1094 (Galileo MSM4: full C, full L, S) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1094_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1094_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1094_I2C (Output rate of the RTCM-3X-TYPE1094 (Galileo MSM4: full C, full L, S) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1094_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1094_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1094_USB (Output rate of the RTCM-3X-TYPE1094 (Galileo MSM4: full C, full L, S) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1097_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1097_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1097_UART1 (Output rate of the RTCM-3X-TYPE1097 (Galileo MSM7: ext full C, ext full L, S, D) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1097_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1097_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1097_UART2 (Output rate of the RTCM-3X-TYPE1097 (Galileo MSM7: ext full C, ext full L, S, D) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1097_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1097_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1097_SPI (Output rate of the RTCM-3X-TYPE1097 (Galileo MSM7: ext full C, ext full L, S, D) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1097_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1097_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1097_I2C (Output rate of the RTCM-3X-TYPE1097 (Galileo MSM7: ext full C, ext full L, S, D) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1097_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1097_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1097_USB (Output rate of the RTCM-3X-TYPE1097 (Galileo MSM7: ext full C, ext full L, S, D) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1124_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1124_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1124_UART1 (Output rate of the RTCM-3X-TYPE1124 (BeiDou MSM4: full C, full L, S) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1124_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1124_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1124_UART2 (Output rate of the RTCM-3X-TYPE1124 (BeiDou MSM4: full C, full L, S) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1124_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1124_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1124_SPI (Output rate of the RTCM-3X-TYPE1124 (BeiDou MSM4: full C, full L, S) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1124_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1124_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1124_I2C (Output rate of the RTCM-3X-TYPE1124 (BeiDou MSM4: full C, full L, S) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1124_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1124_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1124_USB (Output rate of the RTCM-3X-TYPE1124 (BeiDou MSM4: full C, full L, S) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1127_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1127_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1127_UART1 (Output rate of the RTCM-3X-TYPE1127 (BeiDou MSM7: ext full C, ext full L, S, D) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1127_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1127_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1127_UART2 (Output rate of the RTCM-3X-TYPE1127 (BeiDou MSM7: ext full C, ext full L, S, D) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1127_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1127_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1127_SPI (Output rate of the RTCM-3X-TYPE1127 (BeiDou MSM7: ext full C, ext full L, S, D) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1127_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1127_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1127_I2C (Output rate of the RTCM-3X-TYPE1127 (BeiDou MSM7: ext full C, ext full L, S, D) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1127_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1127_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1127_USB (Output rate of the RTCM-3X-TYPE1127 (BeiDou MSM7: ext full C, ext full L, S, D) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1230_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1230_UART1 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1230_UART1 (Output rate of the RTCM-3X-TYPE1230 (GLONASS code-phase biases) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1230_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE1230_UART2 {};    //!< CFG-MSGOUT-RTCM_3X_TYPE1230_UART2 (Output rate of the RTCM-3X-TYPE1230 (GLONASS code-phase biases) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1230_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1230_SPI {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1230_SPI (Output rate of the RTCM-3X-TYPE1230 (GLONASS code-phase biases) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1230_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1230_I2C {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1230_I2C (Output rate of the RTCM-3X-TYPE1230 (GLONASS code-phase biases) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE1230_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_RTCM_3X_TYPE1230_USB {};      //!< CFG-MSGOUT-RTCM_3X_TYPE1230_USB (Output rate of the RTCM-3X-TYPE1230 (GLONASS code-phase biases) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_0_UART1_ID, UBLOXCFG_TYPE_U1>                              CFG_MSGOUT_RTCM_3X_TYPE4072_0_UART1 {};  //!< CFG-MSGOUT-RTCM_3X_TYPE4072_0_UART1 (Output rate of the RTCM-3X-TYPE4072_0 (u-blox proprietary: Reference station PVT) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_0_UART2_ID, UBLOXCFG_TYPE_U1>                              CFG_MSGOUT_RTCM_3X_TYPE4072_0_UART2 {};  //!< CFG-MSGOUT-RTCM_3X_TYPE4072_0_UART2 (Output rate of the RTCM-3X-TYPE4072_0 (u-blox proprietary: Reference station PVT) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_0_SPI_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE4072_0_SPI {};    //!< CFG-MSGOUT-RTCM_3X_TYPE4072_0_SPI (Output rate of the RTCM-3X-TYPE4072_0 (u-blox proprietary: Reference station PVT) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_0_I2C_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE4072_0_I2C {};    //!< CFG-MSGOUT-RTCM_3X_TYPE4072_0_I2C (Output rate of the RTCM-3X-TYPE4072_0 (u-blox proprietary: Reference station PVT) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_0_USB_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE4072_0_USB {};    //!< CFG-MSGOUT-RTCM_3X_TYPE4072_0_USB (Output rate of the RTCM-3X-TYPE4072_0 (u-blox proprietary: Reference station PVT) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_1_UART1_ID, UBLOXCFG_TYPE_U1>                              CFG_MSGOUT_RTCM_3X_TYPE4072_1_UART1 {};  //!< CFG-MSGOUT-RTCM_3X_TYPE4072_1_UART1 (Output rate of the RTCM-3X-TYPE4072_1 (u-blox proprietary: Additional reference station information) message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_1_UART2_ID, UBLOXCFG_TYPE_U1>                              CFG_MSGOUT_RTCM_3X_TYPE4072_1_UART2 {};  //!< CFG-MSGOUT-RTCM_3X_TYPE4072_1_UART2 (Output rate of the RTCM-3X-TYPE4072_1 (u-blox proprietary: Additional reference station information) message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_1_SPI_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE4072_1_SPI {};    //!< CFG-MSGOUT-RTCM_3X_TYPE4072_1_SPI (Output rate of the RTCM-3X-TYPE4072_1 (u-blox proprietary: Additional reference station information) message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_1_I2C_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE4072_1_I2C {};    //!< CFG-MSGOUT-RTCM_3X_TYPE4072_1_I2C (Output rate of the RTCM-3X-TYPE4072_1 (u-blox proprietary: Additional reference station information) message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_RTCM_3X_TYPE4072_1_USB_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_RTCM_3X_TYPE4072_1_USB {};    //!< CFG-MSGOUT-RTCM_3X_TYPE4072_1_USB (Output rate of the RTCM-3X-TYPE4072_1 (u-blox proprietary: Additional reference station information) message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_ALG_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_ESF_ALG_UART1 {};         //!< CFG-MSGOUT-UBX_ESF_ALG_UART1 (Output rate of the UBX-ESF-ALG message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_ALG_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_ESF_ALG_UART2 {};         //!< CFG-MSGOUT-UBX_ESF_ALG_UART2 (Output rate of the UBX-ESF-ALG message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_ALG_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_ESF_ALG_SPI {};           //!< CFG-MSGOUT-UBX_ESF_ALG_SPI (Output rate of the UBX-ESF-ALG message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_ALG_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_ESF_ALG_I2C {};           //!< CFG-MSGOUT-UBX_ESF_ALG_I2C (Output rate of the UBX-ESF-ALG message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_ALG_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_ESF_ALG_USB {};           //!< CFG-MSGOUT-UBX_ESF_ALG_USB (Output rate of the UBX-ESF-ALG message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_INS_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_ESF_INS_UART1 {};         //!< CFG-MSGOUT-UBX_ESF_INS_UART1 (Output rate of the UBX-ESF-INS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_INS_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_ESF_INS_UART2 {};         //!< CFG-MSGOUT-UBX_ESF_INS_UART2 (Output rate of the UBX-ESF-INS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_INS_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_ESF_INS_SPI {};           //!< CFG-MSGOUT-UBX_ESF_INS_SPI (Output rate of the UBX-ESF-INS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_INS_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_ESF_INS_I2C {};           //!< CFG-MSGOUT-UBX_ESF_INS_I2C (Output rate of the UBX-ESF-INS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_INS_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_ESF_INS_USB {};           //!< CFG-MSGOUT-UBX_ESF_INS_USB (Output rate of the UBX-ESF-INS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_MEAS_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_ESF_MEAS_UART1 {};        //!< CFG-MSGOUT-UBX_ESF_MEAS_UART1 (Output rate of the UBX-ESF-MEAS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_MEAS_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_ESF_MEAS_UART2 {};        //!< CFG-MSGOUT-UBX_ESF_MEAS_UART2 (Output rate of the UBX-ESF-MEAS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_MEAS_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_ESF_MEAS_SPI {};          //!< CFG-MSGOUT-UBX_ESF_MEAS_SPI (Output rate of the UBX-ESF-MEAS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_MEAS_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_ESF_MEAS_I2C {};          //!< CFG-MSGOUT-UBX_ESF_MEAS_I2C (Output rate of the UBX-ESF-MEAS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_MEAS_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_ESF_MEAS_USB {};          //!< CFG-MSGOUT-UBX_ESF_MEAS_USB (Output rate of the UBX-ESF-MEAS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_RAW_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_ESF_RAW_UART1 {};         //!< CFG-MSGOUT-UBX_ESF_RAW_UART1 (Output rate of the UBX-ESF-RAW message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_RAW_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_ESF_RAW_UART2 {};         //!< CFG-MSGOUT-UBX_ESF_RAW_UART2 (Output rate of the UBX-ESF-RAW message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_RAW_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_ESF_RAW_SPI {};           //!< CFG-MSGOUT-UBX_ESF_RAW_SPI (Output rate of the UBX-ESF-RAW message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_RAW_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_ESF_RAW_I2C {};           //!< CFG-MSGOUT-UBX_ESF_RAW_I2C (Output rate of the UBX-ESF-RAW message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_RAW_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_ESF_RAW_USB {};           //!< CFG-MSGOUT-UBX_ESF_RAW_USB (Output rate of the UBX-ESF-RAW message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_STATUS_UART1_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_ESF_STATUS_UART1 {};      //!< CFG-MSGOUT-UBX_ESF_STATUS_UART1 (Output rate of the UBX-ESF-STATUS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_STATUS_UART2_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_ESF_STATUS_UART2 {};      //!< CFG-MSGOUT-UBX_ESF_STATUS_UART2 (Output rate of the UBX-ESF-STATUS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_STATUS_SPI_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_ESF_STATUS_SPI {};        //!< CFG-MSGOUT-UBX_ESF_STATUS_SPI (Output rate of the UBX-ESF-STATUS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_STATUS_I2C_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_ESF_STATUS_I2C {};        //!< CFG-MSGOUT-UBX_ESF_STATUS_I2C (Output rate of the UBX-ESF-STATUS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_ESF_STATUS_USB_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_ESF_STATUS_USB {};        //!< CFG-MSGOUT-UBX_ESF_STATUS_USB (Output rate of the UBX-ESF-STATUS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_LOG_INFO_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_LOG_INFO_UART1 {};        //!< CFG-MSGOUT-UBX_LOG_INFO_UART1 (Output rate of the UBX-LOG-INFO message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_LOG_INFO_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_LOG_INFO_UART2 {};        //!< CFG-MSGOUT-UBX_LOG_INFO_UART2 (Output rate of the UBX-LOG-INFO message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_LOG_INFO_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_LOG_INFO_SPI {};          //!< CFG-MSGOUT-UBX_LOG_INFO_SPI (Output rate of the UBX-LOG-INFO message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_LOG_INFO_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_LOG_INFO_I2C {};          //!< CFG-MSGOUT-UBX_LOG_INFO_I2C (Output rate of the UBX-LOG-INFO message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_LOG_INFO_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_LOG_INFO_USB {};          //!< CFG-MSGOUT-UBX_LOG_INFO_USB (Output rate of the UBX-LOG-INFO message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_COMMS_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_MON_COMMS_UART1 {};       //!< CFG-MSGOUT-UBX_MON_COMMS_UART1 (Output rate of the UBX-MON-COMMS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_COMMS_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_MON_COMMS_UART2 {};       //!< CFG-MSGOUT-UBX_MON_COMMS_UART2 (Output rate of the UBX-MON-COMMS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_COMMS_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_COMMS_SPI {};         //!< CFG-MSGOUT-UBX_MON_COMMS_SPI (Output rate of the UBX-MON-COMMS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_COMMS_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_COMMS_I2C {};         //!< CFG-MSGOUT-UBX_MON_COMMS_I2C (Output rate of the UBX-MON-COMMS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_COMMS_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_COMMS_USB {};         //!< CFG-MSGOUT-UBX_MON_COMMS_USB (Output rate of the UBX-MON-COMMS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW2_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_HW2_UART1 {};         //!< CFG-MSGOUT-UBX_MON_HW2_UART1 (Output rate of the UBX-MON-HW2 message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW2_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_HW2_UART2 {};         //!< CFG-MSGOUT-UBX_MON_HW2_UART2 (Output rate of the UBX-MON-HW2 message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW2_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_HW2_SPI {};           //!< CFG-MSGOUT-UBX_MON_HW2_SPI (Output rate of the UBX-MON-HW2 message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW2_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_HW2_I2C {};           //!< CFG-MSGOUT-UBX_MON_HW2_I2C (Output rate of the UBX-MON-HW2 message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW2_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_HW2_USB {};           //!< CFG-MSGOUT-UBX_MON_HW2_USB (Output rate of the UBX-MON-HW2 message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW3_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_HW3_UART1 {};         //!< CFG-MSGOUT-UBX_MON_HW3_UART1 (Output rate of the UBX-MON-HW3 message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW3_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_HW3_UART2 {};         //!< CFG-MSGOUT-UBX_MON_HW3_UART2 (Output rate of the UBX-MON-HW3 message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW3_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_HW3_SPI {};           //!< CFG-MSGOUT-UBX_MON_HW3_SPI (Output rate of the UBX-MON-HW3 message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW3_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_HW3_I2C {};           //!< CFG-MSGOUT-UBX_MON_HW3_I2C (Output rate of the UBX-MON-HW3 message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW3_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_HW3_USB {};           //!< CFG-MSGOUT-UBX_MON_HW3_USB (Output rate of the UBX-MON-HW3 message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW_UART1_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_HW_UART1 {};          //!< CFG-MSGOUT-UBX_MON_HW_UART1 (Output rate of the UBX-MON-HW message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW_UART2_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_HW_UART2 {};          //!< CFG-MSGOUT-UBX_MON_HW_UART2 (Output rate of the UBX-MON-HW message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW_SPI_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_MON_HW_SPI {};            //!< CFG-MSGOUT-UBX_MON_HW_SPI (Output rate of the UBX-MON-HW message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW_I2C_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_MON_HW_I2C {};            //!< CFG-MSGOUT-UBX_MON_HW_I2C (Output rate of the UBX-MON-HW message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_HW_USB_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_MON_HW_USB {};            //!< CFG-MSGOUT-UBX_MON_HW_USB (Output rate of the UBX-MON-HW message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_IO_UART1_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_IO_UART1 {};          //!< CFG-MSGOUT-UBX_MON_IO_UART1 (Output rate of the UBX-MON-IO message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_IO_UART2_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_IO_UART2 {};          //!< CFG-MSGOUT-UBX_MON_IO_UART2 (Output rate of the UBX-MON-IO message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_IO_SPI_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_MON_IO_SPI {};            //!< CFG-MSGOUT-UBX_MON_IO_SPI (Output rate of the UBX-MON-IO message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_IO_I2C_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_MON_IO_I2C {};            //!< CFG-MSGOUT-UBX_MON_IO_I2C (Output rate of the UBX-MON-IO message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_IO_USB_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_MON_IO_USB {};            //!< CFG-MSGOUT-UBX_MON_IO_USB (Output rate of the UBX-MON-IO message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_MSGPP_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_MON_MSGPP_UART1 {};       //!< CFG-MSGOUT-UBX_MON_MSGPP_UART1 (Output rate of the UBX-MON-MSGPP message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_MSGPP_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_MON_MSGPP_UART2 {};       //!< CFG-MSGOUT-UBX_MON_MSGPP_UART2 (Output rate of the UBX-MON-MSGPP message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_MSGPP_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_MSGPP_SPI {};         //!< CFG-MSGOUT-UBX_MON_MSGPP_SPI (Output rate of the UBX-MON-MSGPP message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_MSGPP_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_MSGPP_I2C {};         //!< CFG-MSGOUT-UBX_MON_MSGPP_I2C (Output rate of the UBX-MON-MSGPP message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_MSGPP_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_MSGPP_USB {};         //!< CFG-MSGOUT-UBX_MON_MSGPP_USB (Output rate of the UBX-MON-MSGPP message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RF_UART1_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_RF_UART1 {};          //!< CFG-MSGOUT-UBX_MON_RF_UART1 (Output rate of the UBX-MON-RF message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RF_UART2_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_RF_UART2 {};          //!< CFG-MSGOUT-UBX_MON_RF_UART2 (Output rate of the UBX-MON-RF message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RF_SPI_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_MON_RF_SPI {};            //!< CFG-MSGOUT-UBX_MON_RF_SPI (Output rate of the UBX-MON-RF message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RF_I2C_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_MON_RF_I2C {};            //!< CFG-MSGOUT-UBX_MON_RF_I2C (Output rate of the UBX-MON-RF message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RF_USB_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_MON_RF_USB {};            //!< CFG-MSGOUT-UBX_MON_RF_USB (Output rate of the UBX-MON-RF message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXBUF_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_MON_RXBUF_UART1 {};       //!< CFG-MSGOUT-UBX_MON_RXBUF_UART1 (Output rate of the UBX-MON-RXBUF message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXBUF_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_MON_RXBUF_UART2 {};       //!< CFG-MSGOUT-UBX_MON_RXBUF_UART2 (Output rate of the UBX-MON-RXBUF message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXBUF_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_RXBUF_SPI {};         //!< CFG-MSGOUT-UBX_MON_RXBUF_SPI (Output rate of the UBX-MON-RXBUF message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXBUF_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_RXBUF_I2C {};         //!< CFG-MSGOUT-UBX_MON_RXBUF_I2C (Output rate of the UBX-MON-RXBUF message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXBUF_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_RXBUF_USB {};         //!< CFG-MSGOUT-UBX_MON_RXBUF_USB (Output rate of the UBX-MON-RXBUF message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXR_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_RXR_UART1 {};         //!< CFG-MSGOUT-UBX_MON_RXR_UART1 (Output rate of the UBX-MON-RXR message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXR_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_RXR_UART2 {};         //!< CFG-MSGOUT-UBX_MON_RXR_UART2 (Output rate of the UBX-MON-RXR message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXR_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_RXR_SPI {};           //!< CFG-MSGOUT-UBX_MON_RXR_SPI (Output rate of the UBX-MON-RXR message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXR_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_RXR_I2C {};           //!< CFG-MSGOUT-UBX_MON_RXR_I2C (Output rate of the UBX-MON-RXR message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_RXR_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_RXR_USB {};           //!< CFG-MSGOUT-UBX_MON_RXR_USB (Output rate of the UBX-MON-RXR message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SPAN_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_MON_SPAN_UART1 {};        //!< CFG-MSGOUT-UBX_MON_SPAN_UART1 (Output rate of the UBX-MON-SPAN message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SPAN_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_MON_SPAN_UART2 {};        //!< CFG-MSGOUT-UBX_MON_SPAN_UART2 (Output rate of the UBX-MON-SPAN message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SPAN_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_SPAN_SPI {};          //!< CFG-MSGOUT-UBX_MON_SPAN_SPI (Output rate of the UBX-MON-SPAN message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SPAN_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_SPAN_I2C {};          //!< CFG-MSGOUT-UBX_MON_SPAN_I2C (Output rate of the UBX-MON-SPAN message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SPAN_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_SPAN_USB {};          //!< CFG-MSGOUT-UBX_MON_SPAN_USB (Output rate of the UBX-MON-SPAN message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SYS_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_SYS_UART1 {};         //!< CFG-MSGOUT-UBX_MON_SYS_UART1 (Output rate of the UBX-MON-SYS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SYS_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_SYS_UART2 {};         //!< CFG-MSGOUT-UBX_MON_SYS_UART2 (Output rate of the UBX-MON-SYS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SYS_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_SYS_SPI {};           //!< CFG-MSGOUT-UBX_MON_SYS_SPI (Output rate of the UBX-MON-SYS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SYS_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_SYS_I2C {};           //!< CFG-MSGOUT-UBX_MON_SYS_I2C (Output rate of the UBX-MON-SYS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_SYS_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_MON_SYS_USB {};           //!< CFG-MSGOUT-UBX_MON_SYS_USB (Output rate of the UBX-MON-SYS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TEMP_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_MON_TEMP_UART1 {};        //!< CFG-MSGOUT-UBX_MON_TEMP_UART1 (Output rate of the UBX-MON-TEMP message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TEMP_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_MON_TEMP_UART2 {};        //!< CFG-MSGOUT-UBX_MON_TEMP_UART2 (Output rate of the UBX-MON-TEMP message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TEMP_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_TEMP_SPI {};          //!< CFG-MSGOUT-UBX_MON_TEMP_SPI (Output rate of the UBX-MON-TEMP message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TEMP_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_TEMP_I2C {};          //!< CFG-MSGOUT-UBX_MON_TEMP_I2C (Output rate of the UBX-MON-TEMP message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TEMP_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_MON_TEMP_USB {};          //!< CFG-MSGOUT-UBX_MON_TEMP_USB (Output rate of the UBX-MON-TEMP message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TXBUF_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_MON_TXBUF_UART1 {};       //!< CFG-MSGOUT-UBX_MON_TXBUF_UART1 (Output rate of the UBX-MON-TXBUF message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TXBUF_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_MON_TXBUF_UART2 {};       //!< CFG-MSGOUT-UBX_MON_TXBUF_UART2 (Output rate of the UBX-MON-TXBUF message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TXBUF_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_TXBUF_SPI {};         //!< CFG-MSGOUT-UBX_MON_TXBUF_SPI (Output rate of the UBX-MON-TXBUF message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TXBUF_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_TXBUF_I2C {};         //!< CFG-MSGOUT-UBX_MON_TXBUF_I2C (Output rate of the UBX-MON-TXBUF message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_MON_TXBUF_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_MON_TXBUF_USB {};         //!< CFG-MSGOUT-UBX_MON_TXBUF_USB (Output rate of the UBX-MON-TXBUF message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_AOPSTATUS_UART1_ID, UBLOXCFG_TYPE_U1>                               CFG_MSGOUT_UBX_NAV_AOPSTATUS_UART1 {};   //!< CFG-MSGOUT-UBX_NAV_AOPSTATUS_UART1 (Output rate of the UBX-NAV-AOPSTATUS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_AOPSTATUS_UART2_ID, UBLOXCFG_TYPE_U1>                               CFG_MSGOUT_UBX_NAV_AOPSTATUS_UART2 {};   //!< CFG-MSGOUT-UBX_NAV_AOPSTATUS_UART2 (Output rate of the UBX-NAV-AOPSTATUS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_AOPSTATUS_SPI_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_AOPSTATUS_SPI {};     //!< CFG-MSGOUT-UBX_NAV_AOPSTATUS_SPI (Output rate of the UBX-NAV-AOPSTATUS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_AOPSTATUS_I2C_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_AOPSTATUS_I2C {};     //!< CFG-MSGOUT-UBX_NAV_AOPSTATUS_I2C (Output rate of the UBX-NAV-AOPSTATUS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_AOPSTATUS_USB_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_AOPSTATUS_USB {};     //!< CFG-MSGOUT-UBX_NAV_AOPSTATUS_USB (Output rate of the UBX-NAV-AOPSTATUS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ATT_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_ATT_UART1 {};         //!< CFG-MSGOUT-UBX_NAV_ATT_UART1 (Output rate of the UBX-NAV-ATT message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ATT_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_ATT_UART2 {};         //!< CFG-MSGOUT-UBX_NAV_ATT_UART2 (Output rate of the UBX-NAV-ATT message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ATT_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_ATT_SPI {};           //!< CFG-MSGOUT-UBX_NAV_ATT_SPI (Output rate of the UBX-NAV-ATT message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ATT_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_ATT_I2C {};           //!< CFG-MSGOUT-UBX_NAV_ATT_I2C (Output rate of the UBX-NAV-ATT message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ATT_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_ATT_USB {};           //!< CFG-MSGOUT-UBX_NAV_ATT_USB (Output rate of the UBX-NAV-ATT message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_CLOCK_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_CLOCK_UART1 {};       //!< CFG-MSGOUT-UBX_NAV_CLOCK_UART1 (Output rate of the UBX-NAV-CLOCK message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_CLOCK_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_CLOCK_UART2 {};       //!< CFG-MSGOUT-UBX_NAV_CLOCK_UART2 (Output rate of the UBX-NAV-CLOCK message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_CLOCK_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_CLOCK_SPI {};         //!< CFG-MSGOUT-UBX_NAV_CLOCK_SPI (Output rate of the UBX-NAV-CLOCK message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_CLOCK_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_CLOCK_I2C {};         //!< CFG-MSGOUT-UBX_NAV_CLOCK_I2C (Output rate of the UBX-NAV-CLOCK message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_CLOCK_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_CLOCK_USB {};         //!< CFG-MSGOUT-UBX_NAV_CLOCK_USB (Output rate of the UBX-NAV-CLOCK message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_COV_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_COV_UART1 {};         //!< CFG-MSGOUT-UBX_NAV_COV_UART1 (Output rate of the UBX-NAV-COV message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_COV_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_COV_UART2 {};         //!< CFG-MSGOUT-UBX_NAV_COV_UART2 (Output rate of the UBX-NAV-COV message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_COV_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_COV_SPI {};           //!< CFG-MSGOUT-UBX_NAV_COV_SPI (Output rate of the UBX-NAV-COV message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_COV_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_COV_I2C {};           //!< CFG-MSGOUT-UBX_NAV_COV_I2C (Output rate of the UBX-NAV-COV message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_COV_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_COV_USB {};           //!< CFG-MSGOUT-UBX_NAV_COV_USB (Output rate of the UBX-NAV-COV message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_DOP_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_DOP_UART1 {};         //!< CFG-MSGOUT-UBX_NAV_DOP_UART1 (Output rate of the UBX-NAV-DOP message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_DOP_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_DOP_UART2 {};         //!< CFG-MSGOUT-UBX_NAV_DOP_UART2 (Output rate of the UBX-NAV-DOP message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_DOP_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_DOP_SPI {};           //!< CFG-MSGOUT-UBX_NAV_DOP_SPI (Output rate of the UBX-NAV-DOP message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_DOP_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_DOP_I2C {};           //!< CFG-MSGOUT-UBX_NAV_DOP_I2C (Output rate of the UBX-NAV-DOP message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_DOP_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_DOP_USB {};           //!< CFG-MSGOUT-UBX_NAV_DOP_USB (Output rate of the UBX-NAV-DOP message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EELL_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_EELL_UART1 {};        //!< CFG-MSGOUT-UBX_NAV_EELL_UART1 (Output rate of the UBX-NAV-EELL message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EELL_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_EELL_UART2 {};        //!< CFG-MSGOUT-UBX_NAV_EELL_UART2 (Output rate of the UBX-NAV-EELL message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EELL_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_EELL_SPI {};          //!< CFG-MSGOUT-UBX_NAV_EELL_SPI (Output rate of the UBX-NAV-EELL message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EELL_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_EELL_USB {};          //!< CFG-MSGOUT-UBX_NAV_EELL_USB (Output rate of the UBX-NAV-EELL message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EELL_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_EELL_I2C {};          //!< CFG-MSGOUT-UBX_NAV_EELL_I2C (Output rate of the UBX-NAV-EELL message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EOE_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_EOE_UART1 {};         //!< CFG-MSGOUT-UBX_NAV_EOE_UART1 (Output rate of the UBX-NAV-EOE message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EOE_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_EOE_UART2 {};         //!< CFG-MSGOUT-UBX_NAV_EOE_UART2 (Output rate of the UBX-NAV-EOE message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EOE_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_EOE_SPI {};           //!< CFG-MSGOUT-UBX_NAV_EOE_SPI (Output rate of the UBX-NAV-EOE message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EOE_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_EOE_I2C {};           //!< CFG-MSGOUT-UBX_NAV_EOE_I2C (Output rate of the UBX-NAV-EOE message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_EOE_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_EOE_USB {};           //!< CFG-MSGOUT-UBX_NAV_EOE_USB (Output rate of the UBX-NAV-EOE message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_GEOFENCE_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV_GEOFENCE_UART1 {};    //!< CFG-MSGOUT-UBX_NAV_GEOFENCE_UART1 (Output rate of the UBX-NAV-GEOFENCE message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_GEOFENCE_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV_GEOFENCE_UART2 {};    //!< CFG-MSGOUT-UBX_NAV_GEOFENCE_UART2 (Output rate of the UBX-NAV-GEOFENCE message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_GEOFENCE_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_GEOFENCE_SPI {};      //!< CFG-MSGOUT-UBX_NAV_GEOFENCE_SPI (Output rate of the UBX-NAV-GEOFENCE message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_GEOFENCE_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_GEOFENCE_I2C {};      //!< CFG-MSGOUT-UBX_NAV_GEOFENCE_I2C (Output rate of the UBX-NAV-GEOFENCE message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_GEOFENCE_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_GEOFENCE_USB {};      //!< CFG-MSGOUT-UBX_NAV_GEOFENCE_USB (Output rate of the UBX-NAV-GEOFENCE message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSECEF_UART1_ID, UBLOXCFG_TYPE_U1>                               CFG_MSGOUT_UBX_NAV_HPPOSECEF_UART1 {};   //!< CFG-MSGOUT-UBX_NAV_HPPOSECEF_UART1 (Output rate of the UBX-NAV-HPPOSECEF message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSECEF_UART2_ID, UBLOXCFG_TYPE_U1>                               CFG_MSGOUT_UBX_NAV_HPPOSECEF_UART2 {};   //!< CFG-MSGOUT-UBX_NAV_HPPOSECEF_UART2 (Output rate of the UBX-NAV-HPPOSECEF message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSECEF_SPI_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_HPPOSECEF_SPI {};     //!< CFG-MSGOUT-UBX_NAV_HPPOSECEF_SPI (Output rate of the UBX-NAV-HPPOSECEF message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSECEF_I2C_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_HPPOSECEF_I2C {};     //!< CFG-MSGOUT-UBX_NAV_HPPOSECEF_I2C (Output rate of the UBX-NAV-HPPOSECEF message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSECEF_USB_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_HPPOSECEF_USB {};     //!< CFG-MSGOUT-UBX_NAV_HPPOSECEF_USB (Output rate of the UBX-NAV-HPPOSECEF message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSLLH_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV_HPPOSLLH_UART1 {};    //!< CFG-MSGOUT-UBX_NAV_HPPOSLLH_UART1 (Output rate of the UBX-NAV-HPPOSLLH message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSLLH_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV_HPPOSLLH_UART2 {};    //!< CFG-MSGOUT-UBX_NAV_HPPOSLLH_UART2 (Output rate of the UBX-NAV-HPPOSLLH message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSLLH_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_HPPOSLLH_SPI {};      //!< CFG-MSGOUT-UBX_NAV_HPPOSLLH_SPI (Output rate of the UBX-NAV-HPPOSLLH message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSLLH_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_HPPOSLLH_I2C {};      //!< CFG-MSGOUT-UBX_NAV_HPPOSLLH_I2C (Output rate of the UBX-NAV-HPPOSLLH message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_HPPOSLLH_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_HPPOSLLH_USB {};      //!< CFG-MSGOUT-UBX_NAV_HPPOSLLH_USB (Output rate of the UBX-NAV-HPPOSLLH message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ODO_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_ODO_UART1 {};         //!< CFG-MSGOUT-UBX_NAV_ODO_UART1 (Output rate of the UBX-NAV-ODO message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ODO_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_ODO_UART2 {};         //!< CFG-MSGOUT-UBX_NAV_ODO_UART2 (Output rate of the UBX-NAV-ODO message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ODO_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_ODO_SPI {};           //!< CFG-MSGOUT-UBX_NAV_ODO_SPI (Output rate of the UBX-NAV-ODO message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ODO_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_ODO_I2C {};           //!< CFG-MSGOUT-UBX_NAV_ODO_I2C (Output rate of the UBX-NAV-ODO message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ODO_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_ODO_USB {};           //!< CFG-MSGOUT-UBX_NAV_ODO_USB (Output rate of the UBX-NAV-ODO message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ORB_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_ORB_UART1 {};         //!< CFG-MSGOUT-UBX_NAV_ORB_UART1 (Output rate of the UBX-NAV-ORB message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ORB_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_ORB_UART2 {};         //!< CFG-MSGOUT-UBX_NAV_ORB_UART2 (Output rate of the UBX-NAV-ORB message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ORB_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_ORB_SPI {};           //!< CFG-MSGOUT-UBX_NAV_ORB_SPI (Output rate of the UBX-NAV-ORB message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ORB_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_ORB_I2C {};           //!< CFG-MSGOUT-UBX_NAV_ORB_I2C (Output rate of the UBX-NAV-ORB message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_ORB_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_ORB_USB {};           //!< CFG-MSGOUT-UBX_NAV_ORB_USB (Output rate of the UBX-NAV-ORB message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSECEF_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_POSECEF_UART1 {};     //!< CFG-MSGOUT-UBX_NAV_POSECEF_UART1 (Output rate of the UBX-NAV-POSECEF message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSECEF_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_POSECEF_UART2 {};     //!< CFG-MSGOUT-UBX_NAV_POSECEF_UART2 (Output rate of the UBX-NAV-POSECEF message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSECEF_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_POSECEF_SPI {};       //!< CFG-MSGOUT-UBX_NAV_POSECEF_SPI (Output rate of the UBX-NAV-POSECEF message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSECEF_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_POSECEF_I2C {};       //!< CFG-MSGOUT-UBX_NAV_POSECEF_I2C (Output rate of the UBX-NAV-POSECEF message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSECEF_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_POSECEF_USB {};       //!< CFG-MSGOUT-UBX_NAV_POSECEF_USB (Output rate of the UBX-NAV-POSECEF message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSLLH_UART1_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_POSLLH_UART1 {};      //!< CFG-MSGOUT-UBX_NAV_POSLLH_UART1 (Output rate of the UBX-NAV-POSLLH message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSLLH_UART2_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_POSLLH_UART2 {};      //!< CFG-MSGOUT-UBX_NAV_POSLLH_UART2 (Output rate of the UBX-NAV-POSLLH message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSLLH_SPI_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_POSLLH_SPI {};        //!< CFG-MSGOUT-UBX_NAV_POSLLH_SPI (Output rate of the UBX-NAV-POSLLH message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSLLH_I2C_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_POSLLH_I2C {};        //!< CFG-MSGOUT-UBX_NAV_POSLLH_I2C (Output rate of the UBX-NAV-POSLLH message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_POSLLH_USB_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_POSLLH_USB {};        //!< CFG-MSGOUT-UBX_NAV_POSLLH_USB (Output rate of the UBX-NAV-POSLLH message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVT_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_PVT_UART1 {};         //!< CFG-MSGOUT-UBX_NAV_PVT_UART1 (Output rate of the UBX-NAV-PVT message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVT_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_PVT_UART2 {};         //!< CFG-MSGOUT-UBX_NAV_PVT_UART2 (Output rate of the UBX-NAV-PVT message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVT_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_PVT_SPI {};           //!< CFG-MSGOUT-UBX_NAV_PVT_SPI (Output rate of the UBX-NAV-PVT message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVT_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_PVT_I2C {};           //!< CFG-MSGOUT-UBX_NAV_PVT_I2C (Output rate of the UBX-NAV-PVT message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVT_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_PVT_USB {};           //!< CFG-MSGOUT-UBX_NAV_PVT_USB (Output rate of the UBX-NAV-PVT message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVAT_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_PVAT_UART1 {};        //!< CFG-MSGOUT-UBX_NAV_PVAT_UART1 (Output rate of the UBX-NAV-PVAT message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVAT_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_PVAT_UART2 {};        //!< CFG-MSGOUT-UBX_NAV_PVAT_UART2 (Output rate of the UBX-NAV-PVAT message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVAT_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_PVAT_SPI {};          //!< CFG-MSGOUT-UBX_NAV_PVAT_SPI (Output rate of the UBX-NAV-PVAT message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVAT_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_PVAT_I2C {};          //!< CFG-MSGOUT-UBX_NAV_PVAT_I2C (Output rate of the UBX-NAV-PVAT message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PVAT_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_PVAT_USB {};          //!< CFG-MSGOUT-UBX_NAV_PVAT_USB (Output rate of the UBX-NAV-PVAT message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_RELPOSNED_UART1_ID, UBLOXCFG_TYPE_U1>                               CFG_MSGOUT_UBX_NAV_RELPOSNED_UART1 {};   //!< CFG-MSGOUT-UBX_NAV_RELPOSNED_UART1 (Output rate of the UBX-NAV-RELPOSNED message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_RELPOSNED_UART2_ID, UBLOXCFG_TYPE_U1>                               CFG_MSGOUT_UBX_NAV_RELPOSNED_UART2 {};   //!< CFG-MSGOUT-UBX_NAV_RELPOSNED_UART2 (Output rate of the UBX-NAV-RELPOSNED message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_RELPOSNED_SPI_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_RELPOSNED_SPI {};     //!< CFG-MSGOUT-UBX_NAV_RELPOSNED_SPI (Output rate of the UBX-NAV-RELPOSNED message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_RELPOSNED_I2C_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_RELPOSNED_I2C {};     //!< CFG-MSGOUT-UBX_NAV_RELPOSNED_I2C (Output rate of the UBX-NAV-RELPOSNED message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_RELPOSNED_USB_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_RELPOSNED_USB {};     //!< CFG-MSGOUT-UBX_NAV_RELPOSNED_USB (Output rate of the UBX-NAV-RELPOSNED message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SAT_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_SAT_UART1 {};         //!< CFG-MSGOUT-UBX_NAV_SAT_UART1 (Output rate of the UBX-NAV-SAT message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SAT_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_SAT_UART2 {};         //!< CFG-MSGOUT-UBX_NAV_SAT_UART2 (Output rate of the UBX-NAV-SAT message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SAT_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_SAT_SPI {};           //!< CFG-MSGOUT-UBX_NAV_SAT_SPI (Output rate of the UBX-NAV-SAT message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SAT_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_SAT_I2C {};           //!< CFG-MSGOUT-UBX_NAV_SAT_I2C (Output rate of the UBX-NAV-SAT message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SAT_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_SAT_USB {};           //!< CFG-MSGOUT-UBX_NAV_SAT_USB (Output rate of the UBX-NAV-SAT message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SBAS_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_SBAS_UART1 {};        //!< CFG-MSGOUT-UBX_NAV_SBAS_UART1 (Output rate of the UBX-NAV-SBAS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SBAS_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_SBAS_UART2 {};        //!< CFG-MSGOUT-UBX_NAV_SBAS_UART2 (Output rate of the UBX-NAV-SBAS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SBAS_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_SBAS_SPI {};          //!< CFG-MSGOUT-UBX_NAV_SBAS_SPI (Output rate of the UBX-NAV-SBAS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SBAS_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_SBAS_I2C {};          //!< CFG-MSGOUT-UBX_NAV_SBAS_I2C (Output rate of the UBX-NAV-SBAS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SBAS_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_SBAS_USB {};          //!< CFG-MSGOUT-UBX_NAV_SBAS_USB (Output rate of the UBX-NAV-SBAS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SIG_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_SIG_UART1 {};         //!< CFG-MSGOUT-UBX_NAV_SIG_UART1 (Output rate of the UBX-NAV-SIG message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SIG_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV_SIG_UART2 {};         //!< CFG-MSGOUT-UBX_NAV_SIG_UART2 (Output rate of the UBX-NAV-SIG message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SIG_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_SIG_SPI {};           //!< CFG-MSGOUT-UBX_NAV_SIG_SPI (Output rate of the UBX-NAV-SIG message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SIG_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_SIG_I2C {};           //!< CFG-MSGOUT-UBX_NAV_SIG_I2C (Output rate of the UBX-NAV-SIG message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SIG_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_NAV_SIG_USB {};           //!< CFG-MSGOUT-UBX_NAV_SIG_USB (Output rate of the UBX-NAV-SIG message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SLAS_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_SLAS_UART1 {};        //!< CFG-MSGOUT-UBX_NAV_SLAS_UART1 (Output rate of the UBX-NAV-SLAS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SLAS_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_SLAS_UART2 {};        //!< CFG-MSGOUT-UBX_NAV_SLAS_UART2 (Output rate of the UBX-NAV-SLAS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SLAS_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_SLAS_SPI {};          //!< CFG-MSGOUT-UBX_NAV_SLAS_SPI (Output rate of the UBX-NAV-SLAS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SLAS_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_SLAS_I2C {};          //!< CFG-MSGOUT-UBX_NAV_SLAS_I2C (Output rate of the UBX-NAV-SLAS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SLAS_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_SLAS_USB {};          //!< CFG-MSGOUT-UBX_NAV_SLAS_USB (Output rate of the UBX-NAV-SLAS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_STATUS_UART1_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_STATUS_UART1 {};      //!< CFG-MSGOUT-UBX_NAV_STATUS_UART1 (Output rate of the UBX-NAV-STATUS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_STATUS_UART2_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_STATUS_UART2 {};      //!< CFG-MSGOUT-UBX_NAV_STATUS_UART2 (Output rate of the UBX-NAV-STATUS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_STATUS_SPI_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_STATUS_SPI {};        //!< CFG-MSGOUT-UBX_NAV_STATUS_SPI (Output rate of the UBX-NAV-STATUS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_STATUS_I2C_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_STATUS_I2C {};        //!< CFG-MSGOUT-UBX_NAV_STATUS_I2C (Output rate of the UBX-NAV-STATUS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_STATUS_USB_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_STATUS_USB {};        //!< CFG-MSGOUT-UBX_NAV_STATUS_USB (Output rate of the UBX-NAV-STATUS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SVIN_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_SVIN_UART1 {};        //!< CFG-MSGOUT-UBX_NAV_SVIN_UART1 (Output rate of the UBX-NAV-SVIN message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SVIN_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_SVIN_UART2 {};        //!< CFG-MSGOUT-UBX_NAV_SVIN_UART2 (Output rate of the UBX-NAV-SVIN message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SVIN_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_SVIN_SPI {};          //!< CFG-MSGOUT-UBX_NAV_SVIN_SPI (Output rate of the UBX-NAV-SVIN message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SVIN_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_SVIN_I2C {};          //!< CFG-MSGOUT-UBX_NAV_SVIN_I2C (Output rate of the UBX-NAV-SVIN message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_SVIN_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_SVIN_USB {};          //!< CFG-MSGOUT-UBX_NAV_SVIN_USB (Output rate of the UBX-NAV-SVIN message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEBDS_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEBDS_UART1 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEBDS_UART1 (Output rate of the UBX-NAV-TIMEBDS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEBDS_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEBDS_UART2 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEBDS_UART2 (Output rate of the UBX-NAV-TIMEBDS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEBDS_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEBDS_SPI {};       //!< CFG-MSGOUT-UBX_NAV_TIMEBDS_SPI (Output rate of the UBX-NAV-TIMEBDS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEBDS_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEBDS_I2C {};       //!< CFG-MSGOUT-UBX_NAV_TIMEBDS_I2C (Output rate of the UBX-NAV-TIMEBDS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEBDS_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEBDS_USB {};       //!< CFG-MSGOUT-UBX_NAV_TIMEBDS_USB (Output rate of the UBX-NAV-TIMEBDS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGAL_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEGAL_UART1 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEGAL_UART1 (Output rate of the UBX-NAV-TIMEGAL message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGAL_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEGAL_UART2 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEGAL_UART2 (Output rate of the UBX-NAV-TIMEGAL message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGAL_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEGAL_SPI {};       //!< CFG-MSGOUT-UBX_NAV_TIMEGAL_SPI (Output rate of the UBX-NAV-TIMEGAL message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGAL_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEGAL_I2C {};       //!< CFG-MSGOUT-UBX_NAV_TIMEGAL_I2C (Output rate of the UBX-NAV-TIMEGAL message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGAL_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEGAL_USB {};       //!< CFG-MSGOUT-UBX_NAV_TIMEGAL_USB (Output rate of the UBX-NAV-TIMEGAL message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGLO_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEGLO_UART1 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEGLO_UART1 (Output rate of the UBX-NAV-TIMEGLO message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGLO_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEGLO_UART2 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEGLO_UART2 (Output rate of the UBX-NAV-TIMEGLO message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGLO_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEGLO_SPI {};       //!< CFG-MSGOUT-UBX_NAV_TIMEGLO_SPI (Output rate of the UBX-NAV-TIMEGLO message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGLO_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEGLO_I2C {};       //!< CFG-MSGOUT-UBX_NAV_TIMEGLO_I2C (Output rate of the UBX-NAV-TIMEGLO message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGLO_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEGLO_USB {};       //!< CFG-MSGOUT-UBX_NAV_TIMEGLO_USB (Output rate of the UBX-NAV-TIMEGLO message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGPS_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEGPS_UART1 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEGPS_UART1 (Output rate of the UBX-NAV-TIMEGPS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGPS_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEGPS_UART2 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEGPS_UART2 (Output rate of the UBX-NAV-TIMEGPS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGPS_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEGPS_SPI {};       //!< CFG-MSGOUT-UBX_NAV_TIMEGPS_SPI (Output rate of the UBX-NAV-TIMEGPS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGPS_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEGPS_I2C {};       //!< CFG-MSGOUT-UBX_NAV_TIMEGPS_I2C (Output rate of the UBX-NAV-TIMEGPS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEGPS_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEGPS_USB {};       //!< CFG-MSGOUT-UBX_NAV_TIMEGPS_USB (Output rate of the UBX-NAV-TIMEGPS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMELS_UART1_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_TIMELS_UART1 {};      //!< CFG-MSGOUT-UBX_NAV_TIMELS_UART1 (Output rate of the UBX-NAV-TIMELS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMELS_UART2_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_TIMELS_UART2 {};      //!< CFG-MSGOUT-UBX_NAV_TIMELS_UART2 (Output rate of the UBX-NAV-TIMELS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMELS_SPI_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_TIMELS_SPI {};        //!< CFG-MSGOUT-UBX_NAV_TIMELS_SPI (Output rate of the UBX-NAV-TIMELS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMELS_I2C_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_TIMELS_I2C {};        //!< CFG-MSGOUT-UBX_NAV_TIMELS_I2C (Output rate of the UBX-NAV-TIMELS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMELS_USB_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_TIMELS_USB {};        //!< CFG-MSGOUT-UBX_NAV_TIMELS_USB (Output rate of the UBX-NAV-TIMELS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEQZSS_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV_TIMEQZSS_UART1 {};    //!< CFG-MSGOUT-UBX_NAV_TIMEQZSS_UART1 (Output rate of the UBX-NAV-TIMEQZSS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEQZSS_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV_TIMEQZSS_UART2 {};    //!< CFG-MSGOUT-UBX_NAV_TIMEQZSS_UART2 (Output rate of the UBX-NAV-TIMEQZSS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEQZSS_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_TIMEQZSS_SPI {};      //!< CFG-MSGOUT-UBX_NAV_TIMEQZSS_SPI (Output rate of the UBX-NAV-TIMEQZSS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEQZSS_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_TIMEQZSS_I2C {};      //!< CFG-MSGOUT-UBX_NAV_TIMEQZSS_I2C (Output rate of the UBX-NAV-TIMEQZSS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEQZSS_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_TIMEQZSS_USB {};      //!< CFG-MSGOUT-UBX_NAV_TIMEQZSS_USB (Output rate of the UBX-NAV-TIMEQZSS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEUTC_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEUTC_UART1 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEUTC_UART1 (Output rate of the UBX-NAV-TIMEUTC message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEUTC_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_TIMEUTC_UART2 {};     //!< CFG-MSGOUT-UBX_NAV_TIMEUTC_UART2 (Output rate of the UBX-NAV-TIMEUTC message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEUTC_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEUTC_SPI {};       //!< CFG-MSGOUT-UBX_NAV_TIMEUTC_SPI (Output rate of the UBX-NAV-TIMEUTC message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEUTC_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEUTC_I2C {};       //!< CFG-MSGOUT-UBX_NAV_TIMEUTC_I2C (Output rate of the UBX-NAV-TIMEUTC message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_TIMEUTC_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_TIMEUTC_USB {};       //!< CFG-MSGOUT-UBX_NAV_TIMEUTC_USB (Output rate of the UBX-NAV-TIMEUTC message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELECEF_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_VELECEF_UART1 {};     //!< CFG-MSGOUT-UBX_NAV_VELECEF_UART1 (Output rate of the UBX-NAV-VELECEF message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELECEF_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV_VELECEF_UART2 {};     //!< CFG-MSGOUT-UBX_NAV_VELECEF_UART2 (Output rate of the UBX-NAV-VELECEF message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELECEF_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_VELECEF_SPI {};       //!< CFG-MSGOUT-UBX_NAV_VELECEF_SPI (Output rate of the UBX-NAV-VELECEF message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELECEF_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_VELECEF_I2C {};       //!< CFG-MSGOUT-UBX_NAV_VELECEF_I2C (Output rate of the UBX-NAV-VELECEF message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELECEF_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV_VELECEF_USB {};       //!< CFG-MSGOUT-UBX_NAV_VELECEF_USB (Output rate of the UBX-NAV-VELECEF message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELNED_UART1_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_VELNED_UART1 {};      //!< CFG-MSGOUT-UBX_NAV_VELNED_UART1 (Output rate of the UBX-NAV-VELNED message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELNED_UART2_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV_VELNED_UART2 {};      //!< CFG-MSGOUT-UBX_NAV_VELNED_UART2 (Output rate of the UBX-NAV-VELNED message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELNED_SPI_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_VELNED_SPI {};        //!< CFG-MSGOUT-UBX_NAV_VELNED_SPI (Output rate of the UBX-NAV-VELNED message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELNED_I2C_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_VELNED_I2C {};        //!< CFG-MSGOUT-UBX_NAV_VELNED_I2C (Output rate of the UBX-NAV-VELNED message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_VELNED_USB_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV_VELNED_USB {};        //!< CFG-MSGOUT-UBX_NAV_VELNED_USB (Output rate of the UBX-NAV-VELNED message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PL_UART1_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_PL_UART1 {};          //!< CFG-MSGOUT-UBX_NAV_PL_UART1 (Output rate of the UBX-NAV-PL message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PL_UART2_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV_PL_UART2 {};          //!< CFG-MSGOUT-UBX_NAV_PL_UART2 (Output rate of the UBX-NAV-PL message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PL_SPI_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_NAV_PL_SPI {};            //!< CFG-MSGOUT-UBX_NAV_PL_SPI (Output rate of the UBX-NAV-PL message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PL_I2C_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_NAV_PL_I2C {};            //!< CFG-MSGOUT-UBX_NAV_PL_I2C (Output rate of the UBX-NAV-PL message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV_PL_USB_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_NAV_PL_USB {};            //!< CFG-MSGOUT-UBX_NAV_PL_USB (Output rate of the UBX-NAV-PL message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_CLOCK_UART1_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_CLOCK_UART1 {};      //!< CFG-MSGOUT-UBX_NAV2_CLOCK_UART1 (Output rate of the UBX-NAV2-CLOCK message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_CLOCK_UART2_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_CLOCK_UART2 {};      //!< CFG-MSGOUT-UBX_NAV2_CLOCK_UART2 (Output rate of the UBX-NAV2-CLOCK message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_CLOCK_SPI_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_CLOCK_SPI {};        //!< CFG-MSGOUT-UBX_NAV2_CLOCK_SPI (Output rate of the UBX-NAV2-CLOCK message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_CLOCK_I2C_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_CLOCK_I2C {};        //!< CFG-MSGOUT-UBX_NAV2_CLOCK_I2C (Output rate of the UBX-NAV2-CLOCK message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_CLOCK_USB_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_CLOCK_USB {};        //!< CFG-MSGOUT-UBX_NAV2_CLOCK_USB (Output rate of the UBX-NAV2-CLOCK message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_COV_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_COV_UART1 {};        //!< CFG-MSGOUT-UBX_NAV2_COV_UART1 (Output rate of the UBX-NAV2-COV message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_COV_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_COV_UART2 {};        //!< CFG-MSGOUT-UBX_NAV2_COV_UART2 (Output rate of the UBX-NAV2-COV message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_COV_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_COV_SPI {};          //!< CFG-MSGOUT-UBX_NAV2_COV_SPI (Output rate of the UBX-NAV2-COV message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_COV_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_COV_I2C {};          //!< CFG-MSGOUT-UBX_NAV2_COV_I2C (Output rate of the UBX-NAV2-COV message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_COV_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_COV_USB {};          //!< CFG-MSGOUT-UBX_NAV2_COV_USB (Output rate of the UBX-NAV2-COV message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_DOP_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_DOP_UART1 {};        //!< CFG-MSGOUT-UBX_NAV2_DOP_UART1 (Output rate of the UBX-NAV2-DOP message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_DOP_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_DOP_UART2 {};        //!< CFG-MSGOUT-UBX_NAV2_DOP_UART2 (Output rate of the UBX-NAV2-DOP message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_DOP_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_DOP_SPI {};          //!< CFG-MSGOUT-UBX_NAV2_DOP_SPI (Output rate of the UBX-NAV2-DOP message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_DOP_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_DOP_I2C {};          //!< CFG-MSGOUT-UBX_NAV2_DOP_I2C (Output rate of the UBX-NAV2-DOP message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_DOP_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_DOP_USB {};          //!< CFG-MSGOUT-UBX_NAV2_DOP_USB (Output rate of the UBX-NAV2-DOP message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_EOE_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_EOE_UART1 {};        //!< CFG-MSGOUT-UBX_NAV2_EOE_UART1 (Output rate of the UBX-NAV2-EOE message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_EOE_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_EOE_UART2 {};        //!< CFG-MSGOUT-UBX_NAV2_EOE_UART2 (Output rate of the UBX-NAV2-EOE message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_EOE_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_EOE_SPI {};          //!< CFG-MSGOUT-UBX_NAV2_EOE_SPI (Output rate of the UBX-NAV2-EOE message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_EOE_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_EOE_I2C {};          //!< CFG-MSGOUT-UBX_NAV2_EOE_I2C (Output rate of the UBX-NAV2-EOE message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_EOE_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_EOE_USB {};          //!< CFG-MSGOUT-UBX_NAV2_EOE_USB (Output rate of the UBX-NAV2-EOE message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_ODO_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_ODO_UART1 {};        //!< CFG-MSGOUT-UBX_NAV2_ODO_UART1 (Output rate of the UBX-NAV2-ODO message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_ODO_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_ODO_UART2 {};        //!< CFG-MSGOUT-UBX_NAV2_ODO_UART2 (Output rate of the UBX-NAV2-ODO message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_ODO_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_ODO_SPI {};          //!< CFG-MSGOUT-UBX_NAV2_ODO_SPI (Output rate of the UBX-NAV2-ODO message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_ODO_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_ODO_I2C {};          //!< CFG-MSGOUT-UBX_NAV2_ODO_I2C (Output rate of the UBX-NAV2-ODO message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_ODO_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_ODO_USB {};          //!< CFG-MSGOUT-UBX_NAV2_ODO_USB (Output rate of the UBX-NAV2-ODO message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSECEF_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_POSECEF_UART1 {};    //!< CFG-MSGOUT-UBX_NAV2_POSECEF_UART1 (Output rate of the UBX-NAV2-POSECEF message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSECEF_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_POSECEF_UART2 {};    //!< CFG-MSGOUT-UBX_NAV2_POSECEF_UART2 (Output rate of the UBX-NAV2-POSECEF message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSECEF_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_POSECEF_SPI {};      //!< CFG-MSGOUT-UBX_NAV2_POSECEF_SPI (Output rate of the UBX-NAV2-POSECEF message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSECEF_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_POSECEF_I2C {};      //!< CFG-MSGOUT-UBX_NAV2_POSECEF_I2C (Output rate of the UBX-NAV2-POSECEF message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSECEF_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_POSECEF_USB {};      //!< CFG-MSGOUT-UBX_NAV2_POSECEF_USB (Output rate of the UBX-NAV2-POSECEF message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSLLH_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_POSLLH_UART1 {};     //!< CFG-MSGOUT-UBX_NAV2_POSLLH_UART1 (Output rate of the UBX-NAV2-POSLLH message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSLLH_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_POSLLH_UART2 {};     //!< CFG-MSGOUT-UBX_NAV2_POSLLH_UART2 (Output rate of the UBX-NAV2-POSLLH message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSLLH_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_POSLLH_SPI {};       //!< CFG-MSGOUT-UBX_NAV2_POSLLH_SPI (Output rate of the UBX-NAV2-POSLLH message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSLLH_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_POSLLH_I2C {};       //!< CFG-MSGOUT-UBX_NAV2_POSLLH_I2C (Output rate of the UBX-NAV2-POSLLH message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_POSLLH_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_POSLLH_USB {};       //!< CFG-MSGOUT-UBX_NAV2_POSLLH_USB (Output rate of the UBX-NAV2-POSLLH message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_PVT_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_PVT_UART1 {};        //!< CFG-MSGOUT-UBX_NAV2_PVT_UART1 (Output rate of the UBX-NAV2-PVT message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_PVT_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_PVT_UART2 {};        //!< CFG-MSGOUT-UBX_NAV2_PVT_UART2 (Output rate of the UBX-NAV2-PVT message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_PVT_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_PVT_SPI {};          //!< CFG-MSGOUT-UBX_NAV2_PVT_SPI (Output rate of the UBX-NAV2-PVT message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_PVT_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_PVT_I2C {};          //!< CFG-MSGOUT-UBX_NAV2_PVT_I2C (Output rate of the UBX-NAV2-PVT message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_PVT_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_PVT_USB {};          //!< CFG-MSGOUT-UBX_NAV2_PVT_USB (Output rate of the UBX-NAV2-PVT message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SAT_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_SAT_UART1 {};        //!< CFG-MSGOUT-UBX_NAV2_SAT_UART1 (Output rate of the UBX-NAV2-SAT message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SAT_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_SAT_UART2 {};        //!< CFG-MSGOUT-UBX_NAV2_SAT_UART2 (Output rate of the UBX-NAV2-SAT message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SAT_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_SAT_SPI {};          //!< CFG-MSGOUT-UBX_NAV2_SAT_SPI (Output rate of the UBX-NAV2-SAT message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SAT_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_SAT_I2C {};          //!< CFG-MSGOUT-UBX_NAV2_SAT_I2C (Output rate of the UBX-NAV2-SAT message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SAT_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_SAT_USB {};          //!< CFG-MSGOUT-UBX_NAV2_SAT_USB (Output rate of the UBX-NAV2-SAT message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SBAS_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_SBAS_UART1 {};       //!< CFG-MSGOUT-UBX_NAV2_SBAS_UART1 (Output rate of the UBX-NAV2-SBAS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SBAS_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_SBAS_UART2 {};       //!< CFG-MSGOUT-UBX_NAV2_SBAS_UART2 (Output rate of the UBX-NAV2-SBAS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SBAS_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV2_SBAS_SPI {};         //!< CFG-MSGOUT-UBX_NAV2_SBAS_SPI (Output rate of the UBX-NAV2-SBAS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SBAS_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV2_SBAS_I2C {};         //!< CFG-MSGOUT-UBX_NAV2_SBAS_I2C (Output rate of the UBX-NAV2-SBAS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SBAS_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV2_SBAS_USB {};         //!< CFG-MSGOUT-UBX_NAV2_SBAS_USB (Output rate of the UBX-NAV2-SBAS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SIG_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_SIG_UART1 {};        //!< CFG-MSGOUT-UBX_NAV2_SIG_UART1 (Output rate of the UBX-NAV2-SIG message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SIG_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_NAV2_SIG_UART2 {};        //!< CFG-MSGOUT-UBX_NAV2_SIG_UART2 (Output rate of the UBX-NAV2-SIG message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SIG_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_SIG_SPI {};          //!< CFG-MSGOUT-UBX_NAV2_SIG_SPI (Output rate of the UBX-NAV2-SIG message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SIG_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_SIG_I2C {};          //!< CFG-MSGOUT-UBX_NAV2_SIG_I2C (Output rate of the UBX-NAV2-SIG message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SIG_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_NAV2_SIG_USB {};          //!< CFG-MSGOUT-UBX_NAV2_SIG_USB (Output rate of the UBX-NAV2-SIG message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SLAS_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_SLAS_UART1 {};       //!< CFG-MSGOUT-UBX_NAV2_SLAS_UART1 (Output rate of the UBX-NAV2-SLAS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SLAS_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_SLAS_UART2 {};       //!< CFG-MSGOUT-UBX_NAV2_SLAS_UART2 (Output rate of the UBX-NAV2-SLAS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SLAS_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV2_SLAS_SPI {};         //!< CFG-MSGOUT-UBX_NAV2_SLAS_SPI (Output rate of the UBX-NAV2-SLAS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SLAS_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV2_SLAS_I2C {};         //!< CFG-MSGOUT-UBX_NAV2_SLAS_I2C (Output rate of the UBX-NAV2-SLAS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SLAS_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV2_SLAS_USB {};         //!< CFG-MSGOUT-UBX_NAV2_SLAS_USB (Output rate of the UBX-NAV2-SLAS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_STATUS_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_STATUS_UART1 {};     //!< CFG-MSGOUT-UBX_NAV2_STATUS_UART1 (Output rate of the UBX-NAV2-STATUS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_STATUS_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_STATUS_UART2 {};     //!< CFG-MSGOUT-UBX_NAV2_STATUS_UART2 (Output rate of the UBX-NAV2-STATUS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_STATUS_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_STATUS_SPI {};       //!< CFG-MSGOUT-UBX_NAV2_STATUS_SPI (Output rate of the UBX-NAV2-STATUS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_STATUS_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_STATUS_I2C {};       //!< CFG-MSGOUT-UBX_NAV2_STATUS_I2C (Output rate of the UBX-NAV2-STATUS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_STATUS_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_STATUS_USB {};       //!< CFG-MSGOUT-UBX_NAV2_STATUS_USB (Output rate of the UBX-NAV2-STATUS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SVIN_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_SVIN_UART1 {};       //!< CFG-MSGOUT-UBX_NAV2_SVIN_UART1 (Output rate of the UBX-NAV2-SVIN message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SVIN_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_SVIN_UART2 {};       //!< CFG-MSGOUT-UBX_NAV2_SVIN_UART2 (Output rate of the UBX-NAV2-SVIN message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SVIN_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV2_SVIN_SPI {};         //!< CFG-MSGOUT-UBX_NAV2_SVIN_SPI (Output rate of the UBX-NAV2-SVIN message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SVIN_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV2_SVIN_I2C {};         //!< CFG-MSGOUT-UBX_NAV2_SVIN_I2C (Output rate of the UBX-NAV2-SVIN message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_SVIN_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_NAV2_SVIN_USB {};         //!< CFG-MSGOUT-UBX_NAV2_SVIN_USB (Output rate of the UBX-NAV2-SVIN message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEBDS_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEBDS_UART1 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEBDS_UART1 (Output rate of the UBX-NAV2-TIMEBDS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEBDS_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEBDS_UART2 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEBDS_UART2 (Output rate of the UBX-NAV2-TIMEBDS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEBDS_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEBDS_SPI {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEBDS_SPI (Output rate of the UBX-NAV2-TIMEBDS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEBDS_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEBDS_I2C {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEBDS_I2C (Output rate of the UBX-NAV2-TIMEBDS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEBDS_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEBDS_USB {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEBDS_USB (Output rate of the UBX-NAV2-TIMEBDS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGAL_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEGAL_UART1 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEGAL_UART1 (Output rate of the UBX-NAV2-TIMEGAL message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGAL_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEGAL_UART2 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEGAL_UART2 (Output rate of the UBX-NAV2-TIMEGAL message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGAL_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEGAL_SPI {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEGAL_SPI (Output rate of the UBX-NAV2-TIMEGAL message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGAL_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEGAL_I2C {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEGAL_I2C (Output rate of the UBX-NAV2-TIMEGAL message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGAL_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEGAL_USB {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEGAL_USB (Output rate of the UBX-NAV2-TIMEGAL message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGLO_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEGLO_UART1 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEGLO_UART1 (Output rate of the UBX-NAV2-TIMEGLO message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGLO_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEGLO_UART2 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEGLO_UART2 (Output rate of the UBX-NAV2-TIMEGLO message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGLO_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEGLO_SPI {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEGLO_SPI (Output rate of the UBX-NAV2-TIMEGLO message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGLO_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEGLO_I2C {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEGLO_I2C (Output rate of the UBX-NAV2-TIMEGLO message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGLO_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEGLO_USB {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEGLO_USB (Output rate of the UBX-NAV2-TIMEGLO message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGPS_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEGPS_UART1 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEGPS_UART1 (Output rate of the UBX-NAV2-TIMEGPS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGPS_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEGPS_UART2 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEGPS_UART2 (Output rate of the UBX-NAV2-TIMEGPS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGPS_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEGPS_SPI {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEGPS_SPI (Output rate of the UBX-NAV2-TIMEGPS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGPS_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEGPS_I2C {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEGPS_I2C (Output rate of the UBX-NAV2-TIMEGPS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEGPS_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEGPS_USB {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEGPS_USB (Output rate of the UBX-NAV2-TIMEGPS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMELS_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_TIMELS_UART1 {};     //!< CFG-MSGOUT-UBX_NAV2_TIMELS_UART1 (Output rate of the UBX-NAV2-TIMELS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMELS_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_TIMELS_UART2 {};     //!< CFG-MSGOUT-UBX_NAV2_TIMELS_UART2 (Output rate of the UBX-NAV2-TIMELS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMELS_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_TIMELS_SPI {};       //!< CFG-MSGOUT-UBX_NAV2_TIMELS_SPI (Output rate of the UBX-NAV2-TIMELS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMELS_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_TIMELS_I2C {};       //!< CFG-MSGOUT-UBX_NAV2_TIMELS_I2C (Output rate of the UBX-NAV2-TIMELS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMELS_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_TIMELS_USB {};       //!< CFG-MSGOUT-UBX_NAV2_TIMELS_USB (Output rate of the UBX-NAV2-TIMELS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEQZSS_UART1_ID, UBLOXCFG_TYPE_U1>                               CFG_MSGOUT_UBX_NAV2_TIMEQZSS_UART1 {};   //!< CFG-MSGOUT-UBX_NAV2_TIMEQZSS_UART1 (Output rate of the UBX-NAV2-TIMEQZSS message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEQZSS_UART2_ID, UBLOXCFG_TYPE_U1>                               CFG_MSGOUT_UBX_NAV2_TIMEQZSS_UART2 {};   //!< CFG-MSGOUT-UBX_NAV2_TIMEQZSS_UART2 (Output rate of the UBX-NAV2-TIMEQZSS message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEQZSS_SPI_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_TIMEQZSS_SPI {};     //!< CFG-MSGOUT-UBX_NAV2_TIMEQZSS_SPI (Output rate of the UBX-NAV2-TIMEQZSS message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEQZSS_I2C_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_TIMEQZSS_I2C {};     //!< CFG-MSGOUT-UBX_NAV2_TIMEQZSS_I2C (Output rate of the UBX-NAV2-TIMEQZSS message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEQZSS_USB_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_TIMEQZSS_USB {};     //!< CFG-MSGOUT-UBX_NAV2_TIMEQZSS_USB (Output rate of the UBX-NAV2-TIMEQZSS message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEUTC_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEUTC_UART1 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEUTC_UART1 (Output rate of the UBX-NAV2-TIMEUTC message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEUTC_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_TIMEUTC_UART2 {};    //!< CFG-MSGOUT-UBX_NAV2_TIMEUTC_UART2 (Output rate of the UBX-NAV2-TIMEUTC message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEUTC_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEUTC_SPI {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEUTC_SPI (Output rate of the UBX-NAV2-TIMEUTC message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEUTC_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEUTC_I2C {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEUTC_I2C (Output rate of the UBX-NAV2-TIMEUTC message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_TIMEUTC_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_TIMEUTC_USB {};      //!< CFG-MSGOUT-UBX_NAV2_TIMEUTC_USB (Output rate of the UBX-NAV2-TIMEUTC message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELECEF_UART1_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_VELECEF_UART1 {};    //!< CFG-MSGOUT-UBX_NAV2_VELECEF_UART1 (Output rate of the UBX-NAV2-VELECEF message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELECEF_UART2_ID, UBLOXCFG_TYPE_U1>                                CFG_MSGOUT_UBX_NAV2_VELECEF_UART2 {};    //!< CFG-MSGOUT-UBX_NAV2_VELECEF_UART2 (Output rate of the UBX-NAV2-VELECEF message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELECEF_SPI_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_VELECEF_SPI {};      //!< CFG-MSGOUT-UBX_NAV2_VELECEF_SPI (Output rate of the UBX-NAV2-VELECEF message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELECEF_I2C_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_VELECEF_I2C {};      //!< CFG-MSGOUT-UBX_NAV2_VELECEF_I2C (Output rate of the UBX-NAV2-VELECEF message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELECEF_USB_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_NAV2_VELECEF_USB {};      //!< CFG-MSGOUT-UBX_NAV2_VELECEF_USB (Output rate of the UBX-NAV2-VELECEF message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELNED_UART1_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_VELNED_UART1 {};     //!< CFG-MSGOUT-UBX_NAV2_VELNED_UART1 (Output rate of the UBX-NAV2-VELNED message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELNED_UART2_ID, UBLOXCFG_TYPE_U1>                                 CFG_MSGOUT_UBX_NAV2_VELNED_UART2 {};     //!< CFG-MSGOUT-UBX_NAV2_VELNED_UART2 (Output rate of the UBX-NAV2-VELNED message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELNED_SPI_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_VELNED_SPI {};       //!< CFG-MSGOUT-UBX_NAV2_VELNED_SPI (Output rate of the UBX-NAV2-VELNED message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELNED_I2C_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_VELNED_I2C {};       //!< CFG-MSGOUT-UBX_NAV2_VELNED_I2C (Output rate of the UBX-NAV2-VELNED message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_NAV2_VELNED_USB_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_NAV2_VELNED_USB {};       //!< CFG-MSGOUT-UBX_NAV2_VELNED_USB (Output rate of the UBX-NAV2-VELNED message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_COR_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_COR_UART1 {};         //!< CFG-MSGOUT-UBX_RXM_COR_UART1 (Output rate of the UBX-RXM-COR message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_COR_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_COR_UART2 {};         //!< CFG-MSGOUT-UBX_RXM_COR_UART2 (Output rate of the UBX-RXM-COR message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_COR_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_RXM_COR_SPI {};           //!< CFG-MSGOUT-UBX_RXM_COR_SPI (Output rate of the UBX-RXM-COR message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_COR_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_RXM_COR_I2C {};           //!< CFG-MSGOUT-UBX_RXM_COR_I2C (Output rate of the UBX-RXM-COR message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_COR_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_RXM_COR_USB {};           //!< CFG-MSGOUT-UBX_RXM_COR_USB (Output rate of the UBX-RXM-COR message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_MEASX_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_RXM_MEASX_UART1 {};       //!< CFG-MSGOUT-UBX_RXM_MEASX_UART1 (Output rate of the UBX-RXM-MEASX message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_MEASX_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_RXM_MEASX_UART2 {};       //!< CFG-MSGOUT-UBX_RXM_MEASX_UART2 (Output rate of the UBX-RXM-MEASX message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_MEASX_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_MEASX_SPI {};         //!< CFG-MSGOUT-UBX_RXM_MEASX_SPI (Output rate of the UBX-RXM-MEASX message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_MEASX_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_MEASX_I2C {};         //!< CFG-MSGOUT-UBX_RXM_MEASX_I2C (Output rate of the UBX-RXM-MEASX message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_MEASX_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_MEASX_USB {};         //!< CFG-MSGOUT-UBX_RXM_MEASX_USB (Output rate of the UBX-RXM-MEASX message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RAWX_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_RXM_RAWX_UART1 {};        //!< CFG-MSGOUT-UBX_RXM_RAWX_UART1 (Output rate of the UBX-RXM-RAWX message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RAWX_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_RXM_RAWX_UART2 {};        //!< CFG-MSGOUT-UBX_RXM_RAWX_UART2 (Output rate of the UBX-RXM-RAWX message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RAWX_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_RXM_RAWX_SPI {};          //!< CFG-MSGOUT-UBX_RXM_RAWX_SPI (Output rate of the UBX-RXM-RAWX message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RAWX_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_RXM_RAWX_I2C {};          //!< CFG-MSGOUT-UBX_RXM_RAWX_I2C (Output rate of the UBX-RXM-RAWX message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RAWX_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_RXM_RAWX_USB {};          //!< CFG-MSGOUT-UBX_RXM_RAWX_USB (Output rate of the UBX-RXM-RAWX message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RLM_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_RLM_UART1 {};         //!< CFG-MSGOUT-UBX_RXM_RLM_UART1 (Output rate of the UBX-RXM-RLM message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RLM_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_RLM_UART2 {};         //!< CFG-MSGOUT-UBX_RXM_RLM_UART2 (Output rate of the UBX-RXM-RLM message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RLM_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_RXM_RLM_SPI {};           //!< CFG-MSGOUT-UBX_RXM_RLM_SPI (Output rate of the UBX-RXM-RLM message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RLM_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_RXM_RLM_I2C {};           //!< CFG-MSGOUT-UBX_RXM_RLM_I2C (Output rate of the UBX-RXM-RLM message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RLM_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_RXM_RLM_USB {};           //!< CFG-MSGOUT-UBX_RXM_RLM_USB (Output rate of the UBX-RXM-RLM message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RTCM_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_RXM_RTCM_UART1 {};        //!< CFG-MSGOUT-UBX_RXM_RTCM_UART1 (Output rate of the UBX-RXM-RTCM message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RTCM_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_RXM_RTCM_UART2 {};        //!< CFG-MSGOUT-UBX_RXM_RTCM_UART2 (Output rate of the UBX-RXM-RTCM message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RTCM_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_RXM_RTCM_SPI {};          //!< CFG-MSGOUT-UBX_RXM_RTCM_SPI (Output rate of the UBX-RXM-RTCM message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RTCM_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_RXM_RTCM_I2C {};          //!< CFG-MSGOUT-UBX_RXM_RTCM_I2C (Output rate of the UBX-RXM-RTCM message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_RTCM_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_RXM_RTCM_USB {};          //!< CFG-MSGOUT-UBX_RXM_RTCM_USB (Output rate of the UBX-RXM-RTCM message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SFRBX_UART1_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_RXM_SFRBX_UART1 {};       //!< CFG-MSGOUT-UBX_RXM_SFRBX_UART1 (Output rate of the UBX-RXM-SFRBX message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SFRBX_UART2_ID, UBLOXCFG_TYPE_U1>                                   CFG_MSGOUT_UBX_RXM_SFRBX_UART2 {};       //!< CFG-MSGOUT-UBX_RXM_SFRBX_UART2 (Output rate of the UBX-RXM-SFRBX message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SFRBX_SPI_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_SFRBX_SPI {};         //!< CFG-MSGOUT-UBX_RXM_SFRBX_SPI (Output rate of the UBX-RXM-SFRBX message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SFRBX_I2C_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_SFRBX_I2C {};         //!< CFG-MSGOUT-UBX_RXM_SFRBX_I2C (Output rate of the UBX-RXM-SFRBX message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SFRBX_USB_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_RXM_SFRBX_USB {};         //!< CFG-MSGOUT-UBX_RXM_SFRBX_USB (Output rate of the UBX-RXM-SFRBX message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SPARTN_UART1_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_RXM_SPARTN_UART1 {};      //!< CFG-MSGOUT-UBX_RXM_SPARTN_UART1 (Output rate of the UBX-RXM-SPARTN message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SPARTN_UART2_ID, UBLOXCFG_TYPE_U1>                                  CFG_MSGOUT_UBX_RXM_SPARTN_UART2 {};      //!< CFG-MSGOUT-UBX_RXM_SPARTN_UART2 (Output rate of the UBX-RXM-SPARTN message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SPARTN_SPI_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_RXM_SPARTN_SPI {};        //!< CFG-MSGOUT-UBX_RXM_SPARTN_SPI (Output rate of the UBX-RXM-SPARTN message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SPARTN_I2C_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_RXM_SPARTN_I2C {};        //!< CFG-MSGOUT-UBX_RXM_SPARTN_I2C (Output rate of the UBX-RXM-SPARTN message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_RXM_SPARTN_USB_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_RXM_SPARTN_USB {};        //!< CFG-MSGOUT-UBX_RXM_SPARTN_USB (Output rate of the UBX-RXM-SPARTN message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TM2_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_TIM_TM2_UART1 {};         //!< CFG-MSGOUT-UBX_TIM_TM2_UART1 (Output rate of the UBX-TIM-TM2 message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TM2_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_TIM_TM2_UART2 {};         //!< CFG-MSGOUT-UBX_TIM_TM2_UART2 (Output rate of the UBX-TIM-TM2 message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TM2_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_TIM_TM2_SPI {};           //!< CFG-MSGOUT-UBX_TIM_TM2_SPI (Output rate of the UBX-TIM-TM2 message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TM2_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_TIM_TM2_I2C {};           //!< CFG-MSGOUT-UBX_TIM_TM2_I2C (Output rate of the UBX-TIM-TM2 message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TM2_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_TIM_TM2_USB {};           //!< CFG-MSGOUT-UBX_TIM_TM2_USB (Output rate of the UBX-TIM-TM2 message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TP_UART1_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_TIM_TP_UART1 {};          //!< CFG-MSGOUT-UBX_TIM_TP_UART1 (Output rate of the UBX-TIM-TP message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TP_UART2_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_TIM_TP_UART2 {};          //!< CFG-MSGOUT-UBX_TIM_TP_UART2 (Output rate of the UBX-TIM-TP message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TP_SPI_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_TIM_TP_SPI {};            //!< CFG-MSGOUT-UBX_TIM_TP_SPI (Output rate of the UBX-TIM-TP message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TP_I2C_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_TIM_TP_I2C {};            //!< CFG-MSGOUT-UBX_TIM_TP_I2C (Output rate of the UBX-TIM-TP message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_TP_USB_ID, UBLOXCFG_TYPE_U1>                                        CFG_MSGOUT_UBX_TIM_TP_USB {};            //!< CFG-MSGOUT-UBX_TIM_TP_USB (Output rate of the UBX-TIM-TP message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_VRFY_UART1_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_TIM_VRFY_UART1 {};        //!< CFG-MSGOUT-UBX_TIM_VRFY_UART1 (Output rate of the UBX-TIM-VRFY message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_VRFY_UART2_ID, UBLOXCFG_TYPE_U1>                                    CFG_MSGOUT_UBX_TIM_VRFY_UART2 {};        //!< CFG-MSGOUT-UBX_TIM_VRFY_UART2 (Output rate of the UBX-TIM-VRFY message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_VRFY_SPI_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_TIM_VRFY_SPI {};          //!< CFG-MSGOUT-UBX_TIM_VRFY_SPI (Output rate of the UBX-TIM-VRFY message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_VRFY_I2C_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_TIM_VRFY_I2C {};          //!< CFG-MSGOUT-UBX_TIM_VRFY_I2C (Output rate of the UBX-TIM-VRFY message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_TIM_VRFY_USB_ID, UBLOXCFG_TYPE_U1>                                      CFG_MSGOUT_UBX_TIM_VRFY_USB {};          //!< CFG-MSGOUT-UBX_TIM_VRFY_USB (Output rate of the UBX-TIM-VRFY message on port USB)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_SEC_SIG_UART1_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_SEC_SIG_UART1 {};         //!< CFG-MSGOUT-UBX_SEC_SIG_UART1 (Output rate of the UBX-SEC-SIG message on port UART1)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_SEC_SIG_UART2_ID, UBLOXCFG_TYPE_U1>                                     CFG_MSGOUT_UBX_SEC_SIG_UART2 {};         //!< CFG-MSGOUT-UBX_SEC_SIG_UART2 (Output rate of the UBX-SEC-SIG message on port UART2)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_SEC_SIG_SPI_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_SEC_SIG_SPI {};           //!< CFG-MSGOUT-UBX_SEC_SIG_SPI (Output rate of the UBX-SEC-SIG message on port SPI)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_SEC_SIG_I2C_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_SEC_SIG_I2C {};           //!< CFG-MSGOUT-UBX_SEC_SIG_I2C (Output rate of the UBX-SEC-SIG message on port I2C)
+inline constexpr Item<UBLOXCFG_CFG_MSGOUT_UBX_SEC_SIG_USB_ID, UBLOXCFG_TYPE_U1>                                       CFG_MSGOUT_UBX_SEC_SIG_USB {};           //!< CFG-MSGOUT-UBX_SEC_SIG_USB (Output rate of the UBX-SEC-SIG message on port USB)
+
+// CFG-NAVHPG
+inline constexpr Item<UBLOXCFG_CFG_NAVHPG_DGNSSMODE_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NAVHPG_DGNSSMODE_t>            CFG_NAVHPG_DGNSSMODE {};                 //!< CFG-NAVHPG-DGNSSMODE (Differential corrections mode)
+
+// CFG-NAVSPG
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_FIXMODE_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NAVSPG_FIXMODE_t>                CFG_NAVSPG_FIXMODE {};                   //!< CFG-NAVSPG-FIXMODE (Position fix mode)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_INIFIX3D_ID, UBLOXCFG_TYPE_L>                                               CFG_NAVSPG_INIFIX3D {};                  //!< CFG-NAVSPG-INIFIX3D (Initial fix must be a 3D fix)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_WKNROLLOVER_ID, UBLOXCFG_TYPE_U2>                                           CFG_NAVSPG_WKNROLLOVER {};               //!< CFG-NAVSPG-WKNROLLOVER (GPS week rollover number)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USE_PPP_ID, UBLOXCFG_TYPE_L>                                                CFG_NAVSPG_USE_PPP {};                   //!< CFG-NAVSPG-USE_PPP (Use precise point positioning (PPP))
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_UTCSTANDARD_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NAVSPG_UTCSTANDARD_t>        CFG_NAVSPG_UTCSTANDARD {};               //!< CFG-NAVSPG-UTCSTANDARD (UTC standard to be used)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_DYNMODEL_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NAVSPG_DYNMODEL_t>              CFG_NAVSPG_DYNMODEL {};                  //!< CFG-NAVSPG-DYNMODEL (Dynamic platform model)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_ACKAIDING_ID, UBLOXCFG_TYPE_L>                                              CFG_NAVSPG_ACKAIDING {};                 //!< CFG-NAVSPG-ACKAIDING (Acknowledge assistance input messages)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USE_USRDAT_ID, UBLOXCFG_TYPE_L>                                             CFG_NAVSPG_USE_USRDAT {};                //!< CFG-NAVSPG-USE_USRDAT (Use user geodetic datum parameters)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USRDAT_MAJA_ID, UBLOXCFG_TYPE_R8>                                           CFG_NAVSPG_USRDAT_MAJA {};               //!< CFG-NAVSPG-USRDAT_MAJA (Geodetic datum semi-major axis)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USRDAT_FLAT_ID, UBLOXCFG_TYPE_R8>                                           CFG_NAVSPG_USRDAT_FLAT {};               //!< CFG-NAVSPG-USRDAT_FLAT (Geodetic datum 1.0 / flattening)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USRDAT_DX_ID, UBLOXCFG_TYPE_R4>                                             CFG_NAVSPG_USRDAT_DX {};                 //!< CFG-NAVSPG-USRDAT_DX (Geodetic datum X axis shift at the origin)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USRDAT_DY_ID, UBLOXCFG_TYPE_R4>                                             CFG_NAVSPG_USRDAT_DY {};                 //!< CFG-NAVSPG-USRDAT_DY (Geodetic datum Y axis shift at the origin)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USRDAT_DZ_ID, UBLOXCFG_TYPE_R4>                                             CFG_NAVSPG_USRDAT_DZ {};                 //!< CFG-NAVSPG-USRDAT_DZ (Geodetic datum Z axis shift at the origin)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USRDAT_ROTX_ID, UBLOXCFG_TYPE_R4>                                           CFG_NAVSPG_USRDAT_ROTX {};               //!< CFG-NAVSPG-USRDAT_ROTX (Geodetic datum rotation about the X axis)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USRDAT_ROTY_ID, UBLOXCFG_TYPE_R4>                                           CFG_NAVSPG_USRDAT_ROTY {};               //!< CFG-NAVSPG-USRDAT_ROTY (Geodetic datum rotation about the Y axis ())
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USRDAT_ROTZ_ID, UBLOXCFG_TYPE_R4>                                           CFG_NAVSPG_USRDAT_ROTZ {};               //!< CFG-NAVSPG-USRDAT_ROTZ (Geodetic datum rotation about the Z axis)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_USRDAT_SCALE_ID, UBLOXCFG_TYPE_R4>                                          CFG_NAVSPG_USRDAT_SCALE {};              //!< CFG-NAVSPG-USRDAT_SCALE (Geodetic datum scale factor)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_INFIL_MINSVS_ID, UBLOXCFG_TYPE_U1>                                          CFG_NAVSPG_INFIL_MINSVS {};              //!< CFG-NAVSPG-INFIL_MINSVS (Minimum number of satellites for navigation)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_INFIL_MAXSVS_ID, UBLOXCFG_TYPE_U1>                                          CFG_NAVSPG_INFIL_MAXSVS {};              //!< CFG-NAVSPG-INFIL_MAXSVS (Maximum number of satellites for navigation)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_INFIL_MINCNO_ID, UBLOXCFG_TYPE_U1>                                          CFG_NAVSPG_INFIL_MINCNO {};              //!< CFG-NAVSPG-INFIL_MINCNO (Minimum satellite signal level for navigation)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_INFIL_MINELEV_ID, UBLOXCFG_TYPE_I1>                                         CFG_NAVSPG_INFIL_MINELEV {};             //!< CFG-NAVSPG-INFIL_MINELEV (Minimum elevation for a GNSS satellite to be used in navigation)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_INFIL_NCNOTHRS_ID, UBLOXCFG_TYPE_U1>                                        CFG_NAVSPG_INFIL_NCNOTHRS {};            //!< CFG-NAVSPG-INFIL_NCNOTHRS (Number of satellites required to have C/N0 above CFG-NAVSPG-INFIL_CNOTHRS for a fix to be attempted)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_INFIL_CNOTHRS_ID, UBLOXCFG_TYPE_U1>                                         CFG_NAVSPG_INFIL_CNOTHRS {};             //!< CFG-NAVSPG-INFIL_CNOTHRS (C/N0 threshold for deciding whether to attempt a fix)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_OUTFIL_PDOP_ID, UBLOXCFG_TYPE_U2>                                           CFG_NAVSPG_OUTFIL_PDOP {};               //!< CFG-NAVSPG-OUTFIL_PDOP (Output filter position DOP mask (threshold))
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_OUTFIL_TDOP_ID, UBLOXCFG_TYPE_U2>                                           CFG_NAVSPG_OUTFIL_TDOP {};               //!< CFG-NAVSPG-OUTFIL_TDOP (Output filter time DOP mask (threshold))
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_OUTFIL_PACC_ID, UBLOXCFG_TYPE_U2>                                           CFG_NAVSPG_OUTFIL_PACC {};               //!< CFG-NAVSPG-OUTFIL_PACC (Output filter position accuracy mask (threshold))
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_OUTFIL_TACC_ID, UBLOXCFG_TYPE_U2>                                           CFG_NAVSPG_OUTFIL_TACC {};               //!< CFG-NAVSPG-OUTFIL_TACC (Output filter time accuracy mask (threshold))
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_OUTFIL_FACC_ID, UBLOXCFG_TYPE_U2>                                           CFG_NAVSPG_OUTFIL_FACC {};               //!< CFG-NAVSPG-OUTFIL_FACC (Output filter frequency accuracy mask (threshold))
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_CONSTR_ALT_ID, UBLOXCFG_TYPE_I4>                                            CFG_NAVSPG_CONSTR_ALT {};                //!< CFG-NAVSPG-CONSTR_ALT (Fixed altitude (mean sea level) for 2D fix mode)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_CONSTR_ALTVAR_ID, UBLOXCFG_TYPE_U4>                                         CFG_NAVSPG_CONSTR_ALTVAR {};             //!< CFG-NAVSPG-CONSTR_ALTVAR (Fixed altitude variance for 2D mode)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_CONSTR_DGNSSTO_ID, UBLOXCFG_TYPE_U1>                                        CFG_NAVSPG_CONSTR_DGNSSTO {};            //!< CFG-NAVSPG-CONSTR_DGNSSTO (DGNSS timeout)
+inline constexpr Item<UBLOXCFG_CFG_NAVSPG_SIGATTCOMP_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NAVSPG_SIGATTCOMP_t>          CFG_NAVSPG_SIGATTCOMP {};                //!< CFG-NAVSPG-SIGATTCOMP (Permanently attenuated signal compensation mode)
+
+// CFG-NAV2
+inline constexpr Item<UBLOXCFG_CFG_NAV2_OUT_ENABLED_ID, UBLOXCFG_TYPE_L>                                              CFG_NAV2_OUT_ENABLED {};                 //!< CFG-NAV2-OUT_ENABLED (Enable secondary (UBX-NAV2-*) output)
+inline constexpr Item<UBLOXCFG_CFG_NAV2_SBAS_USE_INTEGRITY_ID, UBLOXCFG_TYPE_L>                                       CFG_NAV2_SBAS_USE_INTEGRITY {};          //!< CFG-NAV2-SBAS_USE_INTEGRITY (Use SBAS integrity information in the secondary output)
+
+// CFG-NMEA
+inline constexpr Item<UBLOXCFG_CFG_NMEA_PROTVER_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NMEA_PROTVER_t>                    CFG_NMEA_PROTVER {};                     //!< CFG-NMEA-PROTVER (NMEA protocol version)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_MAXSVS_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NMEA_MAXSVS_t>                      CFG_NMEA_MAXSVS {};                      //!< CFG-NMEA-MAXSVS (Maximum number of SVs to report per Talker ID)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_COMPAT_ID, UBLOXCFG_TYPE_L>                                                   CFG_NMEA_COMPAT {};                      //!< CFG-NMEA-COMPAT (Enable compatibility mode)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_CONSIDER_ID, UBLOXCFG_TYPE_L>                                                 CFG_NMEA_CONSIDER {};                    //!< CFG-NMEA-CONSIDER (Enable considering mode)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_LIMIT82_ID, UBLOXCFG_TYPE_L>                                                  CFG_NMEA_LIMIT82 {};                     //!< CFG-NMEA-LIMIT82 (Enable strict limit to 82 characters maximum NMEA message length)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_HIGHPREC_ID, UBLOXCFG_TYPE_L>                                                 CFG_NMEA_HIGHPREC {};                    //!< CFG-NMEA-HIGHPREC (Enable high precision mode)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_SVNUMBERING_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NMEA_SVNUMBERING_t>            CFG_NMEA_SVNUMBERING {};                 //!< CFG-NMEA-SVNUMBERING (Display configuration for SVs that do not have value defined in NMEA)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_FILT_GPS_ID, UBLOXCFG_TYPE_L>                                                 CFG_NMEA_FILT_GPS {};                    //!< CFG-NMEA-FILT_GPS (Disable reporting of GPS satellites)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_FILT_SBAS_ID, UBLOXCFG_TYPE_L>                                                CFG_NMEA_FILT_SBAS {};                   //!< CFG-NMEA-FILT_SBAS (Disable reporting of SBAS satellites)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_FILT_GAL_ID, UBLOXCFG_TYPE_L>                                                 CFG_NMEA_FILT_GAL {};                    //!< CFG-NMEA-FILT_GAL (Disable reporting of Galileo satellites)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_FILT_QZSS_ID, UBLOXCFG_TYPE_L>                                                CFG_NMEA_FILT_QZSS {};                   //!< CFG-NMEA-FILT_QZSS (Disable reporting of QZSS satellites)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_FILT_GLO_ID, UBLOXCFG_TYPE_L>                                                 CFG_NMEA_FILT_GLO {};                    //!< CFG-NMEA-FILT_GLO (Disable reporting of GLONASS satellites)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_FILT_BDS_ID, UBLOXCFG_TYPE_L>                                                 CFG_NMEA_FILT_BDS {};                    //!< CFG-NMEA-FILT_BDS (Disable reporting of BeiDou satellites)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_OUT_INVFIX_ID, UBLOXCFG_TYPE_L>                                               CFG_NMEA_OUT_INVFIX {};                  //!< CFG-NMEA-OUT_INVFIX (Enable position output for failed or invalid fixes)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_OUT_MSKFIX_ID, UBLOXCFG_TYPE_L>                                               CFG_NMEA_OUT_MSKFIX {};                  //!< CFG-NMEA-OUT_MSKFIX (Enable position output for invalid fixes)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_OUT_INVTIME_ID, UBLOXCFG_TYPE_L>                                              CFG_NMEA_OUT_INVTIME {};                 //!< CFG-NMEA-OUT_INVTIME (Enable time output for invalid times)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_OUT_INVDATE_ID, UBLOXCFG_TYPE_L>                                              CFG_NMEA_OUT_INVDATE {};                 //!< CFG-NMEA-OUT_INVDATE (Enable date output for invalid dates)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_OUT_ONLYGPS_ID, UBLOXCFG_TYPE_L>                                              CFG_NMEA_OUT_ONLYGPS {};                 //!< CFG-NMEA-OUT_ONLYGPS (Restrict output to GPS satellites only)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_OUT_FROZENCOG_ID, UBLOXCFG_TYPE_L>                                            CFG_NMEA_OUT_FROZENCOG {};               //!< CFG-NMEA-OUT_FROZENCOG (Enable course over ground output even if it is frozen)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_MAINTALKERID_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NMEA_MAINTALKERID_t>          CFG_NMEA_MAINTALKERID {};                //!< CFG-NMEA-MAINTALKERID (Main Talker ID)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_GSVTALKERID_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_NMEA_GSVTALKERID_t>            CFG_NMEA_GSVTALKERID {};                 //!< CFG-NMEA-GSVTALKERID (Talker ID for GSV NMEA messages)
+inline constexpr Item<UBLOXCFG_CFG_NMEA_BDSTALKERID_ID, UBLOXCFG_TYPE_U2>                                             CFG_NMEA_BDSTALKERID {};                 //!< CFG-NMEA-BDSTALKERID (BeiDou Talker ID)
+
+// CFG-ODO
+inline constexpr Item<UBLOXCFG_CFG_ODO_USE_ODO_ID, UBLOXCFG_TYPE_L>                                                   CFG_ODO_USE_ODO {};                      //!< CFG-ODO-USE_ODO (Use odometer)
+inline constexpr Item<UBLOXCFG_CFG_ODO_USE_COG_ID, UBLOXCFG_TYPE_L>                                                   CFG_ODO_USE_COG {};                      //!< CFG-ODO-USE_COG (Use low-speed course over ground filter)
+inline constexpr Item<UBLOXCFG_CFG_ODO_OUTLPVEL_ID, UBLOXCFG_TYPE_L>                                                  CFG_ODO_OUTLPVEL {};                     //!< CFG-ODO-OUTLPVEL (Output low-pass filtered velocity)
+inline constexpr Item<UBLOXCFG_CFG_ODO_OUTLPCOG_ID, UBLOXCFG_TYPE_L>                                                  CFG_ODO_OUTLPCOG {};                     //!< CFG-ODO-OUTLPCOG (Output low-pass filtered course over ground (heading))
+inline constexpr Item<UBLOXCFG_CFG_ODO_PROFILE_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_ODO_PROFILE_t>                      CFG_ODO_PROFILE {};                      //!< CFG-ODO-PROFILE (Odometer profile configuration)
+inline constexpr Item<UBLOXCFG_CFG_ODO_COGMAXSPEED_ID, UBLOXCFG_TYPE_U1>                                              CFG_ODO_COGMAXSPEED {};                  //!< CFG-ODO-COGMAXSPEED (Upper speed limit for low-speed course over ground filter)
+inline constexpr Item<UBLOXCFG_CFG_ODO_COGMAXPOSACC_ID, UBLOXCFG_TYPE_U1>                                             CFG_ODO_COGMAXPOSACC {};                 //!< CFG-ODO-COGMAXPOSACC (Maximum acceptable position accuracy for computing low-speed filtered course over ground)
+inline constexpr Item<UBLOXCFG_CFG_ODO_VELLPGAIN_ID, UBLOXCFG_TYPE_U1>                                                CFG_ODO_VELLPGAIN {};                    //!< CFG-ODO-VELLPGAIN (Velocity low-pass filter level)
+inline constexpr Item<UBLOXCFG_CFG_ODO_COGLPGAIN_ID, UBLOXCFG_TYPE_U1>                                                CFG_ODO_COGLPGAIN {};                    //!< CFG-ODO-COGLPGAIN (Course over ground low-pass filter level (at speed < 8 m/s))
+
+// CFG-PM
+inline constexpr Item<UBLOXCFG_CFG_PM_OPERATEMODE_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_PM_OPERATEMODE_t>                CFG_PM_OPERATEMODE {};                   //!< CFG-PM-OPERATEMODE (General receiver power management mode of operation)
+inline constexpr Item<UBLOXCFG_CFG_PM_POSUPDATEPERIOD_ID, UBLOXCFG_TYPE_U4>                                           CFG_PM_POSUPDATEPERIOD {};               //!< CFG-PM-POSUPDATEPERIOD (Position update period for PSMOO, 0 = no retry, >5)
+inline constexpr Item<UBLOXCFG_CFG_PM_ACQPERIOD_ID, UBLOXCFG_TYPE_U4>                                                 CFG_PM_ACQPERIOD {};                     //!< CFG-PM-ACQPERIOD (Acquisition period used if the receiver previously failed to achieve a position fix)
+inline constexpr Item<UBLOXCFG_CFG_PM_GRIDOFFSET_ID, UBLOXCFG_TYPE_U4>                                                CFG_PM_GRIDOFFSET {};                    //!< CFG-PM-GRIDOFFSET (Position update period grid offset relative to GPS start of week)
+inline constexpr Item<UBLOXCFG_CFG_PM_ONTIME_ID, UBLOXCFG_TYPE_U2>                                                    CFG_PM_ONTIME {};                        //!< CFG-PM-ONTIME (Time to stay in tracking state)
+inline constexpr Item<UBLOXCFG_CFG_PM_MINACQTIME_ID, UBLOXCFG_TYPE_U1>                                                CFG_PM_MINACQTIME {};                    //!< CFG-PM-MINACQTIME (Minimum time to spend in acquisition state)
+inline constexpr Item<UBLOXCFG_CFG_PM_MAXACQTIME_ID, UBLOXCFG_TYPE_U1>                                                CFG_PM_MAXACQTIME {};                    //!< CFG-PM-MAXACQTIME (Maximum time to spend in acquisition state)
+inline constexpr Item<UBLOXCFG_CFG_PM_DONOTENTEROFF_ID, UBLOXCFG_TYPE_L>                                              CFG_PM_DONOTENTEROFF {};                 //!< CFG-PM-DONOTENTEROFF (Disable to make the receiver enter (inactive) awaiting next search state, enable to make the receiver not enter (inactive))
+inline constexpr Item<UBLOXCFG_CFG_PM_WAITTIMEFIX_ID, UBLOXCFG_TYPE_L>                                                CFG_PM_WAITTIMEFIX {};                   //!< CFG-PM-WAITTIMEFIX (Wait for time fix)
+inline constexpr Item<UBLOXCFG_CFG_PM_UPDATEEPH_ID, UBLOXCFG_TYPE_L>                                                  CFG_PM_UPDATEEPH {};                     //!< CFG-PM-UPDATEEPH (Update ephemeris regularly)
+inline constexpr Item<UBLOXCFG_CFG_PM_EXTINTSEL_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_PM_EXTINTSEL_t>                    CFG_PM_EXTINTSEL {};                     //!< CFG-PM-EXTINTSEL (EXTINT pin select)
+inline constexpr Item<UBLOXCFG_CFG_PM_EXTINTWAKE_ID, UBLOXCFG_TYPE_L>                                                 CFG_PM_EXTINTWAKE {};                    //!< CFG-PM-EXTINTWAKE (Enable to keep receiver awake as long as selected EXTINT pin is high)
+inline constexpr Item<UBLOXCFG_CFG_PM_EXTINTBACKUP_ID, UBLOXCFG_TYPE_L>                                               CFG_PM_EXTINTBACKUP {};                  //!< CFG-PM-EXTINTBACKUP (EXTINT pin control (Backup))
+inline constexpr Item<UBLOXCFG_CFG_PM_EXTINTINACTIVE_ID, UBLOXCFG_TYPE_L>                                             CFG_PM_EXTINTINACTIVE {};                //!< CFG-PM-EXTINTINACTIVE (EXTINT pin control (Inactive))
+inline constexpr Item<UBLOXCFG_CFG_PM_EXTINTINACTIVITY_ID, UBLOXCFG_TYPE_U4>                                          CFG_PM_EXTINTINACTIVITY {};              //!< CFG-PM-EXTINTINACTIVITY (Inactivity time out on EXTINT pin if enabled)
+inline constexpr Item<UBLOXCFG_CFG_PM_LIMITPEAKCURR_ID, UBLOXCFG_TYPE_L>                                              CFG_PM_LIMITPEAKCURR {};                 //!< CFG-PM-LIMITPEAKCURR (Limit peak current)
+
+// CFG-QZSS
+inline constexpr Item<UBLOXCFG_CFG_QZSS_USE_SLAS_DGNSS_ID, UBLOXCFG_TYPE_L>                                           CFG_QZSS_USE_SLAS_DGNSS {};              //!< CFG-QZSS-USE_SLAS_DGNSS (Apply QZSS SLAS DGNSS corrections)
+inline constexpr Item<UBLOXCFG_CFG_QZSS_USE_SLAS_TESTMODE_ID, UBLOXCFG_TYPE_L>                                        CFG_QZSS_USE_SLAS_TESTMODE {};           //!< CFG-QZSS-USE_SLAS_TESTMODE (Use QZSS SLAS data when it is in test mode (SLAS msg 0))
+inline constexpr Item<UBLOXCFG_CFG_QZSS_USE_SLAS_RAIM_UNCORR_ID, UBLOXCFG_TYPE_L>                                     CFG_QZSS_USE_SLAS_RAIM_UNCORR {};        //!< CFG-QZSS-USE_SLAS_RAIM_UNCORR (Raim out measurements that are not corrected by QZSS SLAS, if at least 5 measurements are corrected)
+
+// CFG-RATE
+inline constexpr Item<UBLOXCFG_CFG_RATE_MEAS_ID, UBLOXCFG_TYPE_U2>                                                    CFG_RATE_MEAS {};                        //!< CFG-RATE-MEAS (Nominal time between GNSS measurements)
+inline constexpr Item<UBLOXCFG_CFG_RATE_NAV_ID, UBLOXCFG_TYPE_U2>                                                     CFG_RATE_NAV {};                         //!< CFG-RATE-NAV (Ratio of number of measurements to number of navigation solutions)
+inline constexpr Item<UBLOXCFG_CFG_RATE_TIMEREF_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_RATE_TIMEREF_t>                    CFG_RATE_TIMEREF {};                     //!< CFG-RATE-TIMEREF (Time system to which measurements are aligned)
+
+// CFG-RINV
+inline constexpr Item<UBLOXCFG_CFG_RINV_DUMP_ID, UBLOXCFG_TYPE_L>                                                     CFG_RINV_DUMP {};                        //!< CFG-RINV-DUMP (Dump data at startup)
+inline constexpr Item<UBLOXCFG_CFG_RINV_BINARY_ID, UBLOXCFG_TYPE_L>                                                   CFG_RINV_BINARY {};                      //!< CFG-RINV-BINARY (Data is binary)
+inline constexpr Item<UBLOXCFG_CFG_RINV_DATA_SIZE_ID, UBLOXCFG_TYPE_U1>                                               CFG_RINV_DATA_SIZE {};                   //!< CFG-RINV-DATA_SIZE (Size of data)
+inline constexpr Item<UBLOXCFG_CFG_RINV_CHUNK0_ID, UBLOXCFG_TYPE_X8>                                                  CFG_RINV_CHUNK0 {};                      //!< CFG-RINV-CHUNK0 (Data bytes 1-8 (LSB))
+inline constexpr Item<UBLOXCFG_CFG_RINV_CHUNK1_ID, UBLOXCFG_TYPE_X8>                                                  CFG_RINV_CHUNK1 {};                      //!< CFG-RINV-CHUNK1 (Data bytes 9-16)
+inline constexpr Item<UBLOXCFG_CFG_RINV_CHUNK2_ID, UBLOXCFG_TYPE_X8>                                                  CFG_RINV_CHUNK2 {};                      //!< CFG-RINV-CHUNK2 (Data bytes 17-24)
+inline constexpr Item<UBLOXCFG_CFG_RINV_CHUNK3_ID, UBLOXCFG_TYPE_X8>                                                  CFG_RINV_CHUNK3 {};                      //!< CFG-RINV-CHUNK3 (Data bytes 25-30 (MSB))
+
+// CFG-RTCM
+inline constexpr Item<UBLOXCFG_CFG_RTCM_DF003_OUT_ID, UBLOXCFG_TYPE_U2>                                               CFG_RTCM_DF003_OUT {};                   //!< CFG-RTCM-DF003_OUT (RTCM DF003 (Reference station ID) output value (0...4095))
+inline constexpr Item<UBLOXCFG_CFG_RTCM_DF003_IN_ID, UBLOXCFG_TYPE_U2>                                                CFG_RTCM_DF003_IN {};                    //!< CFG-RTCM-DF003_IN (RTCM DF003 (Reference station ID) input value (0...4095))
+inline constexpr Item<UBLOXCFG_CFG_RTCM_DF003_IN_FILTER_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_RTCM_DF003_IN_FILTER_t>    CFG_RTCM_DF003_IN_FILTER {};             //!< CFG-RTCM-DF003_IN_FILTER (RTCM input filter configuration based on RTCM DF003 (Reference station ID) value)
+
+// CFG-SBAS
+inline constexpr Item<UBLOXCFG_CFG_SBAS_USE_TESTMODE_ID, UBLOXCFG_TYPE_L>                                             CFG_SBAS_USE_TESTMODE {};                //!< CFG-SBAS-USE_TESTMODE (Use SBAS data when it is in test mode (SBAS msg 0))
+inline constexpr Item<UBLOXCFG_CFG_SBAS_USE_RANGING_ID, UBLOXCFG_TYPE_L>                                              CFG_SBAS_USE_RANGING {};                 //!< CFG-SBAS-USE_RANGING (Use SBAS GEOs as a ranging source (for navigation))
+inline constexpr Item<UBLOXCFG_CFG_SBAS_USE_DIFFCORR_ID, UBLOXCFG_TYPE_L>                                             CFG_SBAS_USE_DIFFCORR {};                //!< CFG-SBAS-USE_DIFFCORR (Use SBAS differential corrections)
+inline constexpr Item<UBLOXCFG_CFG_SBAS_USE_INTEGRITY_ID, UBLOXCFG_TYPE_L>                                            CFG_SBAS_USE_INTEGRITY {};               //!< CFG-SBAS-USE_INTEGRITY (Use SBAS integrity information)
+inline constexpr Item<UBLOXCFG_CFG_SBAS_PRNSCANMASK_ID, UBLOXCFG_TYPE_X8>                                             CFG_SBAS_PRNSCANMASK {};                 //!< CFG-SBAS-PRNSCANMASK (SBAS PRN search configuration)
+
+// CFG-SEC
+inline constexpr Item<UBLOXCFG_CFG_SEC_CFG_LOCK_ID, UBLOXCFG_TYPE_L>                                                  CFG_SEC_CFG_LOCK {};                     //!< CFG-SEC-CFG_LOCK (Configuration lockdown)
+inline constexpr Item<UBLOXCFG_CFG_SEC_CFG_LOCK_UNLOCKGRP1_ID, UBLOXCFG_TYPE_U2>                                      CFG_SEC_CFG_LOCK_UNLOCKGRP1 {};          //!< CFG-SEC-CFG_LOCK_UNLOCKGRP1 (Configuration lockdown exempted group 1)
+inline constexpr Item<UBLOXCFG_CFG_SEC_CFG_LOCK_UNLOCKGRP2_ID, UBLOXCFG_TYPE_U2>                                      CFG_SEC_CFG_LOCK_UNLOCKGRP2 {};          //!< CFG-SEC-CFG_LOCK_UNLOCKGRP2 (Configuration lockdown exempted group 1)
+
+// CFG-SFCORE
+inline constexpr Item<UBLOXCFG_CFG_SFCORE_USE_SF_ID, UBLOXCFG_TYPE_L>                                                 CFG_SFCORE_USE_SF {};                    //!< CFG-SFCORE-USE_SF (Use ADR/UDR sensor fusion)
+
+// CFG-SFIMU
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_GYRO_TC_UPDATE_PERIOD_ID, UBLOXCFG_TYPE_U2>                                  CFG_SFIMU_GYRO_TC_UPDATE_PERIOD {};      //!< CFG-SFIMU-GYRO_TC_UPDATE_PERIOD (Time period between each update for the saved temperature-dependent gyroscope bias table)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_GYRO_RMSTHDL_ID, UBLOXCFG_TYPE_U1>                                           CFG_SFIMU_GYRO_RMSTHDL {};               //!< CFG-SFIMU-GYRO_RMSTHDL (Gyroscope sensor RMS threshold)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_GYRO_FREQUENCY_ID, UBLOXCFG_TYPE_U1>                                         CFG_SFIMU_GYRO_FREQUENCY {};             //!< CFG-SFIMU-GYRO_FREQUENCY (Nominal gyroscope sensor data sampling frequency)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_GYRO_LATENCY_ID, UBLOXCFG_TYPE_U2>                                           CFG_SFIMU_GYRO_LATENCY {};               //!< CFG-SFIMU-GYRO_LATENCY (Gyroscope sensor data latency due to e.g. CAN bus)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_GYRO_ACCURACY_ID, UBLOXCFG_TYPE_U2>                                          CFG_SFIMU_GYRO_ACCURACY {};              //!< CFG-SFIMU-GYRO_ACCURACY (Gyroscope sensor data accuracy)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_ACCEL_RMSTHDL_ID, UBLOXCFG_TYPE_U1>                                          CFG_SFIMU_ACCEL_RMSTHDL {};              //!< CFG-SFIMU-ACCEL_RMSTHDL (Accelerometer RMS threshold)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_ACCEL_FREQUENCY_ID, UBLOXCFG_TYPE_U1>                                        CFG_SFIMU_ACCEL_FREQUENCY {};            //!< CFG-SFIMU-ACCEL_FREQUENCY (Nominal accelerometer sensor data sampling)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_ACCEL_LATENCY_ID, UBLOXCFG_TYPE_U2>                                          CFG_SFIMU_ACCEL_LATENCY {};              //!< CFG-SFIMU-ACCEL_LATENCY (Accelerometer sensor data latency due to e.g. CAN bus)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_ACCEL_ACCURACY_ID, UBLOXCFG_TYPE_U2>                                         CFG_SFIMU_ACCEL_ACCURACY {};             //!< CFG-SFIMU-ACCEL_ACCURACY (Accelerometer sensor data accuracy)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_IMU_I2C_SCL_PIO_ID, UBLOXCFG_TYPE_U1>                                        CFG_SFIMU_IMU_I2C_SCL_PIO {};            //!< CFG-SFIMU-IMU_I2C_SCL_PIO (PIO of the IMU I2C)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_IMU_I2C_SDA_PIO_ID, UBLOXCFG_TYPE_U1>                                        CFG_SFIMU_IMU_I2C_SDA_PIO {};            //!< CFG-SFIMU-IMU_I2C_SDA_PIO (SDA PIO of the IMU I2C)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_AUTO_MNTALG_ENA_ID, UBLOXCFG_TYPE_L>                                         CFG_SFIMU_AUTO_MNTALG_ENA {};            //!< CFG-SFIMU-AUTO_MNTALG_ENA (Enable automatic IMU-mount alignment)
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_IMU_MNTALG_YAW_ID, UBLOXCFG_TYPE_U4>                                         CFG_SFIMU_IMU_MNTALG_YAW {};             //!< CFG-SFIMU-IMU_MNTALG_YAW (User-defined IMU-mount yaw angle (0..360))
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_IMU_MNTALG_PITCH_ID, UBLOXCFG_TYPE_I2>                                       CFG_SFIMU_IMU_MNTALG_PITCH {};           //!< CFG-SFIMU-IMU_MNTALG_PITCH (User-defined IMU-mount pitch angle (-90..90))
+inline constexpr Item<UBLOXCFG_CFG_SFIMU_IMU_MNTALG_ROLL_ID, UBLOXCFG_TYPE_I2>                                        CFG_SFIMU_IMU_MNTALG_ROLL {};            //!< CFG-SFIMU-IMU_MNTALG_ROLL (User-defined IMU-mount roll angle (-180..180))
+
+// CFG-SFODO
+inline constexpr Item<UBLOXCFG_CFG_SFODO_COMBINE_TICKS_ID, UBLOXCFG_TYPE_L>                                           CFG_SFODO_COMBINE_TICKS {};              //!< CFG-SFODO-COMBINE_TICKS (Use combined rear wheel ticks instead of the single tick)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_USE_SPEED_ID, UBLOXCFG_TYPE_L>                                               CFG_SFODO_USE_SPEED {};                  //!< CFG-SFODO-USE_SPEED (Use speed measurements (UBX-ESF-MEAS data type 11 instead of 10))
+inline constexpr Item<UBLOXCFG_CFG_SFODO_DIS_AUTOCOUNTMAX_ID, UBLOXCFG_TYPE_L>                                        CFG_SFODO_DIS_AUTOCOUNTMAX {};           //!< CFG-SFODO-DIS_AUTOCOUNTMAX (Disable automatic estimation of maximum absolute wheel tick counter)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_DIS_AUTODIRPINPOL_ID, UBLOXCFG_TYPE_L>                                       CFG_SFODO_DIS_AUTODIRPINPOL {};          //!< CFG-SFODO-DIS_AUTODIRPINPOL (Disable automatic wheel tick direction pin polarity detection)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_DIS_AUTOSPEED_ID, UBLOXCFG_TYPE_L>                                           CFG_SFODO_DIS_AUTOSPEED {};              //!< CFG-SFODO-DIS_AUTOSPEED (Disable automatic receiver reconfiguration for processing speed data instead of wheel tick data)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_FACTOR_ID, UBLOXCFG_TYPE_U4>                                                 CFG_SFODO_FACTOR {};                     //!< CFG-SFODO-FACTOR (Wheel tick scale factor to obtain distance [m] from wheel ticks.)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_QUANT_ERROR_ID, UBLOXCFG_TYPE_U4>                                            CFG_SFODO_QUANT_ERROR {};                //!< CFG-SFODO-QUANT_ERROR (Wheel tick quantization)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_COUNT_MAX_ID, UBLOXCFG_TYPE_U4>                                              CFG_SFODO_COUNT_MAX {};                  //!< CFG-SFODO-COUNT_MAX (Wheel tick counter maximum value (0 = relative, 1 = automatic))
+inline constexpr Item<UBLOXCFG_CFG_SFODO_LATENCY_ID, UBLOXCFG_TYPE_U2>                                                CFG_SFODO_LATENCY {};                    //!< CFG-SFODO-LATENCY (Wheel tick data latency due to e.g. CAN bus)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_FREQUENCY_ID, UBLOXCFG_TYPE_U1>                                              CFG_SFODO_FREQUENCY {};                  //!< CFG-SFODO-FREQUENCY (Nominal wheel tick data frequency (0 = not set))
+inline constexpr Item<UBLOXCFG_CFG_SFODO_CNT_BOTH_EDGES_ID, UBLOXCFG_TYPE_L>                                          CFG_SFODO_CNT_BOTH_EDGES {};             //!< CFG-SFODO-CNT_BOTH_EDGES (Count both rising and falling edges on wheel tick signal)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_SPEED_BAND_ID, UBLOXCFG_TYPE_U2>                                             CFG_SFODO_SPEED_BAND {};                 //!< CFG-SFODO-SPEED_BAND (Speed sensor dead badn (0 = not set))
+inline constexpr Item<UBLOXCFG_CFG_SFODO_USE_WT_PIN_ID, UBLOXCFG_TYPE_L>                                              CFG_SFODO_USE_WT_PIN {};                 //!< CFG-SFODO-USE_WT_PIN (Wheel tick signal enabled)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_DIR_PINPOL_ID, UBLOXCFG_TYPE_L>                                              CFG_SFODO_DIR_PINPOL {};                 //!< CFG-SFODO-DIR_PINPOL (Wheel tick direction pin polarity)
+inline constexpr Item<UBLOXCFG_CFG_SFODO_DIS_AUTOSW_ID, UBLOXCFG_TYPE_L>                                              CFG_SFODO_DIS_AUTOSW {};                 //!< CFG-SFODO-DIS_AUTOSW (Disable automatic use of wheel tick or speed data received over the software interface)
+
+// CFG-SIGNAL
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_GPS_ENA_ID, UBLOXCFG_TYPE_L>                                                CFG_SIGNAL_GPS_ENA {};                   //!< CFG-SIGNAL-GPS_ENA (GPS enable)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_GPS_L1CA_ENA_ID, UBLOXCFG_TYPE_L>                                           CFG_SIGNAL_GPS_L1CA_ENA {};              //!< CFG-SIGNAL-GPS_L1CA_ENA (GPS L1C/A)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_GPS_L2C_ENA_ID, UBLOXCFG_TYPE_L>                                            CFG_SIGNAL_GPS_L2C_ENA {};               //!< CFG-SIGNAL-GPS_L2C_ENA (GPS L2C (only on u-blox F9 platform products))
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_SBAS_ENA_ID, UBLOXCFG_TYPE_L>                                               CFG_SIGNAL_SBAS_ENA {};                  //!< CFG-SIGNAL-SBAS_ENA (SBAS enable)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_SBAS_L1CA_ENA_ID, UBLOXCFG_TYPE_L>                                          CFG_SIGNAL_SBAS_L1CA_ENA {};             //!< CFG-SIGNAL-SBAS_L1CA_ENA (SBAS L1C/A)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_GAL_ENA_ID, UBLOXCFG_TYPE_L>                                                CFG_SIGNAL_GAL_ENA {};                   //!< CFG-SIGNAL-GAL_ENA (Galileo enable)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_GAL_E1_ENA_ID, UBLOXCFG_TYPE_L>                                             CFG_SIGNAL_GAL_E1_ENA {};                //!< CFG-SIGNAL-GAL_E1_ENA (Galileo E1)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_GAL_E5B_ENA_ID, UBLOXCFG_TYPE_L>                                            CFG_SIGNAL_GAL_E5B_ENA {};               //!< CFG-SIGNAL-GAL_E5B_ENA (Galileo E5b (only on u-blox F9 platform products))
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_BDS_ENA_ID, UBLOXCFG_TYPE_L>                                                CFG_SIGNAL_BDS_ENA {};                   //!< CFG-SIGNAL-BDS_ENA (BeiDou Enable)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_BDS_B1_ENA_ID, UBLOXCFG_TYPE_L>                                             CFG_SIGNAL_BDS_B1_ENA {};                //!< CFG-SIGNAL-BDS_B1_ENA (BeiDou B1I)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_BDS_B2_ENA_ID, UBLOXCFG_TYPE_L>                                             CFG_SIGNAL_BDS_B2_ENA {};                //!< CFG-SIGNAL-BDS_B2_ENA (BeiDou B2I (only on u-blox F9 platform products))
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_QZSS_ENA_ID, UBLOXCFG_TYPE_L>                                               CFG_SIGNAL_QZSS_ENA {};                  //!< CFG-SIGNAL-QZSS_ENA (QZSS enable)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_QZSS_L1CA_ENA_ID, UBLOXCFG_TYPE_L>                                          CFG_SIGNAL_QZSS_L1CA_ENA {};             //!< CFG-SIGNAL-QZSS_L1CA_ENA (QZSS L1C/A)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_QZSS_L1S_ENA_ID, UBLOXCFG_TYPE_L>                                           CFG_SIGNAL_QZSS_L1S_ENA {};              //!< CFG-SIGNAL-QZSS_L1S_ENA (QZSS L1S)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_QZSS_L2C_ENA_ID, UBLOXCFG_TYPE_L>                                           CFG_SIGNAL_QZSS_L2C_ENA {};              //!< CFG-SIGNAL-QZSS_L2C_ENA (QZSS L2C (only on u-blox F9 platform products))
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_GLO_ENA_ID, UBLOXCFG_TYPE_L>                                                CFG_SIGNAL_GLO_ENA {};                   //!< CFG-SIGNAL-GLO_ENA (GLONASS enable)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_GLO_L1_ENA_ID, UBLOXCFG_TYPE_L>                                             CFG_SIGNAL_GLO_L1_ENA {};                //!< CFG-SIGNAL-GLO_L1_ENA (GLONASS L1)
+inline constexpr Item<UBLOXCFG_CFG_SIGNAL_GLO_L2_ENA_ID, UBLOXCFG_TYPE_L>                                             CFG_SIGNAL_GLO_L2_ENA {};                //!< CFG-SIGNAL-GLO_L2_ENA (GLONASS L2 (only on u-blox F9 platform products))
+
+// CFG-SPARTN
+inline constexpr Item<UBLOXCFG_CFG_SPARTN_USE_SOURCE_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_SPARTN_USE_SOURCE_t>          CFG_SPARTN_USE_SOURCE {};                //!< CFG-SPARTN-USE_SOURCE (Selector for source SPARTN stream)
+
+// CFG-SPI
+inline constexpr Item<UBLOXCFG_CFG_SPI_MAXFF_ID, UBLOXCFG_TYPE_U1>                                                    CFG_SPI_MAXFF {};                        //!< CFG-SPI-MAXFF (Number of bytes containing 0xFF to receive before switching off reception. Range: 0 (mechanism off) - 63)
+inline constexpr Item<UBLOXCFG_CFG_SPI_CPOLARITY_ID, UBLOXCFG_TYPE_L>                                                 CFG_SPI_CPOLARITY {};                    //!< CFG-SPI-CPOLARITY (Clock polarity select: 0: Active Hight Clock, SCLK idles low, 1: Active Low Clock, SCLK idles high)
+inline constexpr Item<UBLOXCFG_CFG_SPI_CPHASE_ID, UBLOXCFG_TYPE_L>                                                    CFG_SPI_CPHASE {};                       //!< CFG-SPI-CPHASE (Clock phase select: 0: Data captured on first edge of SCLK, 1: Data captured on second edge of SCLK)
+inline constexpr Item<UBLOXCFG_CFG_SPI_EXTENDEDTIMEOUT_ID, UBLOXCFG_TYPE_L>                                           CFG_SPI_EXTENDEDTIMEOUT {};              //!< CFG-SPI-EXTENDEDTIMEOUT (Flag to disable timeouting the interface after 1.5s)
+inline constexpr Item<UBLOXCFG_CFG_SPI_ENABLED_ID, UBLOXCFG_TYPE_L>                                                   CFG_SPI_ENABLED {};                      //!< CFG-SPI-ENABLED (Flag to indicate if the SPI interface should be enabled)
+
+// CFG-SPIINPROT
+inline constexpr Item<UBLOXCFG_CFG_SPIINPROT_UBX_ID, UBLOXCFG_TYPE_L>                                                 CFG_SPIINPROT_UBX {};                    //!< CFG-SPIINPROT-UBX (Flag to indicate if UBX should be an input protocol on SPI)
+inline constexpr Item<UBLOXCFG_CFG_SPIINPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                                CFG_SPIINPROT_NMEA {};                   //!< CFG-SPIINPROT-NMEA (Flag to indicate if NMEA should be an input protocol on SPI)
+inline constexpr Item<UBLOXCFG_CFG_SPIINPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                              CFG_SPIINPROT_RTCM3X {};                 //!< CFG-SPIINPROT-RTCM3X (Flag to indicate if RTCM3X should be an input protocol on SPI)
+inline constexpr Item<UBLOXCFG_CFG_SPIINPROT_SPARTN_ID, UBLOXCFG_TYPE_L>                                              CFG_SPIINPROT_SPARTN {};                 //!< CFG-SPIINPROT-SPARTN (Flag to indicate if SPARTN should be an input protocol on SPI)
+
+// CFG-SPIOUTPROT
+inline constexpr Item<UBLOXCFG_CFG_SPIOUTPROT_UBX_ID, UBLOXCFG_TYPE_L>                                                CFG_SPIOUTPROT_UBX {};                   //!< CFG-SPIOUTPROT-UBX (Flag to indicate if UBX should be an output protocol on SPI)
+inline constexpr Item<UBLOXCFG_CFG_SPIOUTPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                               CFG_SPIOUTPROT_NMEA {};                  //!< CFG-SPIOUTPROT-NMEA (Flag to indicate if NMEA should be an output protocol on SPI)
+inline constexpr Item<UBLOXCFG_CFG_SPIOUTPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                             CFG_SPIOUTPROT_RTCM3X {};                //!< CFG-SPIOUTPROT-RTCM3X (Flag to indicate if RTCM3X should be an output protocol on SPI)
+
+// CFG-TMODE
+inline constexpr Item<UBLOXCFG_CFG_TMODE_MODE_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_TMODE_MODE_t>                        CFG_TMODE_MODE {};                       //!< CFG-TMODE-MODE (Receiver mode)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_POS_TYPE_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_TMODE_POS_TYPE_t>                CFG_TMODE_POS_TYPE {};                   //!< CFG-TMODE-POS_TYPE (Determines whether the ARP position is given in ECEF or LAT/LON/HEIGHT?)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_ECEF_X_ID, UBLOXCFG_TYPE_I4>                                                 CFG_TMODE_ECEF_X {};                     //!< CFG-TMODE-ECEF_X (ECEF X coordinate of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_ECEF_Y_ID, UBLOXCFG_TYPE_I4>                                                 CFG_TMODE_ECEF_Y {};                     //!< CFG-TMODE-ECEF_Y (ECEF Y coordinate of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_ECEF_Z_ID, UBLOXCFG_TYPE_I4>                                                 CFG_TMODE_ECEF_Z {};                     //!< CFG-TMODE-ECEF_Z (ECEF Z coordinate of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_ECEF_X_HP_ID, UBLOXCFG_TYPE_I1>                                              CFG_TMODE_ECEF_X_HP {};                  //!< CFG-TMODE-ECEF_X_HP (High-precision ECEF X coordinate of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_ECEF_Y_HP_ID, UBLOXCFG_TYPE_I1>                                              CFG_TMODE_ECEF_Y_HP {};                  //!< CFG-TMODE-ECEF_Y_HP (High-precision ECEF Y coordinate of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_ECEF_Z_HP_ID, UBLOXCFG_TYPE_I1>                                              CFG_TMODE_ECEF_Z_HP {};                  //!< CFG-TMODE-ECEF_Z_HP (High-precision ECEF Z coordinate of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_LAT_ID, UBLOXCFG_TYPE_I4>                                                    CFG_TMODE_LAT {};                        //!< CFG-TMODE-LAT (Latitude of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_LON_ID, UBLOXCFG_TYPE_I4>                                                    CFG_TMODE_LON {};                        //!< CFG-TMODE-LON (Longitude of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_HEIGHT_ID, UBLOXCFG_TYPE_I4>                                                 CFG_TMODE_HEIGHT {};                     //!< CFG-TMODE-HEIGHT (Height of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_LAT_HP_ID, UBLOXCFG_TYPE_I1>                                                 CFG_TMODE_LAT_HP {};                     //!< CFG-TMODE-LAT_HP (High-precision latitude of the ARP position)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_LON_HP_ID, UBLOXCFG_TYPE_I1>                                                 CFG_TMODE_LON_HP {};                     //!< CFG-TMODE-LON_HP (High-precision longitude of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_HEIGHT_HP_ID, UBLOXCFG_TYPE_I1>                                              CFG_TMODE_HEIGHT_HP {};                  //!< CFG-TMODE-HEIGHT_HP (High-precision height of the ARP position.)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_FIXED_POS_ACC_ID, UBLOXCFG_TYPE_U4>                                          CFG_TMODE_FIXED_POS_ACC {};              //!< CFG-TMODE-FIXED_POS_ACC (Fixed position 3D accuracy)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_SVIN_MIN_DUR_ID, UBLOXCFG_TYPE_U4>                                           CFG_TMODE_SVIN_MIN_DUR {};               //!< CFG-TMODE-SVIN_MIN_DUR (Survey-in minimum duration)
+inline constexpr Item<UBLOXCFG_CFG_TMODE_SVIN_ACC_LIMIT_ID, UBLOXCFG_TYPE_U4>                                         CFG_TMODE_SVIN_ACC_LIMIT {};             //!< CFG-TMODE-SVIN_ACC_LIMIT (Survey-in position accuracy limit)
+
+// CFG-TP
+inline constexpr Item<UBLOXCFG_CFG_TP_PULSE_DEF_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_TP_PULSE_DEF_t>                    CFG_TP_PULSE_DEF {};                     //!< CFG-TP-PULSE_DEF (Determines whether the time pulse is interpreted as frequency or period)
+inline constexpr Item<UBLOXCFG_CFG_TP_PULSE_LENGTH_DEF_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_TP_PULSE_LENGTH_DEF_t>      CFG_TP_PULSE_LENGTH_DEF {};              //!< CFG-TP-PULSE_LENGTH_DEF (Determines whether the time pulse length is interpreted as length[us] or pulse ratio[%])
+inline constexpr Item<UBLOXCFG_CFG_TP_ANT_CABLEDELAY_ID, UBLOXCFG_TYPE_I2>                                            CFG_TP_ANT_CABLEDELAY {};                //!< CFG-TP-ANT_CABLEDELAY (Antenna cable delay)
+inline constexpr Item<UBLOXCFG_CFG_TP_PERIOD_TP1_ID, UBLOXCFG_TYPE_U4>                                                CFG_TP_PERIOD_TP1 {};                    //!< CFG-TP-PERIOD_TP1 (Time pulse period (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_PERIOD_LOCK_TP1_ID, UBLOXCFG_TYPE_U4>                                           CFG_TP_PERIOD_LOCK_TP1 {};               //!< CFG-TP-PERIOD_LOCK_TP1 (Time pulse period when locked to GNSS time (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_FREQ_TP1_ID, UBLOXCFG_TYPE_U4>                                                  CFG_TP_FREQ_TP1 {};                      //!< CFG-TP-FREQ_TP1 (Time pulse frequency (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_FREQ_LOCK_TP1_ID, UBLOXCFG_TYPE_U4>                                             CFG_TP_FREQ_LOCK_TP1 {};                 //!< CFG-TP-FREQ_LOCK_TP1 (Time pulse frequency when locked to GNSS time (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_LEN_TP1_ID, UBLOXCFG_TYPE_U4>                                                   CFG_TP_LEN_TP1 {};                       //!< CFG-TP-LEN_TP1 (Time pulse length (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_LEN_LOCK_TP1_ID, UBLOXCFG_TYPE_U4>                                              CFG_TP_LEN_LOCK_TP1 {};                  //!< CFG-TP-LEN_LOCK_TP1 (Time pulse length when locked to GNSS time (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_DUTY_TP1_ID, UBLOXCFG_TYPE_R8>                                                  CFG_TP_DUTY_TP1 {};                      //!< CFG-TP-DUTY_TP1 (Time pulse duty cycle (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_DUTY_LOCK_TP1_ID, UBLOXCFG_TYPE_R8>                                             CFG_TP_DUTY_LOCK_TP1 {};                 //!< CFG-TP-DUTY_LOCK_TP1 (Time pulse duty cycle when locked to GNSS time (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_USER_DELAY_TP1_ID, UBLOXCFG_TYPE_I4>                                            CFG_TP_USER_DELAY_TP1 {};                //!< CFG-TP-USER_DELAY_TP1 (User-configurable time pulse delay (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_TP1_ENA_ID, UBLOXCFG_TYPE_L>                                                    CFG_TP_TP1_ENA {};                       //!< CFG-TP-TP1_ENA (Enable the first timepulse)
+inline constexpr Item<UBLOXCFG_CFG_TP_SYNC_GNSS_TP1_ID, UBLOXCFG_TYPE_L>                                              CFG_TP_SYNC_GNSS_TP1 {};                 //!< CFG-TP-SYNC_GNSS_TP1 (Sync time pulse to GNSS time or local clock (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_USE_LOCKED_TP1_ID, UBLOXCFG_TYPE_L>                                             CFG_TP_USE_LOCKED_TP1 {};                //!< CFG-TP-USE_LOCKED_TP1 (Use locked parameters when possible (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_ALIGN_TO_TOW_TP1_ID, UBLOXCFG_TYPE_L>                                           CFG_TP_ALIGN_TO_TOW_TP1 {};              //!< CFG-TP-ALIGN_TO_TOW_TP1 (Align time pulse to top of second (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_POL_TP1_ID, UBLOXCFG_TYPE_L>                                                    CFG_TP_POL_TP1 {};                       //!< CFG-TP-POL_TP1 (Set time pulse polarity (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_TIMEGRID_TP1_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_TP_TIMEGRID_TP1_t>              CFG_TP_TIMEGRID_TP1 {};                  //!< CFG-TP-TIMEGRID_TP1 (Time grid to use (TP1))
+inline constexpr Item<UBLOXCFG_CFG_TP_DRSTR_TP1_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_TP_DRSTR_TP1_t>                    CFG_TP_DRSTR_TP1 {};                     //!< CFG-TP-DRSTR_TP1 (Drive strength (TP1))
+
+// CFG-TXREADY
+inline constexpr Item<UBLOXCFG_CFG_TXREADY_ENABLED_ID, UBLOXCFG_TYPE_L>                                               CFG_TXREADY_ENABLED {};                  //!< CFG-TXREADY-ENABLED (Flag to indicate if TX ready pin mechanism should be enabled)
+inline constexpr Item<UBLOXCFG_CFG_TXREADY_POLARITY_ID, UBLOXCFG_TYPE_L>                                              CFG_TXREADY_POLARITY {};                 //!< CFG-TXREADY-POLARITY (The polarity of the TX ready pin: false:high-active, true:low-active)
+inline constexpr Item<UBLOXCFG_CFG_TXREADY_PIN_ID, UBLOXCFG_TYPE_U1>                                                  CFG_TXREADY_PIN {};                      //!< CFG-TXREADY-PIN (Pin number to use for the TX ready functionality)
+inline constexpr Item<UBLOXCFG_CFG_TXREADY_THRESHOLD_ID, UBLOXCFG_TYPE_U2>                                            CFG_TXREADY_THRESHOLD {};                //!< CFG-TXREADY-THRESHOLD (Amount of data that should be ready on the interface before triggering the TX ready pin)
+inline constexpr Item<UBLOXCFG_CFG_TXREADY_INTERFACE_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_TXREADY_INTERFACE_t>          CFG_TXREADY_INTERFACE {};                //!< CFG-TXREADY-INTERFACE (Interface where the TX ready feature should be linked to)
+
+// CFG-UART1
+inline constexpr Item<UBLOXCFG_CFG_UART1_BAUDRATE_ID, UBLOXCFG_TYPE_U4>                                               CFG_UART1_BAUDRATE {};                   //!< CFG-UART1-BAUDRATE (The baud rate that should be configured on the UART1)
+inline constexpr Item<UBLOXCFG_CFG_UART1_STOPBITS_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_UART1_STOPBITS_t>                CFG_UART1_STOPBITS {};                   //!< CFG-UART1-STOPBITS (Number of stopbits that should be used on UART1)
+inline constexpr Item<UBLOXCFG_CFG_UART1_DATABITS_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_UART1_DATABITS_t>                CFG_UART1_DATABITS {};                   //!< CFG-UART1-DATABITS (Number of databits that should be used on UART1)
+inline constexpr Item<UBLOXCFG_CFG_UART1_PARITY_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_UART1_PARITY_t>                    CFG_UART1_PARITY {};                     //!< CFG-UART1-PARITY (Parity mode that should be used on UART1)
+inline constexpr Item<UBLOXCFG_CFG_UART1_ENABLED_ID, UBLOXCFG_TYPE_L>                                                 CFG_UART1_ENABLED {};                    //!< CFG-UART1-ENABLED (Flag to indicate if the UART1 should be enabled)
+
+// CFG-UART1INPROT
+inline constexpr Item<UBLOXCFG_CFG_UART1INPROT_UBX_ID, UBLOXCFG_TYPE_L>                                               CFG_UART1INPROT_UBX {};                  //!< CFG-UART1INPROT-UBX (Flag to indicate if UBX should be an input protocol on UART1)
+inline constexpr Item<UBLOXCFG_CFG_UART1INPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                              CFG_UART1INPROT_NMEA {};                 //!< CFG-UART1INPROT-NMEA (Flag to indicate if NMEA should be an input protocol on UART1)
+inline constexpr Item<UBLOXCFG_CFG_UART1INPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                            CFG_UART1INPROT_RTCM3X {};               //!< CFG-UART1INPROT-RTCM3X (Flag to indicate if RTCM3X should be an input protocol on UART1)
+inline constexpr Item<UBLOXCFG_CFG_UART1INPROT_SPARTN_ID, UBLOXCFG_TYPE_L>                                            CFG_UART1INPROT_SPARTN {};               //!< CFG-UART1INPROT-SPARTN (Flag to indicate if SPARTN should be an input protocol on UART1)
+
+// CFG-UART1OUTPROT
+inline constexpr Item<UBLOXCFG_CFG_UART1OUTPROT_UBX_ID, UBLOXCFG_TYPE_L>                                              CFG_UART1OUTPROT_UBX {};                 //!< CFG-UART1OUTPROT-UBX (Flag to indicate if UBX should be an output protocol on UART1)
+inline constexpr Item<UBLOXCFG_CFG_UART1OUTPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                             CFG_UART1OUTPROT_NMEA {};                //!< CFG-UART1OUTPROT-NMEA (Flag to indicate if NMEA should be an output protocol on UART1)
+inline constexpr Item<UBLOXCFG_CFG_UART1OUTPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                           CFG_UART1OUTPROT_RTCM3X {};              //!< CFG-UART1OUTPROT-RTCM3X (Flag to indicate if RTCM3X should be an output protocol on UART1)
+
+// CFG-UART2
+inline constexpr Item<UBLOXCFG_CFG_UART2_BAUDRATE_ID, UBLOXCFG_TYPE_U4>                                               CFG_UART2_BAUDRATE {};                   //!< CFG-UART2-BAUDRATE (The baud rate that should be configured on the UART2)
+inline constexpr Item<UBLOXCFG_CFG_UART2_STOPBITS_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_UART2_STOPBITS_t>                CFG_UART2_STOPBITS {};                   //!< CFG-UART2-STOPBITS (Number of stopbits that should be used on UART2)
+inline constexpr Item<UBLOXCFG_CFG_UART2_DATABITS_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_UART2_DATABITS_t>                CFG_UART2_DATABITS {};                   //!< CFG-UART2-DATABITS (Number of databits that should be used on UART2)
+inline constexpr Item<UBLOXCFG_CFG_UART2_PARITY_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_UART2_PARITY_t>                    CFG_UART2_PARITY {};                     //!< CFG-UART2-PARITY (Parity mode that should be used on UART2)
+inline constexpr Item<UBLOXCFG_CFG_UART2_ENABLED_ID, UBLOXCFG_TYPE_L>                                                 CFG_UART2_ENABLED {};                    //!< CFG-UART2-ENABLED (Flag to indicate if the UART2 should be enabled)
+inline constexpr Item<UBLOXCFG_CFG_UART2_REMAP_ID, UBLOXCFG_TYPE_L>                                                   CFG_UART2_REMAP {};                      //!< CFG-UART2-REMAP (UART2 Remapping)
+
+// CFG-UART2INPROT
+inline constexpr Item<UBLOXCFG_CFG_UART2INPROT_UBX_ID, UBLOXCFG_TYPE_L>                                               CFG_UART2INPROT_UBX {};                  //!< CFG-UART2INPROT-UBX (Flag to indicate if UBX should be an input protocol on UART2)
+inline constexpr Item<UBLOXCFG_CFG_UART2INPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                              CFG_UART2INPROT_NMEA {};                 //!< CFG-UART2INPROT-NMEA (Flag to indicate if NMEA should be an input protocol on UART2)
+inline constexpr Item<UBLOXCFG_CFG_UART2INPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                            CFG_UART2INPROT_RTCM3X {};               //!< CFG-UART2INPROT-RTCM3X (Flag to indicate if RTCM3X should be an input protocol on UART2)
+inline constexpr Item<UBLOXCFG_CFG_UART2INPROT_SPARTN_ID, UBLOXCFG_TYPE_L>                                            CFG_UART2INPROT_SPARTN {};               //!< CFG-UART2INPROT-SPARTN (Flag to indicate if SPARTN should be an input protocol on UART2)
+
+// CFG-UART2OUTPROT
+inline constexpr Item<UBLOXCFG_CFG_UART2OUTPROT_UBX_ID, UBLOXCFG_TYPE_L>                                              CFG_UART2OUTPROT_UBX {};                 //!< CFG-UART2OUTPROT-UBX (Flag to indicate if UBX should be an output protocol on UART2)
+inline constexpr Item<UBLOXCFG_CFG_UART2OUTPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                             CFG_UART2OUTPROT_NMEA {};                //!< CFG-UART2OUTPROT-NMEA (Flag to indicate if NMEA should be an output protocol on UART2)
+inline constexpr Item<UBLOXCFG_CFG_UART2OUTPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                           CFG_UART2OUTPROT_RTCM3X {};              //!< CFG-UART2OUTPROT-RTCM3X (Flag to indicate if RTCM3X should be an output protocol on UART2)
+
+// CFG-USB
+inline constexpr Item<UBLOXCFG_CFG_USB_ENABLED_ID, UBLOXCFG_TYPE_L>                                                   CFG_USB_ENABLED {};                      //!< CFG-USB-ENABLED (Flag to indicate if the USB interface should be enabled)
+inline constexpr Item<UBLOXCFG_CFG_USB_SELFPOW_ID, UBLOXCFG_TYPE_L>                                                   CFG_USB_SELFPOW {};                      //!< CFG-USB-SELFPOW (Self-powered device)
+inline constexpr Item<UBLOXCFG_CFG_USB_VENDOR_ID_ID, UBLOXCFG_TYPE_U2>                                                CFG_USB_VENDOR_ID {};                    //!< CFG-USB-VENDOR_ID (Vendor ID)
+inline constexpr Item<UBLOXCFG_CFG_USB_PRODUCT_ID_ID, UBLOXCFG_TYPE_U2>                                               CFG_USB_PRODUCT_ID {};                   //!< CFG-USB-PRODUCT_ID (Vendor ID)
+inline constexpr Item<UBLOXCFG_CFG_USB_POWER_ID, UBLOXCFG_TYPE_U2>                                                    CFG_USB_POWER {};                        //!< CFG-USB-POWER (Power consumption)
+inline constexpr Item<UBLOXCFG_CFG_USB_VENDOR_STR0_ID, UBLOXCFG_TYPE_X8>                                              CFG_USB_VENDOR_STR0 {};                  //!< CFG-USB-VENDOR_STR0 (Vendor string characters 0-7)
+inline constexpr Item<UBLOXCFG_CFG_USB_VENDOR_STR1_ID, UBLOXCFG_TYPE_X8>                                              CFG_USB_VENDOR_STR1 {};                  //!< CFG-USB-VENDOR_STR1 (Vendor string characters 8-15)
+inline constexpr Item<UBLOXCFG_CFG_USB_VENDOR_STR2_ID, UBLOXCFG_TYPE_X8>                                              CFG_USB_VENDOR_STR2 {};                  //!< CFG-USB-VENDOR_STR2 (Vendor string characters 16-23)
+inline constexpr Item<UBLOXCFG_CFG_USB_VENDOR_STR3_ID, UBLOXCFG_TYPE_X8>                                              CFG_USB_VENDOR_STR3 {};                  //!< CFG-USB-VENDOR_STR3 (Vendor string characters 24-31)
+inline constexpr Item<UBLOXCFG_CFG_USB_PRODUCT_STR0_ID, UBLOXCFG_TYPE_X8>                                             CFG_USB_PRODUCT_STR0 {};                 //!< CFG-USB-PRODUCT_STR0 (Product string characters 0-7)
+inline constexpr Item<UBLOXCFG_CFG_USB_PRODUCT_STR1_ID, UBLOXCFG_TYPE_X8>                                             CFG_USB_PRODUCT_STR1 {};                 //!< CFG-USB-PRODUCT_STR1 (Product string characters 8-15)
+inline constexpr Item<UBLOXCFG_CFG_USB_PRODUCT_STR2_ID, UBLOXCFG_TYPE_X8>                                             CFG_USB_PRODUCT_STR2 {};                 //!< CFG-USB-PRODUCT_STR2 (Product string characters 16-23)
+inline constexpr Item<UBLOXCFG_CFG_USB_PRODUCT_STR3_ID, UBLOXCFG_TYPE_X8>                                             CFG_USB_PRODUCT_STR3 {};                 //!< CFG-USB-PRODUCT_STR3 (Product string characters 24-31)
+inline constexpr Item<UBLOXCFG_CFG_USB_SERIAL_NO_STR0_ID, UBLOXCFG_TYPE_X8>                                           CFG_USB_SERIAL_NO_STR0 {};               //!< CFG-USB-SERIAL_NO_STR0 (Serial number string characters 0-7)
+inline constexpr Item<UBLOXCFG_CFG_USB_SERIAL_NO_STR1_ID, UBLOXCFG_TYPE_X8>                                           CFG_USB_SERIAL_NO_STR1 {};               //!< CFG-USB-SERIAL_NO_STR1 (Serial number string characters 8-15)
+inline constexpr Item<UBLOXCFG_CFG_USB_SERIAL_NO_STR2_ID, UBLOXCFG_TYPE_X8>                                           CFG_USB_SERIAL_NO_STR2 {};               //!< CFG-USB-SERIAL_NO_STR2 (Serial number string characters 16-23)
+inline constexpr Item<UBLOXCFG_CFG_USB_SERIAL_NO_STR3_ID, UBLOXCFG_TYPE_X8>                                           CFG_USB_SERIAL_NO_STR3 {};               //!< CFG-USB-SERIAL_NO_STR3 (Serial number string characters 24-31)
+
+// CFG-USBINPROT
+inline constexpr Item<UBLOXCFG_CFG_USBINPROT_UBX_ID, UBLOXCFG_TYPE_L>                                                 CFG_USBINPROT_UBX {};                    //!< CFG-USBINPROT-UBX (Flag to indicate if UBX should be an input protocol on USB)
+inline constexpr Item<UBLOXCFG_CFG_USBINPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                                CFG_USBINPROT_NMEA {};                   //!< CFG-USBINPROT-NMEA (Flag to indicate if NMEA should be an input protocol on USB)
+inline constexpr Item<UBLOXCFG_CFG_USBINPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                              CFG_USBINPROT_RTCM3X {};                 //!< CFG-USBINPROT-RTCM3X (Flag to indicate if RTCM3X should be an input protocol on USB)
+inline constexpr Item<UBLOXCFG_CFG_USBINPROT_SPARTN_ID, UBLOXCFG_TYPE_L>                                              CFG_USBINPROT_SPARTN {};                 //!< CFG-USBINPROT-SPARTN (Flag to indicate if SPARTN should be an input protocol on USB)
+
+// CFG-USBOUTPROT
+inline constexpr Item<UBLOXCFG_CFG_USBOUTPROT_UBX_ID, UBLOXCFG_TYPE_L>                                                CFG_USBOUTPROT_UBX {};                   //!< CFG-USBOUTPROT-UBX (Flag to indicate if UBX should be an output protocol on USB)
+inline constexpr Item<UBLOXCFG_CFG_USBOUTPROT_NMEA_ID, UBLOXCFG_TYPE_L>                                               CFG_USBOUTPROT_NMEA {};                  //!< CFG-USBOUTPROT-NMEA (Flag to indicate if NMEA should be an output protocol on USB)
+inline constexpr Item<UBLOXCFG_CFG_USBOUTPROT_RTCM3X_ID, UBLOXCFG_TYPE_L>                                             CFG_USBOUTPROT_RTCM3X {};                //!< CFG-USBOUTPROT-RTCM3X (Flag to indicate if RTCM3X should be an output protocol on USB)
+
+// CFG-UBLOXCFGTEST
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_L_ID, UBLOXCFG_TYPE_L>                                                CFG_UBLOXCFGTEST_L {};                   //!< CFG-UBLOXCFGTEST-L (ubloxcfg library test item type L)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_U1_ID, UBLOXCFG_TYPE_U1>                                              CFG_UBLOXCFGTEST_U1 {};                  //!< CFG-UBLOXCFGTEST-U1 (ubloxcfg library test item type U1)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_U2_ID, UBLOXCFG_TYPE_U2>                                              CFG_UBLOXCFGTEST_U2 {};                  //!< CFG-UBLOXCFGTEST-U2 (ubloxcfg library test item type U2)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_U4_ID, UBLOXCFG_TYPE_U4>                                              CFG_UBLOXCFGTEST_U4 {};                  //!< CFG-UBLOXCFGTEST-U4 (ubloxcfg library test item type U4)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_U8_ID, UBLOXCFG_TYPE_U8>                                              CFG_UBLOXCFGTEST_U8 {};                  //!< CFG-UBLOXCFGTEST-U8 (ubloxcfg library test item type U8)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_I1_ID, UBLOXCFG_TYPE_I1>                                              CFG_UBLOXCFGTEST_I1 {};                  //!< CFG-UBLOXCFGTEST-I1 (ubloxcfg library test item type I1)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_I2_ID, UBLOXCFG_TYPE_I2>                                              CFG_UBLOXCFGTEST_I2 {};                  //!< CFG-UBLOXCFGTEST-I2 (ubloxcfg library test item type I2)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_I4_ID, UBLOXCFG_TYPE_I4>                                              CFG_UBLOXCFGTEST_I4 {};                  //!< CFG-UBLOXCFGTEST-I4 (ubloxcfg library test item type I4)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_I8_ID, UBLOXCFG_TYPE_I8>                                              CFG_UBLOXCFGTEST_I8 {};                  //!< CFG-UBLOXCFGTEST-I8 (ubloxcfg library test item type I8)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_X1_ID, UBLOXCFG_TYPE_X1>                                              CFG_UBLOXCFGTEST_X1 {};                  //!< CFG-UBLOXCFGTEST-X1 (ubloxcfg library test item type X1)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_X2_ID, UBLOXCFG_TYPE_X2>                                              CFG_UBLOXCFGTEST_X2 {};                  //!< CFG-UBLOXCFGTEST-X2 (ubloxcfg library test item type X2)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_X4_ID, UBLOXCFG_TYPE_X4>                                              CFG_UBLOXCFGTEST_X4 {};                  //!< CFG-UBLOXCFGTEST-X4 (ubloxcfg library test item type X4)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_X8_ID, UBLOXCFG_TYPE_X8>                                              CFG_UBLOXCFGTEST_X8 {};                  //!< CFG-UBLOXCFGTEST-X8 (ubloxcfg library test item type X8)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_R4_ID, UBLOXCFG_TYPE_R4>                                              CFG_UBLOXCFGTEST_R4 {};                  //!< CFG-UBLOXCFGTEST-R4 (ubloxcfg library test item type R4)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_R8_ID, UBLOXCFG_TYPE_R8>                                              CFG_UBLOXCFGTEST_R8 {};                  //!< CFG-UBLOXCFGTEST-R8 (ubloxcfg library test item type R8)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_E1_ID, UBLOXCFG_TYPE_E1, UBLOXCFG_CFG_UBLOXCFGTEST_E1_t>              CFG_UBLOXCFGTEST_E1 {};                  //!< CFG-UBLOXCFGTEST-E1 (ubloxcfg library test item type E1)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_E2_ID, UBLOXCFG_TYPE_E2, UBLOXCFG_CFG_UBLOXCFGTEST_E2_t>              CFG_UBLOXCFGTEST_E2 {};                  //!< CFG-UBLOXCFGTEST-E2 (ubloxcfg library test item type E2)
+inline constexpr Item<UBLOXCFG_CFG_UBLOXCFGTEST_E4_ID, UBLOXCFG_TYPE_E4, UBLOXCFG_CFG_UBLOXCFGTEST_E4_t>              CFG_UBLOXCFGTEST_E4 {};                  //!< CFG-UBLOXCFGTEST-E4 (ubloxcfg library test item type E4)
+
+// NMEA-PUBX-POSITION
+inline constexpr auto NMEA_PUBX_POSITION_UART1                           = CFG_MSGOUT_PUBX_ID_POLYP_UART1;                    //!< NMEA-PUBX-POSITION rate on port UART1
+inline constexpr auto NMEA_PUBX_POSITION_UART2                           = CFG_MSGOUT_PUBX_ID_POLYP_UART2;                    //!< NMEA-PUBX-POSITION rate on port UART2
+inline constexpr auto NMEA_PUBX_POSITION_SPI                             = CFG_MSGOUT_PUBX_ID_POLYP_SPI;                      //!< NMEA-PUBX-POSITION rate on port SPI
+inline constexpr auto NMEA_PUBX_POSITION_I2C                             = CFG_MSGOUT_PUBX_ID_POLYP_I2C;                      //!< NMEA-PUBX-POSITION rate on port I2C
+inline constexpr auto NMEA_PUBX_POSITION_USB                             = CFG_MSGOUT_PUBX_ID_POLYP_USB;                      //!< NMEA-PUBX-POSITION rate on port USB
+
+// NMEA-PUBX-SVSTATUS
+inline constexpr auto NMEA_PUBX_SVSTATUS_UART1                           = CFG_MSGOUT_PUBX_ID_POLYS_UART1;                    //!< NMEA-PUBX-SVSTATUS rate on port UART1
+inline constexpr auto NMEA_PUBX_SVSTATUS_UART2                           = CFG_MSGOUT_PUBX_ID_POLYS_UART2;                    //!< NMEA-PUBX-SVSTATUS rate on port UART2
+inline constexpr auto NMEA_PUBX_SVSTATUS_SPI                             = CFG_MSGOUT_PUBX_ID_POLYS_SPI;                      //!< NMEA-PUBX-SVSTATUS rate on port SPI
+inline constexpr auto NMEA_PUBX_SVSTATUS_I2C                             = CFG_MSGOUT_PUBX_ID_POLYS_I2C;                      //!< NMEA-PUBX-SVSTATUS rate on port I2C
+inline constexpr auto NMEA_PUBX_SVSTATUS_USB                             = CFG_MSGOUT_PUBX_ID_POLYS_USB;                      //!< NMEA-PUBX-SVSTATUS rate on port USB
+
+// NMEA-PUBX-TIME
+inline constexpr auto NMEA_PUBX_TIME_UART1                               = CFG_MSGOUT_PUBX_ID_POLYT_UART1;                    //!< NMEA-PUBX-TIME rate on port UART1
+inline constexpr auto NMEA_PUBX_TIME_UART2                               = CFG_MSGOUT_PUBX_ID_POLYT_UART2;                    //!< NMEA-PUBX-TIME rate on port UART2
+inline constexpr auto NMEA_PUBX_TIME_SPI                                 = CFG_MSGOUT_PUBX_ID_POLYT_SPI;                      //!< NMEA-PUBX-TIME rate on port SPI
+inline constexpr auto NMEA_PUBX_TIME_I2C                                 = CFG_MSGOUT_PUBX_ID_POLYT_I2C;                      //!< NMEA-PUBX-TIME rate on port I2C
+inline constexpr auto NMEA_PUBX_TIME_USB                                 = CFG_MSGOUT_PUBX_ID_POLYT_USB;                      //!< NMEA-PUBX-TIME rate on port USB
+
+// NMEA-STANDARD-DTM
+inline constexpr auto NMEA_STANDARD_DTM_UART1                            = CFG_MSGOUT_NMEA_ID_DTM_UART1;                      //!< NMEA-STANDARD-DTM rate on port UART1
+inline constexpr auto NMEA_STANDARD_DTM_UART2                            = CFG_MSGOUT_NMEA_ID_DTM_UART2;                      //!< NMEA-STANDARD-DTM rate on port UART2
+inline constexpr auto NMEA_STANDARD_DTM_SPI                              = CFG_MSGOUT_NMEA_ID_DTM_SPI;                        //!< NMEA-STANDARD-DTM rate on port SPI
+inline constexpr auto NMEA_STANDARD_DTM_I2C                              = CFG_MSGOUT_NMEA_ID_DTM_I2C;                        //!< NMEA-STANDARD-DTM rate on port I2C
+inline constexpr auto NMEA_STANDARD_DTM_USB                              = CFG_MSGOUT_NMEA_ID_DTM_USB;                        //!< NMEA-STANDARD-DTM rate on port USB
+
+// NMEA-STANDARD-GBS
+inline constexpr auto NMEA_STANDARD_GBS_UART1                            = CFG_MSGOUT_NMEA_ID_GBS_UART1;                      //!< NMEA-STANDARD-GBS rate on port UART1
+inline constexpr auto NMEA_STANDARD_GBS_UART2                            = CFG_MSGOUT_NMEA_ID_GBS_UART2;                      //!< NMEA-STANDARD-GBS rate on port UART2
+inline constexpr auto NMEA_STANDARD_GBS_SPI                              = CFG_MSGOUT_NMEA_ID_GBS_SPI;                        //!< NMEA-STANDARD-GBS rate on port SPI
+inline constexpr auto NMEA_STANDARD_GBS_I2C                              = CFG_MSGOUT_NMEA_ID_GBS_I2C;                        //!< NMEA-STANDARD-GBS rate on port I2C
+inline constexpr auto NMEA_STANDARD_GBS_USB                              = CFG_MSGOUT_NMEA_ID_GBS_USB;                        //!< NMEA-STANDARD-GBS rate on port USB
+
+// NMEA-STANDARD-GGA
+inline constexpr auto NMEA_STANDARD_GGA_UART1                            = CFG_MSGOUT_NMEA_ID_GGA_UART1;                      //!< NMEA-STANDARD-GGA rate on port UART1
+inline constexpr auto NMEA_STANDARD_GGA_UART2                            = CFG_MSGOUT_NMEA_ID_GGA_UART2;                      //!< NMEA-STANDARD-GGA rate on port UART2
+inline constexpr auto NMEA_STANDARD_GGA_SPI                              = CFG_MSGOUT_NMEA_ID_GGA_SPI;                        //!< NMEA-STANDARD-GGA rate on port SPI
+inline constexpr auto NMEA_STANDARD_GGA_I2C                              = CFG_MSGOUT_NMEA_ID_GGA_I2C;                        //!< NMEA-STANDARD-GGA rate on port I2C
+inline constexpr auto NMEA_STANDARD_GGA_USB                              = CFG_MSGOUT_NMEA_ID_GGA_USB;                        //!< NMEA-STANDARD-GGA rate on port USB
+
+// NMEA-STANDARD-GLL
+inline constexpr auto NMEA_STANDARD_GLL_UART1                            = CFG_MSGOUT_NMEA_ID_GLL_UART1;                      //!< NMEA-STANDARD-GLL rate on port UART1
+inline constexpr auto NMEA_STANDARD_GLL_UART2                            = CFG_MSGOUT_NMEA_ID_GLL_UART2;                      //!< NMEA-STANDARD-GLL rate on port UART2
+inline constexpr auto NMEA_STANDARD_GLL_SPI                              = CFG_MSGOUT_NMEA_ID_GLL_SPI;                        //!< NMEA-STANDARD-GLL rate on port SPI
+inline constexpr auto NMEA_STANDARD_GLL_I2C                              = CFG_MSGOUT_NMEA_ID_GLL_I2C;                        //!< NMEA-STANDARD-GLL rate on port I2C
+inline constexpr auto NMEA_STANDARD_GLL_USB                              = CFG_MSGOUT_NMEA_ID_GLL_USB;                        //!< NMEA-STANDARD-GLL rate on port USB
+
+// NMEA-STANDARD-GNS
+inline constexpr auto NMEA_STANDARD_GNS_UART1                            = CFG_MSGOUT_NMEA_ID_GNS_UART1;                      //!< NMEA-STANDARD-GNS rate on port UART1
+inline constexpr auto NMEA_STANDARD_GNS_UART2                            = CFG_MSGOUT_NMEA_ID_GNS_UART2;                      //!< NMEA-STANDARD-GNS rate on port UART2
+inline constexpr auto NMEA_STANDARD_GNS_SPI                              = CFG_MSGOUT_NMEA_ID_GNS_SPI;                        //!< NMEA-STANDARD-GNS rate on port SPI
+inline constexpr auto NMEA_STANDARD_GNS_I2C                              = CFG_MSGOUT_NMEA_ID_GNS_I2C;                        //!< NMEA-STANDARD-GNS rate on port I2C
+inline constexpr auto NMEA_STANDARD_GNS_USB                              = CFG_MSGOUT_NMEA_ID_GNS_USB;                        //!< NMEA-STANDARD-GNS rate on port USB
+
+// NMEA-STANDARD-GRS
+inline constexpr auto NMEA_STANDARD_GRS_UART1                            = CFG_MSGOUT_NMEA_ID_GRS_UART1;                      //!< NMEA-STANDARD-GRS rate on port UART1
+inline constexpr auto NMEA_STANDARD_GRS_UART2                            = CFG_MSGOUT_NMEA_ID_GRS_UART2;                      //!< NMEA-STANDARD-GRS rate on port UART2
+inline constexpr auto NMEA_STANDARD_GRS_SPI                              = CFG_MSGOUT_NMEA_ID_GRS_SPI;                        //!< NMEA-STANDARD-GRS rate on port SPI
+inline constexpr auto NMEA_STANDARD_GRS_I2C                              = CFG_MSGOUT_NMEA_ID_GRS_I2C;                        //!< NMEA-STANDARD-GRS rate on port I2C
+inline constexpr auto NMEA_STANDARD_GRS_USB                              = CFG_MSGOUT_NMEA_ID_GRS_USB;                        //!< NMEA-STANDARD-GRS rate on port USB
+
+// NMEA-STANDARD-GSA
+inline constexpr auto NMEA_STANDARD_GSA_UART1                            = CFG_MSGOUT_NMEA_ID_GSA_UART1;                      //!< NMEA-STANDARD-GSA rate on port UART1
+inline constexpr auto NMEA_STANDARD_GSA_UART2                            = CFG_MSGOUT_NMEA_ID_GSA_UART2;                      //!< NMEA-STANDARD-GSA rate on port UART2
+inline constexpr auto NMEA_STANDARD_GSA_SPI                              = CFG_MSGOUT_NMEA_ID_GSA_SPI;                        //!< NMEA-STANDARD-GSA rate on port SPI
+inline constexpr auto NMEA_STANDARD_GSA_I2C                              = CFG_MSGOUT_NMEA_ID_GSA_I2C;                        //!< NMEA-STANDARD-GSA rate on port I2C
+inline constexpr auto NMEA_STANDARD_GSA_USB                              = CFG_MSGOUT_NMEA_ID_GSA_USB;                        //!< NMEA-STANDARD-GSA rate on port USB
+
+// NMEA-STANDARD-GST
+inline constexpr auto NMEA_STANDARD_GST_UART1                            = CFG_MSGOUT_NMEA_ID_GST_UART1;                      //!< NMEA-STANDARD-GST rate on port UART1
+inline constexpr auto NMEA_STANDARD_GST_UART2                            = CFG_MSGOUT_NMEA_ID_GST_UART2;                      //!< NMEA-STANDARD-GST rate on port UART2
+inline constexpr auto NMEA_STANDARD_GST_SPI                              = CFG_MSGOUT_NMEA_ID_GST_SPI;                        //!< NMEA-STANDARD-GST rate on port SPI
+inline constexpr auto NMEA_STANDARD_GST_I2C                              = CFG_MSGOUT_NMEA_ID_GST_I2C;                        //!< NMEA-STANDARD-GST rate on port I2C
+inline constexpr auto NMEA_STANDARD_GST_USB                              = CFG_MSGOUT_NMEA_ID_GST_USB;                        //!< NMEA-STANDARD-GST rate on port USB
+
+// NMEA-STANDARD-GSV
+inline constexpr auto NMEA_STANDARD_GSV_UART1                            = CFG_MSGOUT_NMEA_ID_GSV_UART1;                      //!< NMEA-STANDARD-GSV rate on port UART1
+inline constexpr auto NMEA_STANDARD_GSV_UART2                            = CFG_MSGOUT_NMEA_ID_GSV_UART2;                      //!< NMEA-STANDARD-GSV rate on port UART2
+inline constexpr auto NMEA_STANDARD_GSV_SPI                              = CFG_MSGOUT_NMEA_ID_GSV_SPI;                        //!< NMEA-STANDARD-GSV rate on port SPI
+inline constexpr auto NMEA_STANDARD_GSV_I2C                              = CFG_MSGOUT_NMEA_ID_GSV_I2C;                        //!< NMEA-STANDARD-GSV rate on port I2C
+inline constexpr auto NMEA_STANDARD_GSV_USB                              = CFG_MSGOUT_NMEA_ID_GSV_USB;                        //!< NMEA-STANDARD-GSV rate on port USB
+
+// NMEA-STANDARD-RLM
+inline constexpr auto NMEA_STANDARD_RLM_UART1                            = CFG_MSGOUT_NMEA_ID_RLM_UART1;                      //!< NMEA-STANDARD-RLM rate on port UART1
+inline constexpr auto NMEA_STANDARD_RLM_UART2                            = CFG_MSGOUT_NMEA_ID_RLM_UART2;                      //!< NMEA-STANDARD-RLM rate on port UART2
+inline constexpr auto NMEA_STANDARD_RLM_SPI                              = CFG_MSGOUT_NMEA_ID_RLM_SPI;                        //!< NMEA-STANDARD-RLM rate on port SPI
+inline constexpr auto NMEA_STANDARD_RLM_I2C                              = CFG_MSGOUT_NMEA_ID_RLM_I2C;                        //!< NMEA-STANDARD-RLM rate on port I2C
+inline constexpr auto NMEA_STANDARD_RLM_USB                              = CFG_MSGOUT_NMEA_ID_RLM_USB;                        //!< NMEA-STANDARD-RLM rate on port USB
+
+// NMEA-STANDARD-RMC
+inline constexpr auto NMEA_STANDARD_RMC_UART1                            = CFG_MSGOUT_NMEA_ID_RMC_UART1;                      //!< NMEA-STANDARD-RMC rate on port UART1
+inline constexpr auto NMEA_STANDARD_RMC_UART2                            = CFG_MSGOUT_NMEA_ID_RMC_UART2;                      //!< NMEA-STANDARD-RMC rate on port UART2
+inline constexpr auto NMEA_STANDARD_RMC_SPI                              = CFG_MSGOUT_NMEA_ID_RMC_SPI;                        //!< NMEA-STANDARD-RMC rate on port SPI
+inline constexpr auto NMEA_STANDARD_RMC_I2C                              = CFG_MSGOUT_NMEA_ID_RMC_I2C;                        //!< NMEA-STANDARD-RMC rate on port I2C
+inline constexpr auto NMEA_STANDARD_RMC_USB                              = CFG_MSGOUT_NMEA_ID_RMC_USB;                        //!< NMEA-STANDARD-RMC rate on port USB
+
+// NMEA-STANDARD-THS
+inline constexpr auto NMEA_STANDARD_THS_UART1                            = CFG_MSGOUT_NMEA_ID_THS_UART1;                      //!< NMEA-STANDARD-THS rate on port UART1
+inline constexpr auto NMEA_STANDARD_THS_UART2                            = CFG_MSGOUT_NMEA_ID_THS_UART2;                      //!< NMEA-STANDARD-THS rate on port UART2
+inline constexpr auto NMEA_STANDARD_THS_SPI                              = CFG_MSGOUT_NMEA_ID_THS_SPI;                        //!< NMEA-STANDARD-THS rate on port SPI
+inline constexpr auto NMEA_STANDARD_THS_I2C                              = CFG_MSGOUT_NMEA_ID_THS_I2C;                        //!< NMEA-STANDARD-THS rate on port I2C
+inline constexpr auto NMEA_STANDARD_THS_USB                              = CFG_MSGOUT_NMEA_ID_THS_USB;                        //!< NMEA-STANDARD-THS rate on port USB
+
+// NMEA-STANDARD-VLW
+inline constexpr auto NMEA_STANDARD_VLW_UART1                            = CFG_MSGOUT_NMEA_ID_VLW_UART1;                      //!< NMEA-STANDARD-VLW rate on port UART1
+inline constexpr auto NMEA_STANDARD_VLW_UART2                            = CFG_MSGOUT_NMEA_ID_VLW_UART2;                      //!< NMEA-STANDARD-VLW rate on port UART2
+inline constexpr auto NMEA_STANDARD_VLW_SPI                              = CFG_MSGOUT_NMEA_ID_VLW_SPI;                        //!< NMEA-STANDARD-VLW rate on port SPI
+inline constexpr auto NMEA_STANDARD_VLW_I2C                              = CFG_MSGOUT_NMEA_ID_VLW_I2C;                        //!< NMEA-STANDARD-VLW rate on port I2C
+inline constexpr auto NMEA_STANDARD_VLW_USB                              = CFG_MSGOUT_NMEA_ID_VLW_USB;                        //!< NMEA-STANDARD-VLW rate on port USB
+
+// NMEA-STANDARD-VTG
+inline constexpr auto NMEA_STANDARD_VTG_UART1                            = CFG_MSGOUT_NMEA_ID_VTG_UART1;                      //!< NMEA-STANDARD-VTG rate on port UART1
+inline constexpr auto NMEA_STANDARD_VTG_UART2                            = CFG_MSGOUT_NMEA_ID_VTG_UART2;                      //!< NMEA-STANDARD-VTG rate on port UART2
+inline constexpr auto NMEA_STANDARD_VTG_SPI                              = CFG_MSGOUT_NMEA_ID_VTG_SPI;                        //!< NMEA-STANDARD-VTG rate on port SPI
+inline constexpr auto NMEA_STANDARD_VTG_I2C                              = CFG_MSGOUT_NMEA_ID_VTG_I2C;                        //!< NMEA-STANDARD-VTG rate on port I2C
+inline constexpr auto NMEA_STANDARD_VTG_USB                              = CFG_MSGOUT_NMEA_ID_VTG_USB;                        //!< NMEA-STANDARD-VTG rate on port USB
+
+// NMEA-STANDARD-ZDA
+inline constexpr auto NMEA_STANDARD_ZDA_UART1                            = CFG_MSGOUT_NMEA_ID_ZDA_UART1;                      //!< NMEA-STANDARD-ZDA rate on port UART1
+inline constexpr auto NMEA_STANDARD_ZDA_UART2                            = CFG_MSGOUT_NMEA_ID_ZDA_UART2;                      //!< NMEA-STANDARD-ZDA rate on port UART2
+inline constexpr auto NMEA_STANDARD_ZDA_SPI                              = CFG_MSGOUT_NMEA_ID_ZDA_SPI;                        //!< NMEA-STANDARD-ZDA rate on port SPI
+inline constexpr auto NMEA_STANDARD_ZDA_I2C                              = CFG_MSGOUT_NMEA_ID_ZDA_I2C;                        //!< NMEA-STANDARD-ZDA rate on port I2C
+inline constexpr auto NMEA_STANDARD_ZDA_USB                              = CFG_MSGOUT_NMEA_ID_ZDA_USB;                        //!< NMEA-STANDARD-ZDA rate on port USB
+
+// RTCM-3X-TYPE1005
+inline constexpr auto RTCM_3X_TYPE1005_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1005_UART1;                 //!< RTCM-3X-TYPE1005 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1005_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1005_UART2;                 //!< RTCM-3X-TYPE1005 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1005_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1005_SPI;                   //!< RTCM-3X-TYPE1005 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1005_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1005_I2C;                   //!< RTCM-3X-TYPE1005 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1005_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1005_USB;                   //!< RTCM-3X-TYPE1005 rate on port USB
+
+// RTCM-3X-TYPE1074
+inline constexpr auto RTCM_3X_TYPE1074_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1074_UART1;                 //!< RTCM-3X-TYPE1074 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1074_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1074_UART2;                 //!< RTCM-3X-TYPE1074 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1074_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1074_SPI;                   //!< RTCM-3X-TYPE1074 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1074_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1074_I2C;                   //!< RTCM-3X-TYPE1074 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1074_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1074_USB;                   //!< RTCM-3X-TYPE1074 rate on port USB
+
+// RTCM-3X-TYPE1077
+inline constexpr auto RTCM_3X_TYPE1077_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1077_UART1;                 //!< RTCM-3X-TYPE1077 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1077_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1077_UART2;                 //!< RTCM-3X-TYPE1077 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1077_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1077_SPI;                   //!< RTCM-3X-TYPE1077 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1077_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1077_I2C;                   //!< RTCM-3X-TYPE1077 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1077_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1077_USB;                   //!< RTCM-3X-TYPE1077 rate on port USB
+
+// RTCM-3X-TYPE1084
+inline constexpr auto RTCM_3X_TYPE1084_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1084_UART1;                 //!< RTCM-3X-TYPE1084 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1084_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1084_UART2;                 //!< RTCM-3X-TYPE1084 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1084_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1084_SPI;                   //!< RTCM-3X-TYPE1084 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1084_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1084_I2C;                   //!< RTCM-3X-TYPE1084 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1084_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1084_USB;                   //!< RTCM-3X-TYPE1084 rate on port USB
+
+// RTCM-3X-TYPE1087
+inline constexpr auto RTCM_3X_TYPE1087_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1087_UART1;                 //!< RTCM-3X-TYPE1087 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1087_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1087_UART2;                 //!< RTCM-3X-TYPE1087 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1087_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1087_SPI;                   //!< RTCM-3X-TYPE1087 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1087_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1087_I2C;                   //!< RTCM-3X-TYPE1087 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1087_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1087_USB;                   //!< RTCM-3X-TYPE1087 rate on port USB
+
+// RTCM-3X-TYPE1094
+inline constexpr auto RTCM_3X_TYPE1094_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1094_UART1;                 //!< RTCM-3X-TYPE1094 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1094_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1094_UART2;                 //!< RTCM-3X-TYPE1094 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1094_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1094_SPI;                   //!< RTCM-3X-TYPE1094 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1094_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1094_I2C;                   //!< RTCM-3X-TYPE1094 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1094_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1094_USB;                   //!< RTCM-3X-TYPE1094 rate on port USB
+
+// RTCM-3X-TYPE1097
+inline constexpr auto RTCM_3X_TYPE1097_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1097_UART1;                 //!< RTCM-3X-TYPE1097 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1097_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1097_UART2;                 //!< RTCM-3X-TYPE1097 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1097_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1097_SPI;                   //!< RTCM-3X-TYPE1097 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1097_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1097_I2C;                   //!< RTCM-3X-TYPE1097 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1097_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1097_USB;                   //!< RTCM-3X-TYPE1097 rate on port USB
+
+// RTCM-3X-TYPE1124
+inline constexpr auto RTCM_3X_TYPE1124_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1124_UART1;                 //!< RTCM-3X-TYPE1124 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1124_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1124_UART2;                 //!< RTCM-3X-TYPE1124 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1124_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1124_SPI;                   //!< RTCM-3X-TYPE1124 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1124_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1124_I2C;                   //!< RTCM-3X-TYPE1124 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1124_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1124_USB;                   //!< RTCM-3X-TYPE1124 rate on port USB
+
+// RTCM-3X-TYPE1127
+inline constexpr auto RTCM_3X_TYPE1127_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1127_UART1;                 //!< RTCM-3X-TYPE1127 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1127_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1127_UART2;                 //!< RTCM-3X-TYPE1127 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1127_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1127_SPI;                   //!< RTCM-3X-TYPE1127 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1127_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1127_I2C;                   //!< RTCM-3X-TYPE1127 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1127_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1127_USB;                   //!< RTCM-3X-TYPE1127 rate on port USB
+
+// RTCM-3X-TYPE1230
+inline constexpr auto RTCM_3X_TYPE1230_UART1                             = CFG_MSGOUT_RTCM_3X_TYPE1230_UART1;                 //!< RTCM-3X-TYPE1230 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE1230_UART2                             = CFG_MSGOUT_RTCM_3X_TYPE1230_UART2;                 //!< RTCM-3X-TYPE1230 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE1230_SPI                               = CFG_MSGOUT_RTCM_3X_TYPE1230_SPI;                   //!< RTCM-3X-TYPE1230 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE1230_I2C                               = CFG_MSGOUT_RTCM_3X_TYPE1230_I2C;                   //!< RTCM-3X-TYPE1230 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE1230_USB                               = CFG_MSGOUT_RTCM_3X_TYPE1230_USB;                   //!< RTCM-3X-TYPE1230 rate on port USB
+
+// RTCM-3X-TYPE4072_0
+inline constexpr auto RTCM_3X_TYPE4072_0_UART1                           = CFG_MSGOUT_RTCM_3X_TYPE4072_0_UART1;               //!< RTCM-3X-TYPE4072_0 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE4072_0_UART2                           = CFG_MSGOUT_RTCM_3X_TYPE4072_0_UART2;               //!< RTCM-3X-TYPE4072_0 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE4072_0_SPI                             = CFG_MSGOUT_RTCM_3X_TYPE4072_0_SPI;                 //!< RTCM-3X-TYPE4072_0 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE4072_0_I2C                             = CFG_MSGOUT_RTCM_3X_TYPE4072_0_I2C;                 //!< RTCM-3X-TYPE4072_0 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE4072_0_USB                             = CFG_MSGOUT_RTCM_3X_TYPE4072_0_USB;                 //!< RTCM-3X-TYPE4072_0 rate on port USB
+
+// RTCM-3X-TYPE4072_1
+inline constexpr auto RTCM_3X_TYPE4072_1_UART1                           = CFG_MSGOUT_RTCM_3X_TYPE4072_1_UART1;               //!< RTCM-3X-TYPE4072_1 rate on port UART1
+inline constexpr auto RTCM_3X_TYPE4072_1_UART2                           = CFG_MSGOUT_RTCM_3X_TYPE4072_1_UART2;               //!< RTCM-3X-TYPE4072_1 rate on port UART2
+inline constexpr auto RTCM_3X_TYPE4072_1_SPI                             = CFG_MSGOUT_RTCM_3X_TYPE4072_1_SPI;                 //!< RTCM-3X-TYPE4072_1 rate on port SPI
+inline constexpr auto RTCM_3X_TYPE4072_1_I2C                             = CFG_MSGOUT_RTCM_3X_TYPE4072_1_I2C;                 //!< RTCM-3X-TYPE4072_1 rate on port I2C
+inline constexpr auto RTCM_3X_TYPE4072_1_USB                             = CFG_MSGOUT_RTCM_3X_TYPE4072_1_USB;                 //!< RTCM-3X-TYPE4072_1 rate on port USB
+
+// UBX-ESF-ALG
+inline constexpr auto UBX_ESF_ALG_UART1                                  = CFG_MSGOUT_UBX_ESF_ALG_UART1;                      //!< UBX-ESF-ALG rate on port UART1
+inline constexpr auto UBX_ESF_ALG_UART2                                  = CFG_MSGOUT_UBX_ESF_ALG_UART2;                      //!< UBX-ESF-ALG rate on port UART2
+inline constexpr auto UBX_ESF_ALG_SPI                                    = CFG_MSGOUT_UBX_ESF_ALG_SPI;                        //!< UBX-ESF-ALG rate on port SPI
+inline constexpr auto UBX_ESF_ALG_I2C                                    = CFG_MSGOUT_UBX_ESF_ALG_I2C;                        //!< UBX-ESF-ALG rate on port I2C
+inline constexpr auto UBX_ESF_ALG_USB                                    = CFG_MSGOUT_UBX_ESF_ALG_USB;                        //!< UBX-ESF-ALG rate on port USB
+
+// UBX-ESF-INS
+inline constexpr auto UBX_ESF_INS_UART1                                  = CFG_MSGOUT_UBX_ESF_INS_UART1;                      //!< UBX-ESF-INS rate on port UART1
+inline constexpr auto UBX_ESF_INS_UART2                                  = CFG_MSGOUT_UBX_ESF_INS_UART2;                      //!< UBX-ESF-INS rate on port UART2
+inline constexpr auto UBX_ESF_INS_SPI                                    = CFG_MSGOUT_UBX_ESF_INS_SPI;                        //!< UBX-ESF-INS rate on port SPI
+inline constexpr auto UBX_ESF_INS_I2C                                    = CFG_MSGOUT_UBX_ESF_INS_I2C;                        //!< UBX-ESF-INS rate on port I2C
+inline constexpr auto UBX_ESF_INS_USB                                    = CFG_MSGOUT_UBX_ESF_INS_USB;                        //!< UBX-ESF-INS rate on port USB
+
+// UBX-ESF-MEAS
+inline constexpr auto UBX_ESF_MEAS_UART1                                 = CFG_MSGOUT_UBX_ESF_MEAS_UART1;                     //!< UBX-ESF-MEAS rate on port UART1
+inline constexpr auto UBX_ESF_MEAS_UART2                                 = CFG_MSGOUT_UBX_ESF_MEAS_UART2;                     //!< UBX-ESF-MEAS rate on port UART2
+inline constexpr auto UBX_ESF_MEAS_SPI                                   = CFG_MSGOUT_UBX_ESF_MEAS_SPI;                       //!< UBX-ESF-MEAS rate on port SPI
+inline constexpr auto UBX_ESF_MEAS_I2C                                   = CFG_MSGOUT_UBX_ESF_MEAS_I2C;                       //!< UBX-ESF-MEAS rate on port I2C
+inline constexpr auto UBX_ESF_MEAS_USB                                   = CFG_MSGOUT_UBX_ESF_MEAS_USB;                       //!< UBX-ESF-MEAS rate on port USB
+
+// UBX-ESF-RAW
+inline constexpr auto UBX_ESF_RAW_UART1                                  = CFG_MSGOUT_UBX_ESF_RAW_UART1;                      //!< UBX-ESF-RAW rate on port UART1
+inline constexpr auto UBX_ESF_RAW_UART2                                  = CFG_MSGOUT_UBX_ESF_RAW_UART2;                      //!< UBX-ESF-RAW rate on port UART2
+inline constexpr auto UBX_ESF_RAW_SPI                                    = CFG_MSGOUT_UBX_ESF_RAW_SPI;                        //!< UBX-ESF-RAW rate on port SPI
+inline constexpr auto UBX_ESF_RAW_I2C                                    = CFG_MSGOUT_UBX_ESF_RAW_I2C;                        //!< UBX-ESF-RAW rate on port I2C
+inline constexpr auto UBX_ESF_RAW_USB                                    = CFG_MSGOUT_UBX_ESF_RAW_USB;                        //!< UBX-ESF-RAW rate on port USB
+
+// UBX-ESF-STATUS
+inline constexpr auto UBX_ESF_STATUS_UART1                               = CFG_MSGOUT_UBX_ESF_STATUS_UART1;                   //!< UBX-ESF-STATUS rate on port UART1
+inline constexpr auto UBX_ESF_STATUS_UART2                               = CFG_MSGOUT_UBX_ESF_STATUS_UART2;                   //!< UBX-ESF-STATUS rate on port UART2
+inline constexpr auto UBX_ESF_STATUS_SPI                                 = CFG_MSGOUT_UBX_ESF_STATUS_SPI;                     //!< UBX-ESF-STATUS rate on port SPI
+inline constexpr auto UBX_ESF_STATUS_I2C                                 = CFG_MSGOUT_UBX_ESF_STATUS_I2C;                     //!< UBX-ESF-STATUS rate on port I2C
+inline constexpr auto UBX_ESF_STATUS_USB                                 = CFG_MSGOUT_UBX_ESF_STATUS_USB;                     //!< UBX-ESF-STATUS rate on port USB
+
+// UBX-LOG-INFO
+inline constexpr auto UBX_LOG_INFO_UART1                                 = CFG_MSGOUT_UBX_LOG_INFO_UART1;                     //!< UBX-LOG-INFO rate on port UART1
+inline constexpr auto UBX_LOG_INFO_UART2                                 = CFG_MSGOUT_UBX_LOG_INFO_UART2;                     //!< UBX-LOG-INFO rate on port UART2
+inline constexpr auto UBX_LOG_INFO_SPI                                   = CFG_MSGOUT_UBX_LOG_INFO_SPI;                       //!< UBX-LOG-INFO rate on port SPI
+inline constexpr auto UBX_LOG_INFO_I2C                                   = CFG_MSGOUT_UBX_LOG_INFO_I2C;                       //!< UBX-LOG-INFO rate on port I2C
+inline constexpr auto UBX_LOG_INFO_USB                                   = CFG_MSGOUT_UBX_LOG_INFO_USB;                       //!< UBX-LOG-INFO rate on port USB
+
+// UBX-MON-COMMS
+inline constexpr auto UBX_MON_COMMS_UART1                                = CFG_MSGOUT_UBX_MON_COMMS_UART1;                    //!< UBX-MON-COMMS rate on port UART1
+inline constexpr auto UBX_MON_COMMS_UART2                                = CFG_MSGOUT_UBX_MON_COMMS_UART2;                    //!< UBX-MON-COMMS rate on port UART2
+inline constexpr auto UBX_MON_COMMS_SPI                                  = CFG_MSGOUT_UBX_MON_COMMS_SPI;                      //!< UBX-MON-COMMS rate on port SPI
+inline constexpr auto UBX_MON_COMMS_I2C                                  = CFG_MSGOUT_UBX_MON_COMMS_I2C;                      //!< UBX-MON-COMMS rate on port I2C
+inline constexpr auto UBX_MON_COMMS_USB                                  = CFG_MSGOUT_UBX_MON_COMMS_USB;                      //!< UBX-MON-COMMS rate on port USB
+
+// UBX-MON-HW
+inline constexpr auto UBX_MON_HW_UART1                                   = CFG_MSGOUT_UBX_MON_HW_UART1;                       //!< UBX-MON-HW rate on port UART1
+inline constexpr auto UBX_MON_HW_UART2                                   = CFG_MSGOUT_UBX_MON_HW_UART2;                       //!< UBX-MON-HW rate on port UART2
+inline constexpr auto UBX_MON_HW_SPI                                     = CFG_MSGOUT_UBX_MON_HW_SPI;                         //!< UBX-MON-HW rate on port SPI
+inline constexpr auto UBX_MON_HW_I2C                                     = CFG_MSGOUT_UBX_MON_HW_I2C;                         //!< UBX-MON-HW rate on port I2C
+inline constexpr auto UBX_MON_HW_USB                                     = CFG_MSGOUT_UBX_MON_HW_USB;                         //!< UBX-MON-HW rate on port USB
+
+// UBX-MON-HW2
+inline constexpr auto UBX_MON_HW2_UART1                                  = CFG_MSGOUT_UBX_MON_HW2_UART1;                      //!< UBX-MON-HW2 rate on port UART1
+inline constexpr auto UBX_MON_HW2_UART2                                  = CFG_MSGOUT_UBX_MON_HW2_UART2;                      //!< UBX-MON-HW2 rate on port UART2
+inline constexpr auto UBX_MON_HW2_SPI                                    = CFG_MSGOUT_UBX_MON_HW2_SPI;                        //!< UBX-MON-HW2 rate on port SPI
+inline constexpr auto UBX_MON_HW2_I2C                                    = CFG_MSGOUT_UBX_MON_HW2_I2C;                        //!< UBX-MON-HW2 rate on port I2C
+inline constexpr auto UBX_MON_HW2_USB                                    = CFG_MSGOUT_UBX_MON_HW2_USB;                        //!< UBX-MON-HW2 rate on port USB
+
+// UBX-MON-HW3
+inline constexpr auto UBX_MON_HW3_UART1                                  = CFG_MSGOUT_UBX_MON_HW3_UART1;                      //!< UBX-MON-HW3 rate on port UART1
+inline constexpr auto UBX_MON_HW3_UART2                                  = CFG_MSGOUT_UBX_MON_HW3_UART2;                      //!< UBX-MON-HW3 rate on port UART2
+inline constexpr auto UBX_MON_HW3_SPI                                    = CFG_MSGOUT_UBX_MON_HW3_SPI;                        //!< UBX-MON-HW3 rate on port SPI
+inline constexpr auto UBX_MON_HW3_I2C                                    = CFG_MSGOUT_UBX_MON_HW3_I2C;                        //!< UBX-MON-HW3 rate on port I2C
+inline constexpr auto UBX_MON_HW3_USB                                    = CFG_MSGOUT_UBX_MON_HW3_USB;                        //!< UBX-MON-HW3 rate on port USB
+
+// UBX-MON-IO
+inline constexpr auto UBX_MON_IO_UART1                                   = CFG_MSGOUT_UBX_MON_IO_UART1;                       //!< UBX-MON-IO rate on port UART1
+inline constexpr auto UBX_MON_IO_UART2                                   = CFG_MSGOUT_UBX_MON_IO_UART2;                       //!< UBX-MON-IO rate on port UART2
+inline constexpr auto UBX_MON_IO_SPI                                     = CFG_MSGOUT_UBX_MON_IO_SPI;                         //!< UBX-MON-IO rate on port SPI
+inline constexpr auto UBX_MON_IO_I2C                                     = CFG_MSGOUT_UBX_MON_IO_I2C;                         //!< UBX-MON-IO rate on port I2C
+inline constexpr auto UBX_MON_IO_USB                                     = CFG_MSGOUT_UBX_MON_IO_USB;                         //!< UBX-MON-IO rate on port USB
+
+// UBX-MON-MSGPP
+inline constexpr auto UBX_MON_MSGPP_UART1                                = CFG_MSGOUT_UBX_MON_MSGPP_UART1;                    //!< UBX-MON-MSGPP rate on port UART1
+inline constexpr auto UBX_MON_MSGPP_UART2                                = CFG_MSGOUT_UBX_MON_MSGPP_UART2;                    //!< UBX-MON-MSGPP rate on port UART2
+inline constexpr auto UBX_MON_MSGPP_SPI                                  = CFG_MSGOUT_UBX_MON_MSGPP_SPI;                      //!< UBX-MON-MSGPP rate on port SPI
+inline constexpr auto UBX_MON_MSGPP_I2C                                  = CFG_MSGOUT_UBX_MON_MSGPP_I2C;                      //!< UBX-MON-MSGPP rate on port I2C
+inline constexpr auto UBX_MON_MSGPP_USB                                  = CFG_MSGOUT_UBX_MON_MSGPP_USB;                      //!< UBX-MON-MSGPP rate on port USB
+
+// UBX-MON-RF
+inline constexpr auto UBX_MON_RF_UART1                                   = CFG_MSGOUT_UBX_MON_RF_UART1;                       //!< UBX-MON-RF rate on port UART1
+inline constexpr auto UBX_MON_RF_UART2                                   = CFG_MSGOUT_UBX_MON_RF_UART2;                       //!< UBX-MON-RF rate on port UART2
+inline constexpr auto UBX_MON_RF_SPI                                     = CFG_MSGOUT_UBX_MON_RF_SPI;                         //!< UBX-MON-RF rate on port SPI
+inline constexpr auto UBX_MON_RF_I2C                                     = CFG_MSGOUT_UBX_MON_RF_I2C;                         //!< UBX-MON-RF rate on port I2C
+inline constexpr auto UBX_MON_RF_USB                                     = CFG_MSGOUT_UBX_MON_RF_USB;                         //!< UBX-MON-RF rate on port USB
+
+// UBX-MON-RXBUF
+inline constexpr auto UBX_MON_RXBUF_UART1                                = CFG_MSGOUT_UBX_MON_RXBUF_UART1;                    //!< UBX-MON-RXBUF rate on port UART1
+inline constexpr auto UBX_MON_RXBUF_UART2                                = CFG_MSGOUT_UBX_MON_RXBUF_UART2;                    //!< UBX-MON-RXBUF rate on port UART2
+inline constexpr auto UBX_MON_RXBUF_SPI                                  = CFG_MSGOUT_UBX_MON_RXBUF_SPI;                      //!< UBX-MON-RXBUF rate on port SPI
+inline constexpr auto UBX_MON_RXBUF_I2C                                  = CFG_MSGOUT_UBX_MON_RXBUF_I2C;                      //!< UBX-MON-RXBUF rate on port I2C
+inline constexpr auto UBX_MON_RXBUF_USB                                  = CFG_MSGOUT_UBX_MON_RXBUF_USB;                      //!< UBX-MON-RXBUF rate on port USB
+
+// UBX-MON-RXR
+inline constexpr auto UBX_MON_RXR_UART1                                  = CFG_MSGOUT_UBX_MON_RXR_UART1;                      //!< UBX-MON-RXR rate on port UART1
+inline constexpr auto UBX_MON_RXR_UART2                                  = CFG_MSGOUT_UBX_MON_RXR_UART2;                      //!< UBX-MON-RXR rate on port UART2
+inline constexpr auto UBX_MON_RXR_SPI                                    = CFG_MSGOUT_UBX_MON_RXR_SPI;                        //!< UBX-MON-RXR rate on port SPI
+inline constexpr auto UBX_MON_RXR_I2C                                    = CFG_MSGOUT_UBX_MON_RXR_I2C;                        //!< UBX-MON-RXR rate on port I2C
+inline constexpr auto UBX_MON_RXR_USB                                    = CFG_MSGOUT_UBX_MON_RXR_USB;                        //!< UBX-MON-RXR rate on port USB
+
+// UBX-MON-SPAN
+inline constexpr auto UBX_MON_SPAN_UART1                                 = CFG_MSGOUT_UBX_MON_SPAN_UART1;                     //!< UBX-MON-SPAN rate on port UART1
+inline constexpr auto UBX_MON_SPAN_UART2                                 = CFG_MSGOUT_UBX_MON_SPAN_UART2;                     //!< UBX-MON-SPAN rate on port UART2
+inline constexpr auto UBX_MON_SPAN_SPI                                   = CFG_MSGOUT_UBX_MON_SPAN_SPI;                       //!< UBX-MON-SPAN rate on port SPI
+inline constexpr auto UBX_MON_SPAN_I2C                                   = CFG_MSGOUT_UBX_MON_SPAN_I2C;                       //!< UBX-MON-SPAN rate on port I2C
+inline constexpr auto UBX_MON_SPAN_USB                                   = CFG_MSGOUT_UBX_MON_SPAN_USB;                       //!< UBX-MON-SPAN rate on port USB
+
+// UBX-MON-SYS
+inline constexpr auto UBX_MON_SYS_UART1                                  = CFG_MSGOUT_UBX_MON_SYS_UART1;                      //!< UBX-MON-SYS rate on port UART1
+inline constexpr auto UBX_MON_SYS_UART2                                  = CFG_MSGOUT_UBX_MON_SYS_UART2;                      //!< UBX-MON-SYS rate on port UART2
+inline constexpr auto UBX_MON_SYS_SPI                                    = CFG_MSGOUT_UBX_MON_SYS_SPI;                        //!< UBX-MON-SYS rate on port SPI
+inline constexpr auto UBX_MON_SYS_I2C                                    = CFG_MSGOUT_UBX_MON_SYS_I2C;                        //!< UBX-MON-SYS rate on port I2C
+inline constexpr auto UBX_MON_SYS_USB                                    = CFG_MSGOUT_UBX_MON_SYS_USB;                        //!< UBX-MON-SYS rate on port USB
+
+// UBX-MON-TEMP
+inline constexpr auto UBX_MON_TEMP_UART1                                 = CFG_MSGOUT_UBX_MON_TEMP_UART1;                     //!< UBX-MON-TEMP rate on port UART1
+inline constexpr auto UBX_MON_TEMP_UART2                                 = CFG_MSGOUT_UBX_MON_TEMP_UART2;                     //!< UBX-MON-TEMP rate on port UART2
+inline constexpr auto UBX_MON_TEMP_SPI                                   = CFG_MSGOUT_UBX_MON_TEMP_SPI;                       //!< UBX-MON-TEMP rate on port SPI
+inline constexpr auto UBX_MON_TEMP_I2C                                   = CFG_MSGOUT_UBX_MON_TEMP_I2C;                       //!< UBX-MON-TEMP rate on port I2C
+inline constexpr auto UBX_MON_TEMP_USB                                   = CFG_MSGOUT_UBX_MON_TEMP_USB;                       //!< UBX-MON-TEMP rate on port USB
+
+// UBX-MON-TXBUF
+inline constexpr auto UBX_MON_TXBUF_UART1                                = CFG_MSGOUT_UBX_MON_TXBUF_UART1;                    //!< UBX-MON-TXBUF rate on port UART1
+inline constexpr auto UBX_MON_TXBUF_UART2                                = CFG_MSGOUT_UBX_MON_TXBUF_UART2;                    //!< UBX-MON-TXBUF rate on port UART2
+inline constexpr auto UBX_MON_TXBUF_SPI                                  = CFG_MSGOUT_UBX_MON_TXBUF_SPI;                      //!< UBX-MON-TXBUF rate on port SPI
+inline constexpr auto UBX_MON_TXBUF_I2C                                  = CFG_MSGOUT_UBX_MON_TXBUF_I2C;                      //!< UBX-MON-TXBUF rate on port I2C
+inline constexpr auto UBX_MON_TXBUF_USB                                  = CFG_MSGOUT_UBX_MON_TXBUF_USB;                      //!< UBX-MON-TXBUF rate on port USB
+
+// UBX-NAV-AOPSTATUS
+inline constexpr auto UBX_NAV_AOPSTATUS_UART1                            = CFG_MSGOUT_UBX_NAV_AOPSTATUS_UART1;                //!< UBX-NAV-AOPSTATUS rate on port UART1
+inline constexpr auto UBX_NAV_AOPSTATUS_UART2                            = CFG_MSGOUT_UBX_NAV_AOPSTATUS_UART2;                //!< UBX-NAV-AOPSTATUS rate on port UART2
+inline constexpr auto UBX_NAV_AOPSTATUS_SPI                              = CFG_MSGOUT_UBX_NAV_AOPSTATUS_SPI;                  //!< UBX-NAV-AOPSTATUS rate on port SPI
+inline constexpr auto UBX_NAV_AOPSTATUS_I2C                              = CFG_MSGOUT_UBX_NAV_AOPSTATUS_I2C;                  //!< UBX-NAV-AOPSTATUS rate on port I2C
+inline constexpr auto UBX_NAV_AOPSTATUS_USB                              = CFG_MSGOUT_UBX_NAV_AOPSTATUS_USB;                  //!< UBX-NAV-AOPSTATUS rate on port USB
+
+// UBX-NAV-ATT
+inline constexpr auto UBX_NAV_ATT_UART1                                  = CFG_MSGOUT_UBX_NAV_ATT_UART1;                      //!< UBX-NAV-ATT rate on port UART1
+inline constexpr auto UBX_NAV_ATT_UART2                                  = CFG_MSGOUT_UBX_NAV_ATT_UART2;                      //!< UBX-NAV-ATT rate on port UART2
+inline constexpr auto UBX_NAV_ATT_SPI                                    = CFG_MSGOUT_UBX_NAV_ATT_SPI;                        //!< UBX-NAV-ATT rate on port SPI
+inline constexpr auto UBX_NAV_ATT_I2C                                    = CFG_MSGOUT_UBX_NAV_ATT_I2C;                        //!< UBX-NAV-ATT rate on port I2C
+inline constexpr auto UBX_NAV_ATT_USB                                    = CFG_MSGOUT_UBX_NAV_ATT_USB;                        //!< UBX-NAV-ATT rate on port USB
+
+// UBX-NAV-CLOCK
+inline constexpr auto UBX_NAV_CLOCK_UART1                                = CFG_MSGOUT_UBX_NAV_CLOCK_UART1;                    //!< UBX-NAV-CLOCK rate on port UART1
+inline constexpr auto UBX_NAV_CLOCK_UART2                                = CFG_MSGOUT_UBX_NAV_CLOCK_UART2;                    //!< UBX-NAV-CLOCK rate on port UART2
+inline constexpr auto UBX_NAV_CLOCK_SPI                                  = CFG_MSGOUT_UBX_NAV_CLOCK_SPI;                      //!< UBX-NAV-CLOCK rate on port SPI
+inline constexpr auto UBX_NAV_CLOCK_I2C                                  = CFG_MSGOUT_UBX_NAV_CLOCK_I2C;                      //!< UBX-NAV-CLOCK rate on port I2C
+inline constexpr auto UBX_NAV_CLOCK_USB                                  = CFG_MSGOUT_UBX_NAV_CLOCK_USB;                      //!< UBX-NAV-CLOCK rate on port USB
+
+// UBX-NAV-COV
+inline constexpr auto UBX_NAV_COV_UART1                                  = CFG_MSGOUT_UBX_NAV_COV_UART1;                      //!< UBX-NAV-COV rate on port UART1
+inline constexpr auto UBX_NAV_COV_UART2                                  = CFG_MSGOUT_UBX_NAV_COV_UART2;                      //!< UBX-NAV-COV rate on port UART2
+inline constexpr auto UBX_NAV_COV_SPI                                    = CFG_MSGOUT_UBX_NAV_COV_SPI;                        //!< UBX-NAV-COV rate on port SPI
+inline constexpr auto UBX_NAV_COV_I2C                                    = CFG_MSGOUT_UBX_NAV_COV_I2C;                        //!< UBX-NAV-COV rate on port I2C
+inline constexpr auto UBX_NAV_COV_USB                                    = CFG_MSGOUT_UBX_NAV_COV_USB;                        //!< UBX-NAV-COV rate on port USB
+
+// UBX-NAV-DOP
+inline constexpr auto UBX_NAV_DOP_UART1                                  = CFG_MSGOUT_UBX_NAV_DOP_UART1;                      //!< UBX-NAV-DOP rate on port UART1
+inline constexpr auto UBX_NAV_DOP_UART2                                  = CFG_MSGOUT_UBX_NAV_DOP_UART2;                      //!< UBX-NAV-DOP rate on port UART2
+inline constexpr auto UBX_NAV_DOP_SPI                                    = CFG_MSGOUT_UBX_NAV_DOP_SPI;                        //!< UBX-NAV-DOP rate on port SPI
+inline constexpr auto UBX_NAV_DOP_I2C                                    = CFG_MSGOUT_UBX_NAV_DOP_I2C;                        //!< UBX-NAV-DOP rate on port I2C
+inline constexpr auto UBX_NAV_DOP_USB                                    = CFG_MSGOUT_UBX_NAV_DOP_USB;                        //!< UBX-NAV-DOP rate on port USB
+
+// UBX-NAV-EELL
+inline constexpr auto UBX_NAV_EELL_UART1                                 = CFG_MSGOUT_UBX_NAV_EELL_UART1;                     //!< UBX-NAV-EELL rate on port UART1
+inline constexpr auto UBX_NAV_EELL_UART2                                 = CFG_MSGOUT_UBX_NAV_EELL_UART2;                     //!< UBX-NAV-EELL rate on port UART2
+inline constexpr auto UBX_NAV_EELL_SPI                                   = CFG_MSGOUT_UBX_NAV_EELL_SPI;                       //!< UBX-NAV-EELL rate on port SPI
+inline constexpr auto UBX_NAV_EELL_I2C                                   = CFG_MSGOUT_UBX_NAV_EELL_I2C;                       //!< UBX-NAV-EELL rate on port I2C
+inline constexpr auto UBX_NAV_EELL_USB                                   = CFG_MSGOUT_UBX_NAV_EELL_USB;                       //!< UBX-NAV-EELL rate on port USB
+
+// UBX-NAV-EOE
+inline constexpr auto UBX_NAV_EOE_UART1                                  = CFG_MSGOUT_UBX_NAV_EOE_UART1;                      //!< UBX-NAV-EOE rate on port UART1
+inline constexpr auto UBX_NAV_EOE_UART2                                  = CFG_MSGOUT_UBX_NAV_EOE_UART2;                      //!< UBX-NAV-EOE rate on port UART2
+inline constexpr auto UBX_NAV_EOE_SPI                                    = CFG_MSGOUT_UBX_NAV_EOE_SPI;                        //!< UBX-NAV-EOE rate on port SPI
+inline constexpr auto UBX_NAV_EOE_I2C                                    = CFG_MSGOUT_UBX_NAV_EOE_I2C;                        //!< UBX-NAV-EOE rate on port I2C
+inline constexpr auto UBX_NAV_EOE_USB                                    = CFG_MSGOUT_UBX_NAV_EOE_USB;                        //!< UBX-NAV-EOE rate on port USB
+
+// UBX-NAV-GEOFENCE
+inline constexpr auto UBX_NAV_GEOFENCE_UART1                             = CFG_MSGOUT_UBX_NAV_GEOFENCE_UART1;                 //!< UBX-NAV-GEOFENCE rate on port UART1
+inline constexpr auto UBX_NAV_GEOFENCE_UART2                             = CFG_MSGOUT_UBX_NAV_GEOFENCE_UART2;                 //!< UBX-NAV-GEOFENCE rate on port UART2
+inline constexpr auto UBX_NAV_GEOFENCE_SPI                               = CFG_MSGOUT_UBX_NAV_GEOFENCE_SPI;                   //!< UBX-NAV-GEOFENCE rate on port SPI
+inline constexpr auto UBX_NAV_GEOFENCE_I2C                               = CFG_MSGOUT_UBX_NAV_GEOFENCE_I2C;                   //!< UBX-NAV-GEOFENCE rate on port I2C
+inline constexpr auto UBX_NAV_GEOFENCE_USB                               = CFG_MSGOUT_UBX_NAV_GEOFENCE_USB;                   //!< UBX-NAV-GEOFENCE rate on port USB
+
+// UBX-NAV-HPPOSECEF
+inline constexpr auto UBX_NAV_HPPOSECEF_UART1                            = CFG_MSGOUT_UBX_NAV_HPPOSECEF_UART1;                //!< UBX-NAV-HPPOSECEF rate on port UART1
+inline constexpr auto UBX_NAV_HPPOSECEF_UART2                            = CFG_MSGOUT_UBX_NAV_HPPOSECEF_UART2;                //!< UBX-NAV-HPPOSECEF rate on port UART2
+inline constexpr auto UBX_NAV_HPPOSECEF_SPI                              = CFG_MSGOUT_UBX_NAV_HPPOSECEF_SPI;                  //!< UBX-NAV-HPPOSECEF rate on port SPI
+inline constexpr auto UBX_NAV_HPPOSECEF_I2C                              = CFG_MSGOUT_UBX_NAV_HPPOSECEF_I2C;                  //!< UBX-NAV-HPPOSECEF rate on port I2C
+inline constexpr auto UBX_NAV_HPPOSECEF_USB                              = CFG_MSGOUT_UBX_NAV_HPPOSECEF_USB;                  //!< UBX-NAV-HPPOSECEF rate on port USB
+
+// UBX-NAV-HPPOSLLH
+inline constexpr auto UBX_NAV_HPPOSLLH_UART1                             = CFG_MSGOUT_UBX_NAV_HPPOSLLH_UART1;                 //!< UBX-NAV-HPPOSLLH rate on port UART1
+inline constexpr auto UBX_NAV_HPPOSLLH_UART2                             = CFG_MSGOUT_UBX_NAV_HPPOSLLH_UART2;                 //!< UBX-NAV-HPPOSLLH rate on port UART2
+inline constexpr auto UBX_NAV_HPPOSLLH_SPI                               = CFG_MSGOUT_UBX_NAV_HPPOSLLH_SPI;                   //!< UBX-NAV-HPPOSLLH rate on port SPI
+inline constexpr auto UBX_NAV_HPPOSLLH_I2C                               = CFG_MSGOUT_UBX_NAV_HPPOSLLH_I2C;                   //!< UBX-NAV-HPPOSLLH rate on port I2C
+inline constexpr auto UBX_NAV_HPPOSLLH_USB                               = CFG_MSGOUT_UBX_NAV_HPPOSLLH_USB;                   //!< UBX-NAV-HPPOSLLH rate on port USB
+
+// UBX-NAV-ODO
+inline constexpr auto UBX_NAV_ODO_UART1                                  = CFG_MSGOUT_UBX_NAV_ODO_UART1;                      //!< UBX-NAV-ODO rate on port UART1
+inline constexpr auto UBX_NAV_ODO_UART2                                  = CFG_MSGOUT_UBX_NAV_ODO_UART2;                      //!< UBX-NAV-ODO rate on port UART2
+inline constexpr auto UBX_NAV_ODO_SPI                                    = CFG_MSGOUT_UBX_NAV_ODO_SPI;                        //!< UBX-NAV-ODO rate on port SPI
+inline constexpr auto UBX_NAV_ODO_I2C                                    = CFG_MSGOUT_UBX_NAV_ODO_I2C;                        //!< UBX-NAV-ODO rate on port I2C
+inline constexpr auto UBX_NAV_ODO_USB                                    = CFG_MSGOUT_UBX_NAV_ODO_USB;                        //!< UBX-NAV-ODO rate on port USB
+
+// UBX-NAV-ORB
+inline constexpr auto UBX_NAV_ORB_UART1                                  = CFG_MSGOUT_UBX_NAV_ORB_UART1;                      //!< UBX-NAV-ORB rate on port UART1
+inline constexpr auto UBX_NAV_ORB_UART2                                  = CFG_MSGOUT_UBX_NAV_ORB_UART2;                      //!< UBX-NAV-ORB rate on port UART2
+inline constexpr auto UBX_NAV_ORB_SPI                                    = CFG_MSGOUT_UBX_NAV_ORB_SPI;                        //!< UBX-NAV-ORB rate on port SPI
+inline constexpr auto UBX_NAV_ORB_I2C                                    = CFG_MSGOUT_UBX_NAV_ORB_I2C;                        //!< UBX-NAV-ORB rate on port I2C
+inline constexpr auto UBX_NAV_ORB_USB                                    = CFG_MSGOUT_UBX_NAV_ORB_USB;                        //!< UBX-NAV-ORB rate on port USB
+
+// UBX-NAV-PL
+inline constexpr auto UBX_NAV_PL_UART1                                   = CFG_MSGOUT_UBX_NAV_PL_UART1;                       //!< UBX-NAV-PL rate on port UART1
+inline constexpr auto UBX_NAV_PL_UART2                                   = CFG_MSGOUT_UBX_NAV_PL_UART2;                       //!< UBX-NAV-PL rate on port UART2
+inline constexpr auto UBX_NAV_PL_SPI                                     = CFG_MSGOUT_UBX_NAV_PL_SPI;                         //!< UBX-NAV-PL rate on port SPI
+inline constexpr auto UBX_NAV_PL_I2C                                     = CFG_MSGOUT_UBX_NAV_PL_I2C;                         //!< UBX-NAV-PL rate on port I2C
+inline constexpr auto UBX_NAV_PL_USB                                     = CFG_MSGOUT_UBX_NAV_PL_USB;                         //!< UBX-NAV-PL rate on port USB
+
+// UBX-NAV-POSECEF
+inline constexpr auto UBX_NAV_POSECEF_UART1                              = CFG_MSGOUT_UBX_NAV_POSECEF_UART1;                  //!< UBX-NAV-POSECEF rate on port UART1
+inline constexpr auto UBX_NAV_POSECEF_UART2                              = CFG_MSGOUT_UBX_NAV_POSECEF_UART2;                  //!< UBX-NAV-POSECEF rate on port UART2
+inline constexpr auto UBX_NAV_POSECEF_SPI                                = CFG_MSGOUT_UBX_NAV_POSECEF_SPI;                    //!< UBX-NAV-POSECEF rate on port SPI
+inline constexpr auto UBX_NAV_POSECEF_I2C                                = CFG_MSGOUT_UBX_NAV_POSECEF_I2C;                    //!< UBX-NAV-POSECEF rate on port I2C
+inline constexpr auto UBX_NAV_POSECEF_USB                                = CFG_MSGOUT_UBX_NAV_POSECEF_USB;                    //!< UBX-NAV-POSECEF rate on port USB
+
+// UBX-NAV-POSLLH
+inline constexpr auto UBX_NAV_POSLLH_UART1                               = CFG_MSGOUT_UBX_NAV_POSLLH_UART1;                   //!< UBX-NAV-POSLLH rate on port UART1
+inline constexpr auto UBX_NAV_POSLLH_UART2                               = CFG_MSGOUT_UBX_NAV_POSLLH_UART2;                   //!< UBX-NAV-POSLLH rate on port UART2
+inline constexpr auto UBX_NAV_POSLLH_SPI                                 = CFG_MSGOUT_UBX_NAV_POSLLH_SPI;                     //!< UBX-NAV-POSLLH rate on port SPI
+inline constexpr auto UBX_NAV_POSLLH_I2C                                 = CFG_MSGOUT_UBX_NAV_POSLLH_I2C;                     //!< UBX-NAV-POSLLH rate on port I2C
+inline constexpr auto UBX_NAV_POSLLH_USB                                 = CFG_MSGOUT_UBX_NAV_POSLLH_USB;                     //!< UBX-NAV-POSLLH rate on port USB
+
+// UBX-NAV-PVAT
+inline constexpr auto UBX_NAV_PVAT_UART1                                 = CFG_MSGOUT_UBX_NAV_PVAT_UART1;                     //!< UBX-NAV-PVAT rate on port UART1
+inline constexpr auto UBX_NAV_PVAT_UART2                                 = CFG_MSGOUT_UBX_NAV_PVAT_UART2;                     //!< UBX-NAV-PVAT rate on port UART2
+inline constexpr auto UBX_NAV_PVAT_SPI                                   = CFG_MSGOUT_UBX_NAV_PVAT_SPI;                       //!< UBX-NAV-PVAT rate on port SPI
+inline constexpr auto UBX_NAV_PVAT_I2C                                   = CFG_MSGOUT_UBX_NAV_PVAT_I2C;                       //!< UBX-NAV-PVAT rate on port I2C
+inline constexpr auto UBX_NAV_PVAT_USB                                   = CFG_MSGOUT_UBX_NAV_PVAT_USB;                       //!< UBX-NAV-PVAT rate on port USB
+
+// UBX-NAV-PVT
+inline constexpr auto UBX_NAV_PVT_UART1                                  = CFG_MSGOUT_UBX_NAV_PVT_UART1;                      //!< UBX-NAV-PVT rate on port UART1
+inline constexpr auto UBX_NAV_PVT_UART2                                  = CFG_MSGOUT_UBX_NAV_PVT_UART2;                      //!< UBX-NAV-PVT rate on port UART2
+inline constexpr auto UBX_NAV_PVT_SPI                                    = CFG_MSGOUT_UBX_NAV_PVT_SPI;                        //!< UBX-NAV-PVT rate on port SPI
+inline constexpr auto UBX_NAV_PVT_I2C                                    = CFG_MSGOUT_UBX_NAV_PVT_I2C;                        //!< UBX-NAV-PVT rate on port I2C
+inline constexpr auto UBX_NAV_PVT_USB                                    = CFG_MSGOUT_UBX_NAV_PVT_USB;                        //!< UBX-NAV-PVT rate on port USB
+
+// UBX-NAV-RELPOSNED
+inline constexpr auto UBX_NAV_RELPOSNED_UART1                            = CFG_MSGOUT_UBX_NAV_RELPOSNED_UART1;                //!< UBX-NAV-RELPOSNED rate on port UART1
+inline constexpr auto UBX_NAV_RELPOSNED_UART2                            = CFG_MSGOUT_UBX_NAV_RELPOSNED_UART2;                //!< UBX-NAV-RELPOSNED rate on port UART2
+inline constexpr auto UBX_NAV_RELPOSNED_SPI                              = CFG_MSGOUT_UBX_NAV_RELPOSNED_SPI;                  //!< UBX-NAV-RELPOSNED rate on port SPI
+inline constexpr auto UBX_NAV_RELPOSNED_I2C                              = CFG_MSGOUT_UBX_NAV_RELPOSNED_I2C;                  //!< UBX-NAV-RELPOSNED rate on port I2C
+inline constexpr auto UBX_NAV_RELPOSNED_USB                              = CFG_MSGOUT_UBX_NAV_RELPOSNED_USB;                  //!< UBX-NAV-RELPOSNED rate on port USB
+
+// UBX-NAV-SAT
+inline constexpr auto UBX_NAV_SAT_UART1                                  = CFG_MSGOUT_UBX_NAV_SAT_UART1;                      //!< UBX-NAV-SAT rate on port UART1
+inline constexpr auto UBX_NAV_SAT_UART2                                  = CFG_MSGOUT_UBX_NAV_SAT_UART2;                      //!< UBX-NAV-SAT rate on port UART2
+inline constexpr auto UBX_NAV_SAT_SPI                                    = CFG_MSGOUT_UBX_NAV_SAT_SPI;                        //!< UBX-NAV-SAT rate on port SPI
+inline constexpr auto UBX_NAV_SAT_I2C                                    = CFG_MSGOUT_UBX_NAV_SAT_I2C;                        //!< UBX-NAV-SAT rate on port I2C
+inline constexpr auto UBX_NAV_SAT_USB                                    = CFG_MSGOUT_UBX_NAV_SAT_USB;                        //!< UBX-NAV-SAT rate on port USB
+
+// UBX-NAV-SBAS
+inline constexpr auto UBX_NAV_SBAS_UART1                                 = CFG_MSGOUT_UBX_NAV_SBAS_UART1;                     //!< UBX-NAV-SBAS rate on port UART1
+inline constexpr auto UBX_NAV_SBAS_UART2                                 = CFG_MSGOUT_UBX_NAV_SBAS_UART2;                     //!< UBX-NAV-SBAS rate on port UART2
+inline constexpr auto UBX_NAV_SBAS_SPI                                   = CFG_MSGOUT_UBX_NAV_SBAS_SPI;                       //!< UBX-NAV-SBAS rate on port SPI
+inline constexpr auto UBX_NAV_SBAS_I2C                                   = CFG_MSGOUT_UBX_NAV_SBAS_I2C;                       //!< UBX-NAV-SBAS rate on port I2C
+inline constexpr auto UBX_NAV_SBAS_USB                                   = CFG_MSGOUT_UBX_NAV_SBAS_USB;                       //!< UBX-NAV-SBAS rate on port USB
+
+// UBX-NAV-SIG
+inline constexpr auto UBX_NAV_SIG_UART1                                  = CFG_MSGOUT_UBX_NAV_SIG_UART1;                      //!< UBX-NAV-SIG rate on port UART1
+inline constexpr auto UBX_NAV_SIG_UART2                                  = CFG_MSGOUT_UBX_NAV_SIG_UART2;                      //!< UBX-NAV-SIG rate on port UART2
+inline constexpr auto UBX_NAV_SIG_SPI                                    = CFG_MSGOUT_UBX_NAV_SIG_SPI;                        //!< UBX-NAV-SIG rate on port SPI
+inline constexpr auto UBX_NAV_SIG_I2C                                    = CFG_MSGOUT_UBX_NAV_SIG_I2C;                        //!< UBX-NAV-SIG rate on port I2C
+inline constexpr auto UBX_NAV_SIG_USB                                    = CFG_MSGOUT_UBX_NAV_SIG_USB;                        //!< UBX-NAV-SIG rate on port USB
+
+// UBX-NAV-SLAS
+inline constexpr auto UBX_NAV_SLAS_UART1                                 = CFG_MSGOUT_UBX_NAV_SLAS_UART1;                     //!< UBX-NAV-SLAS rate on port UART1
+inline constexpr auto UBX_NAV_SLAS_UART2                                 = CFG_MSGOUT_UBX_NAV_SLAS_UART2;                     //!< UBX-NAV-SLAS rate on port UART2
+inline constexpr auto UBX_NAV_SLAS_SPI                                   = CFG_MSGOUT_UBX_NAV_SLAS_SPI;                       //!< UBX-NAV-SLAS rate on port SPI
+inline constexpr auto UBX_NAV_SLAS_I2C                                   = CFG_MSGOUT_UBX_NAV_SLAS_I2C;                       //!< UBX-NAV-SLAS rate on port I2C
+inline constexpr auto UBX_NAV_SLAS_USB                                   = CFG_MSGOUT_UBX_NAV_SLAS_USB;                       //!< UBX-NAV-SLAS rate on port USB
+
+// UBX-NAV-STATUS
+inline constexpr auto UBX_NAV_STATUS_UART1                               = CFG_MSGOUT_UBX_NAV_STATUS_UART1;                   //!< UBX-NAV-STATUS rate on port UART1
+inline constexpr auto UBX_NAV_STATUS_UART2                               = CFG_MSGOUT_UBX_NAV_STATUS_UART2;                   //!< UBX-NAV-STATUS rate on port UART2
+inline constexpr auto UBX_NAV_STATUS_SPI                                 = CFG_MSGOUT_UBX_NAV_STATUS_SPI;                     //!< UBX-NAV-STATUS rate on port SPI
+inline constexpr auto UBX_NAV_STATUS_I2C                                 = CFG_MSGOUT_UBX_NAV_STATUS_I2C;                     //!< UBX-NAV-STATUS rate on port I2C
+inline constexpr auto UBX_NAV_STATUS_USB                                 = CFG_MSGOUT_UBX_NAV_STATUS_USB;                     //!< UBX-NAV-STATUS rate on port USB
+
+// UBX-NAV-SVIN
+inline constexpr auto UBX_NAV_SVIN_UART1                                 = CFG_MSGOUT_UBX_NAV_SVIN_UART1;                     //!< UBX-NAV-SVIN rate on port UART1
+inline constexpr auto UBX_NAV_SVIN_UART2                                 = CFG_MSGOUT_UBX_NAV_SVIN_UART2;                     //!< UBX-NAV-SVIN rate on port UART2
+inline constexpr auto UBX_NAV_SVIN_SPI                                   = CFG_MSGOUT_UBX_NAV_SVIN_SPI;                       //!< UBX-NAV-SVIN rate on port SPI
+inline constexpr auto UBX_NAV_SVIN_I2C                                   = CFG_MSGOUT_UBX_NAV_SVIN_I2C;                       //!< UBX-NAV-SVIN rate on port I2C
+inline constexpr auto UBX_NAV_SVIN_USB                                   = CFG_MSGOUT_UBX_NAV_SVIN_USB;                       //!< UBX-NAV-SVIN rate on port USB
+
+// UBX-NAV-TIMEBDS
+inline constexpr auto UBX_NAV_TIMEBDS_UART1                              = CFG_MSGOUT_UBX_NAV_TIMEBDS_UART1;                  //!< UBX-NAV-TIMEBDS rate on port UART1
+inline constexpr auto UBX_NAV_TIMEBDS_UART2                              = CFG_MSGOUT_UBX_NAV_TIMEBDS_UART2;                  //!< UBX-NAV-TIMEBDS rate on port UART2
+inline constexpr auto UBX_NAV_TIMEBDS_SPI                                = CFG_MSGOUT_UBX_NAV_TIMEBDS_SPI;                    //!< UBX-NAV-TIMEBDS rate on port SPI
+inline constexpr auto UBX_NAV_TIMEBDS_I2C                                = CFG_MSGOUT_UBX_NAV_TIMEBDS_I2C;                    //!< UBX-NAV-TIMEBDS rate on port I2C
+inline constexpr auto UBX_NAV_TIMEBDS_USB                                = CFG_MSGOUT_UBX_NAV_TIMEBDS_USB;                    //!< UBX-NAV-TIMEBDS rate on port USB
+
+// UBX-NAV-TIMEGAL
+inline constexpr auto UBX_NAV_TIMEGAL_UART1                              = CFG_MSGOUT_UBX_NAV_TIMEGAL_UART1;                  //!< UBX-NAV-TIMEGAL rate on port UART1
+inline constexpr auto UBX_NAV_TIMEGAL_UART2                              = CFG_MSGOUT_UBX_NAV_TIMEGAL_UART2;                  //!< UBX-NAV-TIMEGAL rate on port UART2
+inline constexpr auto UBX_NAV_TIMEGAL_SPI                                = CFG_MSGOUT_UBX_NAV_TIMEGAL_SPI;                    //!< UBX-NAV-TIMEGAL rate on port SPI
+inline constexpr auto UBX_NAV_TIMEGAL_I2C                                = CFG_MSGOUT_UBX_NAV_TIMEGAL_I2C;                    //!< UBX-NAV-TIMEGAL rate on port I2C
+inline constexpr auto UBX_NAV_TIMEGAL_USB                                = CFG_MSGOUT_UBX_NAV_TIMEGAL_USB;                    //!< UBX-NAV-TIMEGAL rate on port USB
+
+// UBX-NAV-TIMEGLO
+inline constexpr auto UBX_NAV_TIMEGLO_UART1                              = CFG_MSGOUT_UBX_NAV_TIMEGLO_UART1;                  //!< UBX-NAV-TIMEGLO rate on port UART1
+inline constexpr auto UBX_NAV_TIMEGLO_UART2                              = CFG_MSGOUT_UBX_NAV_TIMEGLO_UART2;                  //!< UBX-NAV-TIMEGLO rate on port UART2
+inline constexpr auto UBX_NAV_TIMEGLO_SPI                                = CFG_MSGOUT_UBX_NAV_TIMEGLO_SPI;                    //!< UBX-NAV-TIMEGLO rate on port SPI
+inline constexpr auto UBX_NAV_TIMEGLO_I2C                                = CFG_MSGOUT_UBX_NAV_TIMEGLO_I2C;                    //!< UBX-NAV-TIMEGLO rate on port I2C
+inline constexpr auto UBX_NAV_TIMEGLO_USB                                = CFG_MSGOUT_UBX_NAV_TIMEGLO_USB;                    //!< UBX-NAV-TIMEGLO rate on port USB
+
+// UBX-NAV-TIMEGPS
+inline constexpr auto UBX_NAV_TIMEGPS_UART1                              = CFG_MSGOUT_UBX_NAV_TIMEGPS_UART1;                  //!< UBX-NAV-TIMEGPS rate on port UART1
+inline constexpr auto UBX_NAV_TIMEGPS_UART2                              = CFG_MSGOUT_UBX_NAV_TIMEGPS_UART2;                  //!< UBX-NAV-TIMEGPS rate on port UART2
+inline constexpr auto UBX_NAV_TIMEGPS_SPI                                = CFG_MSGOUT_UBX_NAV_TIMEGPS_SPI;                    //!< UBX-NAV-TIMEGPS rate on port SPI
+inline constexpr auto UBX_NAV_TIMEGPS_I2C                                = CFG_MSGOUT_UBX_NAV_TIMEGPS_I2C;                    //!< UBX-NAV-TIMEGPS rate on port I2C
+inline constexpr auto UBX_NAV_TIMEGPS_USB                                = CFG_MSGOUT_UBX_NAV_TIMEGPS_USB;                    //!< UBX-NAV-TIMEGPS rate on port USB
+
+// UBX-NAV-TIMELS
+inline constexpr auto UBX_NAV_TIMELS_UART1                               = CFG_MSGOUT_UBX_NAV_TIMELS_UART1;                   //!< UBX-NAV-TIMELS rate on port UART1
+inline constexpr auto UBX_NAV_TIMELS_UART2                               = CFG_MSGOUT_UBX_NAV_TIMELS_UART2;                   //!< UBX-NAV-TIMELS rate on port UART2
+inline constexpr auto UBX_NAV_TIMELS_SPI                                 = CFG_MSGOUT_UBX_NAV_TIMELS_SPI;                     //!< UBX-NAV-TIMELS rate on port SPI
+inline constexpr auto UBX_NAV_TIMELS_I2C                                 = CFG_MSGOUT_UBX_NAV_TIMELS_I2C;                     //!< UBX-NAV-TIMELS rate on port I2C
+inline constexpr auto UBX_NAV_TIMELS_USB                                 = CFG_MSGOUT_UBX_NAV_TIMELS_USB;                     //!< UBX-NAV-TIMELS rate on port USB
+
+// UBX-NAV-TIMEQZSS
+inline constexpr auto UBX_NAV_TIMEQZSS_UART1                             = CFG_MSGOUT_UBX_NAV_TIMEQZSS_UART1;                 //!< UBX-NAV-TIMEQZSS rate on port UART1
+inline constexpr auto UBX_NAV_TIMEQZSS_UART2                             = CFG_MSGOUT_UBX_NAV_TIMEQZSS_UART2;                 //!< UBX-NAV-TIMEQZSS rate on port UART2
+inline constexpr auto UBX_NAV_TIMEQZSS_SPI                               = CFG_MSGOUT_UBX_NAV_TIMEQZSS_SPI;                   //!< UBX-NAV-TIMEQZSS rate on port SPI
+inline constexpr auto UBX_NAV_TIMEQZSS_I2C                               = CFG_MSGOUT_UBX_NAV_TIMEQZSS_I2C;                   //!< UBX-NAV-TIMEQZSS rate on port I2C
+inline constexpr auto UBX_NAV_TIMEQZSS_USB                               = CFG_MSGOUT_UBX_NAV_TIMEQZSS_USB;                   //!< UBX-NAV-TIMEQZSS rate on port USB
+
+// UBX-NAV-TIMEUTC
+inline constexpr auto UBX_NAV_TIMEUTC_UART1                              = CFG_MSGOUT_UBX_NAV_TIMEUTC_UART1;                  //!< UBX-NAV-TIMEUTC rate on port UART1
+inline constexpr auto UBX_NAV_TIMEUTC_UART2                              = CFG_MSGOUT_UBX_NAV_TIMEUTC_UART2;                  //!< UBX-NAV-TIMEUTC rate on port UART2
+inline constexpr auto UBX_NAV_TIMEUTC_SPI                                = CFG_MSGOUT_UBX_NAV_TIMEUTC_SPI;                    //!< UBX-NAV-TIMEUTC rate on port SPI
+inline constexpr auto UBX_NAV_TIMEUTC_I2C                                = CFG_MSGOUT_UBX_NAV_TIMEUTC_I2C;                    //!< UBX-NAV-TIMEUTC rate on port I2C
+inline constexpr auto UBX_NAV_TIMEUTC_USB                                = CFG_MSGOUT_UBX_NAV_TIMEUTC_USB;                    //!< UBX-NAV-TIMEUTC rate on port USB
+
+// UBX-NAV-VELECEF
+inline constexpr auto UBX_NAV_VELECEF_UART1                              = CFG_MSGOUT_UBX_NAV_VELECEF_UART1;                  //!< UBX-NAV-VELECEF rate on port UART1
+inline constexpr auto UBX_NAV_VELECEF_UART2                              = CFG_MSGOUT_UBX_NAV_VELECEF_UART2;                  //!< UBX-NAV-VELECEF rate on port UART2
+inline constexpr auto UBX_NAV_VELECEF_SPI                                = CFG_MSGOUT_UBX_NAV_VELECEF_SPI;                    //!< UBX-NAV-VELECEF rate on port SPI
+inline constexpr auto UBX_NAV_VELECEF_I2C                                = CFG_MSGOUT_UBX_NAV_VELECEF_I2C;                    //!< UBX-NAV-VELECEF rate on port I2C
+inline constexpr auto UBX_NAV_VELECEF_USB                                = CFG_MSGOUT_UBX_NAV_VELECEF_USB;                    //!< UBX-NAV-VELECEF rate on port USB
+
+// UBX-NAV-VELNED
+inline constexpr auto UBX_NAV_VELNED_UART1                               = CFG_MSGOUT_UBX_NAV_VELNED_UART1;                   //!< UBX-NAV-VELNED rate on port UART1
+inline constexpr auto UBX_NAV_VELNED_UART2                               = CFG_MSGOUT_UBX_NAV_VELNED_UART2;                   //!< UBX-NAV-VELNED rate on port UART2
+inline constexpr auto UBX_NAV_VELNED_SPI                                 = CFG_MSGOUT_UBX_NAV_VELNED_SPI;                     //!< UBX-NAV-VELNED rate on port SPI
+inline constexpr auto UBX_NAV_VELNED_I2C                                 = CFG_MSGOUT_UBX_NAV_VELNED_I2C;                     //!< UBX-NAV-VELNED rate on port I2C
+inline constexpr auto UBX_NAV_VELNED_USB                                 = CFG_MSGOUT_UBX_NAV_VELNED_USB;                     //!< UBX-NAV-VELNED rate on port USB
+
+// UBX-NAV2-CLOCK
+inline constexpr auto UBX_NAV2_CLOCK_UART1                               = CFG_MSGOUT_UBX_NAV2_CLOCK_UART1;                   //!< UBX-NAV2-CLOCK rate on port UART1
+inline constexpr auto UBX_NAV2_CLOCK_UART2                               = CFG_MSGOUT_UBX_NAV2_CLOCK_UART2;                   //!< UBX-NAV2-CLOCK rate on port UART2
+inline constexpr auto UBX_NAV2_CLOCK_SPI                                 = CFG_MSGOUT_UBX_NAV2_CLOCK_SPI;                     //!< UBX-NAV2-CLOCK rate on port SPI
+inline constexpr auto UBX_NAV2_CLOCK_I2C                                 = CFG_MSGOUT_UBX_NAV2_CLOCK_I2C;                     //!< UBX-NAV2-CLOCK rate on port I2C
+inline constexpr auto UBX_NAV2_CLOCK_USB                                 = CFG_MSGOUT_UBX_NAV2_CLOCK_USB;                     //!< UBX-NAV2-CLOCK rate on port USB
+
+// UBX-NAV2-COV
+inline constexpr auto UBX_NAV2_COV_UART1                                 = CFG_MSGOUT_UBX_NAV2_COV_UART1;                     //!< UBX-NAV2-COV rate on port UART1
+inline constexpr auto UBX_NAV2_COV_UART2                                 = CFG_MSGOUT_UBX_NAV2_COV_UART2;                     //!< UBX-NAV2-COV rate on port UART2
+inline constexpr auto UBX_NAV2_COV_SPI                                   = CFG_MSGOUT_UBX_NAV2_COV_SPI;                       //!< UBX-NAV2-COV rate on port SPI
+inline constexpr auto UBX_NAV2_COV_I2C                                   = CFG_MSGOUT_UBX_NAV2_COV_I2C;                       //!< UBX-NAV2-COV rate on port I2C
+inline constexpr auto UBX_NAV2_COV_USB                                   = CFG_MSGOUT_UBX_NAV2_COV_USB;                       //!< UBX-NAV2-COV rate on port USB
+
+// UBX-NAV2-DOP
+inline constexpr auto UBX_NAV2_DOP_UART1                                 = CFG_MSGOUT_UBX_NAV2_DOP_UART1;                     //!< UBX-NAV2-DOP rate on port UART1
+inline constexpr auto UBX_NAV2_DOP_UART2                                 = CFG_MSGOUT_UBX_NAV2_DOP_UART2;                     //!< UBX-NAV2-DOP rate on port UART2
+inline constexpr auto UBX_NAV2_DOP_SPI                                   = CFG_MSGOUT_UBX_NAV2_DOP_SPI;                       //!< UBX-NAV2-DOP rate on port SPI
+inline constexpr auto UBX_NAV2_DOP_I2C                                   = CFG_MSGOUT_UBX_NAV2_DOP_I2C;                       //!< UBX-NAV2-DOP rate on port I2C
+inline constexpr auto UBX_NAV2_DOP_USB                                   = CFG_MSGOUT_UBX_NAV2_DOP_USB;                       //!< UBX-NAV2-DOP rate on port USB
+
+// UBX-NAV2-EOE
+inline constexpr auto UBX_NAV2_EOE_UART1                                 = CFG_MSGOUT_UBX_NAV2_EOE_UART1;                     //!< UBX-NAV2-EOE rate on port UART1
+inline constexpr auto UBX_NAV2_EOE_UART2                                 = CFG_MSGOUT_UBX_NAV2_EOE_UART2;                     //!< UBX-NAV2-EOE rate on port UART2
+inline constexpr auto UBX_NAV2_EOE_SPI                                   = CFG_MSGOUT_UBX_NAV2_EOE_SPI;                       //!< UBX-NAV2-EOE rate on port SPI
+inline constexpr auto UBX_NAV2_EOE_I2C                                   = CFG_MSGOUT_UBX_NAV2_EOE_I2C;                       //!< UBX-NAV2-EOE rate on port I2C
+inline constexpr auto UBX_NAV2_EOE_USB                                   = CFG_MSGOUT_UBX_NAV2_EOE_USB;                       //!< UBX-NAV2-EOE rate on port USB
+
+// UBX-NAV2-ODO
+inline constexpr auto UBX_NAV2_ODO_UART1                                 = CFG_MSGOUT_UBX_NAV2_ODO_UART1;                     //!< UBX-NAV2-ODO rate on port UART1
+inline constexpr auto UBX_NAV2_ODO_UART2                                 = CFG_MSGOUT_UBX_NAV2_ODO_UART2;                     //!< UBX-NAV2-ODO rate on port UART2
+inline constexpr auto UBX_NAV2_ODO_SPI                                   = CFG_MSGOUT_UBX_NAV2_ODO_SPI;                       //!< UBX-NAV2-ODO rate on port SPI
+inline constexpr auto UBX_NAV2_ODO_I2C                                   = CFG_MSGOUT_UBX_NAV2_ODO_I2C;                       //!< UBX-NAV2-ODO rate on port I2C
+inline constexpr auto UBX_NAV2_ODO_USB                                   = CFG_MSGOUT_UBX_NAV2_ODO_USB;                       //!< UBX-NAV2-ODO rate on port USB
+
+// UBX-NAV2-POSECEF
+inline constexpr auto UBX_NAV2_POSECEF_UART1                             = CFG_MSGOUT_UBX_NAV2_POSECEF_UART1;                 //!< UBX-NAV2-POSECEF rate on port UART1
+inline constexpr auto UBX_NAV2_POSECEF_UART2                             = CFG_MSGOUT_UBX_NAV2_POSECEF_UART2;                 //!< UBX-NAV2-POSECEF rate on port UART2
+inline constexpr auto UBX_NAV2_POSECEF_SPI                               = CFG_MSGOUT_UBX_NAV2_POSECEF_SPI;                   //!< UBX-NAV2-POSECEF rate on port SPI
+inline constexpr auto UBX_NAV2_POSECEF_I2C                               = CFG_MSGOUT_UBX_NAV2_POSECEF_I2C;                   //!< UBX-NAV2-POSECEF rate on port I2C
+inline constexpr auto UBX_NAV2_POSECEF_USB                               = CFG_MSGOUT_UBX_NAV2_POSECEF_USB;                   //!< UBX-NAV2-POSECEF rate on port USB
+
+// UBX-NAV2-POSLLH
+inline constexpr auto UBX_NAV2_POSLLH_UART1                              = CFG_MSGOUT_UBX_NAV2_POSLLH_UART1;                  //!< UBX-NAV2-POSLLH rate on port UART1
+inline constexpr auto UBX_NAV2_POSLLH_UART2                              = CFG_MSGOUT_UBX_NAV2_POSLLH_UART2;                  //!< UBX-NAV2-POSLLH rate on port UART2
+inline constexpr auto UBX_NAV2_POSLLH_SPI                                = CFG_MSGOUT_UBX_NAV2_POSLLH_SPI;                    //!< UBX-NAV2-POSLLH rate on port SPI
+inline constexpr auto UBX_NAV2_POSLLH_I2C                                = CFG_MSGOUT_UBX_NAV2_POSLLH_I2C;                    //!< UBX-NAV2-POSLLH rate on port I2C
+inline constexpr auto UBX_NAV2_POSLLH_USB                                = CFG_MSGOUT_UBX_NAV2_POSLLH_USB;                    //!< UBX-NAV2-POSLLH rate on port USB
+
+// UBX-NAV2-PVT
+inline constexpr auto UBX_NAV2_PVT_UART1                                 = CFG_MSGOUT_UBX_NAV2_PVT_UART1;                     //!< UBX-NAV2-PVT rate on port UART1
+inline constexpr auto UBX_NAV2_PVT_UART2                                 = CFG_MSGOUT_UBX_NAV2_PVT_UART2;                     //!< UBX-NAV2-PVT rate on port UART2
+inline constexpr auto UBX_NAV2_PVT_SPI                                   = CFG_MSGOUT_UBX_NAV2_PVT_SPI;                       //!< UBX-NAV2-PVT rate on port SPI
+inline constexpr auto UBX_NAV2_PVT_I2C                                   = CFG_MSGOUT_UBX_NAV2_PVT_I2C;                       //!< UBX-NAV2-PVT rate on port I2C
+inline constexpr auto UBX_NAV2_PVT_USB                                   = CFG_MSGOUT_UBX_NAV2_PVT_USB;                       //!< UBX-NAV2-PVT rate on port USB
+
+// UBX-NAV2-SAT
+inline constexpr auto UBX_NAV2_SAT_UART1                                 = CFG_MSGOUT_UBX_NAV2_SAT_UART1;                     //!< UBX-NAV2-SAT rate on port UART1
+inline constexpr auto UBX_NAV2_SAT_UART2                                 = CFG_MSGOUT_UBX_NAV2_SAT_UART2;                     //!< UBX-NAV2-SAT rate on port UART2
+inline constexpr auto UBX_NAV2_SAT_SPI                                   = CFG_MSGOUT_UBX_NAV2_SAT_SPI;                       //!< UBX-NAV2-SAT rate on port SPI
+inline constexpr auto UBX_NAV2_SAT_I2C                                   = CFG_MSGOUT_UBX_NAV2_SAT_I2C;                       //!< UBX-NAV2-SAT rate on port I2C
+inline constexpr auto UBX_NAV2_SAT_USB                                   = CFG_MSGOUT_UBX_NAV2_SAT_USB;                       //!< UBX-NAV2-SAT rate on port USB
+
+// UBX-NAV2-SBAS
+inline constexpr auto UBX_NAV2_SBAS_UART1                                = CFG_MSGOUT_UBX_NAV2_SBAS_UART1;                    //!< UBX-NAV2-SBAS rate on port UART1
+inline constexpr auto UBX_NAV2_SBAS_UART2                                = CFG_MSGOUT_UBX_NAV2_SBAS_UART2;                    //!< UBX-NAV2-SBAS rate on port UART2
+inline constexpr auto UBX_NAV2_SBAS_SPI                                  = CFG_MSGOUT_UBX_NAV2_SBAS_SPI;                      //!< UBX-NAV2-SBAS rate on port SPI
+inline constexpr auto UBX_NAV2_SBAS_I2C                                  = CFG_MSGOUT_UBX_NAV2_SBAS_I2C;                      //!< UBX-NAV2-SBAS rate on port I2C
+inline constexpr auto UBX_NAV2_SBAS_USB                                  = CFG_MSGOUT_UBX_NAV2_SBAS_USB;                      //!< UBX-NAV2-SBAS rate on port USB
+
+// UBX-NAV2-SIG
+inline constexpr auto UBX_NAV2_SIG_UART1                                 = CFG_MSGOUT_UBX_NAV2_SIG_UART1;                     //!< UBX-NAV2-SIG rate on port UART1
+inline constexpr auto UBX_NAV2_SIG_UART2                                 = CFG_MSGOUT_UBX_NAV2_SIG_UART2;                     //!< UBX-NAV2-SIG rate on port UART2
+inline constexpr auto UBX_NAV2_SIG_SPI                                   = CFG_MSGOUT_UBX_NAV2_SIG_SPI;                       //!< UBX-NAV2-SIG rate on port SPI
+inline constexpr auto UBX_NAV2_SIG_I2C                                   = CFG_MSGOUT_UBX_NAV2_SIG_I2C;                       //!< UBX-NAV2-SIG rate on port I2C
+inline constexpr auto UBX_NAV2_SIG_USB                                   = CFG_MSGOUT_UBX_NAV2_SIG_USB;                       //!< UBX-NAV2-SIG rate on port USB
+
+// UBX-NAV2-SLAS
+inline constexpr auto UBX_NAV2_SLAS_UART1                                = CFG_MSGOUT_UBX_NAV2_SLAS_UART1;                    //!< UBX-NAV2-SLAS rate on port UART1
+inline constexpr auto UBX_NAV2_SLAS_UART2                                = CFG_MSGOUT_UBX_NAV2_SLAS_UART2;                    //!< UBX-NAV2-SLAS rate on port UART2
+inline constexpr auto UBX_NAV2_SLAS_SPI                                  = CFG_MSGOUT_UBX_NAV2_SLAS_SPI;                      //!< UBX-NAV2-SLAS rate on port SPI
+inline constexpr auto UBX_NAV2_SLAS_I2C                                  = CFG_MSGOUT_UBX_NAV2_SLAS_I2C;                      //!< UBX-NAV2-SLAS rate on port I2C
+inline constexpr auto UBX_NAV2_SLAS_USB                                  = CFG_MSGOUT_UBX_NAV2_SLAS_USB;                      //!< UBX-NAV2-SLAS rate on port USB
+
+// UBX-NAV2-STATUS
+inline constexpr auto UBX_NAV2_STATUS_UART1                              = CFG_MSGOUT_UBX_NAV2_STATUS_UART1;                  //!< UBX-NAV2-STATUS rate on port UART1
+inline constexpr auto UBX_NAV2_STATUS_UART2                              = CFG_MSGOUT_UBX_NAV2_STATUS_UART2;                  //!< UBX-NAV2-STATUS rate on port UART2
+inline constexpr auto UBX_NAV2_STATUS_SPI                                = CFG_MSGOUT_UBX_NAV2_STATUS_SPI;                    //!< UBX-NAV2-STATUS rate on port SPI
+inline constexpr auto UBX_NAV2_STATUS_I2C                                = CFG_MSGOUT_UBX_NAV2_STATUS_I2C;                    //!< UBX-NAV2-STATUS rate on port I2C
+inline constexpr auto UBX_NAV2_STATUS_USB                                = CFG_MSGOUT_UBX_NAV2_STATUS_USB;                    //!< UBX-NAV2-STATUS rate on port USB
+
+// UBX-NAV2-SVIN
+inline constexpr auto UBX_NAV2_SVIN_UART1                                = CFG_MSGOUT_UBX_NAV2_SVIN_UART1;                    //!< UBX-NAV2-SVIN rate on port UART1
+inline constexpr auto UBX_NAV2_SVIN_UART2                                = CFG_MSGOUT_UBX_NAV2_SVIN_UART2;                    //!< UBX-NAV2-SVIN rate on port UART2
+inline constexpr auto UBX_NAV2_SVIN_SPI                                  = CFG_MSGOUT_UBX_NAV2_SVIN_SPI;                      //!< UBX-NAV2-SVIN rate on port SPI
+inline constexpr auto UBX_NAV2_SVIN_I2C                                  = CFG_MSGOUT_UBX_NAV2_SVIN_I2C;                      //!< UBX-NAV2-SVIN rate on port I2C
+inline constexpr auto UBX_NAV2_SVIN_USB                                  = CFG_MSGOUT_UBX_NAV2_SVIN_USB;                      //!< UBX-NAV2-SVIN rate on port USB
+
+// UBX-NAV2-TIMEBDS
+inline constexpr auto UBX_NAV2_TIMEBDS_UART1                             = CFG_MSGOUT_UBX_NAV2_TIMEBDS_UART1;                 //!< UBX-NAV2-TIMEBDS rate on port UART1
+inline constexpr auto UBX_NAV2_TIMEBDS_UART2                             = CFG_MSGOUT_UBX_NAV2_TIMEBDS_UART2;                 //!< UBX-NAV2-TIMEBDS rate on port UART2
+inline constexpr auto UBX_NAV2_TIMEBDS_SPI                               = CFG_MSGOUT_UBX_NAV2_TIMEBDS_SPI;                   //!< UBX-NAV2-TIMEBDS rate on port SPI
+inline constexpr auto UBX_NAV2_TIMEBDS_I2C                               = CFG_MSGOUT_UBX_NAV2_TIMEBDS_I2C;                   //!< UBX-NAV2-TIMEBDS rate on port I2C
+inline constexpr auto UBX_NAV2_TIMEBDS_USB                               = CFG_MSGOUT_UBX_NAV2_TIMEBDS_USB;                   //!< UBX-NAV2-TIMEBDS rate on port USB
+
+// UBX-NAV2-TIMEGAL
+inline constexpr auto UBX_NAV2_TIMEGAL_UART1                             = CFG_MSGOUT_UBX_NAV2_TIMEGAL_UART1;                 //!< UBX-NAV2-TIMEGAL rate on port UART1
+inline constexpr auto UBX_NAV2_TIMEGAL_UART2                             = CFG_MSGOUT_UBX_NAV2_TIMEGAL_UART2;                 //!< UBX-NAV2-TIMEGAL rate on port UART2
+inline constexpr auto UBX_NAV2_TIMEGAL_SPI                               = CFG_MSGOUT_UBX_NAV2_TIMEGAL_SPI;                   //!< UBX-NAV2-TIMEGAL rate on port SPI
+inline constexpr auto UBX_NAV2_TIMEGAL_I2C                               = CFG_MSGOUT_UBX_NAV2_TIMEGAL_I2C;                   //!< UBX-NAV2-TIMEGAL rate on port I2C
+inline constexpr auto UBX_NAV2_TIMEGAL_USB                               = CFG_MSGOUT_UBX_NAV2_TIMEGAL_USB;                   //!< UBX-NAV2-TIMEGAL rate on port USB
+
+// UBX-NAV2-TIMEGLO
+inline constexpr auto UBX_NAV2_TIMEGLO_UART1                             = CFG_MSGOUT_UBX_NAV2_TIMEGLO_UART1;                 //!< UBX-NAV2-TIMEGLO rate on port UART1
+inline constexpr auto UBX_NAV2_TIMEGLO_UART2                             = CFG_MSGOUT_UBX_NAV2_TIMEGLO_UART2;                 //!< UBX-NAV2-TIMEGLO rate on port UART2
+inline constexpr auto UBX_NAV2_TIMEGLO_SPI                               = CFG_MSGOUT_UBX_NAV2_TIMEGLO_SPI;                   //!< UBX-NAV2-TIMEGLO rate on port SPI
+inline constexpr auto UBX_NAV2_TIMEGLO_I2C                               = CFG_MSGOUT_UBX_NAV2_TIMEGLO_I2C;                   //!< UBX-NAV2-TIMEGLO rate on port I2C
+inline constexpr auto UBX_NAV2_TIMEGLO_USB                               = CFG_MSGOUT_UBX_NAV2_TIMEGLO_USB;                   //!< UBX-NAV2-TIMEGLO rate on port USB
+
+// UBX-NAV2-TIMEGPS
+inline constexpr auto UBX_NAV2_TIMEGPS_UART1                             = CFG_MSGOUT_UBX_NAV2_TIMEGPS_UART1;                 //!< UBX-NAV2-TIMEGPS rate on port UART1
+inline constexpr auto UBX_NAV2_TIMEGPS_UART2                             = CFG_MSGOUT_UBX_NAV2_TIMEGPS_UART2;                 //!< UBX-NAV2-TIMEGPS rate on port UART2
+inline constexpr auto UBX_NAV2_TIMEGPS_SPI                               = CFG_MSGOUT_UBX_NAV2_TIMEGPS_SPI;                   //!< UBX-NAV2-TIMEGPS rate on port SPI
+inline constexpr auto UBX_NAV2_TIMEGPS_I2C                               = CFG_MSGOUT_UBX_NAV2_TIMEGPS_I2C;                   //!< UBX-NAV2-TIMEGPS rate on port I2C
+inline constexpr auto UBX_NAV2_TIMEGPS_USB                               = CFG_MSGOUT_UBX_NAV2_TIMEGPS_USB;                   //!< UBX-NAV2-TIMEGPS rate on port USB
+
+// UBX-NAV2-TIMELS
+inline constexpr auto UBX_NAV2_TIMELS_UART1                              = CFG_MSGOUT_UBX_NAV2_TIMELS_UART1;                  //!< UBX-NAV2-TIMELS rate on port UART1
+inline constexpr auto UBX_NAV2_TIMELS_UART2                              = CFG_MSGOUT_UBX_NAV2_TIMELS_UART2;                  //!< UBX-NAV2-TIMELS rate on port UART2
+inline constexpr auto UBX_NAV2_TIMELS_SPI                                = CFG_MSGOUT_UBX_NAV2_TIMELS_SPI;                    //!< UBX-NAV2-TIMELS rate on port SPI
+inline constexpr auto UBX_NAV2_TIMELS_I2C                                = CFG_MSGOUT_UBX_NAV2_TIMELS_I2C;                    //!< UBX-NAV2-TIMELS rate on port I2C
+inline constexpr auto UBX_NAV2_TIMELS_USB                                = CFG_MSGOUT_UBX_NAV2_TIMELS_USB;                    //!< UBX-NAV2-TIMELS rate on port USB
+
+// UBX-NAV2-TIMEQZSS
+inline constexpr auto UBX_NAV2_TIMEQZSS_UART1                            = CFG_MSGOUT_UBX_NAV2_TIMEQZSS_UART1;                //!< UBX-NAV2-TIMEQZSS rate on port UART1
+inline constexpr auto UBX_NAV2_TIMEQZSS_UART2                            = CFG_MSGOUT_UBX_NAV2_TIMEQZSS_UART2;                //!< UBX-NAV2-TIMEQZSS rate on port UART2
+inline constexpr auto UBX_NAV2_TIMEQZSS_SPI                              = CFG_MSGOUT_UBX_NAV2_TIMEQZSS_SPI;                  //!< UBX-NAV2-TIMEQZSS rate on port SPI
+inline constexpr auto UBX_NAV2_TIMEQZSS_I2C                              = CFG_MSGOUT_UBX_NAV2_TIMEQZSS_I2C;                  //!< UBX-NAV2-TIMEQZSS rate on port I2C
+inline constexpr auto UBX_NAV2_TIMEQZSS_USB                              = CFG_MSGOUT_UBX_NAV2_TIMEQZSS_USB;                  //!< UBX-NAV2-TIMEQZSS rate on port USB
+
+// UBX-NAV2-TIMEUTC
+inline constexpr auto UBX_NAV2_TIMEUTC_UART1                             = CFG_MSGOUT_UBX_NAV2_TIMEUTC_UART1;                 //!< UBX-NAV2-TIMEUTC rate on port UART1
+inline constexpr auto UBX_NAV2_TIMEUTC_UART2                             = CFG_MSGOUT_UBX_NAV2_TIMEUTC_UART2;                 //!< UBX-NAV2-TIMEUTC rate on port UART2
+inline constexpr auto UBX_NAV2_TIMEUTC_SPI                               = CFG_MSGOUT_UBX_NAV2_TIMEUTC_SPI;                   //!< UBX-NAV2-TIMEUTC rate on port SPI
+inline constexpr auto UBX_NAV2_TIMEUTC_I2C                               = CFG_MSGOUT_UBX_NAV2_TIMEUTC_I2C;                   //!< UBX-NAV2-TIMEUTC rate on port I2C
+inline constexpr auto UBX_NAV2_TIMEUTC_USB                               = CFG_MSGOUT_UBX_NAV2_TIMEUTC_USB;                   //!< UBX-NAV2-TIMEUTC rate on port USB
+
+// UBX-NAV2-VELECEF
+inline constexpr auto UBX_NAV2_VELECEF_UART1                             = CFG_MSGOUT_UBX_NAV2_VELECEF_UART1;                 //!< UBX-NAV2-VELECEF rate on port UART1
+inline constexpr auto UBX_NAV2_VELECEF_UART2                             = CFG_MSGOUT_UBX_NAV2_VELECEF_UART2;                 //!< UBX-NAV2-VELECEF rate on port UART2
+inline constexpr auto UBX_NAV2_VELECEF_SPI                               = CFG_MSGOUT_UBX_NAV2_VELECEF_SPI;                   //!< UBX-NAV2-VELECEF rate on port SPI
+inline constexpr auto UBX_NAV2_VELECEF_I2C                               = CFG_MSGOUT_UBX_NAV2_VELECEF_I2C;                   //!< UBX-NAV2-VELECEF rate on port I2C
+inline constexpr auto UBX_NAV2_VELECEF_USB                               = CFG_MSGOUT_UBX_NAV2_VELECEF_USB;                   //!< UBX-NAV2-VELECEF rate on port USB
+
+// UBX-NAV2-VELNED
+inline constexpr auto UBX_NAV2_VELNED_UART1                              = CFG_MSGOUT_UBX_NAV2_VELNED_UART1;                  //!< UBX-NAV2-VELNED rate on port UART1
+inline constexpr auto UBX_NAV2_VELNED_UART2                              = CFG_MSGOUT_UBX_NAV2_VELNED_UART2;                  //!< UBX-NAV2-VELNED rate on port UART2
+inline constexpr auto UBX_NAV2_VELNED_SPI                                = CFG_MSGOUT_UBX_NAV2_VELNED_SPI;                    //!< UBX-NAV2-VELNED rate on port SPI
+inline constexpr auto UBX_NAV2_VELNED_I2C                                = CFG_MSGOUT_UBX_NAV2_VELNED_I2C;                    //!< UBX-NAV2-VELNED rate on port I2C
+inline constexpr auto UBX_NAV2_VELNED_USB                                = CFG_MSGOUT_UBX_NAV2_VELNED_USB;                    //!< UBX-NAV2-VELNED rate on port USB
+
+// UBX-RXM-COR
+inline constexpr auto UBX_RXM_COR_UART1                                  = CFG_MSGOUT_UBX_RXM_COR_UART1;                      //!< UBX-RXM-COR rate on port UART1
+inline constexpr auto UBX_RXM_COR_UART2                                  = CFG_MSGOUT_UBX_RXM_COR_UART2;                      //!< UBX-RXM-COR rate on port UART2
+inline constexpr auto UBX_RXM_COR_SPI                                    = CFG_MSGOUT_UBX_RXM_COR_SPI;                        //!< UBX-RXM-COR rate on port SPI
+inline constexpr auto UBX_RXM_COR_I2C                                    = CFG_MSGOUT_UBX_RXM_COR_I2C;                        //!< UBX-RXM-COR rate on port I2C
+inline constexpr auto UBX_RXM_COR_USB                                    = CFG_MSGOUT_UBX_RXM_COR_USB;                        //!< UBX-RXM-COR rate on port USB
+
+// UBX-RXM-MEASX
+inline constexpr auto UBX_RXM_MEASX_UART1                                = CFG_MSGOUT_UBX_RXM_MEASX_UART1;                    //!< UBX-RXM-MEASX rate on port UART1
+inline constexpr auto UBX_RXM_MEASX_UART2                                = CFG_MSGOUT_UBX_RXM_MEASX_UART2;                    //!< UBX-RXM-MEASX rate on port UART2
+inline constexpr auto UBX_RXM_MEASX_SPI                                  = CFG_MSGOUT_UBX_RXM_MEASX_SPI;                      //!< UBX-RXM-MEASX rate on port SPI
+inline constexpr auto UBX_RXM_MEASX_I2C                                  = CFG_MSGOUT_UBX_RXM_MEASX_I2C;                      //!< UBX-RXM-MEASX rate on port I2C
+inline constexpr auto UBX_RXM_MEASX_USB                                  = CFG_MSGOUT_UBX_RXM_MEASX_USB;                      //!< UBX-RXM-MEASX rate on port USB
+
+// UBX-RXM-RAWX
+inline constexpr auto UBX_RXM_RAWX_UART1                                 = CFG_MSGOUT_UBX_RXM_RAWX_UART1;                     //!< UBX-RXM-RAWX rate on port UART1
+inline constexpr auto UBX_RXM_RAWX_UART2                                 = CFG_MSGOUT_UBX_RXM_RAWX_UART2;                     //!< UBX-RXM-RAWX rate on port UART2
+inline constexpr auto UBX_RXM_RAWX_SPI                                   = CFG_MSGOUT_UBX_RXM_RAWX_SPI;                       //!< UBX-RXM-RAWX rate on port SPI
+inline constexpr auto UBX_RXM_RAWX_I2C                                   = CFG_MSGOUT_UBX_RXM_RAWX_I2C;                       //!< UBX-RXM-RAWX rate on port I2C
+inline constexpr auto UBX_RXM_RAWX_USB                                   = CFG_MSGOUT_UBX_RXM_RAWX_USB;                       //!< UBX-RXM-RAWX rate on port USB
+
+// UBX-RXM-RLM
+inline constexpr auto UBX_RXM_RLM_UART1                                  = CFG_MSGOUT_UBX_RXM_RLM_UART1;                      //!< UBX-RXM-RLM rate on port UART1
+inline constexpr auto UBX_RXM_RLM_UART2                                  = CFG_MSGOUT_UBX_RXM_RLM_UART2;                      //!< UBX-RXM-RLM rate on port UART2
+inline constexpr auto UBX_RXM_RLM_SPI                                    = CFG_MSGOUT_UBX_RXM_RLM_SPI;                        //!< UBX-RXM-RLM rate on port SPI
+inline constexpr auto UBX_RXM_RLM_I2C                                    = CFG_MSGOUT_UBX_RXM_RLM_I2C;                        //!< UBX-RXM-RLM rate on port I2C
+inline constexpr auto UBX_RXM_RLM_USB                                    = CFG_MSGOUT_UBX_RXM_RLM_USB;                        //!< UBX-RXM-RLM rate on port USB
+
+// UBX-RXM-RTCM
+inline constexpr auto UBX_RXM_RTCM_UART1                                 = CFG_MSGOUT_UBX_RXM_RTCM_UART1;                     //!< UBX-RXM-RTCM rate on port UART1
+inline constexpr auto UBX_RXM_RTCM_UART2                                 = CFG_MSGOUT_UBX_RXM_RTCM_UART2;                     //!< UBX-RXM-RTCM rate on port UART2
+inline constexpr auto UBX_RXM_RTCM_SPI                                   = CFG_MSGOUT_UBX_RXM_RTCM_SPI;                       //!< UBX-RXM-RTCM rate on port SPI
+inline constexpr auto UBX_RXM_RTCM_I2C                                   = CFG_MSGOUT_UBX_RXM_RTCM_I2C;                       //!< UBX-RXM-RTCM rate on port I2C
+inline constexpr auto UBX_RXM_RTCM_USB                                   = CFG_MSGOUT_UBX_RXM_RTCM_USB;                       //!< UBX-RXM-RTCM rate on port USB
+
+// UBX-RXM-SFRBX
+inline constexpr auto UBX_RXM_SFRBX_UART1                                = CFG_MSGOUT_UBX_RXM_SFRBX_UART1;                    //!< UBX-RXM-SFRBX rate on port UART1
+inline constexpr auto UBX_RXM_SFRBX_UART2                                = CFG_MSGOUT_UBX_RXM_SFRBX_UART2;                    //!< UBX-RXM-SFRBX rate on port UART2
+inline constexpr auto UBX_RXM_SFRBX_SPI                                  = CFG_MSGOUT_UBX_RXM_SFRBX_SPI;                      //!< UBX-RXM-SFRBX rate on port SPI
+inline constexpr auto UBX_RXM_SFRBX_I2C                                  = CFG_MSGOUT_UBX_RXM_SFRBX_I2C;                      //!< UBX-RXM-SFRBX rate on port I2C
+inline constexpr auto UBX_RXM_SFRBX_USB                                  = CFG_MSGOUT_UBX_RXM_SFRBX_USB;                      //!< UBX-RXM-SFRBX rate on port USB
+
+// UBX-RXM-SPARTN
+inline constexpr auto UBX_RXM_SPARTN_UART1                               = CFG_MSGOUT_UBX_RXM_SPARTN_UART1;                   //!< UBX-RXM-SPARTN rate on port UART1
+inline constexpr auto UBX_RXM_SPARTN_UART2                               = CFG_MSGOUT_UBX_RXM_SPARTN_UART2;                   //!< UBX-RXM-SPARTN rate on port UART2
+inline constexpr auto UBX_RXM_SPARTN_SPI                                 = CFG_MSGOUT_UBX_RXM_SPARTN_SPI;                     //!< UBX-RXM-SPARTN rate on port SPI
+inline constexpr auto UBX_RXM_SPARTN_I2C                                 = CFG_MSGOUT_UBX_RXM_SPARTN_I2C;                     //!< UBX-RXM-SPARTN rate on port I2C
+inline constexpr auto UBX_RXM_SPARTN_USB                                 = CFG_MSGOUT_UBX_RXM_SPARTN_USB;                     //!< UBX-RXM-SPARTN rate on port USB
+
+// UBX-SEC-SIG
+inline constexpr auto UBX_SEC_SIG_UART1                                  = CFG_MSGOUT_UBX_SEC_SIG_UART1;                      //!< UBX-SEC-SIG rate on port UART1
+inline constexpr auto UBX_SEC_SIG_UART2                                  = CFG_MSGOUT_UBX_SEC_SIG_UART2;                      //!< UBX-SEC-SIG rate on port UART2
+inline constexpr auto UBX_SEC_SIG_SPI                                    = CFG_MSGOUT_UBX_SEC_SIG_SPI;                        //!< UBX-SEC-SIG rate on port SPI
+inline constexpr auto UBX_SEC_SIG_I2C                                    = CFG_MSGOUT_UBX_SEC_SIG_I2C;                        //!< UBX-SEC-SIG rate on port I2C
+inline constexpr auto UBX_SEC_SIG_USB                                    = CFG_MSGOUT_UBX_SEC_SIG_USB;                        //!< UBX-SEC-SIG rate on port USB
+
+// UBX-TIM-TM2
+inline constexpr auto UBX_TIM_TM2_UART1                                  = CFG_MSGOUT_UBX_TIM_TM2_UART1;                      //!< UBX-TIM-TM2 rate on port UART1
+inline constexpr auto UBX_TIM_TM2_UART2                                  = CFG_MSGOUT_UBX_TIM_TM2_UART2;                      //!< UBX-TIM-TM2 rate on port UART2
+inline constexpr auto UBX_TIM_TM2_SPI                                    = CFG_MSGOUT_UBX_TIM_TM2_SPI;                        //!< UBX-TIM-TM2 rate on port SPI
+inline constexpr auto UBX_TIM_TM2_I2C                                    = CFG_MSGOUT_UBX_TIM_TM2_I2C;                        //!< UBX-TIM-TM2 rate on port I2C
+inline constexpr auto UBX_TIM_TM2_USB                                    = CFG_MSGOUT_UBX_TIM_TM2_USB;                        //!< UBX-TIM-TM2 rate on port USB
+
+// UBX-TIM-TP
+inline constexpr auto UBX_TIM_TP_UART1                                   = CFG_MSGOUT_UBX_TIM_TP_UART1;                       //!< UBX-TIM-TP rate on port UART1
+inline constexpr auto UBX_TIM_TP_UART2                                   = CFG_MSGOUT_UBX_TIM_TP_UART2;                       //!< UBX-TIM-TP rate on port UART2
+inline constexpr auto UBX_TIM_TP_SPI                                     = CFG_MSGOUT_UBX_TIM_TP_SPI;                         //!< UBX-TIM-TP rate on port SPI
+inline constexpr auto UBX_TIM_TP_I2C                                     = CFG_MSGOUT_UBX_TIM_TP_I2C;                         //!< UBX-TIM-TP rate on port I2C
+inline constexpr auto UBX_TIM_TP_USB                                     = CFG_MSGOUT_UBX_TIM_TP_USB;                         //!< UBX-TIM-TP rate on port USB
+
+// UBX-TIM-VRFY
+inline constexpr auto UBX_TIM_VRFY_UART1                                 = CFG_MSGOUT_UBX_TIM_VRFY_UART1;                     //!< UBX-TIM-VRFY rate on port UART1
+inline constexpr auto UBX_TIM_VRFY_UART2                                 = CFG_MSGOUT_UBX_TIM_VRFY_UART2;                     //!< UBX-TIM-VRFY rate on port UART2
+inline constexpr auto UBX_TIM_VRFY_SPI                                   = CFG_MSGOUT_UBX_TIM_VRFY_SPI;                       //!< UBX-TIM-VRFY rate on port SPI
+inline constexpr auto UBX_TIM_VRFY_I2C                                   = CFG_MSGOUT_UBX_TIM_VRFY_I2C;                       //!< UBX-TIM-VRFY rate on port I2C
+inline constexpr auto UBX_TIM_VRFY_USB                                   = CFG_MSGOUT_UBX_TIM_VRFY_USB;                       //!< UBX-TIM-VRFY rate on port USB
+
+///@}
+
+} // namespace ubloxcfg
+
+#endif // __UBLOXCFG_GEN_HPP__
@@ -182,6 +182,7 @@ sub genCodeC
 
     my $c = '';
     my $h = '';
+    my $hpp = '';
     my $cc = '';
     my $hh = '';
 
@@ -223,11 +224,26 @@ sub genCodeC
     $h .= "    \@{\n";
     $h .= "*/\n";
 
+    $hpp .= $top;
+    $hpp .= "\n";
+    $hpp .= "#ifndef __UBLOXCFG_GEN_HPP__\n";
+    $hpp .= "#define __UBLOXCFG_GEN_HPP__\n";
+    $hpp .= "\n";
+    $hpp .= "#include \"ubloxcfg.hpp\"\n";
+    $hpp .= "\n";
+    $hpp .= "namespace ubloxcfg {\n";
+    $hpp .= "\n";
+    $hpp .= "/*!\n";
+    $hpp .= "    \\addtogroup UBLOXCFG_CPP\n";
+    $hpp .= "    \@{\n";
+    $hpp .= "*/\n";
+
     $c .= $top;
     $c .= "// Sources:\n";
     $c .= "// - $_\n" for (@{$sources});
     $c .= "\n";
     $c .= "#include <stddef.h>\n";
+    $c .= "#include <stdint.h>\n";
     $c .= "#include \"ubloxcfg.h\"\n";
     $c .= "#include \"ubloxcfg_gen.h\"\n";
     $c .= "\n";
@@ -269,6 +285,8 @@ sub genCodeC
             $h .= "*/\n";
             $h .= "\n";
             $h .= sprintf("#define UBLOXCFG_${groupNameC}_ID  0x%08x //!< Group ID of the $groupName-* items\n", hex($item->{id}) & 0x00ff0000);
+            $hpp .= "\n";
+            $hpp .= "// $groupName\n";
             $lastGroup = $groupName;
         }
 
@@ -312,6 +330,15 @@ sub genCodeC
         }
         $h .= "///@}\n"; # UBLOXCFG_ITEMS_FOO_BAR (item)
 
+        # ##### c++ header file #####
+
+        my $itemTemplArgs = "UBLOXCFG_${itemNameC}_ID, UBLOXCFG_TYPE_$item->{type}";
+        if ($item->{consts} && ($item->{type} =~ m{^E}))
+        {
+            $itemTemplArgs .= ", UBLOXCFG_${itemNameC}_t";
+        }
+        $hpp .= sprintf("inline constexpr %-100s %-40s //!< %s\n", "Item<$itemTemplArgs>", "$itemNameC {};", "$item->{name} ($item->{title})");
+
         # end last group
         if ($itemIx == $#${items})
         {
@@ -420,6 +447,28 @@ sub genCodeC
     $hh .= "const void **_ubloxcfg_allItems(void);\n";
     $cc .= "const void **_ubloxcfg_allItems(void) { return (const void **)ubloxcfg_allItems; }\n";
 
+    # generate lookup tables (indices into ubloxcfg_allItems[] sorted by ID resp. name) for binary search
+    if ($numItems > 0xffff)
+    {
+        print(STDERR "Too many items for uint16_t lookup tables!\n");
+        $errors++;
+    }
+    my @itemsById   = sort { hex($items->[$a]->{id}) <=> hex($items->[$b]->{id}) } (0 .. $numItems - 1);
+    my @itemsByName = sort { $items->[$a]->{name} cmp $items->[$b]->{name} } (0 .. $numItems - 1); # strcmp() order
+    $c .= "\n";
+    $c .= "static const uint16_t ubloxcfg_itemsById[$numItems] =\n";
+    $c .= "{\n";
+    $c .= genIndexList(@itemsById);
+    $c .= "};\n";
+    $c .= "static const uint16_t ubloxcfg_itemsByName[$numItems] =\n";
+    $c .= "{\n";
+    $c .= genIndexList(@itemsByName);
+    $c .= "};\n";
+    $hh .= "const uint16_t *_ubloxcfg_itemsById(void);\n";
+    $hh .= "const uint16_t *_ubloxcfg_itemsByName(void);\n";
+    $cc .= "const uint16_t *_ubloxcfg_itemsById(void) { return ubloxcfg_itemsById; }\n";
+    $cc .= "const uint16_t *_ubloxcfg_itemsByName(void) { return ubloxcfg_itemsByName; }\n";
+
     # generate aliases for message rate configs
     my @msgNames = sort keys %msgCfgs;
     $h .= "\n";
@@ -451,10 +500,21 @@ sub genCodeC
             }
         }
         $h .= "///@}\n";
+
+        $hpp .= "\n";
+        $hpp .= "// $msgName\n";
+        foreach my $port (qw(UART1 UART2 SPI I2C USB))
+        {
+            if ($msgCfgs{$msgName}->{$port})
+            {
+                $hpp .= sprintf("inline constexpr auto %-50s = %-50s //!< $msgName rate on port $port\n",
+                    "${msgNameC}_${port}", "$msgCfgs{$msgName}->{$port}->{itemNameC};");
+            }
+        }
     }
     $h .= "///@}\n";
 
-    # generate lut for message name to config item
+    # generate lut for message name to config item (sorted by name, in strcmp() order, for binary search)
     my @msgrateStructs = ();
     foreach my $msgName (@msgNames)
     {
@@ -518,6 +578,14 @@ sub genCodeC
     # end source
     $c .= "\n";
 
+    # end c++ header
+    $hpp .= "\n";
+    $hpp .= "///@}\n";
+    $hpp .= "\n";
+    $hpp .= "} // namespace ubloxcfg\n";
+    $hpp .= "\n";
+    $hpp .= "#endif // __UBLOXCFG_GEN_HPP__\n";
+
     # write output
     eval { path("$OUT.h")->spew_raw($h); };
     if ($! || $@)
@@ -526,6 +594,13 @@ sub genCodeC
         print(STDERR "Failed writing '$OUT.h': $err\n");
         $errors++;
     }
+    eval { path("$OUT.hpp")->spew_raw($hpp); };
+    if ($! || $@)
+    {
+        my $err = ("$!" || "$@"); $err =~ s{\s*\r?\n$}{};
+        print(STDERR "Failed writing '$OUT.hpp': $err\n");
+        $errors++;
+    }
     eval { path("$OUT.c")->spew_raw($c); };
     if ($! || $@)
     {
@@ -540,6 +615,18 @@ sub genCodeC
 ####################################################################################################
 # funky functions
 
+sub genIndexList
+{
+    my (@indices) = @_;
+    my $str = '';
+    while (my @line = splice(@indices, 0, 16))
+    {
+        $str .= '    ' . join(', ', map { sprintf('%3d', $_) } @line) . ",\n";
+    }
+    substr($str, -2, 1, '');
+    return $str;
+}
+
 sub DEBUG
 {
     return unless ($DEBUG);